@@ -7,6 +7,7 @@ include config/default.mk
 # Override for debugging
 OPT_LEVEL = 0
 DEBUG_SYMBOLS = 1
+HEAP_DEBUG_LEVEL = 2
 
 # Enable all smoke tests
 CTRL_SMOKE_TEST = 1
@@ -9,6 +9,9 @@ ENABLE_GESTALT ?= 1
 ENABLE_SCRAP ?= 1
 ENABLE_LIST ?= 1
 MODERN_INPUT_ONLY ?= 1
+MEMORY_TELEMETRY ?= 0
+ATA_DMA ?= 0
+HEAP_DEBUG_LEVEL ?= 1
 GESTALT_MACHINE_TYPE ?= 0
 BEZEL_STYLE ?= rounded
 
@@ -16,6 +19,16 @@ BEZEL_STYLE ?= rounded
 CTRL_SMOKE_TEST ?= 0
 LIST_SMOKE_TEST ?= 0
 ALERT_SMOKE_TEST ?= 0
+HEAP_BENCH ?= 0
+HFS_BENCH ?= 0
+ATA_BENCH ?= 0
+ALLOC_BENCH ?= 0
+RES_BENCH ?= 0
+DCMP_BENCH ?= 0
+FONT_BENCH ?= 0
+RES_PREFETCH ?= 0
+HFS_BCACHE_SMOKE_TEST ?= 0
+FONT_RASTER_SMOKE_TEST ?= 0
 
 # Optimization and debug settings
 OPT_LEVEL ?= 1
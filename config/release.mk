@@ -7,6 +7,7 @@ include config/default.mk
 # Override for release
 OPT_LEVEL = 2
 DEBUG_SYMBOLS = 0
+HEAP_DEBUG_LEVEL = 0
 
 # Disable all smoke tests
 CTRL_SMOKE_TEST = 0
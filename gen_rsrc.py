@@ -54,7 +54,8 @@ OUTPUT
 ------
 A classic Resource file with:
   - Header: dataOffset, mapOffset, dataLength, mapLength (big-endian)
-  - Data area: for each resource: 4-byte big-endian length, followed by the raw data bytes
+  - Data area: for each resource: 4-byte big-endian length, followed by the raw data bytes,
+    padded to a 4-byte boundary
   - Map area: includes type list, reference lists, and name list.
 This is suitable for loaders that expect real Mac .rsrc files.
 
@@ -216,6 +217,8 @@ def build_rsrc(resources):
             off = len(data_area)
             data_offsets[(rtype, r.rid)] = off
             data_area += be32(len(r.data)) + r.data
+            # Keep entries 4-byte aligned: the kernel uses the data in place
+            data_area += b"\x00" * (-len(data_area) % 4)
 
     # Build name list: Pascal strings
     name_list = bytearray()
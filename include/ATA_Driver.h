@@ -1,8 +1,9 @@
 /*
  * ATA_Driver.h - ATA/IDE disk driver interface
  *
- * Provides PIO mode access to ATA/IDE hard disks for bare-metal System 7.1.
- * Supports LBA28 addressing mode for drives up to 128GB.
+ * Provides access to ATA/IDE hard disks for bare-metal System 7.1: PIO,
+ * PIO READ/WRITE MULTIPLE and PCI IDE bus-master DMA, with LBA28 addressing
+ * and LBA48 for drives beyond 128GB.
  */
 
 #ifndef ATA_DRIVER_H
@@ -53,8 +54,40 @@
 /* ATA Commands */
 #define ATA_CMD_READ_SECTORS    0x20    /* Read sectors with retry */
 #define ATA_CMD_WRITE_SECTORS   0x30    /* Write sectors with retry */
+#define ATA_CMD_READ_SECTORS_EXT  0x24  /* LBA48 variants */
+#define ATA_CMD_WRITE_SECTORS_EXT 0x34
+#define ATA_CMD_READ_MULTIPLE   0xC4    /* One DRQ block per multiple_sectors */
+#define ATA_CMD_WRITE_MULTIPLE  0xC5
+#define ATA_CMD_READ_MULTIPLE_EXT  0x29
+#define ATA_CMD_WRITE_MULTIPLE_EXT 0x39
+#define ATA_CMD_SET_MULTIPLE    0xC6    /* Set sectors per DRQ block */
+#define ATA_CMD_READ_DMA        0xC8
+#define ATA_CMD_WRITE_DMA       0xCA
+#define ATA_CMD_READ_DMA_EXT    0x25
+#define ATA_CMD_WRITE_DMA_EXT   0x35
 #define ATA_CMD_IDENTIFY        0xEC    /* Identify device */
 #define ATA_CMD_FLUSH_CACHE     0xE7    /* Flush write cache */
+#define ATA_CMD_FLUSH_CACHE_EXT 0xEA
+
+/* PCI IDE bus-master registers (offsets from BAR4, secondary channel +8) */
+#define ATA_BM_REG_COMMAND      0x00
+#define ATA_BM_REG_STATUS       0x02
+#define ATA_BM_REG_PRDT         0x04    /* Physical address of the PRD table */
+#define ATA_BM_CHANNEL_STRIDE   0x08
+
+#define ATA_BM_CMD_START        0x01
+#define ATA_BM_CMD_READ         0x08    /* Device to memory */
+
+#define ATA_BM_STATUS_ACTIVE    0x01
+#define ATA_BM_STATUS_ERR       0x02
+#define ATA_BM_STATUS_IRQ       0x04    /* Device raised INTRQ; write 1 to clear */
+
+#define ATA_PRD_EOT             0x8000  /* Last entry of a PRD table */
+
+/* Largest transfer per command */
+#define ATA_LBA28_MAX_SECTORS   256
+#define ATA_LBA48_MAX_SECTORS   65536
+#define ATA_DMA_MAX_SECTORS     256     /* Bounded by the PRD table size */
 
 /* Drive Selection Bits (for ATA_REG_DRIVE_HEAD) */
 #define ATA_DRIVE_MASTER        0xA0    /* Master drive, LBA mode */
@@ -75,6 +108,13 @@ typedef enum {
     ATA_DEVICE_SATAPI       /* SATAPI */
 } ATADeviceType;
 
+/* How ATA_Transfer moves data */
+typedef enum {
+    ATA_XFER_PIO = 0,       /* One sector per DRQ block */
+    ATA_XFER_PIO_MULTIPLE,  /* READ/WRITE MULTIPLE */
+    ATA_XFER_DMA            /* PCI IDE bus-master DMA */
+} ATATransferMode;
+
 /* ATA Device Information */
 typedef struct {
     bool present;           /* Device is present and detected */
@@ -89,6 +129,9 @@ typedef struct {
     char firmware[9];       /* Firmware revision (8 chars + null) */
     bool lba48_supported;   /* LBA48 addressing supported */
     bool dma_supported;     /* DMA transfers supported */
+    uint16_t multiple_sectors; /* Sectors per DRQ block for READ/WRITE MULTIPLE, 0 = off */
+    uint16_t bm_io;         /* Bus-master registers for this channel, 0 = none */
+    ATATransferMode xfer_mode; /* Fastest mode that works; lowered on DMA errors */
 } ATADevice;
 
 /* Maximum devices (primary master/slave + secondary master/slave) */
@@ -108,6 +151,14 @@ OSErr ATA_ReadSectors(ATADevice* device, uint32_t lba, uint8_t count, void* buff
 OSErr ATA_WriteSectors(ATADevice* device, uint32_t lba, uint8_t count, const void* buffer);
 OSErr ATA_FlushCache(ATADevice* device);
 
+/* Move any number of sectors using the device's xfer_mode, splitting into
+ * per-command chunks and switching to LBA48 where needed.  Does not flush
+ * the drive's write cache. */
+OSErr ATA_Transfer(ATADevice* device, uint64_t lba, uint32_t count, void* buffer, bool write);
+
+/* Total addressable sectors (LBA48 count when supported) */
+uint64_t ATA_GetSectorCount(const ATADevice* device);
+
 /* Low-level ATA Operations */
 void ATA_WaitBusy(uint16_t base_io);
 void ATA_WaitReady(uint16_t base_io);
@@ -119,4 +170,7 @@ void ATA_SelectDrive(uint16_t base_io, bool is_slave);
 void ATA_PrintDeviceInfo(ATADevice* device);
 const char* ATA_GetDeviceTypeName(ATADeviceType type);
 
+/* Boot-time transfer mode benchmark on drive 0 (ATA_BENCH=1) */
+void ATABench_Run(void);
+
 #endif /* ATA_DRIVER_H */
@@ -0,0 +1,66 @@
+/* HFS Block Buffer Cache
+ *
+ * One pool of 512-byte blocks shared by every attached HFS_BlockDev.
+ * HFS_BD_Read/HFS_BD_Write route through it for devices with a nonzero
+ * cacheId: ATA and SDHCI devices attach themselves at init.
+ *
+ * - Reads fill the cache; a read that starts where the previous one on the
+ *   same device ended also pulls in a read-ahead window that doubles up to
+ *   HFS_BCACHE_READAHEAD_MAX sectors while the pattern holds.
+ * - Writes are write-back.  HFS_BD_Flush (HFS_BC_Flush) is the barrier;
+ *   HFS_BD_Close detaches the device, flushing and dropping its blocks.
+ *   HFS_BC_Idle, called from the main loop, also flushes a device once its
+ *   oldest unflushed write is HFS_BCACHE_FLUSH_TICKS old.
+ * - Sector-aligned transfers of HFS_BCACHE_DIRECT_MIN sectors or more go
+ *   straight between the caller's buffer and the device, keeping any cached
+ *   copies coherent.
+ */
+#pragma once
+#include "hfs_diskio.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#define HFS_BCACHE_BLOCK_SIZE   512
+
+#ifndef HFS_BCACHE_BLOCKS
+#define HFS_BCACHE_BLOCKS       256     /* 128KB pool */
+#endif
+#define HFS_BCACHE_DEVICES      8
+#define HFS_BCACHE_READAHEAD_MIN 8
+#define HFS_BCACHE_READAHEAD_MAX 64
+#define HFS_BCACHE_DIRECT_MIN   32      /* Sectors */
+#ifndef HFS_BCACHE_FLUSH_TICKS
+#define HFS_BCACHE_FLUSH_TICKS  120     /* 2 seconds */
+#endif
+
+typedef struct {
+    uint32_t hits;          /* Sectors served from the pool */
+    uint32_t misses;        /* Sectors read on demand */
+    uint32_t readAhead;     /* Sectors read ahead of demand */
+    uint32_t readAheadHits; /* Read-ahead sectors later used */
+    uint32_t directReads;
+    uint32_t directWrites;
+    uint32_t writebacks;    /* Dirty sectors written to the device */
+    uint32_t evictions;
+} HFS_BCacheStats;
+
+/* Register a device; returns its cacheId, or 0 if it can't be cached.
+ * Attaching the same device again shares the id. */
+uint16_t HFS_BC_Attach(const HFS_BlockDev* bd);
+
+/* Drop one reference; the last one flushes and forgets the device */
+void HFS_BC_Detach(uint16_t cacheId);
+
+bool HFS_BC_Read(const HFS_BlockDev* bd, uint64_t offset, void* buffer, uint32_t length);
+bool HFS_BC_Write(HFS_BlockDev* bd, uint64_t offset, const void* buffer, uint32_t length);
+
+/* Write back the device's dirty blocks in sector order */
+bool HFS_BC_Flush(uint16_t cacheId);
+
+/* Flush each device whose dirty blocks have waited HFS_BCACHE_FLUSH_TICKS */
+void HFS_BC_Idle(void);
+
+void HFS_BC_GetStats(HFS_BCacheStats* stats);
+
+/* Boot-time smoke test against an in-memory device (HFS_BCACHE_SMOKE_TEST=1) */
+void HFSBCacheSmoke_Run(void);
@@ -27,6 +27,8 @@ typedef struct {
 
     /* Node buffer for operations */
     void*        nodeBuffer;    /* Buffer for reading nodes */
+
+    uint32_t     nodeReads;     /* Node lookups since Init, cached or not */
 } HFS_BTree;
 
 /* Initialize a B-tree */
@@ -35,14 +37,40 @@ bool HFS_BT_Init(HFS_BTree* bt, HFS_Volume* vol, HFS_BTreeType type);
 /* Close a B-tree */
 void HFS_BT_Close(HFS_BTree* bt);
 
-/* Read a node from the B-tree */
+/* Read a node from the B-tree (a copy, served from the node cache) */
 bool HFS_BT_ReadNode(HFS_BTree* bt, uint32_t nodeNum, void* buffer);
 
+/* Pin a cached node in place, read-only; release it with HFS_BT_ReleaseNode */
+void* HFS_BT_GetNode(HFS_BTree* bt, uint32_t nodeNum);
+void HFS_BT_ReleaseNode(HFS_BTree* bt, void* node);
+
+/* Raw node read through the tree file's extents, bypassing the cache */
+bool HFS_BT_ReadNodeUncached(HFS_Volume* vol, HFS_BTreeType type, uint16_t nodeSize,
+                             uint32_t nodeNum, void* buffer);
+
 /* Get record from a node */
 bool HFS_BT_GetRecord(void* node, uint16_t nodeSize, uint16_t recordNum,
                       void** recordPtr, uint16_t* recordLen);
 
-/* Find a record by key */
+/* Deepest tree HFS_BT_Search will descend (HFS itself stops at 8) */
+#define HFS_BT_MAX_DEPTH 16
+
+/* Descend from the root through the index nodes to the leaf record whose
+ * key equals key.  nodeBuffer (nodeSize bytes) receives the leaf node and
+ * keyPtr/dataPtr point into it; any of the out parameters may be NULL. */
+bool HFS_BT_Search(HFS_BTree* bt, const void* key, void* nodeBuffer,
+                   void** keyPtr, void** dataPtr, uint16_t* dataLen);
+
+/* Leaf node a record with key would be in: the one an ordered scan for
+ * key and the keys after it starts from */
+bool HFS_BT_LocateLeaf(HFS_BTree* bt, const void* key, uint32_t* leafNode);
+
+/* Split leaf record recordNum of node into key and data */
+bool HFS_BT_GetLeafRecord(HFS_BTree* bt, void* node, uint16_t recordNum,
+                          void** keyPtr, void** dataPtr, uint16_t* dataLen);
+
+/* Find a record by key and copy its data (the part after the key) into
+ * recordBuffer, which must hold the tree's largest data record */
 bool HFS_BT_FindRecord(HFS_BTree* bt, const void* key, uint16_t keyLen,
                        void* recordBuffer, uint16_t* recordLen);
 
@@ -53,6 +81,7 @@ typedef bool (*HFS_BT_IteratorFunc)(void* key, uint16_t keyLen,
 
 bool HFS_BT_IterateLeaves(HFS_BTree* bt, HFS_BT_IteratorFunc func, void* context);
 
-/* Key comparison functions */
+/* Key comparison functions; catalog names compare by HFS_CatalogNameOrder */
+extern const uint8_t HFS_CatalogNameOrder[256];
 int HFS_CompareCatalogKeys(const void* key1, const void* key2);
 int HFS_CompareExtentsKeys(const void* key1, const void* key2);
\ No newline at end of file
@@ -2,12 +2,15 @@
 #pragma once
 #include "hfs_types.h"
 #include "hfs_btree.h"
+#include "hfs_namecache.h"
 #include <stdbool.h>
 
 /* Catalog operations context */
 typedef struct {
     HFS_BTree   bt;          /* B-tree for catalog */
     HFS_Volume* vol;         /* Volume reference */
+    HFS_NameCache* names;    /* Lookup results; NULL if it couldn't be allocated */
+    struct HFS_CatIDHint* idHints; /* Keys of records without threads, from leaf walks */
 } HFS_Catalog;
 
 /* Initialize catalog */
@@ -16,17 +19,41 @@ bool HFS_CatalogInit(HFS_Catalog* cat, HFS_Volume* vol);
 /* Close catalog */
 void HFS_CatalogClose(HFS_Catalog* cat);
 
-/* Enumerate entries in a directory */
+/* Resumable directory enumeration.  Holds the B-tree position of the next
+ * record (leaf node and record index) so each batch continues where the
+ * last stopped instead of rescanning from the first leaf. */
+typedef struct {
+    DirID    parentID;
+    uint32_t node;          /* Leaf holding the next record; 0 once done */
+    uint16_t record;
+    uint32_t aheadFrom;     /* Leaf whose successor was last fetched ahead */
+    uint32_t leaves;        /* Leaves finished so far */
+} HFS_CatalogCursor;
+
+bool HFS_CatalogCursorInit(HFS_Catalog* cat, DirID parentID, HFS_CatalogCursor* cursor);
+
+/* Up to maxEntries more entries; *count is 0 once the directory is done */
+bool HFS_CatalogCursorNext(HFS_Catalog* cat, HFS_CatalogCursor* cursor,
+                           CatEntry* entries, int maxEntries, int* count);
+
+/* Enumerate entries in a directory (the first maxEntries) */
+
 bool HFS_CatalogEnumerate(HFS_Catalog* cat, DirID parentID,
                          CatEntry* entries, int maxEntries, int* count);
 
-/* Lookup a specific entry by name */
+/* Lookup a specific entry by name: either the MacRoman name in the key or
+ * the ASCII rendering HFS_ParseCatalogRecord gives it in CatEntry.name */
 bool HFS_CatalogLookup(HFS_Catalog* cat, DirID parentID, const char* name,
                        CatEntry* entry);
 
 /* Get entry by CNID */
 bool HFS_CatalogGetByID(HFS_Catalog* cat, FileID cnid, CatEntry* entry);
 
+/* Get the raw key and file/folder record for a CNID; rec must hold an
+ * HFS_CatFileRec.  Uses the thread record when there is one, else a key
+ * remembered from an earlier leaf walk, else walks the leaves. */
+bool HFS_CatalogGetRecordByID(HFS_Catalog* cat, FileID cnid, HFS_CatKey* key, void* rec);
+
 /* Convert MacRoman to ASCII */
 void HFS_MacRomanToASCII(char* dst, const uint8_t* src, uint8_t len, size_t maxDst);
 
@@ -14,11 +14,12 @@ typedef enum {
 /* Block device abstraction */
 typedef struct {
     HFS_BD_Type type;       /* Device type */
-    void*    data;          /* Memory-mapped image or file handle (for MEMORY/FILE) */
+    void*    data;          /* RAM image (MEMORY) or paged HFS_Image (FILE) */
     int      device_index;  /* Device index (ATA device for ATA, drive index for SDHCI) */
     uint64_t size;          /* Total size in bytes */
     uint32_t sectorSize;    /* Sector size (typically 512) */
     bool     readonly;      /* Read-only flag */
+    uint16_t cacheId;       /* Block cache registration, 0 = uncached */
 } HFS_BlockDev;
 
 /* Initialize block device from memory buffer (for RAM disk) */
@@ -39,6 +40,10 @@ bool HFS_BD_Read(const HFS_BlockDev* bd, uint64_t offset, void* buffer, uint32_t
 /* Write to block device (if not readonly) */
 bool HFS_BD_Write(HFS_BlockDev* bd, uint64_t offset, const void* buffer, uint32_t length);
 
+/* Move whole sectors to or from the device, bypassing the block cache */
+bool HFS_BD_TransferSectors(const HFS_BlockDev* bd, uint32_t sector, uint32_t count,
+                            void* buffer, bool write);
+
 /* Close block device */
 void HFS_BD_Close(HFS_BlockDev* bd);
 
@@ -4,6 +4,16 @@
 #include "hfs_catalog.h"
 #include <stdbool.h>
 
+/* One run of a fork's extent map: file allocation blocks
+ * [fileBlock, fileBlock + blockCount) live at volume allocation blocks
+ * [startBlock, startBlock + blockCount).  Physically adjacent extents are
+ * merged, so counts can exceed 16 bits. */
+typedef struct {
+    uint32_t fileBlock;
+    uint32_t startBlock;
+    uint32_t blockCount;
+} HFS_FileExtent;
+
 /* File handle structure */
 typedef struct HFSFile {
     HFS_Volume*  vol;           /* Volume containing the file */
@@ -14,6 +24,9 @@ typedef struct HFSFile {
     HFS_Extent   rsrcExtents[3];/* First 3 resource fork extents */
     uint32_t     position;      /* Current read position */
     bool         isResource;    /* Reading resource fork? */
+    HFS_FileExtent* extMap;     /* Open fork's inline + overflow extents, built on first read */
+    uint16_t     extCount;
+    uint16_t     extHint;       /* Map entry used by the last read */
 } HFSFile;
 
 /* Open a file by CNID */
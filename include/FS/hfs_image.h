@@ -0,0 +1,48 @@
+/* HFS Paged Disk Image
+ *
+ * Backs HFS_BD_TYPE_FILE block devices.  Opening an image only records its
+ * size; data is faulted in HFS_IMAGE_CHUNK_SIZE chunks on first touch and
+ * kept in a small least-recently-used chunk cache.  Written chunks are
+ * marked dirty and go back to the file on eviction, HFS_Image_Flush and
+ * HFS_Image_Close.
+ *
+ * The file is reached through fopen/fseek/ftell, so an image can be at most
+ * LONG_MAX bytes: 2GB where long is 32 bits, which includes the i386 kernel.
+ * HFS_Image_Open fails on anything larger because ftell can't report it.
+ * The bare-metal kernel's stdio is stubbed out (sys71_stubs.c), so there
+ * the open always fails and HFS_BD_InitFile falls back to a RAM disk;
+ * tests/hfs_image exercises the paging against real files on the host.
+ */
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+
+#define HFS_IMAGE_CHUNK_SIZE    (64u * 1024u)
+#ifndef HFS_IMAGE_CHUNKS
+#define HFS_IMAGE_CHUNKS        16      /* 1MB resident */
+#endif
+
+typedef struct HFS_Image HFS_Image;
+
+typedef struct {
+    uint32_t faults;        /* Chunks read from the file */
+    uint32_t hits;
+    uint32_t writebacks;    /* Dirty chunks written to the file */
+    uint32_t resident;      /* Chunks currently held */
+} HFS_ImageStats;
+
+/* Open an existing image; NULL if it can't be opened or is empty */
+HFS_Image* HFS_Image_Open(const char* path, bool readonly);
+
+/* Write back and release */
+void HFS_Image_Close(HFS_Image* img);
+
+uint64_t HFS_Image_Size(const HFS_Image* img);
+
+bool HFS_Image_Read(HFS_Image* img, uint64_t offset, void* buffer, uint32_t length);
+bool HFS_Image_Write(HFS_Image* img, uint64_t offset, const void* buffer, uint32_t length);
+
+/* Write every dirty chunk back to the file */
+bool HFS_Image_Flush(HFS_Image* img);
+
+void HFS_Image_GetStats(const HFS_Image* img, HFS_ImageStats* stats);
@@ -0,0 +1,55 @@
+/* HFS Catalog Name Cache
+ *
+ * One cache per open catalog, remembering the result of name lookups by
+ * (parent directory, folded name).  Names are folded to their sort
+ * weights in HFS_CatalogNameOrder, which HFS_CompareCatalogKeys orders
+ * catalog keys by, so two names share an entry exactly when a catalog
+ * search treats them as the same name.  Lookups that found nothing
+ * are kept as negative entries.  Entries are hashed and evicted least
+ * recently used first; anything that changes a directory's names must call
+ * HFS_NM_Forget or HFS_NM_ForgetID.
+ */
+#pragma once
+#include "hfs_types.h"
+#include <stdbool.h>
+
+/* Names held per catalog */
+#ifndef HFS_NAME_CACHE_ENTRIES
+#define HFS_NAME_CACHE_ENTRIES 256
+#endif
+
+typedef struct HFS_NameCache HFS_NameCache;
+
+typedef enum {
+    kHFSNameUnknown = 0,    /* Not cached: search the catalog */
+    kHFSNameFound,          /* Cached entry copied out */
+    kHFSNameMissing         /* Cached negative: no such name */
+} HFS_NameResult;
+
+typedef struct {
+    uint32_t hits;
+    uint32_t negativeHits;
+    uint32_t misses;
+    uint32_t evictions;
+    uint32_t invalidations; /* Entries dropped by Forget/ForgetID */
+    uint32_t cached;
+} HFS_NameCacheStats;
+
+HFS_NameCache* HFS_NM_Create(void);
+void HFS_NM_Destroy(HFS_NameCache* nm);
+
+HFS_NameResult HFS_NM_Lookup(HFS_NameCache* nm, DirID parentID, const uint8_t* name,
+                             uint8_t len, CatEntry* entry);
+
+/* Remember a lookup's outcome; entry NULL records that the name is absent */
+void HFS_NM_Enter(HFS_NameCache* nm, DirID parentID, const uint8_t* name,
+                  uint8_t len, const CatEntry* entry);
+
+/* Drop one name */
+void HFS_NM_Forget(HFS_NameCache* nm, DirID parentID, const uint8_t* name, uint8_t len);
+
+/* cnid was renamed, moved or deleted: drop the entries naming it, the
+ * entries inside it and every negative entry */
+void HFS_NM_ForgetID(HFS_NameCache* nm, FileID cnid);
+
+void HFS_NM_GetStats(const HFS_NameCache* nm, HFS_NameCacheStats* stats);
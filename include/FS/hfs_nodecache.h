@@ -0,0 +1,35 @@
+/* HFS B-Tree Node Cache
+ *
+ * One cache per mounted volume, shared by its catalog and extents trees
+ * and created by the first HFS_BT_Init on the volume.  Nodes are hashed by
+ * (tree, node number), pinned while a caller holds them and evicted least
+ * recently used first.  Cached nodes are read-only: nothing in the HFS
+ * layer modifies B-tree nodes, so eviction just drops them.
+ */
+#pragma once
+#include "hfs_btree.h"
+#include <stdbool.h>
+
+/* Nodes held per volume */
+#ifndef HFS_NODE_CACHE_NODES
+#define HFS_NODE_CACHE_NODES 64
+#endif
+
+typedef struct {
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t evictions;
+    uint32_t cached;        /* Nodes currently held */
+    uint32_t pinned;        /* Of which in use */
+} HFS_NodeCacheStats;
+
+/* Create/destroy a volume's cache */
+HFS_NodeCache* HFS_NC_Create(HFS_Volume* vol);
+void HFS_NC_Destroy(HFS_NodeCache* nc);
+
+/* Pin a node, reading it on a miss.  NULL if it can't be read or every
+ * slot is pinned.  Each successful get needs a matching release. */
+void* HFS_NC_Get(HFS_NodeCache* nc, HFS_BTreeType tree, uint32_t nodeNum, uint16_t nodeSize);
+void HFS_NC_Release(HFS_NodeCache* nc, void* node);
+
+void HFS_NC_GetStats(const HFS_NodeCache* nc, HFS_NodeCacheStats* stats);
@@ -4,6 +4,8 @@
 #include "hfs_diskio.h"
 #include <stdbool.h>
 
+typedef struct HFS_NodeCache HFS_NodeCache;
+
 /* HFS Volume structure */
 typedef struct {
     HFS_BlockDev bd;          /* Block device */
@@ -33,6 +35,8 @@ typedef struct {
     uint32_t    nextCNID;     /* Next available CNID */
     bool        mounted;      /* Is volume mounted */
     VRefNum     vRefNum;      /* Volume reference number */
+
+    HFS_NodeCache* nodeCache; /* B-tree nodes, created by HFS_BT_Init */
 } HFS_Volume;
 
 /* Mount an HFS volume from a disk image */
@@ -58,4 +62,7 @@ bool HFS_GetVolumeInfo(const HFS_Volume* vol, VolumeControlBlock* vcb);
 bool HFS_CreateBlankVolume(void* buffer, uint64_t size, const char* volName);
 
 /* Format a block device with HFS filesystem */
-bool HFS_FormatVolume(HFS_BlockDev* bd, const char* volName);
\ No newline at end of file
+bool HFS_FormatVolume(HFS_BlockDev* bd, const char* volName);
+
+/* Boot-time catalog lookup benchmark (HFS_BENCH=1) */
+void HFSBench_Run(void);
\ No newline at end of file
@@ -45,6 +45,15 @@ VRefNum VFS_GetBootVRef(void);
 
 /* Directory operations */
 bool VFS_Enumerate(VRefNum vref, DirID dir, CatEntry* entries, int maxEntries, int* count);
+
+/* Enumeration in batches: each VFS_EnumerateNext continues where the last
+ * one stopped, so large folders can be read a piece at a time */
+typedef struct VFSEnumCursor VFSEnumCursor;
+VFSEnumCursor* VFS_EnumerateOpen(VRefNum vref, DirID dir);
+bool VFS_EnumerateNext(VFSEnumCursor* cursor, CatEntry* entries, int maxEntries, int* count);
+bool VFS_EnumerateDone(const VFSEnumCursor* cursor);
+void VFS_EnumerateClose(VFSEnumCursor* cursor);
+
 bool VFS_Lookup(VRefNum vref, DirID dir, const char* name, CatEntry* entry);
 bool VFS_GetByID(VRefNum vref, FileID id, CatEntry* entry);
 
@@ -62,4 +71,8 @@ bool VFS_CreateFolder(VRefNum vref, DirID parent, const char* name, DirID* newID
 bool VFS_CreateFile(VRefNum vref, DirID parent, const char* name,
                    uint32_t type, uint32_t creator, FileID* newID);
 bool VFS_Rename(VRefNum vref, FileID id, const char* newName);
-bool VFS_Delete(VRefNum vref, FileID id);
\ No newline at end of file
+bool VFS_Delete(VRefNum vref, FileID id);
+
+/* Drop cached name lookups that changing id's name or location makes stale;
+ * called by every operation that does so */
+void VFS_InvalidateNames(VRefNum vref, FileID id);
\ No newline at end of file
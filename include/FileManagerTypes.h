@@ -40,6 +40,7 @@ typedef struct VCBExt {
     UInt32          vcbFilCnt;      /* File count */
     UInt32          vcbDirCnt;      /* Directory count */
     UInt16          vcbDevice;      /* Device number */
+    struct AllocBitmap* vcbAllocMap; /* Free-run summary over the bitmap at vcbMAdr */
 } VCBExt;
 
 /* Extended File Control Block for File Manager */
@@ -0,0 +1,65 @@
+/*
+ * alloc_bitmap.h - Volume allocation bitmap with a free-run summary
+ *
+ * Wraps an in-memory copy of a volume bitmap (one bit per allocation
+ * block, most significant bit first, set = in use) with a summary of each
+ * ABM_CHUNK_BLOCKS-block chunk: its free count, its longest free run and
+ * the free runs touching either end.  Run searches go chunk by chunk on
+ * the summary and only read the bits of a chunk that can hold the run, so
+ * full and empty stretches of a volume cost nothing to pass over.
+ *
+ * All changes to the bits must go through ABM_Mark to keep the summary
+ * in step.
+ */
+
+#ifndef ALLOC_BITMAP_H
+#define ALLOC_BITMAP_H
+
+#include "SystemTypes.h"
+
+#define ABM_CHUNK_BLOCKS    512u        /* 64 bitmap bytes */
+
+typedef struct {
+    UInt16 freeCount;
+    UInt16 longest;         /* Longest free run inside the chunk */
+    UInt16 head;            /* Free blocks at the start of the chunk */
+    UInt16 tail;            /* Free blocks at the end of the chunk */
+} ABMChunk;
+
+typedef struct {
+    UInt32 searches;
+    UInt32 chunksScanned;   /* Chunks whose bits a search had to read */
+    UInt32 chunksSkipped;   /* Chunks a search passed on the summary alone */
+} AllocBitmapStats;
+
+typedef struct AllocBitmap {
+    UInt8*    bits;
+    UInt32    numBlocks;
+    UInt32    numChunks;
+    UInt32    freeBlocks;
+    Boolean   ownsBits;
+    ABMChunk* chunks;
+    AllocBitmapStats stats;
+} AllocBitmap;
+
+/* Summarize bits (numBlocks bits, not copied).  With bits NULL, a cleared
+ * bitmap is allocated and owned by the map. */
+AllocBitmap* ABM_Create(UInt8* bits, UInt32 numBlocks);
+void ABM_Dispose(AllocBitmap* abm);
+
+/* First run of at least minBlocks free blocks at or after hint, wrapping to
+ * the start of the volume; returns up to maxBlocks of it */
+Boolean ABM_FindRun(AllocBitmap* abm, UInt32 hint, UInt32 minBlocks, UInt32 maxBlocks,
+                    UInt32* start, UInt32* count);
+
+/* Set (inUse) or clear blocks; returns how many changed state */
+UInt32 ABM_Mark(AllocBitmap* abm, UInt32 start, UInt32 count, Boolean inUse);
+
+Boolean ABM_IsFree(const AllocBitmap* abm, UInt32 block);
+UInt32 ABM_FreeBlocks(const AllocBitmap* abm);
+void ABM_GetStats(const AllocBitmap* abm, AllocBitmapStats* stats);
+
+/* Boot-time free-run search benchmark (ALLOC_BENCH=1) */
+void AllocBench_Run(void);
+
+#endif /* ALLOC_BITMAP_H */
@@ -16,6 +16,7 @@
 #include "SystemTypes.h"
 
 #include "hfs_structs.h"
+#include "fs_queue.h"
 
 /* File permission constants */
 #define fsRdPerm    1    /* Read permission */
@@ -88,19 +89,18 @@ OSErr FXMAllocateExtent(VCB* vcb, FCB* fcb, UInt32 bytes_needed, ExtentRecord* e
 OSErr FXMDeallocateExtent(VCB* vcb, ExtentRecord* extent_rec);
 OSErr FXMExtendFile(FCB* fcb, UInt32 bytes_to_add);
 OSErr FXMTruncateFile(FCB* fcb, UInt32 new_length);
+void FXMReleaseVolume(VCB* vcb);
 
 /*
  * File System Queue Operations
 
  */
 OSErr FSQueue(void* param_block);
-OSErr FSQueueSync(void);
 
 /*
  * Internal Support Functions
 
  */
-void CmdDone(void);
 OSErr DSHook(void);  /* Disk switch hook */
 
 /*
@@ -0,0 +1,34 @@
+/*
+ * fs_queue.h - File System request queue
+ *
+ * PBCloseAsync/PBReadAsync/PBWriteAsync and FSQueue put requests here;
+ * FSQueue_Service, called from the event loop, runs them and CmdDone calls
+ * their completion routines.  Kept apart from file_manager.h so the legacy File Manager
+ * (FileManager.c) can use it alongside its own prototypes.
+ */
+
+#ifndef FS_QUEUE_H
+#define FS_QUEUE_H
+
+#include "SystemTypes.h"
+
+typedef OSErr (*FSQueueProc)(ParamBlockRec* pb);
+
+typedef struct {
+    UInt32 queued;
+    UInt32 completed;
+    UInt32 foreground;      /* Requests run for foreground callers */
+    UInt32 background;
+    UInt32 overflows;       /* Queue full, a request was run inline */
+    UInt32 pending;
+} FSQueueStats;
+
+/* Queue pb to run proc(pb) later, after earlier requests for refNum */
+OSErr FSQueueRequest(ParamBlockRec* pb, FSQueueProc proc, SInt16 refNum);
+OSErr FSQueueWait(SInt16 refNum);
+OSErr FSQueueSync(void);
+UInt32 FSQueue_Service(UInt32 maxRequests, UInt32 maxMicros);
+void FSQueue_GetStats(FSQueueStats* stats);
+void CmdDone(void);
+
+#endif /* FS_QUEUE_H */
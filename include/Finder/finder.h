@@ -133,6 +133,7 @@ void InitializeFolderContentsEx(WindowPtr w, Boolean isTrash, VRefNum vref, DirI
 WindowPtr FolderWindow_OpenFolder(VRefNum vref, DirID dirID, ConstStr255Param title);
 Boolean HandleFolderWindowClick(WindowPtr w, EventRecord *ev, Boolean isDoubleClick);
 void FolderWindow_Draw(WindowPtr w);
+void FolderWindow_Idle(void);
 Boolean IsFolderWindow(WindowPtr w);
 void FolderWindow_SelectAll(WindowPtr w);
 Boolean FolderWindow_GetSelectedItem(WindowPtr w, VRefNum* outVref, FileID* outFileID);
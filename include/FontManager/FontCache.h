@@ -1,8 +1,11 @@
 /*
  * FontCache.h - Font Strike Cache Management
  *
- * Efficient LRU caching for font strikes
- * Optimized for System 7.1 memory constraints
+ * Strikes loaded from FOND/NFNT resources are kept by (family, size,
+ * face, device) in a chained hash table, and on an LRU list threaded
+ * through the strikes themselves, so a lookup and an eviction are both
+ * O(1).  Past the byte budget or the entry limit set by InitFontCache,
+ * the least recently used strikes are disposed - never the current one.
  */
 
 #ifndef FONT_CACHE_H
@@ -16,68 +19,41 @@ extern "C" {
 #endif
 
 /* Cache configuration */
-#define FM_MAX_CACHE_SIZE      (256 * 1024)  /* 256KB max cache */
-#define FM_MAX_STRIKES         16            /* Max cached strikes */
-#define FM_CACHE_PURGE_RATIO   0.75f        /* Purge when 75% full */
+#define FM_MAX_CACHE_SIZE      (256 * 1024)  /* Default byte budget */
+#define FM_MAX_STRIKES         32            /* Default entry limit */
+#define FM_CACHE_BUCKETS       64            /* Hash buckets, a power of two */
 
-/* Strike cache key */
-typedef struct StrikeCacheKey {
-    short   fontID;
-    short   fontSize;
-    Style   face;
-    Boolean fractEnable;
-} StrikeCacheKey;
-
-/* Cached strike entry */
-typedef struct CachedStrike {
-    StrikeCacheKey      key;
-    struct FontStrike*  strike;
-    UInt32             memorySize;
-    UInt32             lastUsed;      /* TickCount of last use */
-    UInt32             useCount;      /* Number of uses */
-    struct CachedStrike* next;
-    struct CachedStrike* prev;
-} CachedStrike;
+/* Device of strikes drawn to the screen */
+#define FM_SCREEN_DEVICE       0
 
 /* Cache statistics */
 typedef struct CacheStats {
-    UInt32  totalMemory;    /* Total memory used */
+    UInt32  totalMemory;    /* Bytes charged to the cache */
+    UInt32  maxMemory;      /* Byte budget */
     UInt32  strikeCount;    /* Number of cached strikes */
+    UInt32  maxStrikes;     /* Entry limit */
     UInt32  hitCount;       /* Cache hits */
     UInt32  missCount;      /* Cache misses */
-    float   hitRate;        /* Hit rate percentage */
+    UInt32  evictions;      /* Strikes disposed to stay within the limits */
 } CacheStats;
 
-/* Cache initialization */
-OSErr FM_InitCache(void);
-void FM_ShutdownCache(void);
-
 /* Strike management */
-struct FontStrike* FM_GetCachedStrike(short fontID, short size, Style face);
-OSErr FM_CacheStrike(short fontID, short size, Style face,
-                     struct FontStrike* strike);
-void FM_RemoveStrike(short fontID, short size, Style face);
+struct FontStrike* FM_GetCachedStrike(short fontID, short size, Style face, short device);
 
-/* Cache operations */
-void FM_FlushCache(void);
-void FM_PurgeOldStrikes(UInt32 ageThreshold);
-void FM_CompactCache(void);
+/* Cache a strike the caller built with NewPtr; the cache owns it from now
+ * on and may dispose it once it is no longer current */
+OSErr FM_CacheStrike(struct FontStrike* strike, short device);
+void FM_DisposeStrike(struct FontStrike* strike);
 
 /* Statistics */
 void FM_GetCacheStats(CacheStats* stats);
 void FM_ResetCacheStats(void);
 
-/* Memory management */
-UInt32 FM_GetCacheMemoryUsage(void);
-Boolean FM_CanAllocateStrike(UInt32 strikeSize);
-void FM_OptimizeCacheMemory(void);
-
-/* Debugging */
-void FM_DumpCacheInfo(void);
-void FM_ValidateCache(void);
+/* Boot-time strike cache benchmark (FONT_BENCH=1) */
+void FontBench_Run(void);
 
 #ifdef __cplusplus
 }
 #endif
 
-#endif /* FONT_CACHE_H */
\ No newline at end of file
+#endif /* FONT_CACHE_H */
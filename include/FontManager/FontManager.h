@@ -65,6 +65,7 @@ OSErr InitFontCache(short maxEntries, unsigned long maxSize);
 OSErr FlushFontCache(void);
 OSErr PurgeFontCache(short familyID);
 OSErr GetFontCacheStats(short *entries, unsigned long *size);
+Fixed GetCacheHitRatio(void);
 
 /* Font Format Detection */
 short GetFontFormat(short familyID, short size);
@@ -174,6 +175,11 @@ short CharWidth(short ch);
 short StringWidth(ConstStr255Param s);
 short TextWidth(const void* textBuf, short firstByte, short byteCount);
 
+/* Width of any length of text in the port's font, size and face, from the
+ * strike's cached width tables; fractional when FractEnable is on and the
+ * family has a FOND width table.  Saturates at the largest Fixed. */
+Fixed FM_TextWidthFixed(const void* textBuf, SInt32 firstByte, SInt32 byteCount);
+
 /* Get current Font Manager state */
 FontManagerState *GetFontManagerState(void);
 FontStrike *FM_GetCurrentStrike(void);
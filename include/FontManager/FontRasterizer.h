@@ -0,0 +1,100 @@
+/*
+ * FontRasterizer.h - TrueType Outline Rasterizer
+ *
+ * Renders the quadratic outlines of an 'sfnt' resource at a pixel size.
+ * Contours are flattened into edges and filled scanline by scanline with
+ * the non-zero winding rule, sampling each pixel once at its centre or,
+ * smoothed, on a 4x4 grid for coverage.  FM_RasterizeStrike renders a
+ * family's characters into a 1-bit strike laid out like an NFNT's, which
+ * the Font Manager caches per size like any loaded strike.
+ */
+
+#ifndef FONT_RASTERIZER_H
+#define FONT_RASTERIZER_H
+
+#include "SystemTypes.h"
+#include "FontTypes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define FM_OUTLINE_MAX_SIZE    127   /* Largest size rendered, in pixels per em */
+#define FM_COVERAGE_FULL       255   /* Coverage of a pixel inside the outline */
+
+/* Point of a decoded contour: font units, then 26.6 pixels once placed */
+typedef struct OutlinePoint {
+    SInt32  x;
+    SInt32  y;
+    UInt8   flags;          /* glyf point flags; bit 0 set on the curve */
+} OutlinePoint;
+
+/* Edge of a flattened contour, in 26.6 pixels, y0 < y1 */
+typedef struct OutlineEdge {
+    SInt32  x0, y0;
+    SInt32  x1, y1;
+    SInt32  dir;            /* +1 running down, -1 running up */
+} OutlineEdge;
+
+/* An opened 'sfnt': table pointers into the caller's data, and scratch
+ * buffers that grow as glyphs need them */
+typedef struct OutlineFont {
+    const UInt8*  data;
+    UInt32        length;
+    const UInt8*  glyf;
+    UInt32        glyfLength;
+    const UInt8*  loca;
+    const UInt8*  hmtx;
+    const UInt8*  cmap;     /* Character map subtable used */
+    UInt32        cmapLength;
+    UInt16        cmapFormat;
+    UInt16        unitsPerEm;
+    UInt16        numGlyphs;
+    UInt16        numHMetrics;
+    Boolean       longLoca;
+    SInt16        ascender;
+    SInt16        descender;
+    SInt16        lineGap;
+
+    OutlinePoint* points;
+    UInt32        pointCap;
+    OutlineEdge*  edges;
+    UInt32        edgeCount;
+    UInt32        edgeCap;
+    SInt32*       crossings;
+    UInt32        crossingCap;
+} OutlineFont;
+
+/* Open the sfnt in data, which must stay put until FM_CloseOutlineFont */
+OSErr FM_OpenOutlineFont(const void* data, UInt32 length, OutlineFont* font);
+void FM_CloseOutlineFont(OutlineFont* font);
+
+/* Glyph of a Mac Roman character code, 0 (the missing glyph) if none */
+UInt16 FM_OutlineGlyphIndex(const OutlineFont* font, UInt8 ch);
+
+/* Advance of a glyph at ppem pixels per em */
+Fixed FM_OutlineAdvance(const OutlineFont* font, UInt16 glyph, short ppem);
+
+/* Pixel bounds of a glyph at ppem, relative to its origin with y down;
+ * empty for a glyph without contours */
+OSErr FM_GetGlyphBounds(const OutlineFont* font, UInt16 glyph, short ppem, Rect* bounds);
+
+/* Render a glyph at ppem into frame (pixels relative to the origin, y
+ * down): one coverage byte per pixel, 0 to FM_COVERAGE_FULL, rowBytes
+ * apart.  The outline is clipped to the frame. */
+OSErr FM_RenderGlyph(OutlineFont* font, UInt16 glyph, short ppem, Boolean smooth,
+                     const Rect* frame, UInt8* coverage, short rowBytes);
+
+/* Strike of characters 0-255 of the sfnt at size, for familyID and face,
+ * or NULL.  Smoothed strikes keep the pixels at least half covered. */
+struct FontStrike* FM_RasterizeStrike(Handle sfnt, short familyID, short size, Style face,
+                                      Boolean smooth);
+
+/* Boot-time reference bitmap smoke test (FONT_RASTER_SMOKE_TEST=1) */
+void FontRasterSmoke_Run(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FONT_RASTERIZER_H */
@@ -30,7 +30,8 @@ typedef struct NFNTResource {
 
     /* Variable length data follows:
      * - Bitmap data (rowWords * fRectHeight * 2 bytes)
-     * - Offset/Width table
+     * - Location table (bit offset of each glyph, lastChar - firstChar + 3 words)
+     * - Offset/Width table (same count)
      * - Optional: Width table (fractional widths)
      * - Optional: Kerning table
      */
@@ -77,9 +78,9 @@ typedef struct FONDResource {
 
 /* Font Association Table Entry */
 typedef struct FontAssocEntry {
-    SInt16  fontSize;       /* Point size */
+    SInt16  fontSize;       /* Point size, 0 for an outline font */
     SInt16  fontStyle;      /* Style bits */
-    SInt16  fontID;         /* Resource ID of NFNT */
+    SInt16  fontID;         /* Resource ID of NFNT, or of sfnt at size 0 */
 } FontAssocEntry;
 
 /* Width Table (for fractional widths) */
@@ -104,12 +105,16 @@ typedef struct StyleMapEntry {
 /* Resource Loading Functions */
 OSErr FM_LoadFONDResource(Handle fondHandle, FONDResource **fondOut);
 OSErr FM_LoadNFNTResource(Handle nfntHandle, NFNTResource **nfntOut);
+OSErr FM_ParseLocationTable(const NFNTResource *nfnt, SInt16 **locOut);
 OSErr FM_ParseOWTTable(const NFNTResource *nfnt, OWTEntry **owtOut);
 OSErr FM_BuildWidthTable(const NFNTResource *nfnt, const OWTEntry *owt, UInt8 **widthsOut);
-OSErr FM_ExtractBitmap(const NFNTResource *nfnt, UInt8 **bitmapOut, Size *sizeOut);
+OSErr FM_BuildFixedWidthTable(FONDResource *fond, SInt16 size, Style face, Fixed **fixedOut);
+OSErr FM_ExtractBitmap(const NFNTResource *nfnt, Handle *bitmapOut, Size *sizeOut);
 
 /* Font Association Functions */
 SInt16 FM_FindBestMatch(const FONDResource *fond, SInt16 size, Style face);
+SInt16 FM_FindOutlineMatch(const FONDResource *fond, SInt16 size, Style face,
+                           Boolean outlinePreferred);
 OSErr FM_GetFontAssociation(const FONDResource *fond, SInt16 index, const FontAssocEntry **entryOut);
 
 /* Resource Utilities */
@@ -2,6 +2,9 @@
  * FontStyleSynthesis.h - Font Style Synthesis API
  *
  * Style generation functions for System 7.1 Font Manager
+ *
+ * Styled strikes are synthesized once from the plain strike of the same
+ * family and size, and cached by the Font Manager under their face.
  */
 
 #ifndef FONT_STYLE_SYNTHESIS_H
@@ -14,7 +17,9 @@
 extern "C" {
 #endif
 
-/* Individual Style Synthesis - internal functions, not exported */
+/* Strike Synthesis - bold, italic, outline, shadow, condense and extend;
+ * NULL if base has no glyph bitmap or memory runs out */
+struct FontStrike* FM_SynthesizeStrike(const struct FontStrike* base, Style face);
 
 /* Width Calculations for Styles */
 short FM_GetBoldWidth(short normalWidth);
@@ -23,6 +28,7 @@ short FM_GetShadowWidth(short normalWidth);
 short FM_GetOutlineWidth(short normalWidth);
 short FM_GetCondensedWidth(short normalWidth);
 short FM_GetExtendedWidth(short normalWidth);
+short FM_StyleAdvance(short width, Style face, short height);
 
 /* Combined Style Support */
 short FM_GetStyledCharWidth(char ch, Style face);
@@ -69,8 +69,6 @@ typedef struct FontManagerState {
 
     /* Family and strike management */
     struct FontFamily*     familyList;     /* Linked list of families */
-    struct FontStrike*     strikeCache;    /* LRU cache of strikes */
-    short           strikeCacheSize;
     struct FontStrike*     currentStrike;  /* Active strike for current port */
 
     /* Substitutions */
@@ -240,12 +238,15 @@ typedef struct FontStrike {
     /* Tables */
     Handle      bitmapData;     /* Handle to bitmap data */
     short*      locTable;       /* Character location table */
-    unsigned char* widthTable;  /* Character width table */
+    unsigned char* widthTable;  /* 256 integer advances by character code */
+    Fixed*      fixedWidths;    /* 256 fractional advances, NULL if whole */
 
-    /* Cache linkage */
-    struct FontStrike* next;
+    /* Cache linkage (FontCache.c) */
+    struct FontStrike* next;    /* LRU list, most recently used first */
     struct FontStrike* prev;
-    unsigned long lastUsed;     /* Tick count for LRU */
+    struct FontStrike* hashNext; /* Chain within the hash bucket */
+    short       device;
+    unsigned long cacheBytes;   /* Charged against the cache budget */
 } FontStrike;
 
 /* Font Family - Runtime representation of a font family */
@@ -95,6 +95,7 @@ OSErr GetSysEnv(short versionRequested, SysEnvRec *answer);
 #define gestaltFPUType          FOURCC('f','p','u',' ')
 #define gestaltInitBits         FOURCC('i','n','i','t')
 #define gestaltMemoryMap        FOURCC('m','m','a','p')
+#define gestaltMemTelemetry     FOURCC('m','t','e','l')  /* MemTelemetrySnapshot* */
 
 #ifdef __cplusplus
 }
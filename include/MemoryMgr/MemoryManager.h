@@ -19,9 +19,14 @@ enum {
     BF_HANDLE    = 1<<2,       /* Relocatable (Handle) data block */
     BF_LOCKED    = 1<<3,       /* Handle data pinned */
     BF_PURGEABLE = 1<<4,       /* Handle can be discarded */
-    BF_RESOURCE  = 1<<5        /* Resource handle */
+    BF_RESOURCE  = 1<<5,       /* Resource handle */
+    BF_APPEND    = 1<<6        /* Handle has grown before; give it headroom */
 };
 
+/* High byte of BlockHeader.flags holds the telemetry owner slot */
+#define BF_OWNER_SHIFT 8
+#define BF_OWNER_MASK  0xFF00u
+
 /* Block header - precedes every allocation */
 #ifndef BLOCKHEADER_DEFINED
 #define BLOCKHEADER_DEFINED
@@ -95,6 +100,7 @@ void    HPurge(Handle h);
 void    HNoPurge(Handle h);
 void    MoveHHi(Handle h);
 void    EmptyHandle(Handle h);
+bool    ReallocateHandle(Handle h, u32 byteCount);
 bool    RecoverHandle(void* p, Handle* h);
 
 /* Handle utility functions - System 7 */
@@ -107,6 +113,7 @@ OSErr   HandAndHand(Handle aHndl, Handle bHndl);
 void    InitZone(ZoneInfo* zone, void* memory, u32 size, void** masterTable, u32 masterCount);
 ZoneInfo* GetZone(void);
 void    SetZone(ZoneInfo* zone);
+ZoneInfo* MemoryManager_GetTempZone(void);
 u32     FreeMem(void);
 u32     MaxMem(void);
 u32     CompactMem(u32 cbNeeded);
@@ -139,6 +146,13 @@ OSErr   MemoryManager_MapToM68K(struct M68KAddressSpace* as);
 /* Synchronize key low-memory globals with current zone state */
 void    MemoryManager_SyncLowMemGlobals(void);
 
+/* Handles onto read-only data outside the heap (see MemoryManager.c) */
+void    MemoryManager_SetROM(const void* base, u32 size);
+Handle  MemoryManager_NewROMHandle(const void* data);
+bool    MemoryManager_IsROMHandle(Handle h);
+/* Move a ROM handle's data into the heap; true if h now lives there */
+bool    MemoryManager_CopyROMHandle(Handle h);
+
 /* Utility to detect if a pointer belongs to a managed heap */
 bool    MemoryManager_IsHeapPointer(const void* p);
 
@@ -147,4 +161,7 @@ void    CheckHeap(ZoneInfo* zone);
 void    DumpHeap(ZoneInfo* zone);
 void    MemoryManager_CheckSuspectBlock(const char* tag);
 
+/* Boot-time handle growth benchmark (HEAP_BENCH=1) */
+void    HeapBench_Run(void);
+
 #endif /* MEMORY_MANAGER_H */
@@ -0,0 +1,119 @@
+/*
+ * MemoryTelemetry.h - Optional Memory Manager allocation telemetry
+ *
+ * Per-zone size histograms, per-call counters, live bytes per owning
+ * module and cycle counts for the Memory Manager entry points.  Compiled
+ * in with MEMORY_TELEMETRY=1 (see config/default.mk); otherwise every hook
+ * below expands to nothing and the allocator pays no cost.
+ *
+ * Owners are identified by a 32-bit key: either a tag pushed by the caller
+ * with MemTelemetry_SetOwnerTag() (typically a FOURCC such as 'HFS ') or,
+ * when no tag is active, the return address of the allocating call.  The
+ * owner slot is stashed in the high byte of BlockHeader.flags so live
+ * bytes can be credited back when the block is freed or purged.
+ *
+ * The live counters are published through Gestalt selector 'mtel' (the
+ * response is a pointer to a MemTelemetrySnapshot) and can be dumped over
+ * serial as CSV or as a framed binary image of the snapshot.
+ */
+
+#ifndef MEMORY_TELEMETRY_H
+#define MEMORY_TELEMETRY_H
+
+#include "SystemTypes.h"
+#include "MemoryMgr/MemoryManager.h"
+
+#define kMemTelemetryVersion        1
+#define kMemTelemetryMaxZones       4
+#define kMemTelemetryMaxOwners      64      /* slot 0 collects overflow */
+#define kMemTelemetryHistBuckets    16      /* <=16B, <=32B, ... , >128KB */
+
+/* Operations with call and cycle counters */
+typedef enum {
+    kMemOpNewPtr = 0,
+    kMemOpNewHandle,
+    kMemOpDisposePtr,
+    kMemOpDisposeHandle,
+    kMemOpSetHandleSize,
+    kMemOpCompactMem,
+    kMemOpCount
+} MemTelemetryOp;
+
+typedef struct MemTelemetryZoneStats {
+    char    name[4];                            /* First chars of ZoneInfo.name */
+    UInt32  sizeHist[kMemTelemetryHistBuckets]; /* Requested sizes, log2 buckets */
+    UInt32  calls[kMemOpCount];
+    UInt64  cycles[kMemOpCount];                /* Inclusive PlatformCounterNow() ticks */
+    UInt32  allocFailures;
+    UInt32  handleMoves;                        /* SetHandleSize relocations */
+    UInt32  purgedBlocks;
+    UInt32  purgedBytes;
+    UInt32  compactBytesMoved;
+    UInt32  liveBytes;
+    UInt32  peakLiveBytes;
+} MemTelemetryZoneStats;
+
+typedef struct MemTelemetryOwner {
+    UInt32  key;                                /* Tag or return address; 0 = unused */
+    UInt32  liveBytes;
+    UInt32  peakLiveBytes;
+    UInt32  allocCount;
+} MemTelemetryOwner;
+
+typedef struct MemTelemetrySnapshot {
+    UInt16  version;
+    UInt16  zoneCount;
+    UInt16  ownerCount;
+    UInt16  histBuckets;
+    MemTelemetryZoneStats zones[kMemTelemetryMaxZones];
+    MemTelemetryOwner     owners[kMemTelemetryMaxOwners];
+} MemTelemetrySnapshot;
+
+#ifdef MEMORY_TELEMETRY
+
+/* Recording hooks - called from MemoryManager.c only */
+UInt64  MemTelemetry_Now(void);
+void    MemTelemetry_RecordAlloc(ZoneInfo* z, MemTelemetryOp op, BlockHeader* b,
+                                 u32 requested, UInt32 returnKey);
+void    MemTelemetry_RecordFree(ZoneInfo* z, MemTelemetryOp op, BlockHeader* b);
+void    MemTelemetry_RecordPurge(ZoneInfo* z, BlockHeader* b);
+void    MemTelemetry_RecordResize(ZoneInfo* z, BlockHeader* b, u32 oldBlockSize, bool moved);
+void    MemTelemetry_RecordFailure(ZoneInfo* z, MemTelemetryOp op);
+void    MemTelemetry_RecordMoved(ZoneInfo* z, u32 bytes);
+void    MemTelemetry_End(ZoneInfo* z, MemTelemetryOp op, UInt64 start);
+
+#define MEMTEL_BEGIN(t)                 UInt64 t = MemTelemetry_Now()
+#define MEMTEL_END(z, op, t)            MemTelemetry_End((z), (op), (t))
+#define MEMTEL_ALLOC(z, op, b, req)     MemTelemetry_RecordAlloc((z), (op), (b), (req), \
+                                            (UInt32)(uintptr_t)__builtin_return_address(0))
+#define MEMTEL_FREE(z, op, b)           MemTelemetry_RecordFree((z), (op), (b))
+#define MEMTEL_PURGE(z, b)              MemTelemetry_RecordPurge((z), (b))
+#define MEMTEL_RESIZE(z, b, old, mv)    MemTelemetry_RecordResize((z), (b), (old), (mv))
+#define MEMTEL_FAIL(z, op)              MemTelemetry_RecordFailure((z), (op))
+#define MEMTEL_MOVED(z, n)              MemTelemetry_RecordMoved((z), (n))
+
+#else
+
+#define MEMTEL_BEGIN(t)                 ((void)0)
+#define MEMTEL_END(z, op, t)            ((void)0)
+#define MEMTEL_ALLOC(z, op, b, req)     ((void)0)
+#define MEMTEL_FREE(z, op, b)           ((void)0)
+#define MEMTEL_PURGE(z, b)              ((void)0)
+#define MEMTEL_RESIZE(z, b, old, mv)    ((void)(old))
+#define MEMTEL_FAIL(z, op)              ((void)0)
+#define MEMTEL_MOVED(z, n)              ((void)0)
+
+#endif /* MEMORY_TELEMETRY */
+
+#ifdef MEMORY_TELEMETRY
+
+/* Public API (available only when MEMORY_TELEMETRY is compiled in) */
+UInt32  MemTelemetry_SetOwnerTag(UInt32 tag);   /* Returns previous tag; 0 = use return address */
+const MemTelemetrySnapshot* MemTelemetry_GetSnapshot(void);
+void    MemTelemetry_Reset(void);
+void    MemTelemetry_DumpCSV(void);
+void    MemTelemetry_DumpBinary(void);
+
+#endif /* MEMORY_TELEMETRY */
+
+#endif /* MEMORY_TELEMETRY_H */
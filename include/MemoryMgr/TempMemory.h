@@ -0,0 +1,57 @@
+/*
+ * TempMemory.h - Temporary memory and kernel scratch arena
+ *
+ * Transient buffers are kept out of the application heap.  Two interfaces
+ * share a dedicated system arena that is separate from the system and
+ * application zones:
+ *
+ *  - The Process Manager temporary memory calls (TempNewHandle and
+ *    friends) hand out ordinary relocatable handles from the temp zone.
+ *    DisposeHandle, SetHandleSize, HLock etc. work on them as usual.
+ *
+ *  - A scoped bump allocator for kernel-internal scratch (sector bounce
+ *    buffers, B-tree node buffers, redraw lists).  Take a mark, allocate,
+ *    then release back to the mark to free everything allocated since in
+ *    one step:
+ *
+ *        TempScratchMark mark = TempScratch_Mark();
+ *        u8* buf = TempScratch_Alloc(len);
+ *        ...
+ *        TempScratch_Release(mark);
+ *
+ *    Marks nest (strict LIFO).  Requests the arena can't hold spill to
+ *    NewPtr in the temp zone and are disposed by the matching release.
+ *    Scratch memory is not zeroed.
+ */
+
+#ifndef TEMP_MEMORY_H
+#define TEMP_MEMORY_H
+
+#include "SystemTypes.h"
+#include "MemoryMgr/MemoryManager.h"
+
+#define kTempScratchSize        (128u * 1024u)
+#define kTempScratchAlign       16u     /* Suitable for DMA/sector buffers */
+#define kTempScratchSpillMax    16u     /* Outstanding oversize allocations */
+
+/* Process Manager temporary memory */
+Handle  TempNewHandle(Size logicalSize, OSErr* resultCode);
+Size    TempFreeMem(void);
+Size    TempMaxMem(Size* grow);
+Ptr     TempTopMem(void);
+void    TempHLock(Handle h, OSErr* resultCode);
+void    TempHUnlock(Handle h, OSErr* resultCode);
+void    TempDisposeHandle(Handle h, OSErr* resultCode);
+
+/* Scoped scratch arena */
+typedef struct TempScratchMark {
+    u32 top;            /* Arena offset at the time of the mark */
+    u32 spills;         /* Spill count at the time of the mark */
+} TempScratchMark;
+
+TempScratchMark TempScratch_Mark(void);
+void*   TempScratch_Alloc(u32 size);
+void    TempScratch_Release(TempScratchMark mark);
+u32     TempScratch_HighWater(void);
+
+#endif /* TEMP_MEMORY_H */
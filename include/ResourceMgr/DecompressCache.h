@@ -0,0 +1,58 @@
+/*
+ * DecompressCache.h - Unpacked copies of compressed resources
+ *
+ * Keeps the unpacked bytes of resCompressed resources by (file, type, ID),
+ * so loading one again after ReleaseResource, or after its handle was
+ * purged, is a copy instead of a read and a 'dcmp' run.  Entries are
+ * purgeable handles: PurgeMem may reclaim them at any time, and past a
+ * byte budget the least recently used are disposed.  Entries of the
+ * definition procedures and fonts the system loads over and over
+ * ('CDEF', 'WDEF', 'MDEF', 'FONT') are pinned instead - not purgeable
+ * and outside the budget - so each is unpacked once per boot.
+ */
+
+#ifndef DECOMPRESS_CACHE_H
+#define DECOMPRESS_CACHE_H
+
+#include "SystemTypes.h"
+
+/* Bytes of unpinned entries kept before LRU eviction */
+#ifndef DC_BUDGET
+#define DC_BUDGET (128u * 1024u)
+#endif
+
+/* Most entries held at once */
+#define DC_MAX_ENTRIES 64u
+
+typedef struct {
+    UInt32 entries;
+    UInt32 maxEntries;
+    UInt32 bytes;           /* Unpinned resident bytes */
+    UInt32 pinnedBytes;
+    UInt32 hits;
+    UInt32 misses;
+    UInt32 evictions;       /* Disposed to stay in budget or under maxEntries */
+    UInt32 reclaimed;       /* Found purged by the Memory Manager */
+} DecompCacheStats;
+
+/* Unpacked data cached for (refNum, type, id), or NULL */
+Handle DC_Lookup(SInt16 refNum, ResType type, ResID id);
+
+/* Cache a copy of size unpacked bytes; does nothing if caching is off */
+void DC_Insert(SInt16 refNum, ResType type, ResID id, const void* data, UInt32 size);
+
+/* Dispose every entry of refNum (its file closed) */
+void DC_RemoveFile(SInt16 refNum);
+
+/* Dispose every entry, pinned ones included */
+void DC_Flush(void);
+
+/* Entry limit, at most DC_MAX_ENTRIES; extra entries are evicted */
+void DC_SetMaxEntries(UInt32 maxEntries);
+
+/* Turn caching on or off (on by default); off also flushes */
+void DC_SetEnabled(Boolean on);
+
+void DC_GetStats(DecompCacheStats* stats);
+
+#endif /* DECOMPRESS_CACHE_H */
@@ -0,0 +1,49 @@
+/*
+ * ResourceCache.h - Loaded resource handles by (file, type, ID)
+ *
+ * Open-addressing hash (linear probing, doubled at 3/4 load) from
+ * (refNum, type, id) to the handle GetResource returned for it.  Entries
+ * loaded from purgeable resources count against a byte budget; past it
+ * the least recently used of them are emptied (EmptyHandle) but stay in
+ * the cache, so the next GetResource or LoadResource reloads into the same
+ * handle.  ReleaseResource, DetachResource and CloseResFile remove
+ * entries.
+ */
+
+#ifndef RESOURCE_CACHE_H
+#define RESOURCE_CACHE_H
+
+#include "SystemTypes.h"
+
+/* Resident bytes of purgeable resources kept before LRU purging starts */
+#ifndef RC_PURGEABLE_BUDGET
+#define RC_PURGEABLE_BUDGET (256u * 1024u)
+#endif
+
+typedef struct {
+    UInt32 entries;
+    UInt32 capacity;
+    UInt32 residentBytes;   /* Bytes of cached handles not purged */
+    UInt32 hits;
+    UInt32 misses;
+    UInt32 purges;          /* Handles emptied to stay in budget */
+} ResCacheStats;
+
+/* Handle cached for (refNum, type, id), or NULL.  A hit may be a purged
+ * handle (*h == NULL) that the caller must reload. */
+Handle RC_Lookup(SInt16 refNum, ResType type, ResID id);
+
+/* Remember h; purgeable entries may be emptied later to keep the budget */
+void RC_Insert(SInt16 refNum, ResType type, ResID id, Handle h, Boolean purgeable);
+
+/* A purged entry was reloaded: count it resident again */
+void RC_Reloaded(SInt16 refNum, ResType type, ResID id);
+
+void RC_Remove(SInt16 refNum, ResType type, ResID id);
+
+/* Drop every entry of refNum, calling dispose on each handle if given */
+void RC_RemoveFile(SInt16 refNum, void (*dispose)(Handle h));
+
+void RC_GetStats(ResCacheStats* stats);
+
+#endif /* RESOURCE_CACHE_H */
@@ -0,0 +1,45 @@
+/*
+ * ResourceDecompress.h - 'dcmp' 0, 1 and 2 decompression of resource data
+ *
+ * A compressed resource (attribute resCompressed) starts with an extended
+ * resource header: signature, header length, version (8 for the DonnBits
+ * family, dcmp 0 and 1; 9 for GreggyBits, dcmp 2), attributes and the
+ * unpacked size, then per-version fields; the packed data follows at
+ * headerLength.  All fields are big-endian.
+ */
+
+#ifndef RESOURCE_DECOMPRESS_H
+#define RESOURCE_DECOMPRESS_H
+
+#include "SystemTypes.h"
+
+#define RD_SIGNATURE        0xA89F6572u
+#define RD_HEADER_SIZE      18u
+
+/* GreggyBits flags */
+#define RD_FLAG_CUSTOM_TABLE    0x01    /* Word table follows the header */
+#define RD_FLAG_TAGGED          0x02    /* Tag bytes mark table words and literals */
+
+typedef struct {
+    UInt32 unpackedSize;
+    UInt16 headerLength;
+    UInt8  version;
+    UInt8  attributes;
+    SInt16 dcmpID;          /* 0, 1 or 2 are built in */
+    UInt8  tableSize;       /* dcmp 2: custom table entries - 1 */
+    UInt8  flags;           /* dcmp 2: RD_FLAG_* */
+} RDHeader;
+
+/* Parse the extended header; false if data does not start with one */
+Boolean RD_ParseHeader(const UInt8* data, UInt32 size, RDHeader* header);
+
+/* Unpack a whole compressed resource (header included) into dst, which
+ * must hold exactly the header's unpackedSize bytes.  Returns noErr,
+ * badExtResource for a bad header or CantDecompress for an unknown dcmp
+ * or a stream that does not decode to exactly unpackedSize bytes. */
+OSErr RD_Decompress(const UInt8* data, UInt32 size, UInt8* dst, UInt32 dstSize);
+
+/* Boot-time round trip and throughput benchmark (DCMP_BENCH=1) */
+void DcmpBench_Run(void);
+
+#endif /* RESOURCE_DECOMPRESS_H */
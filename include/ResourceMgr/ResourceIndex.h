@@ -0,0 +1,35 @@
+/*
+ * ResourceIndex.h - Per-file lookup index over a resource map
+ *
+ * Built once when a resource file is opened: the map's types, its
+ * (type, ID) pairs and its named resources, read out of the big-endian
+ * map into host-endian arrays sorted for binary search.  Lookups return
+ * map offsets of the original TypeListEntry / RefListEntry, so the map
+ * stays the one place the runtime state (handles) is kept.
+ */
+
+#ifndef RESOURCE_INDEX_H
+#define RESOURCE_INDEX_H
+
+#include "SystemTypes.h"
+
+typedef struct ResIndex ResIndex;
+
+/* Index a map of mapSize bytes; NULL if it is malformed or memory is short.
+ * Only the first type list entry of a type is indexed, as a linear walk of
+ * the map would only ever find that one. */
+ResIndex* RI_Build(const UInt8* map, UInt32 mapSize);
+void RI_Dispose(ResIndex* idx);
+
+/* Map offset of the TypeListEntry for type, or 0 */
+UInt32 RI_FindType(const ResIndex* idx, ResType type);
+
+/* Map offset of the RefListEntry for (type, id), or 0 */
+UInt32 RI_FindResource(const ResIndex* idx, ResType type, ResID id);
+
+/* Map offset of the RefListEntry of type named name (exact match), or 0 */
+UInt32 RI_FindNamed(const ResIndex* idx, const UInt8* map, ResType type, ConstStr255Param name);
+
+UInt32 RI_CountResources(const ResIndex* idx);
+
+#endif /* RESOURCE_INDEX_H */
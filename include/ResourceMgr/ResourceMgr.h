@@ -77,4 +77,14 @@ SInt16 Count1Types(void);
 SInt16 UniqueID(ResType theType);
 SInt16 Unique1ID(ResType theType);
 
+/* Load every resource of theType in resource file refNum that isn't loaded
+ * yet, reading them from disk in as few transfers as possible */
+void PreloadResources(SInt16 refNum, ResType theType);
+
+/* Loaded-resource cache: handles held, their resident bytes, lookups */
+void GetResourceCacheStats(size_t* entries, size_t* totalSize, size_t* hits, size_t* misses);
+
+/* Boot-time resource file open benchmark (RES_BENCH=1) */
+void ResBench_Run(void);
+
 #endif /* RESOURCE_MGR_H */
\ No newline at end of file
@@ -8,6 +8,7 @@
 #define RESOURCE_MGR_PRIV_H
 
 #include "SystemTypes.h"
+#include "ResourceMgr/ResourceIndex.h"
 
 /* Maximum number of open resource files */
 #define MAX_RES_FILES 16
@@ -59,15 +60,27 @@ typedef struct ResourceDataEntry {
     /* Followed by actual resource data */
 } ResourceDataEntry;
 
-/* Resource file control block */
+/* Resource file control block
+ *
+ * A file opened from disk keeps only its map in memory (mapHandle) and its
+ * fork open (forkRef); resource data is read from the fork when loaded.
+ * The built-in System resources are the read-only image linked into the
+ * kernel (data, rom): their map is copied to the heap and their handles
+ * point into the image.  Either way the map gets an index for lookups
+ * when it is opened. */
 typedef struct ResFile {
     Boolean     inUse;          /* Slot is in use */
     SInt16      refNum;         /* File reference number */
-    UInt8*      data;           /* Memory-mapped resource fork or buffer */
+    UInt8*      data;           /* Whole resource fork in memory, or NULL */
     UInt32      dataSize;       /* Size of resource fork */
     ResMapHeader* map;          /* Pointer to resource map in memory */
     UInt32      mapSize;        /* Size of resource map */
     Handle      mapHandle;      /* Handle to map if loaded separately */
+    UInt32      dataBase;       /* Fork offset of the resource data section */
+    Boolean     forkOpen;       /* forkRef is open and backs the data */
+    FileRefNum  forkRef;        /* Open resource fork */
+    ResIndex*   index;          /* Sorted map lookups, or NULL to walk the map */
+    Boolean     rom;            /* data is the built-in image, used in place */
     Str255      fileName;       /* File name for debugging */
 } ResFile;
 
@@ -89,7 +102,23 @@ RefListEntry* ResMap_FindNamedResource(ResFile* file, ResType type, ConstStr255P
 OSErr ResFile_Open(const char* path, SInt16* refNum);
 void ResFile_Close(SInt16 refNum);
 OSErr ResFile_ReadAt(ResFile* file, UInt32 offset, void* dst, UInt32 size);
-Handle ResFile_LoadResource(ResFile* file, RefListEntry* ref);
+Handle ResFile_LoadResource(ResFile* file, RefListEntry* ref, ResType type);
+
+/* One resource of a batched load; offset is filled in by ResFile_LoadBatch */
+typedef struct {
+    RefListEntry* ref;
+    ResType       type;
+    UInt32        offset;
+} ResBatchItem;
+
+void ResFile_LoadBatch(ResFile* file, ResBatchItem* items, UInt32 count);
+
+/* Prefetch hooks (ResourcePrefetch.c): a resource was loaded; a file was opened */
+void RP_Record(const ResFile* file, ResType type, ResID id);
+void RP_FileOpened(ResFile* file);
+
+/* Whether files opened from now on get a ResIndex (on by default) */
+void ResMap_SetIndexing(Boolean on);
 
 /* Byte swapping for big-endian data */
 UInt16 read_be16(const UInt8* p);
@@ -0,0 +1,52 @@
+/*
+ * ResourcePrefetch.h - Recorded resource loads replayed as batched reads
+ *
+ * While recording, every resource loaded from a file on disk is noted as
+ * (file name, type, ID) in load order.  The result is a compact manifest
+ * that can be saved to a file.  A manifest armed with RP_SetManifest is
+ * replayed file by file as each file is opened: the file's recorded
+ * resources are loaded at once, sorted by fork offset, in as few reads as
+ * ResFile_LoadBatch can manage, so the GetResource calls that follow find
+ * them in the cache.
+ *
+ * Manifest layout (big-endian): 'RPMF', version, file count, item count;
+ * the file names as Pascal strings; then 8-byte items of file index, ID
+ * and type.
+ */
+
+#ifndef RESOURCE_PREFETCH_H
+#define RESOURCE_PREFETCH_H
+
+#include "SystemTypes.h"
+
+#define RP_SIGNATURE    0x52504D46u     /* 'RPMF' */
+#define RP_VERSION      1
+#define RP_MAX_FILES    16
+#define RP_MAX_ITEMS    1024
+
+typedef struct {
+    UInt32 recorded;        /* Items in the last recording */
+    UInt32 filesReplayed;   /* Opened files the manifest named */
+    UInt32 prefetched;      /* Resources loaded by replay */
+} ResPrefetchStats;
+
+/* Start noting loads; a recording already running is restarted */
+OSErr RP_BeginRecording(void);
+
+/* Stop and return the manifest, or NULL if nothing was recorded */
+Handle RP_EndRecording(void);
+
+/* Replay manifest for each file opened from now on (NULL disarms).  The
+ * manifest becomes the Resource Manager's; a previous one is disposed. */
+void RP_SetManifest(Handle manifest);
+
+/* Arm manifest like RP_SetManifest but hand back the previous one, still
+ * the caller's to re-arm or dispose */
+Handle RP_SwapManifest(Handle manifest);
+
+OSErr RP_SaveManifest(Handle manifest, ConstStr255Param fileName);
+Handle RP_LoadManifest(ConstStr255Param fileName);
+
+void RP_GetStats(ResPrefetchStats* stats);
+
+#endif /* RESOURCE_PREFETCH_H */
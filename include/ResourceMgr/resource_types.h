@@ -45,6 +45,7 @@
 #define resProtected    (1 << 3)  /* 8 - Resource is protected */
 #define resPreload      (1 << 2)  /* 4 - Preload resource */
 #define resChanged      (1 << 1)  /* 2 - Resource changed */
+#define resCompressed   (1 << 0)  /* 1 - Data is 'dcmp' compressed */
 
 /* Error Codes */
 /* noErr is defined in MacTypes.h */
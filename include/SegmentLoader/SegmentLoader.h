@@ -138,6 +138,11 @@ typedef struct SegmentLoaderContext {
 
     Boolean initialized;           /* Loader initialized */
     UInt32 launchTime;             /* Launch timestamp */
+#ifdef RES_PREFETCH
+    Boolean recordingLaunch;       /* No manifest yet; recording this launch */
+    UInt32 launchStartUs;          /* Microseconds at SegmentLoader_OpenAppFile */
+    Str255 manifestName;           /* "<app> Prefetch" */
+#endif
 } SegmentLoaderContext;
 
 /*
@@ -176,6 +181,21 @@ OSErr SegmentLoader_Cleanup(SegmentLoaderContext* ctx);
  */
 OSErr EnsureEntrySegmentsLoaded(SegmentLoaderContext* ctx);
 
+/*
+ * SegmentLoader_OpenAppFile - Open the application's resource fork
+ *
+ * Opens appName on the default volume and makes it the current resource
+ * file, so CODE and the application's other resources come from it.  The
+ * file is closed by SegmentLoader_Cleanup.  With RES_PREFETCH, the loads
+ * up to the end of EnsureEntrySegmentsLoaded are replayed from the
+ * application's manifest, or recorded into one on its first launch.
+ *
+ * @param ctx               Segment loader context
+ * @param appName           Application file name (Pascal string)
+ * @return                  OSErr; resFNotFound leaves the chain as it was
+ */
+OSErr SegmentLoader_OpenAppFile(SegmentLoaderContext* ctx, ConstStr255Param appName);
+
 /*
  * LoadSegment - Load CODE segment on demand
  *
@@ -28,6 +28,9 @@ uint64_t PlatformCounterNow(void);
 /* Classic trap */
 void Microseconds(UnsignedWide *microTickCount);
 
+/* Low word of Microseconds(), for timing intervals */
+UInt32 MicrosecondsNow(void);
+
 /* Conversions */
 OSErr AbsoluteToNanoseconds(UnsignedWide absolute, UnsignedWide *duration);
 OSErr NanosecondsToAbsolute(UnsignedWide duration, UnsignedWide *absolute);
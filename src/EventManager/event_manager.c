@@ -15,6 +15,7 @@
 #include "../../include/EventManager/EventTypes.h"
 #include "../../include/EventManager/EventManager.h"
 #include "../../include/ProcessMgr/ProcessMgr.h"
+#include "../../include/FileMgr/fs_queue.h"
 #include "../../include/QuickDraw/QDRegions.h"
 #include "EventManager/EventLogging.h"
 
@@ -305,7 +306,9 @@ Boolean WaitNextEvent(short eventMask, EventRecord* theEvent, UInt32 sleep, RgnH
         return true;
     }
 
-    /* Cooperative yield - give other processes a chance to run */
+    /* Cooperative yield - let queued async file I/O run and give other
+     * processes a chance to run */
+    FSQueue_Service(4, 1000);
     if (gMultiFinderActive) {
         OSErr err = Scheduler_GetNextProcess(&nextProcess);
         if (err == noErr && nextProcess != gCurrentProcess) {
@@ -337,6 +340,7 @@ Boolean WaitNextEvent(short eventMask, EventRecord* theEvent, UInt32 sleep, RgnH
         }
 
         /* Yield to other processes during wait */
+        FSQueue_Service(4, 1000);
         if (gMultiFinderActive) {
             Scheduler_GetNextProcess(&nextProcess);
             if (nextProcess != gCurrentProcess) {
@@ -0,0 +1,164 @@
+/*
+ * HFSBCacheSmoke.c - HFS block buffer cache smoke test
+ *
+ * Attaches a 512KB in-memory block device to the block cache and checks,
+ * through HFS_BD_Read/HFS_BD_Write:
+ * - Partial-sector writes stay in the cache until HFS_BD_Flush
+ * - Re-reads are served from the cache
+ * - Sequential reads pull in a read-ahead window that later reads hit
+ * - Large aligned transfers go direct and see/refresh cached blocks
+ * - Evicting dirty blocks writes them back intact
+ * - Detaching flushes what is left
+ *
+ * Activated with HFS_BCACHE_SMOKE_TEST=1; called from main.c.
+ */
+
+#include "SystemTypes.h"
+#include "System71StdLib.h"
+#include "FS/hfs_diskio.h"
+#include "FS/hfs_bcache.h"
+#include "FS/FSLogging.h"
+#include <string.h>
+
+#ifdef HFS_BCACHE_SMOKE_TEST
+
+#define BC_SMOKE_LOG(fmt, ...) serial_logf(kLogModuleFileSystem, kLogLevelInfo, "[BCACHE SMOKE] " fmt, ##__VA_ARGS__)
+
+#define SMOKE_SECTORS   1024u
+#define SMOKE_SIZE      (SMOKE_SECTORS * 512u)
+
+static uint8_t gSmokeDisk[SMOKE_SIZE] __attribute__((aligned(16)));
+static uint8_t gSmokeBuf[64 * 512];
+static int gFailures;
+
+static void check(bool cond, const char* what) {
+    if (cond) {
+        BC_SMOKE_LOG("PASS: %s\n", what);
+    } else {
+        BC_SMOKE_LOG("FAIL: %s\n", what);
+        gFailures++;
+    }
+}
+
+static uint8_t pattern(uint32_t offset) {
+    return (uint8_t)((offset * 7u) ^ (offset >> 9));
+}
+
+static bool matches_pattern(const uint8_t* p, uint32_t offset, uint32_t length) {
+    for (uint32_t i = 0; i < length; i++) {
+        if (p[i] != pattern(offset + i)) return false;
+    }
+    return true;
+}
+
+void HFSBCacheSmoke_Run(void) {
+    HFS_BlockDev bd;
+    HFS_BCacheStats before, after;
+
+    BC_SMOKE_LOG("Starting block cache smoke test\n");
+    gFailures = 0;
+
+    for (uint32_t i = 0; i < SMOKE_SIZE; i++) {
+        gSmokeDisk[i] = pattern(i);
+    }
+
+    memset(&bd, 0, sizeof(bd));
+    bd.type = HFS_BD_TYPE_MEMORY;
+    bd.data = gSmokeDisk;
+    bd.size = SMOKE_SIZE;
+    bd.sectorSize = 512;
+    bd.device_index = -1;
+    bd.cacheId = HFS_BC_Attach(&bd);
+    check(bd.cacheId != 0, "attach memory device");
+    if (!bd.cacheId) return;
+
+    /* Write-back: a write straddling two sectors stays cached until flush */
+    uint8_t ones[100];
+    memset(ones, 0x11, sizeof(ones));
+    check(HFS_BD_Write(&bd, 1000, ones, sizeof(ones)), "partial write");
+    check(gSmokeDisk[1000] == pattern(1000), "write not on device before flush");
+    check(HFS_BD_Read(&bd, 990, gSmokeBuf, 120) &&
+          matches_pattern(gSmokeBuf, 990, 10) &&
+          gSmokeBuf[10] == 0x11 && gSmokeBuf[109] == 0x11 &&
+          matches_pattern(gSmokeBuf + 110, 1100, 10),
+          "read sees cached write");
+    check(HFS_BD_Flush(&bd) && gSmokeDisk[1000] == 0x11 && gSmokeDisk[1099] == 0x11 &&
+          gSmokeDisk[999] == pattern(999) && gSmokeDisk[1100] == pattern(1100),
+          "flush writes back");
+
+    /* Hits */
+    HFS_BC_GetStats(&before);
+    HFS_BD_Read(&bd, 10 * 512 + 3, gSmokeBuf, 200);
+    HFS_BD_Read(&bd, 10 * 512 + 3, gSmokeBuf, 200);
+    HFS_BC_GetStats(&after);
+    check(after.hits > before.hits && matches_pattern(gSmokeBuf, 10 * 512 + 3, 200),
+          "re-read served from cache");
+
+    /* Sequential read-ahead */
+    HFS_BC_GetStats(&before);
+    bool seqOk = true;
+    for (uint32_t s = 200; s < 260; s++) {
+        if (!HFS_BD_Read(&bd, s * 512, gSmokeBuf, 512) || !matches_pattern(gSmokeBuf, s * 512, 512)) {
+            seqOk = false;
+        }
+    }
+    HFS_BC_GetStats(&after);
+    check(seqOk, "sequential reads correct");
+    check(after.readAhead > before.readAhead && after.readAheadHits > before.readAheadHits &&
+          after.misses - before.misses < 8,
+          "sequential reads served by read-ahead");
+    BC_SMOKE_LOG("60 sequential sectors: %u misses, %u read ahead, %u read-ahead hits\n",
+                 after.misses - before.misses, after.readAhead - before.readAhead,
+                 after.readAheadHits - before.readAheadHits);
+
+    /* Direct reads overlay dirty cached blocks */
+    memset(ones, 0x22, sizeof(ones));
+    HFS_BD_Write(&bd, 600 * 512 + 50, ones, sizeof(ones));
+    HFS_BC_GetStats(&before);
+    check(HFS_BD_Read(&bd, 576 * 512, gSmokeBuf, 64 * 512), "direct read");
+    HFS_BC_GetStats(&after);
+    check(after.directReads - before.directReads == 64, "aligned 32KB read bypasses pool");
+    check(matches_pattern(gSmokeBuf, 576 * 512, 24 * 512 + 50) &&
+          gSmokeBuf[24 * 512 + 50] == 0x22 && gSmokeBuf[24 * 512 + 149] == 0x22 &&
+          matches_pattern(gSmokeBuf + 24 * 512 + 150, 600 * 512 + 150, 40 * 512 - 150),
+          "direct read sees dirty cached sector");
+
+    /* Direct writes refresh cached blocks */
+    memset(gSmokeBuf, 0x33, 64 * 512);
+    check(HFS_BD_Write(&bd, 576 * 512, gSmokeBuf, 64 * 512), "direct write");
+    check(gSmokeDisk[600 * 512 + 50] == 0x33, "direct write reaches device");
+    HFS_BD_Read(&bd, 600 * 512 + 40, gSmokeBuf, 20);
+    check(gSmokeBuf[0] == 0x33 && gSmokeBuf[19] == 0x33, "cached copy refreshed by direct write");
+    check(HFS_BD_Flush(&bd) && gSmokeDisk[600 * 512 + 50] == 0x33,
+          "flush does not resurrect stale data");
+
+    /* Dirty eviction: more dirty sectors than the pool holds */
+    HFS_BC_GetStats(&before);
+    for (uint32_t s = 0; s < HFS_BCACHE_BLOCKS + 64; s++) {
+        uint8_t stamp[4] = { 0xA5, (uint8_t)s, (uint8_t)(s >> 8), 0x5A };
+        HFS_BD_Write(&bd, (640 + s) * 512 + 8, stamp, sizeof(stamp));
+    }
+    HFS_BC_GetStats(&after);
+    check(after.evictions > before.evictions && after.writebacks > before.writebacks,
+          "pool overflow evicts and writes back");
+
+    HFS_BC_Detach(bd.cacheId);
+    bd.cacheId = 0;
+    bool evictOk = true;
+    for (uint32_t s = 0; s < HFS_BCACHE_BLOCKS + 64; s++) {
+        const uint8_t* p = gSmokeDisk + (640 + s) * 512;
+        if (p[8] != 0xA5 || p[9] != (uint8_t)s || p[10] != (uint8_t)(s >> 8) || p[11] != 0x5A ||
+            !matches_pattern(p, (640 + s) * 512, 8)) {
+            evictOk = false;
+        }
+    }
+    check(evictOk, "evicted and detached sectors written intact");
+
+    HFS_BC_GetStats(&after);
+    BC_SMOKE_LOG("Totals: hits=%u misses=%u readAhead=%u raHits=%u direct=%u/%u writebacks=%u evictions=%u\n",
+                 after.hits, after.misses, after.readAhead, after.readAheadHits,
+                 after.directReads, after.directWrites, after.writebacks, after.evictions);
+    BC_SMOKE_LOG("%s (%d failures)\n", gFailures ? "FAILED" : "PASSED", gFailures);
+}
+
+#endif /* HFS_BCACHE_SMOKE_TEST */
@@ -0,0 +1,562 @@
+/*
+ * HFSBench.c - HFS catalog lookup benchmark
+ *
+ * Builds an in-memory HFS volume whose catalog holds 5 folders of 10000
+ * files each, every item with a thread record, using 512-byte nodes and
+ * padded keys the way the Mac OS lays them out.  It then times name
+ * lookups and by-ID resolution through the B-tree index against a full
+ * leaf scan, and enumeration of one 10000-entry folder through a catalog
+ * cursor against the old whole-tree walk, and reports over serial.
+ *
+ * Activated with HFS_BENCH=1 compile flag; called from main.c once the
+ * Memory Manager is up.  The image lives in a 12MB static buffer, so only
+ * benchmark builds pay for it.
+ */
+
+#include "SystemTypes.h"
+#include "System71StdLib.h"
+#include "FS/hfs_volume.h"
+#include "FS/hfs_catalog.h"
+#include "FS/hfs_nodecache.h"
+#include "FS/hfs_endian.h"
+#include "FS/FSLogging.h"
+#include "TimeManager/TimeBase.h"
+#include <string.h>
+
+#ifdef HFS_BENCH
+
+#define HFS_BENCH_LOG(fmt, ...) serial_logf(kLogModuleFileSystem, kLogLevelInfo, "[HFS BENCH] " fmt, ##__VA_ARGS__)
+
+#define BENCH_FOLDERS           5u
+#define BENCH_FILES_PER_FOLDER  10000u
+#define BENCH_FILES             (BENCH_FOLDERS * BENCH_FILES_PER_FOLDER)
+#define BENCH_FIRST_FOLDER      HFS_FIRST_CNID
+#define BENCH_FIRST_FILE        (BENCH_FIRST_FOLDER + BENCH_FOLDERS)
+
+#define BENCH_IMAGE_SIZE        (12u * 1024u * 1024u)
+#define BENCH_NODE_SIZE         512u
+#define BENCH_VBM_START         3u      /* Bitmap follows the MDB */
+#define BENCH_VBM_SECTORS       16u     /* 65536 allocation blocks */
+#define BENCH_AL_BL_ST          (BENCH_VBM_START + BENCH_VBM_SECTORS)
+#define BENCH_INDEX_KEY_LEN     37u     /* Catalog index keys are fixed-length */
+
+#define BENCH_LOOKUPS           2000u
+#define BENCH_SCANS             20u
+#define BENCH_HOT_NAMES         100u    /* Working set re-resolved by the name cache pass */
+#define BENCH_HOT_PASSES        20u
+#define BENCH_ENUM_BATCH        32u     /* Finder folder window batch */
+
+static uint8_t gBenchImage[BENCH_IMAGE_SIZE] __attribute__((aligned(512)));
+
+typedef struct {
+    uint8_t*  base;         /* Catalog file */
+    uint32_t  maxNodes;
+    uint32_t  nodes;        /* Nodes used, including the header */
+    uint32_t  leaf;         /* Leaf being filled, 0 before the first */
+    uint32_t  leafRecords;
+} CatBuilder;
+
+static uint8_t* node_at(CatBuilder* b, uint32_t nodeNum) {
+    return b->base + nodeNum * BENCH_NODE_SIZE;
+}
+
+/* Offset table slot i, counted back from the end of the node */
+static uint8_t* node_slot(uint8_t* node, uint16_t i) {
+    return node + BENCH_NODE_SIZE - 2 - 2 * i;
+}
+
+static uint32_t new_node(CatBuilder* b, uint8_t kind, uint8_t height) {
+    if (b->nodes >= b->maxNodes) return 0;
+
+    uint32_t nodeNum = b->nodes++;
+    uint8_t* node = node_at(b, nodeNum);
+    memset(node, 0, BENCH_NODE_SIZE);
+
+    HFS_BTNodeDesc* desc = (HFS_BTNodeDesc*)node;
+    desc->kind = kind;
+    desc->height = height;
+    be16_write(node_slot(node, 0), sizeof(HFS_BTNodeDesc));  /* Free space offset */
+    return nodeNum;
+}
+
+/* Append a record, keeping the free space offset after the last one */
+static bool node_append(uint8_t* node, const uint8_t* rec, uint16_t len) {
+    HFS_BTNodeDesc* desc = (HFS_BTNodeDesc*)node;
+    uint16_t n = be16_read(&desc->numRecords);
+    uint16_t freeOff = be16_read(node_slot(node, n));
+
+    if (freeOff + len + 2u * (n + 2u) > BENCH_NODE_SIZE) return false;
+
+    memcpy(node + freeOff, rec, len);
+    be16_write(node_slot(node, n + 1), (uint16_t)(freeOff + len));
+    be16_write(&desc->numRecords, (uint16_t)(n + 1));
+    return true;
+}
+
+static bool link_new_node(CatBuilder* b, uint32_t* current, uint8_t kind, uint8_t height) {
+    uint32_t next = new_node(b, kind, height);
+    if (!next) return false;
+
+    if (*current) {
+        be32_write(&((HFS_BTNodeDesc*)node_at(b, *current))->fLink, next);
+        be32_write(&((HFS_BTNodeDesc*)node_at(b, next))->bLink, *current);
+    }
+    *current = next;
+    return true;
+}
+
+/* Leaf records are added in key order; a full leaf starts the next one */
+static bool leaf_add(CatBuilder* b, const uint8_t* rec, uint16_t len) {
+    if (!b->leaf || !node_append(node_at(b, b->leaf), rec, len)) {
+        if (!link_new_node(b, &b->leaf, kBTLeafNode, 1) ||
+            !node_append(node_at(b, b->leaf), rec, len)) {
+            return false;
+        }
+    }
+    b->leafRecords++;
+    return true;
+}
+
+/* Key, pad byte to a word boundary, then data */
+static uint16_t make_record(uint8_t* rec, uint32_t parentID, const char* name,
+                            const void* data, uint16_t dataLen) {
+    uint8_t nameLen = (uint8_t)strlen(name);
+
+    rec[0] = (uint8_t)(6 + nameLen);
+    rec[1] = 0;
+    be32_write(rec + 2, parentID);
+    rec[6] = nameLen;
+    memcpy(rec + 7, name, nameLen);
+
+    uint16_t off = (uint16_t)((1 + rec[0] + 1) & ~1);
+    if (off > 1 + rec[0]) rec[off - 1] = 0;
+    memcpy(rec + off, data, dataLen);
+    return (uint16_t)(off + dataLen);
+}
+
+static bool add_folder(CatBuilder* b, uint32_t parentID, const char* name,
+                       uint32_t cnid, uint16_t valence) {
+    HFS_CatFolderRec folder;
+    uint8_t rec[64 + sizeof(folder)];
+
+    memset(&folder, 0, sizeof(folder));
+    be16_write(&folder.recordType, kHFS_FolderRecord);
+    be16_write(&folder.valence, valence);
+    be32_write(&folder.folderID, cnid);
+    return leaf_add(b, rec, make_record(rec, parentID, name, &folder, sizeof(folder)));
+}
+
+static bool add_file(CatBuilder* b, uint32_t parentID, const char* name, uint32_t cnid) {
+    HFS_CatFileRec file;
+    uint8_t rec[64 + sizeof(file)];
+
+    memset(&file, 0, sizeof(file));
+    be16_write(&file.recordType, kHFS_FileRecord);
+    be32_write(&file.fileID, cnid);
+    be32_write(&file.finderInfo[0], 0x54455854);  /* 'TEXT' */
+    be32_write(&file.finderInfo[4], 0x74747874);  /* 'ttxt' */
+    return leaf_add(b, rec, make_record(rec, parentID, name, &file, sizeof(file)));
+}
+
+static bool add_thread(CatBuilder* b, uint16_t recordType, uint32_t cnid,
+                       uint32_t parentID, const char* name) {
+    HFS_CatThreadRec thread;
+    uint8_t rec[64 + sizeof(thread)];
+
+    memset(&thread, 0, sizeof(thread));
+    be16_write(&thread.recordType, recordType);
+    be32_write(&thread.parentID, parentID);
+    thread.nameLength = (uint8_t)strlen(name);
+    memcpy(thread.name, name, thread.nameLength);
+    return leaf_add(b, rec, make_record(rec, cnid, "", &thread, sizeof(thread)));
+}
+
+static void folder_name(char* buf, uint32_t folder) {
+    snprintf(buf, 32, "Folder %02u", folder);
+}
+
+static void file_name(char* buf, uint32_t file) {
+    snprintf(buf, 32, "File %04u", file);
+}
+
+/*
+ * Index levels over a run of consecutive nodes: one record per child
+ * holding the child's first key, padded to the fixed index key length,
+ * and the child's node number.  Returns the root.
+ */
+static uint32_t build_index(CatBuilder* b, uint32_t first, uint32_t count, uint16_t* depth) {
+    uint8_t height = 1;
+
+    while (count > 1) {
+        uint32_t levelFirst = b->nodes;
+        uint32_t current = 0;
+        height++;
+
+        for (uint32_t i = 0; i < count; i++) {
+            uint8_t* child = node_at(b, first + i);
+            const uint8_t* childKey = child + be16_read(node_slot(child, 0));
+            uint8_t rec[1 + BENCH_INDEX_KEY_LEN + 4];
+
+            memset(rec, 0, sizeof(rec));
+            memcpy(rec, childKey, 1u + childKey[0]);
+            rec[0] = BENCH_INDEX_KEY_LEN;
+            be32_write(rec + 1 + BENCH_INDEX_KEY_LEN, first + i);
+
+            if (!current || !node_append(node_at(b, current), rec, sizeof(rec))) {
+                if (!link_new_node(b, &current, kBTIndexNode, height) ||
+                    !node_append(node_at(b, current), rec, sizeof(rec))) {
+                    return 0;
+                }
+            }
+        }
+
+        count = current - levelFirst + 1;
+        first = levelFirst;
+    }
+
+    *depth = height;
+    return first;
+}
+
+static void write_header_node(uint8_t* node, uint16_t depth, uint32_t root,
+                              uint32_t leafRecords, uint32_t firstLeaf,
+                              uint32_t lastLeaf, uint32_t totalNodes) {
+    memset(node, 0, BENCH_NODE_SIZE);
+    HFS_BTNodeDesc* desc = (HFS_BTNodeDesc*)node;
+    desc->kind = kBTHeaderNode;
+    be16_write(&desc->numRecords, 3);
+
+    HFS_BTHeaderRec* hdr = (HFS_BTHeaderRec*)(node + sizeof(HFS_BTNodeDesc));
+    be16_write(&hdr->depth, depth);
+    be32_write(&hdr->rootNode, root);
+    be32_write(&hdr->leafRecords, leafRecords);
+    be32_write(&hdr->firstLeafNode, firstLeaf);
+    be32_write(&hdr->lastLeafNode, lastLeaf);
+    be16_write(&hdr->nodeSize, BENCH_NODE_SIZE);
+    be16_write(&hdr->keyCompareType, BENCH_INDEX_KEY_LEN);
+    be32_write(&hdr->totalNodes, totalNodes);
+
+    /* Header, user data and map records */
+    be16_write(node_slot(node, 0), 14);
+    be16_write(node_slot(node, 1), 120);
+    be16_write(node_slot(node, 2), 248);
+    be16_write(node_slot(node, 3), 504);
+}
+
+/* Lay out MDB, bitmap, a one-node extents tree and the catalog */
+static bool build_volume(void) {
+    uint8_t* img = gBenchImage;
+    uint32_t numAlBlks = BENCH_IMAGE_SIZE / 512 - BENCH_AL_BL_ST - 2;
+    char name[32];
+
+    memset(img, 0, BENCH_IMAGE_SIZE);
+
+    /* Extents tree in block 0, catalog from block 1 */
+    write_header_node(img + BENCH_AL_BL_ST * 512, 0, 0, 0, 0, 0, 1);
+
+    CatBuilder b = {
+        .base = img + (BENCH_AL_BL_ST + 1) * 512,
+        .maxNodes = numAlBlks - 1,
+        .nodes = 1
+    };
+
+    /* Root folder and its thread, then the folders in root */
+    bool ok = add_folder(&b, HFS_ROOT_PARENT_CNID, "Bench", 2, BENCH_FOLDERS) &&
+              add_thread(&b, kHFS_FolderThreadRecord, 2, HFS_ROOT_PARENT_CNID, "Bench");
+    for (uint32_t f = 0; ok && f < BENCH_FOLDERS; f++) {
+        folder_name(name, f);
+        ok = add_folder(&b, 2, name, BENCH_FIRST_FOLDER + f, BENCH_FILES_PER_FOLDER);
+    }
+
+    /* Each folder: its thread (empty name sorts first), then its files */
+    for (uint32_t f = 0; ok && f < BENCH_FOLDERS; f++) {
+        folder_name(name, f);
+        ok = add_thread(&b, kHFS_FolderThreadRecord, BENCH_FIRST_FOLDER + f, 2, name);
+        for (uint32_t i = 0; ok && i < BENCH_FILES_PER_FOLDER; i++) {
+            file_name(name, i);
+            ok = add_file(&b, BENCH_FIRST_FOLDER + f, name,
+                          BENCH_FIRST_FILE + f * BENCH_FILES_PER_FOLDER + i);
+        }
+    }
+
+    /* File threads: keyed by file CNID, which sorts after every folder */
+    for (uint32_t id = 0; ok && id < BENCH_FILES; id++) {
+        file_name(name, id % BENCH_FILES_PER_FOLDER);
+        ok = add_thread(&b, kHFS_FileThreadRecord, BENCH_FIRST_FILE + id,
+                        BENCH_FIRST_FOLDER + id / BENCH_FILES_PER_FOLDER, name);
+    }
+    if (!ok) return false;
+
+    uint32_t lastLeaf = b.leaf;
+    uint16_t depth = 0;
+    uint32_t root = build_index(&b, 1, lastLeaf, &depth);
+    if (!root) return false;
+
+    write_header_node(b.base, depth, root, b.leafRecords, 1, lastLeaf, b.nodes);
+
+    /* Allocation bitmap: extents block plus the catalog */
+    uint32_t used = 1 + b.nodes;
+    for (uint32_t i = 0; i < used; i++) {
+        img[BENCH_VBM_START * 512 + i / 8] |= (uint8_t)(0x80 >> (i % 8));
+    }
+
+    uint8_t* mdb = img + HFS_MDB_SECTOR * 512;
+    be16_write(mdb + 0, HFS_SIGNATURE);
+    be16_write(mdb + 16, BENCH_VBM_START);
+    be16_write(mdb + 20, (uint16_t)numAlBlks);
+    be32_write(mdb + 22, 512);
+    be32_write(mdb + 26, 4 * 512);
+    be16_write(mdb + 30, BENCH_AL_BL_ST);
+    be32_write(mdb + 32, BENCH_FIRST_FILE + BENCH_FILES);
+    be16_write(mdb + 36, (uint16_t)(numAlBlks - used));
+    mdb[38] = 5;
+    memcpy(mdb + 39, "Bench", 5);
+    be32_write(mdb + 86, BENCH_FILES);
+    be32_write(mdb + 90, BENCH_FOLDERS);
+    be32_write(mdb + 126, BENCH_NODE_SIZE);
+    be16_write(mdb + 130, 0);
+    be16_write(mdb + 132, 1);
+    be32_write(mdb + 142, b.nodes * BENCH_NODE_SIZE);
+    be16_write(mdb + 146, 1);
+    be16_write(mdb + 148, (uint16_t)b.nodes);
+
+    HFS_BENCH_LOG("built catalog: %u nodes (%u leaves), depth %u, %u leaf records\n",
+                  b.nodes, lastLeaf, depth, b.leafRecords);
+    return true;
+}
+
+/* Scan baseline: the leaf walk every lookup used to pay for */
+typedef struct {
+    const HFS_CatKey* key;
+    bool found;
+} ScanContext;
+
+static bool scan_callback(void* keyPtr, uint16_t keyLen, void* dataPtr,
+                          uint16_t dataLen, void* context) {
+    ScanContext* ctx = (ScanContext*)context;
+    if (HFS_CompareCatalogKeys(keyPtr, ctx->key) != 0) return true;
+    ctx->found = true;
+    return false;
+}
+
+static uint32_t bench_rand(uint32_t* seed) {
+    *seed = *seed * 1664525u + 1013904223u;
+    return *seed >> 8;
+}
+
+static void bench_lookup(HFS_Catalog* cat) {
+    char name[32];
+    uint32_t seed = 0x2545F491u;
+    uint32_t misses = 0;
+    uint32_t reads = cat->bt.nodeReads;
+    UInt32 start = MicrosecondsNow();
+
+    for (uint32_t i = 0; i < BENCH_LOOKUPS; i++) {
+        uint32_t id = bench_rand(&seed) % BENCH_FILES;
+        CatEntry entry;
+
+        file_name(name, id % BENCH_FILES_PER_FOLDER);
+        if (!HFS_CatalogLookup(cat, BENCH_FIRST_FOLDER + id / BENCH_FILES_PER_FOLDER, name, &entry) ||
+            entry.id != BENCH_FIRST_FILE + id) {
+            misses++;
+        }
+    }
+
+    UInt32 elapsed = MicrosecondsNow() - start;
+    reads = cat->bt.nodeReads - reads;
+    HFS_BENCH_LOG("HFS_CatalogLookup x%u: %u us, %u node reads (%u per lookup), %u wrong\n",
+                  BENCH_LOOKUPS, elapsed, reads, reads / BENCH_LOOKUPS, misses);
+
+    /* Names that aren't there must fail just as cheaply */
+    reads = cat->bt.nodeReads;
+    start = MicrosecondsNow();
+    for (uint32_t i = 0; i < BENCH_LOOKUPS; i++) {
+        CatEntry entry;
+        snprintf(name, sizeof(name), "Missing %04u", bench_rand(&seed) % 10000u);
+        if (HFS_CatalogLookup(cat, BENCH_FIRST_FOLDER + bench_rand(&seed) % BENCH_FOLDERS,
+                              name, &entry)) {
+            misses++;
+        }
+    }
+    elapsed = MicrosecondsNow() - start;
+    reads = cat->bt.nodeReads - reads;
+    HFS_BENCH_LOG("HFS_CatalogLookup (absent) x%u: %u us, %u node reads\n",
+                  BENCH_LOOKUPS, elapsed, reads);
+}
+
+/* The same few names resolved over and over, as repeated OpenResFile and
+ * Standard File path lookups do: after the first pass the name cache
+ * answers without touching the B-tree */
+static void bench_hot_names(HFS_Catalog* cat) {
+    char name[32];
+    uint32_t wrong = 0;
+    uint32_t reads = cat->bt.nodeReads;
+    HFS_NameCacheStats before, after;
+    HFS_NM_GetStats(cat->names, &before);
+    UInt32 start = MicrosecondsNow();
+
+    for (uint32_t pass = 0; pass < BENCH_HOT_PASSES; pass++) {
+        for (uint32_t i = 0; i < BENCH_HOT_NAMES; i++) {
+            uint32_t id = i * (BENCH_FILES / BENCH_HOT_NAMES);
+            CatEntry entry;
+
+            /* Every other name in lowercase: the cache folds case */
+            file_name(name, id % BENCH_FILES_PER_FOLDER);
+            if (i & 1) name[0] = 'f';
+            if (!HFS_CatalogLookup(cat, BENCH_FIRST_FOLDER + id / BENCH_FILES_PER_FOLDER, name, &entry) ||
+                entry.id != BENCH_FIRST_FILE + id) {
+                wrong++;
+            }
+
+            snprintf(name, sizeof(name), "Missing %04u", i);
+            if (HFS_CatalogLookup(cat, BENCH_FIRST_FOLDER, name, &entry)) wrong++;
+        }
+    }
+
+    UInt32 elapsed = MicrosecondsNow() - start;
+    reads = cat->bt.nodeReads - reads;
+    HFS_NM_GetStats(cat->names, &after);
+    HFS_BENCH_LOG("hot names %u x%u (+ as many absent): %u us, %u node reads, "
+                  "%u hits, %u negative hits, %u wrong\n",
+                  BENCH_HOT_NAMES, BENCH_HOT_PASSES, elapsed, reads,
+                  after.hits - before.hits, after.negativeHits - before.negativeHits, wrong);
+}
+
+static void bench_get_by_id(HFS_Catalog* cat) {
+    uint32_t seed = 0x9E3779B9u;
+    uint32_t misses = 0;
+    uint32_t reads = cat->bt.nodeReads;
+    UInt32 start = MicrosecondsNow();
+
+    for (uint32_t i = 0; i < BENCH_LOOKUPS; i++) {
+        uint32_t id = bench_rand(&seed) % BENCH_FILES;
+        CatEntry entry;
+
+        if (!HFS_CatalogGetByID(cat, BENCH_FIRST_FILE + id, &entry) ||
+            entry.parent != BENCH_FIRST_FOLDER + id / BENCH_FILES_PER_FOLDER) {
+            misses++;
+        }
+    }
+
+    UInt32 elapsed = MicrosecondsNow() - start;
+    reads = cat->bt.nodeReads - reads;
+    HFS_BENCH_LOG("HFS_CatalogGetByID x%u: %u us, %u node reads (%u per lookup), %u wrong\n",
+                  BENCH_LOOKUPS, elapsed, reads, reads / BENCH_LOOKUPS, misses);
+}
+
+static void bench_scan(HFS_Catalog* cat) {
+    char name[32];
+    uint32_t seed = 0x2545F491u;
+    uint32_t misses = 0;
+    uint32_t reads = cat->bt.nodeReads;
+    UInt32 start = MicrosecondsNow();
+
+    for (uint32_t i = 0; i < BENCH_SCANS; i++) {
+        uint32_t id = bench_rand(&seed) % BENCH_FILES;
+        HFS_CatKey key;
+
+        file_name(name, id % BENCH_FILES_PER_FOLDER);
+        memset(&key, 0, sizeof(key));
+        key.keyLength = (uint8_t)(6 + strlen(name));
+        be32_write(&key.parentID, BENCH_FIRST_FOLDER + id / BENCH_FILES_PER_FOLDER);
+        key.nameLength = (uint8_t)strlen(name);
+        memcpy(key.name, name, key.nameLength);
+
+        ScanContext ctx = { &key, false };
+        HFS_BT_IterateLeaves(&cat->bt, scan_callback, &ctx);
+        if (!ctx.found) misses++;
+    }
+
+    UInt32 elapsed = MicrosecondsNow() - start;
+    reads = cat->bt.nodeReads - reads;
+    HFS_BENCH_LOG("leaf scan x%u: %u us, %u node reads (%u per lookup), %u missed\n",
+                  BENCH_SCANS, elapsed, reads, reads / BENCH_SCANS, misses);
+}
+
+/* Old VFS_Enumerate: walk every leaf, keeping the records in the folder */
+typedef struct {
+    uint32_t parentID;
+    uint32_t count;
+} EnumScanContext;
+
+static bool enum_scan_callback(void* keyPtr, uint16_t keyLen, void* dataPtr,
+                               uint16_t dataLen, void* context) {
+    EnumScanContext* ctx = (EnumScanContext*)context;
+    CatEntry entry;
+    if (be32_read(&((HFS_CatKey*)keyPtr)->parentID) == ctx->parentID &&
+        HFS_ParseCatalogRecord((HFS_CatKey*)keyPtr, dataPtr, dataLen, &entry)) {
+        ctx->count++;
+    }
+    return true;
+}
+
+static void bench_enumerate(HFS_Catalog* cat) {
+    static CatEntry batch[BENCH_ENUM_BATCH];
+    uint32_t folder = BENCH_FOLDERS / 2;
+    uint32_t parentID = BENCH_FIRST_FOLDER + folder;
+    uint32_t expected = BENCH_FIRST_FILE + folder * BENCH_FILES_PER_FOLDER;
+    uint32_t total = 0, batches = 0, wrong = 0, firstUs = 0;
+    uint32_t reads = cat->bt.nodeReads;
+    HFS_CatalogCursor cursor;
+    int count;
+
+    UInt32 start = MicrosecondsNow();
+    HFS_CatalogCursorInit(cat, parentID, &cursor);
+    while (HFS_CatalogCursorNext(cat, &cursor, batch, BENCH_ENUM_BATCH, &count) && count > 0) {
+        if (batches++ == 0) firstUs = MicrosecondsNow() - start;
+        for (int i = 0; i < count; i++) {
+            if (batch[i].id != expected + total + (uint32_t)i) wrong++;
+        }
+        total += (uint32_t)count;
+    }
+    UInt32 elapsed = MicrosecondsNow() - start;
+    reads = cat->bt.nodeReads - reads;
+    HFS_BENCH_LOG("cursor enumerate %u entries: %u us (first batch %u us), %u batches, "
+                  "%u leaves, %u node reads, %u out of order\n",
+                  total, elapsed, firstUs, batches, cursor.leaves, reads, wrong);
+
+    EnumScanContext ctx = { parentID, 0 };
+    reads = cat->bt.nodeReads;
+    start = MicrosecondsNow();
+    HFS_BT_IterateLeaves(&cat->bt, enum_scan_callback, &ctx);
+    elapsed = MicrosecondsNow() - start;
+    reads = cat->bt.nodeReads - reads;
+    HFS_BENCH_LOG("leaf scan enumerate %u entries: %u us, %u node reads\n",
+                  ctx.count, elapsed, reads);
+}
+
+void HFSBench_Run(void) {
+    static HFS_Volume vol;
+    static HFS_Catalog cat;
+
+    HFS_BENCH_LOG("starting (%u folders x %u files)\n", BENCH_FOLDERS, BENCH_FILES_PER_FOLDER);
+
+    if (!build_volume()) {
+        HFS_BENCH_LOG("catalog does not fit in the %u byte image\n", BENCH_IMAGE_SIZE);
+        return;
+    }
+    if (!HFS_VolumeMountMemory(&vol, gBenchImage, BENCH_IMAGE_SIZE, 0) ||
+        !HFS_CatalogInit(&cat, &vol)) {
+        HFS_BENCH_LOG("mount failed\n");
+        return;
+    }
+
+    bench_lookup(&cat);
+    bench_hot_names(&cat);
+    bench_get_by_id(&cat);
+    bench_scan(&cat);
+    bench_enumerate(&cat);
+
+    HFS_NodeCacheStats stats;
+    HFS_NC_GetStats(vol.nodeCache, &stats);
+    HFS_BENCH_LOG("node cache (%u nodes): %u hits, %u misses, %u evictions\n",
+                  HFS_NODE_CACHE_NODES, stats.hits, stats.misses, stats.evictions);
+
+    /* No HFS_VolumeUnmount: it would DisposePtr the static image */
+    HFS_CatalogClose(&cat);
+    HFS_NC_Destroy(vol.nodeCache);
+    vol.nodeCache = NULL;
+    HFS_BENCH_LOG("done\n");
+}
+
+#endif /* HFS_BENCH */
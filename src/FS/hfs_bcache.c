@@ -0,0 +1,450 @@
+/* HFS Block Buffer Cache Implementation */
+#include "../../include/FS/hfs_bcache.h"
+#include "../../include/MemoryMgr/TempMemory.h"
+#include "EventManager/EventManager.h"
+#include <string.h>
+#include "FS/FSLogging.h"
+
+#define BC_BUCKETS      (HFS_BCACHE_BLOCKS * 2)     /* Power of two */
+#define BC_NONE         (-1)
+#define BC_RUN_MAX      HFS_BCACHE_READAHEAD_MAX    /* Sectors per device transfer */
+
+typedef struct {
+    uint32_t sector;
+    uint8_t  dev;           /* cacheId */
+    bool     valid;
+    bool     dirty;
+    bool     readAhead;     /* Filled speculatively, not yet requested */
+    int16_t  hashNext;
+    int16_t  lruPrev;       /* Towards most recently used */
+    int16_t  lruNext;       /* Towards least recently used */
+} BCEntry;
+
+typedef struct {
+    bool         used;
+    uint16_t     refs;
+    HFS_BlockDev bd;        /* Private copy, used for write-back on eviction */
+    uint32_t     nextSector;/* Where a sequential reader would continue */
+    uint32_t     raWindow;
+    uint32_t     dirtySince;/* Tick of the oldest unflushed write; 0 when clean */
+} BCDevice;
+
+static uint8_t  gPool[HFS_BCACHE_BLOCKS][HFS_BCACHE_BLOCK_SIZE] __attribute__((aligned(16)));
+static BCEntry  gEntries[HFS_BCACHE_BLOCKS];
+static int16_t  gBuckets[BC_BUCKETS];
+static int16_t  gLruHead = BC_NONE;
+static int16_t  gLruTail = BC_NONE;
+static bool     gInitialized = false;
+static BCDevice gDevices[HFS_BCACHE_DEVICES];
+static HFS_BCacheStats gStats;
+
+static void bc_init(void) {
+    if (gInitialized) return;
+
+    for (int i = 0; i < BC_BUCKETS; i++) {
+        gBuckets[i] = BC_NONE;
+    }
+    for (int i = 0; i < HFS_BCACHE_BLOCKS; i++) {
+        memset(&gEntries[i], 0, sizeof(BCEntry));
+        gEntries[i].hashNext = BC_NONE;
+        gEntries[i].lruPrev = gEntries[i].lruNext = BC_NONE;
+    }
+    gLruHead = gLruTail = BC_NONE;
+    gInitialized = true;
+}
+
+static uint32_t bc_hash(uint8_t dev, uint32_t sector) {
+    return ((sector * 2654435761u) ^ dev) & (BC_BUCKETS - 1);
+}
+
+static void lru_unlink(int16_t i) {
+    BCEntry* e = &gEntries[i];
+    if (e->lruPrev != BC_NONE) gEntries[e->lruPrev].lruNext = e->lruNext;
+    else gLruHead = e->lruNext;
+    if (e->lruNext != BC_NONE) gEntries[e->lruNext].lruPrev = e->lruPrev;
+    else gLruTail = e->lruPrev;
+    e->lruPrev = e->lruNext = BC_NONE;
+}
+
+static void lru_push_front(int16_t i) {
+    BCEntry* e = &gEntries[i];
+    e->lruPrev = BC_NONE;
+    e->lruNext = gLruHead;
+    if (gLruHead != BC_NONE) gEntries[gLruHead].lruPrev = i;
+    gLruHead = i;
+    if (gLruTail == BC_NONE) gLruTail = i;
+}
+
+static void hash_remove(int16_t i) {
+    BCEntry* e = &gEntries[i];
+    int16_t* link = &gBuckets[bc_hash(e->dev, e->sector)];
+    while (*link != BC_NONE) {
+        if (*link == i) {
+            *link = e->hashNext;
+            break;
+        }
+        link = &gEntries[*link].hashNext;
+    }
+    e->hashNext = BC_NONE;
+}
+
+static int16_t lookup(uint8_t dev, uint32_t sector) {
+    for (int16_t i = gBuckets[bc_hash(dev, sector)]; i != BC_NONE; i = gEntries[i].hashNext) {
+        if (gEntries[i].sector == sector && gEntries[i].dev == dev) return i;
+    }
+    return BC_NONE;
+}
+
+static void insert(int16_t i, uint8_t dev, uint32_t sector) {
+    BCEntry* e = &gEntries[i];
+    uint32_t bucket = bc_hash(dev, sector);
+    e->dev = dev;
+    e->sector = sector;
+    e->valid = true;
+    e->dirty = false;
+    e->readAhead = false;
+    e->hashNext = gBuckets[bucket];
+    gBuckets[bucket] = i;
+    lru_push_front(i);
+}
+
+static void invalidate(int16_t i) {
+    hash_remove(i);
+    lru_unlink(i);
+    gEntries[i].valid = false;
+    gEntries[i].dirty = false;
+}
+
+static bool write_back(int16_t i) {
+    BCEntry* e = &gEntries[i];
+    if (!e->dirty) return true;
+
+    if (!HFS_BD_TransferSectors(&gDevices[e->dev - 1].bd, e->sector, 1, gPool[i], true)) {
+        FS_LOG_ERROR("HFS BCache: write-back of sector %u failed\n", e->sector);
+        return false;
+    }
+    e->dirty = false;
+    gStats.writebacks++;
+    return true;
+}
+
+/* Free slot, else the least recently used block that is clean or can be
+ * written back */
+static int16_t claim_entry(void) {
+    for (int16_t i = 0; i < HFS_BCACHE_BLOCKS; i++) {
+        if (!gEntries[i].valid) return i;
+    }
+
+    for (int16_t i = gLruTail; i != BC_NONE; i = gEntries[i].lruPrev) {
+        if (!write_back(i)) continue;
+        invalidate(i);
+        gStats.evictions++;
+        return i;
+    }
+
+    return BC_NONE;
+}
+
+static BCDevice* device_for(uint16_t cacheId) {
+    if (cacheId == 0 || cacheId > HFS_BCACHE_DEVICES) return NULL;
+    BCDevice* d = &gDevices[cacheId - 1];
+    return d->used ? d : NULL;
+}
+
+/* Copy the part of sector `sector` that overlaps [offset, offset + length) */
+static void copy_out(uint32_t sector, const uint8_t* block, uint64_t offset,
+                     uint32_t length, uint8_t* buffer) {
+    uint64_t blockStart = (uint64_t)sector * HFS_BCACHE_BLOCK_SIZE;
+    uint64_t from = (offset > blockStart) ? offset : blockStart;
+    uint64_t to = blockStart + HFS_BCACHE_BLOCK_SIZE;
+    if (to > offset + length) to = offset + length;
+    memcpy(buffer + (from - offset), block + (from - blockStart), (uint32_t)(to - from));
+}
+
+uint16_t HFS_BC_Attach(const HFS_BlockDev* bd) {
+    if (!bd || bd->sectorSize != HFS_BCACHE_BLOCK_SIZE) return 0;
+    bc_init();
+
+    for (int i = 0; i < HFS_BCACHE_DEVICES; i++) {
+        BCDevice* d = &gDevices[i];
+        if (!d->used || d->bd.type != bd->type || d->bd.device_index != bd->device_index) continue;
+        if ((bd->type == HFS_BD_TYPE_MEMORY || bd->type == HFS_BD_TYPE_FILE) && d->bd.data != bd->data) continue;
+        d->refs++;
+        return (uint16_t)(i + 1);
+    }
+
+    for (int i = 0; i < HFS_BCACHE_DEVICES; i++) {
+        BCDevice* d = &gDevices[i];
+        if (d->used) continue;
+        d->used = true;
+        d->refs = 1;
+        d->bd = *bd;
+        d->bd.cacheId = 0;
+        d->nextSector = UINT32_MAX;
+        d->raWindow = HFS_BCACHE_READAHEAD_MIN;
+        d->dirtySince = 0;
+        return (uint16_t)(i + 1);
+    }
+
+    FS_LOG_WARN("HFS BCache: device table full, device %d will be uncached\n", bd->device_index);
+    return 0;
+}
+
+void HFS_BC_Detach(uint16_t cacheId) {
+    BCDevice* d = device_for(cacheId);
+    if (!d || --d->refs > 0) return;
+
+    HFS_BC_Flush(cacheId);
+    for (int16_t i = 0; i < HFS_BCACHE_BLOCKS; i++) {
+        if (gEntries[i].valid && gEntries[i].dev == cacheId) {
+            if (gEntries[i].dirty) {
+                FS_LOG_WARN("HFS BCache: dropping unwritten sector %u\n", gEntries[i].sector);
+            }
+            invalidate(i);
+        }
+    }
+    d->used = false;
+}
+
+/* Read [first, first + count) into the cache; the part inside [offset,
+ * offset + length) also lands in the caller's buffer.  Sectors past `demandEnd`
+ * are read-ahead. */
+static bool fill_run(BCDevice* d, uint8_t dev, uint32_t first, uint32_t count, uint32_t demandEnd,
+                     uint64_t offset, uint32_t length, uint8_t* buffer) {
+    TempScratchMark mark = TempScratch_Mark();
+    uint8_t* bounce = TempScratch_Alloc(count * HFS_BCACHE_BLOCK_SIZE);
+    if (!bounce) return false;
+
+    if (!HFS_BD_TransferSectors(&d->bd, first, count, bounce, false)) {
+        TempScratch_Release(mark);
+        return false;
+    }
+
+    for (uint32_t k = 0; k < count; k++) {
+        uint32_t sector = first + k;
+        const uint8_t* block = bounce + k * HFS_BCACHE_BLOCK_SIZE;
+        bool ahead = (sector >= demandEnd);
+
+        if (ahead) gStats.readAhead++;
+        else {
+            gStats.misses++;
+            copy_out(sector, block, offset, length, buffer);
+        }
+
+        int16_t i = claim_entry();
+        if (i == BC_NONE) continue;  /* Served, just not cached */
+        memcpy(gPool[i], block, HFS_BCACHE_BLOCK_SIZE);
+        insert(i, dev, sector);
+        gEntries[i].readAhead = ahead;
+    }
+
+    TempScratch_Release(mark);
+    return true;
+}
+
+bool HFS_BC_Read(const HFS_BlockDev* bd, uint64_t offset, void* buffer, uint32_t length) {
+    BCDevice* d = bd ? device_for(bd->cacheId) : NULL;
+    if (!d || !buffer) return false;
+    if (length == 0) return true;
+
+    uint8_t dev = (uint8_t)bd->cacheId;
+    uint8_t* out = (uint8_t*)buffer;
+    uint32_t start = (uint32_t)(offset / HFS_BCACHE_BLOCK_SIZE);
+    uint32_t end = (uint32_t)((offset + length + HFS_BCACHE_BLOCK_SIZE - 1) / HFS_BCACHE_BLOCK_SIZE);
+    uint32_t devSectors = (uint32_t)(d->bd.size / HFS_BCACHE_BLOCK_SIZE);
+    bool sequential = (start == d->nextSector);
+    d->nextSector = end;
+
+    /* Large aligned transfers bypass the pool; dirty blocks are newer than the disk */
+    if (offset % HFS_BCACHE_BLOCK_SIZE == 0 && length % HFS_BCACHE_BLOCK_SIZE == 0 &&
+        end - start >= HFS_BCACHE_DIRECT_MIN) {
+        if (!HFS_BD_TransferSectors(&d->bd, start, end - start, out, false)) return false;
+        for (int16_t i = 0; i < HFS_BCACHE_BLOCKS; i++) {
+            BCEntry* e = &gEntries[i];
+            if (e->valid && e->dirty && e->dev == dev && e->sector >= start && e->sector < end) {
+                memcpy(out + (e->sector - start) * HFS_BCACHE_BLOCK_SIZE, gPool[i], HFS_BCACHE_BLOCK_SIZE);
+            }
+        }
+        gStats.directReads += end - start;
+        return true;
+    }
+
+    if (!sequential) d->raWindow = HFS_BCACHE_READAHEAD_MIN;
+
+    uint32_t s = start;
+    while (s < end) {
+        int16_t i = lookup(dev, s);
+        if (i != BC_NONE) {
+            BCEntry* e = &gEntries[i];
+            gStats.hits++;
+            if (e->readAhead) {
+                gStats.readAheadHits++;
+                e->readAhead = false;
+            }
+            lru_unlink(i);
+            lru_push_front(i);
+            copy_out(s, gPool[i], offset, length, out);
+            s++;
+            continue;
+        }
+
+        /* Coalesce the run of missing sectors */
+        uint32_t runEnd = s + 1;
+        while (runEnd < end && runEnd - s < BC_RUN_MAX && lookup(dev, runEnd) == BC_NONE) {
+            runEnd++;
+        }
+
+        uint32_t fetchEnd = runEnd;
+        if (sequential && runEnd == end) {
+            uint32_t limit = end + d->raWindow;
+            if (limit > devSectors) limit = devSectors;
+            while (fetchEnd < limit && lookup(dev, fetchEnd) == BC_NONE) {
+                fetchEnd++;
+            }
+            if (d->raWindow < HFS_BCACHE_READAHEAD_MAX) d->raWindow *= 2;
+        }
+
+        if (!fill_run(d, dev, s, fetchEnd - s, end, offset, length, out)) {
+            return false;
+        }
+        s = runEnd;
+    }
+
+    return true;
+}
+
+bool HFS_BC_Write(HFS_BlockDev* bd, uint64_t offset, const void* buffer, uint32_t length) {
+    BCDevice* d = bd ? device_for(bd->cacheId) : NULL;
+    if (!d || !buffer) return false;
+    if (length == 0) return true;
+
+    uint8_t dev = (uint8_t)bd->cacheId;
+    const uint8_t* in = (const uint8_t*)buffer;
+    uint32_t start = (uint32_t)(offset / HFS_BCACHE_BLOCK_SIZE);
+    uint32_t end = (uint32_t)((offset + length + HFS_BCACHE_BLOCK_SIZE - 1) / HFS_BCACHE_BLOCK_SIZE);
+
+    /* Large aligned writes go straight through; cached copies become clean */
+    if (offset % HFS_BCACHE_BLOCK_SIZE == 0 && length % HFS_BCACHE_BLOCK_SIZE == 0 &&
+        end - start >= HFS_BCACHE_DIRECT_MIN) {
+        if (!HFS_BD_TransferSectors(&d->bd, start, end - start, (void*)(uintptr_t)in, true)) return false;
+        for (int16_t i = 0; i < HFS_BCACHE_BLOCKS; i++) {
+            BCEntry* e = &gEntries[i];
+            if (e->valid && e->dev == dev && e->sector >= start && e->sector < end) {
+                memcpy(gPool[i], in + (e->sector - start) * HFS_BCACHE_BLOCK_SIZE, HFS_BCACHE_BLOCK_SIZE);
+                e->dirty = false;
+            }
+        }
+        gStats.directWrites += end - start;
+        return true;
+    }
+
+    for (uint32_t s = start; s < end; s++) {
+        uint64_t blockStart = (uint64_t)s * HFS_BCACHE_BLOCK_SIZE;
+        uint64_t from = (offset > blockStart) ? offset : blockStart;
+        uint64_t to = blockStart + HFS_BCACHE_BLOCK_SIZE;
+        if (to > offset + length) to = offset + length;
+        bool whole = (from == blockStart && to == blockStart + HFS_BCACHE_BLOCK_SIZE);
+
+        int16_t i = lookup(dev, s);
+        if (i == BC_NONE) {
+            i = claim_entry();
+            if (i == BC_NONE) {
+                /* Pool is stuck on unwritable blocks: write this sector through */
+                uint8_t block[HFS_BCACHE_BLOCK_SIZE];
+                if (!whole && !HFS_BD_TransferSectors(&d->bd, s, 1, block, false)) return false;
+                memcpy(block + (from - blockStart), in + (from - offset), (uint32_t)(to - from));
+                if (!HFS_BD_TransferSectors(&d->bd, s, 1, block, true)) return false;
+                continue;
+            }
+            if (!whole && !HFS_BD_TransferSectors(&d->bd, s, 1, gPool[i], false)) {
+                return false;
+            }
+            insert(i, dev, s);
+        } else {
+            lru_unlink(i);
+            lru_push_front(i);
+        }
+
+        memcpy(gPool[i] + (from - blockStart), in + (from - offset), (uint32_t)(to - from));
+        gEntries[i].dirty = true;
+        gEntries[i].readAhead = false;
+    }
+
+    if (d->dirtySince == 0) d->dirtySince = TickCount() | 1;
+    return true;
+}
+
+bool HFS_BC_Flush(uint16_t cacheId) {
+    BCDevice* d = device_for(cacheId);
+    if (!d) return false;
+
+    /* Dirty blocks in sector order so adjacent ones share a transfer */
+    static int16_t order[HFS_BCACHE_BLOCKS];
+    int n = 0;
+    for (int16_t i = 0; i < HFS_BCACHE_BLOCKS; i++) {
+        if (!gEntries[i].valid || !gEntries[i].dirty || gEntries[i].dev != cacheId) continue;
+        int j = n++;
+        while (j > 0 && gEntries[order[j - 1]].sector > gEntries[i].sector) {
+            order[j] = order[j - 1];
+            j--;
+        }
+        order[j] = i;
+    }
+    if (n == 0) {
+        d->dirtySince = 0;
+        return true;
+    }
+
+    TempScratchMark mark = TempScratch_Mark();
+    uint8_t* bounce = TempScratch_Alloc(BC_RUN_MAX * HFS_BCACHE_BLOCK_SIZE);
+    bool ok = true;
+
+    int k = 0;
+    while (k < n) {
+        int run = 1;
+        while (bounce && k + run < n && run < BC_RUN_MAX &&
+               gEntries[order[k + run]].sector == gEntries[order[k]].sector + run) {
+            run++;
+        }
+
+        if (run == 1) {
+            if (!write_back(order[k])) ok = false;
+        } else {
+            for (int r = 0; r < run; r++) {
+                memcpy(bounce + r * HFS_BCACHE_BLOCK_SIZE, gPool[order[k + r]], HFS_BCACHE_BLOCK_SIZE);
+            }
+            if (HFS_BD_TransferSectors(&d->bd, gEntries[order[k]].sector, run, bounce, true)) {
+                for (int r = 0; r < run; r++) {
+                    gEntries[order[k + r]].dirty = false;
+                }
+                gStats.writebacks += run;
+            } else {
+                FS_LOG_ERROR("HFS BCache: write-back of sectors %u-%u failed\n",
+                             gEntries[order[k]].sector, gEntries[order[k]].sector + run - 1);
+                ok = false;
+            }
+        }
+        k += run;
+    }
+
+    TempScratch_Release(mark);
+
+    /* Blocks that failed to write stay dirty; try them again next interval */
+    d->dirtySince = ok ? 0 : (TickCount() | 1);
+    return ok;
+}
+
+void HFS_BC_Idle(void) {
+    uint32_t now = TickCount();
+    for (int i = 0; i < HFS_BCACHE_DEVICES; i++) {
+        BCDevice* d = &gDevices[i];
+        if (d->used && d->dirtySince && now - d->dirtySince >= HFS_BCACHE_FLUSH_TICKS) {
+            HFS_BC_Flush((uint16_t)(i + 1));
+        }
+    }
+}
+
+void HFS_BC_GetStats(HFS_BCacheStats* stats) {
+    if (!stats) return;
+    *stats = gStats;
+}
@@ -1,66 +1,76 @@
 /* HFS B-Tree Implementation */
 #include "../../include/FS/hfs_btree.h"
+#include "../../include/FS/hfs_nodecache.h"
 #include "../../include/FS/hfs_endian.h"
 #include "../../include/MemoryMgr/MemoryManager.h"
+#include "../../include/MemoryMgr/TempMemory.h"
 #include <string.h>
 #include "FS/FSLogging.h"
 
 /* Serial debug output */
 
-/* Read data from B-tree file using extents */
-static bool read_btree_data(HFS_BTree* bt, uint32_t offset, void* buffer, uint32_t length) {
-    if (!bt || !buffer) return false;
+/* Read data from a B-tree file through its first three extents */
+static bool btree_read(HFS_Volume* vol, const HFS_Extent* extents, uint32_t offset,
+                       void* buffer, uint32_t length) {
+    if (!vol || !buffer || vol->alBlkSize == 0) return false;
 
-    FS_LOG_DEBUG("read_btree_data: offset=%d length=%d fileSize=%d vol=%08x bd.data=%08x\n",
-                 (int)offset, (int)length, (int)bt->fileSize,
-                 (unsigned int)bt->vol, (unsigned int)bt->vol->bd.data);
+    FS_LOG_DEBUG("btree_read: offset=%d length=%d vol=%08x bd.data=%08x\n",
+                 (int)offset, (int)length,
+                 (unsigned int)vol, (unsigned int)vol->bd.data);
 
-    uint32_t bytesRead = 0;
+    uint32_t bytesDone = 0;
     uint32_t currentOffset = offset;
 
-    /* Read from first 3 extents */
-    for (int i = 0; i < 3 && bytesRead < length; i++) {
-        if (bt->extents[i].blockCount == 0) {
-            /* FS_LOG_DEBUG("read_btree_data: Extent %d has 0 blocks\n", i); */
+    for (int i = 0; i < 3 && bytesDone < length; i++) {
+        if (extents[i].blockCount == 0) {
             break;
         }
-        FS_LOG_DEBUG("read_btree_data: Extent %d - startBlock=%u, blockCount=%u\n",
-                     i, bt->extents[i].startBlock, bt->extents[i].blockCount);
 
-        uint32_t extentBytes = bt->extents[i].blockCount * bt->vol->alBlkSize;
+        uint32_t extentBytes = extents[i].blockCount * vol->alBlkSize;
 
         if (currentOffset >= extentBytes) {
             currentOffset -= extentBytes;
             continue;
         }
 
-        uint32_t startBlock = bt->extents[i].startBlock;
-        uint32_t blockOffset = currentOffset / bt->vol->alBlkSize;
-        uint32_t byteOffset = currentOffset % bt->vol->alBlkSize;
+        uint32_t startBlock = extents[i].startBlock;
+        uint32_t blockOffset = currentOffset / vol->alBlkSize;
+        uint32_t byteOffset = currentOffset % vol->alBlkSize;
 
-        uint32_t toRead = extentBytes - currentOffset;
-        if (toRead > (length - bytesRead)) {
-            toRead = length - bytesRead;
+        uint32_t toCopy = extentBytes - currentOffset;
+        if (toCopy > (length - bytesDone)) {
+            toCopy = length - bytesDone;
         }
 
-        /* Read the blocks */
-        uint8_t* tempBuffer = NewPtr(bt->vol->alBlkSize * 2);
+        uint32_t blocks = (toCopy + byteOffset + vol->alBlkSize - 1) / vol->alBlkSize;
+        uint8_t* tempBuffer = NewPtr(blocks * vol->alBlkSize);
         if (!tempBuffer) return false;
 
-        uint32_t blocksToRead = (toRead + byteOffset + bt->vol->alBlkSize - 1) / bt->vol->alBlkSize;
-        if (!HFS_ReadAllocBlocks(bt->vol, startBlock + blockOffset, blocksToRead, tempBuffer)) {
-            DisposePtr((Ptr)tempBuffer);
-            return false;
+        bool ok = HFS_ReadAllocBlocks(vol, startBlock + blockOffset, blocks, tempBuffer);
+        if (ok) {
+            memcpy((uint8_t*)buffer + bytesDone, tempBuffer + byteOffset, toCopy);
         }
-
-        memcpy((uint8_t*)buffer + bytesRead, tempBuffer + byteOffset, toRead);
         DisposePtr((Ptr)tempBuffer);
+        if (!ok) return false;
 
-        bytesRead += toRead;
+        bytesDone += toCopy;
         currentOffset = 0;  /* Reset for next extent */
     }
 
-    return bytesRead == length;
+    return bytesDone == length;
+}
+
+static bool read_btree_data(HFS_BTree* bt, uint32_t offset, void* buffer, uint32_t length) {
+    if (!bt) return false;
+    return btree_read(bt->vol, bt->extents, offset, buffer, length);
+}
+
+bool HFS_BT_ReadNodeUncached(HFS_Volume* vol, HFS_BTreeType type, uint16_t nodeSize,
+                             uint32_t nodeNum, void* buffer) {
+    if (!vol || !buffer) return false;
+
+    const HFS_Extent* extents = (type == kBTreeCatalog) ? vol->catExtents : vol->extExtents;
+    return btree_read(vol, extents, nodeNum * nodeSize, buffer, nodeSize);
 }
 
 bool HFS_BT_Init(HFS_BTree* bt, HFS_Volume* vol, HFS_BTreeType type) {
@@ -133,6 +143,12 @@ bool HFS_BT_Init(HFS_BTree* bt, HFS_Volume* vol, HFS_BTreeType type) {
         return false;
     }
 
+    /* Both trees share the volume's node cache; without one, nodes are
+     * read straight from the device */
+    if (!vol->nodeCache) {
+        vol->nodeCache = HFS_NC_Create(vol);
+    }
+
     FS_LOG_DEBUG("HFS BTree: Initialized %s tree (nodeSize=%u, root=%u, depth=%u)\n",
                   type == kBTreeCatalog ? "Catalog" : "Extents",
                   bt->nodeSize, bt->rootNode, bt->treeDepth);
@@ -151,13 +167,48 @@ void HFS_BT_Close(HFS_BTree* bt) {
     memset(bt, 0, sizeof(HFS_BTree));
 }
 
+void* HFS_BT_GetNode(HFS_BTree* bt, uint32_t nodeNum) {
+    if (!bt || !bt->vol || !bt->vol->nodeCache || nodeNum >= bt->totalNodes) return NULL;
+
+    bt->nodeReads++;
+    return HFS_NC_Get(bt->vol->nodeCache, bt->type, nodeNum, bt->nodeSize);
+}
+
+void HFS_BT_ReleaseNode(HFS_BTree* bt, void* node) {
+    if (!bt || !bt->vol || !node) return;
+    HFS_NC_Release(bt->vol->nodeCache, node);
+}
+
 bool HFS_BT_ReadNode(HFS_BTree* bt, uint32_t nodeNum, void* buffer) {
     if (!bt || !buffer || nodeNum >= bt->totalNodes) return false;
 
+    void* node = HFS_BT_GetNode(bt, nodeNum);
+    if (node) {
+        memcpy(buffer, node, bt->nodeSize);
+        HFS_BT_ReleaseNode(bt, node);
+        return true;
+    }
+
     uint32_t offset = nodeNum * bt->nodeSize;
     return read_btree_data(bt, offset, buffer, bt->nodeSize);
 }
 
+/* A pinned cache node, or a copy in fallback when the cache can't hold it */
+static void* pin_node(HFS_BTree* bt, uint32_t nodeNum, void* fallback) {
+    void* node = HFS_BT_GetNode(bt, nodeNum);
+    if (node) return node;
+
+    if (fallback && nodeNum < bt->totalNodes &&
+        read_btree_data(bt, nodeNum * bt->nodeSize, fallback, bt->nodeSize)) {
+        return fallback;
+    }
+    return NULL;
+}
+
+static void unpin_node(HFS_BTree* bt, void* node, void* fallback) {
+    if (node != fallback) HFS_BT_ReleaseNode(bt, node);
+}
+
 bool HFS_BT_GetRecord(void* node, uint16_t nodeSize, uint16_t recordNum,
                       void** recordPtr, uint16_t* recordLen) {
     if (!node || !recordPtr) return false;
@@ -196,21 +247,223 @@ bool HFS_BT_GetRecord(void* node, uint16_t nodeSize, uint16_t recordNum,
     return true;
 }
 
+/*
+ * Offset of a leaf record's data.  keyLength excludes the length byte, so
+ * data starts at 1 + keyLength, rounded up to a word boundary on volumes
+ * written by the Mac OS.  HFS_CreateBlankVolume doesn't pad, so only skip
+ * the byte when it is a pad: catalog record types never start with zero.
+ */
+static uint16_t leaf_data_offset(const HFS_BTree* bt, const uint8_t* record,
+                                 uint16_t recordLen) {
+    uint16_t off = 1 + record[0];
+    if ((off & 1) && off + 1 < recordLen &&
+        (bt->type != kBTreeCatalog || record[off] == 0)) {
+        off++;
+    }
+    return off;
+}
+
+/* Index records always use padded keys followed by a 4-byte child pointer */
+static uint16_t index_data_offset(const uint8_t* record) {
+    return (uint16_t)((1 + record[0] + 1) & ~1);
+}
+
+static int bt_compare(const HFS_BTree* bt, const void* key1, const void* key2) {
+    return (bt->type == kBTreeCatalog) ? HFS_CompareCatalogKeys(key1, key2)
+                                       : HFS_CompareExtentsKeys(key1, key2);
+}
+
+/* Largest data record a tree holds: what HFS_BT_FindRecord may copy out */
+static uint16_t bt_max_data_len(const HFS_BTree* bt) {
+    return (bt->type == kBTreeCatalog) ? sizeof(HFS_CatFileRec) : 3 * sizeof(HFS_Extent);
+}
+
+/*
+ * Index node: binary search for the last record whose key is <= key and
+ * return its child pointer, or 0 if key sorts before the whole node.
+ */
+static uint32_t index_child_for(HFS_BTree* bt, void* node, const void* key) {
+    uint16_t numRecords = be16_read(&((HFS_BTNodeDesc*)node)->numRecords);
+    int lo = 0, hi = (int)numRecords - 1, found = -1;
+
+    while (lo <= hi) {
+        int mid = (lo + hi) / 2;
+        void* record;
+        uint16_t recordLen;
+
+        if (!HFS_BT_GetRecord(node, bt->nodeSize, (uint16_t)mid, &record, &recordLen)) {
+            return 0;
+        }
+        if (bt_compare(bt, record, key) <= 0) {
+            found = mid;
+            lo = mid + 1;
+        } else {
+            hi = mid - 1;
+        }
+    }
+    if (found < 0) return 0;
+
+    void* record;
+    uint16_t recordLen;
+    HFS_BT_GetRecord(node, bt->nodeSize, (uint16_t)found, &record, &recordLen);
+    uint16_t off = index_data_offset(record);
+    if (off + 4 > recordLen) return 0;
+    return be32_read((uint8_t*)record + off);
+}
+
+bool HFS_BT_Search(HFS_BTree* bt, const void* key, void* nodeBuffer,
+                   void** keyPtr, void** dataPtr, uint16_t* dataLen) {
+    if (!bt || !key || !nodeBuffer || bt->rootNode == 0) return false;
+
+    uint32_t nodeNum = bt->rootNode;
+
+    for (int level = 0; level < HFS_BT_MAX_DEPTH && nodeNum != 0; level++) {
+        /* Index nodes are used in place; only the leaf is copied out */
+        void* node = pin_node(bt, nodeNum, nodeBuffer);
+        if (!node) return false;
+
+        HFS_BTNodeDesc* nodeDesc = (HFS_BTNodeDesc*)node;
+        if (nodeDesc->kind == kBTIndexNode) {
+            uint32_t child = index_child_for(bt, node, key);
+            unpin_node(bt, node, nodeBuffer);
+            nodeNum = child;
+            continue;
+        }
+        if (node != nodeBuffer) {
+            memcpy(nodeBuffer, node, bt->nodeSize);
+            unpin_node(bt, node, nodeBuffer);
+            nodeDesc = (HFS_BTNodeDesc*)nodeBuffer;
+        }
+        if (nodeDesc->kind != kBTLeafNode) {
+            FS_LOG_WARN("HFS BTree: node %u has unexpected kind %d\n", nodeNum, nodeDesc->kind);
+            return false;
+        }
+
+        /* Leaves written by HFS_CreateBlankVolume aren't sorted, so scan
+         * the node rather than bisecting it; it's already in memory. */
+        uint16_t numRecords = be16_read(&nodeDesc->numRecords);
+        for (uint16_t i = 0; i < numRecords; i++) {
+            void* record;
+            uint16_t recordLen;
+
+            if (!HFS_BT_GetRecord(nodeBuffer, bt->nodeSize, i, &record, &recordLen) ||
+                bt_compare(bt, record, key) != 0) {
+                continue;
+            }
+
+            uint16_t off = leaf_data_offset(bt, record, recordLen);
+            if (off >= recordLen) return false;
+            if (keyPtr) *keyPtr = record;
+            if (dataPtr) *dataPtr = (uint8_t*)record + off;
+            if (dataLen) *dataLen = recordLen - off;
+            return true;
+        }
+        return false;
+    }
+
+    return false;
+}
+
+bool HFS_BT_LocateLeaf(HFS_BTree* bt, const void* key, uint32_t* leafNode) {
+    if (!bt || !key || !leafNode || bt->rootNode == 0) return false;
+
+    TempScratchMark mark = TempScratch_Mark();
+    void* fallback = TempScratch_Alloc(bt->nodeSize);
+    uint32_t nodeNum = bt->rootNode;
+    bool found = false;
+
+    for (int level = 0; level < HFS_BT_MAX_DEPTH && nodeNum != 0; level++) {
+        void* node = pin_node(bt, nodeNum, fallback);
+        if (!node) break;
+
+        HFS_BTNodeDesc* nodeDesc = (HFS_BTNodeDesc*)node;
+        if (nodeDesc->kind == kBTLeafNode) {
+            unpin_node(bt, node, fallback);
+            *leafNode = nodeNum;
+            found = true;
+            break;
+        }
+        if (nodeDesc->kind != kBTIndexNode) {
+            unpin_node(bt, node, fallback);
+            break;
+        }
+
+        /* Keys before the whole node start in its leftmost child */
+        uint32_t child = index_child_for(bt, node, key);
+        void* record;
+        uint16_t recordLen;
+        if (child == 0 && HFS_BT_GetRecord(node, bt->nodeSize, 0, &record, &recordLen)) {
+            uint16_t off = index_data_offset(record);
+            if (off + 4 <= recordLen) child = be32_read((uint8_t*)record + off);
+        }
+        unpin_node(bt, node, fallback);
+        nodeNum = child;
+    }
+
+    TempScratch_Release(mark);
+    return found;
+}
+
+bool HFS_BT_GetLeafRecord(HFS_BTree* bt, void* node, uint16_t recordNum,
+                          void** keyPtr, void** dataPtr, uint16_t* dataLen) {
+    void* record;
+    uint16_t recordLen;
+
+    if (!bt || !HFS_BT_GetRecord(node, bt->nodeSize, recordNum, &record, &recordLen)) {
+        return false;
+    }
+
+    uint16_t off = leaf_data_offset(bt, record, recordLen);
+    if (off >= recordLen) return false;
+    if (keyPtr) *keyPtr = record;
+    if (dataPtr) *dataPtr = (uint8_t*)record + off;
+    if (dataLen) *dataLen = recordLen - off;
+    return true;
+}
+
+bool HFS_BT_FindRecord(HFS_BTree* bt, const void* key, uint16_t keyLen,
+                       void* recordBuffer, uint16_t* recordLen) {
+    if (!bt || !key || !recordBuffer || keyLen < 1 + ((const uint8_t*)key)[0]) {
+        return false;
+    }
+
+    TempScratchMark mark = TempScratch_Mark();
+    void* nodeBuffer = TempScratch_Alloc(bt->nodeSize);
+    void* data;
+    uint16_t dataLen;
+    bool found = false;
+
+    if (nodeBuffer && HFS_BT_Search(bt, key, nodeBuffer, NULL, &data, &dataLen)) {
+        /* The last record in a node runs up to the offset table */
+        if (dataLen > bt_max_data_len(bt)) dataLen = bt_max_data_len(bt);
+        memcpy(recordBuffer, data, dataLen);
+        if (recordLen) *recordLen = dataLen;
+        found = true;
+    }
+
+    TempScratch_Release(mark);
+    return found;
+}
+
 bool HFS_BT_IterateLeaves(HFS_BTree* bt, HFS_BT_IteratorFunc func, void* context) {
     if (!bt || !func) return false;
 
     uint32_t currentNode = bt->firstLeaf;
-    void* nodeBuffer = NewPtr(bt->nodeSize);
-    if (!nodeBuffer) return false;
+    TempScratchMark mark = TempScratch_Mark();
+    void* fallback = NULL;
 
     while (currentNode != 0) {
-        /* Read the leaf node */
-        if (!HFS_BT_ReadNode(bt, currentNode, nodeBuffer)) {
-            DisposePtr((Ptr)nodeBuffer);
+        /* Pin the leaf for the callbacks; they may look up other nodes */
+        void* node = pin_node(bt, currentNode, fallback);
+        if (!node && !fallback && (fallback = TempScratch_Alloc(bt->nodeSize)) != NULL) {
+            node = pin_node(bt, currentNode, fallback);
+        }
+        if (!node) {
+            TempScratch_Release(mark);
             return false;
         }
 
-        HFS_BTNodeDesc* nodeDesc = (HFS_BTNodeDesc*)nodeBuffer;
+        HFS_BTNodeDesc* nodeDesc = (HFS_BTNodeDesc*)node;
         uint16_t numRecords = be16_read(&nodeDesc->numRecords);
 
         /* Process each record in the leaf */
@@ -218,7 +471,7 @@ bool HFS_BT_IterateLeaves(HFS_BTree* bt, HFS_BT_IteratorFunc func, void* context
             void* record;
             uint16_t recordLen;
 
-            if (!HFS_BT_GetRecord(nodeBuffer, bt->nodeSize, i, &record, &recordLen)) {
+            if (!HFS_BT_GetRecord(node, bt->nodeSize, i, &record, &recordLen)) {
                 continue;
             }
 
@@ -226,12 +479,14 @@ bool HFS_BT_IterateLeaves(HFS_BTree* bt, HFS_BT_IteratorFunc func, void* context
             if (bt->type == kBTreeCatalog) {
                 HFS_CatKey* key = (HFS_CatKey*)record;
                 uint8_t keyLen = key->keyLength;
-                /* keyLength excludes the keyLength byte itself, so data starts at +1 + keyLen */
-                void* data = (uint8_t*)record + 1 + keyLen;
-                uint16_t dataLen = recordLen - 1 - keyLen;
+                uint16_t dataOff = leaf_data_offset(bt, record, recordLen);
+                if (dataOff >= recordLen) continue;
+                void* data = (uint8_t*)record + dataOff;
+                uint16_t dataLen = recordLen - dataOff;
 
                 if (!func(key, keyLen, data, dataLen, context)) {
-                    DisposePtr((Ptr)nodeBuffer);
+                    unpin_node(bt, node, fallback);
+                    TempScratch_Release(mark);
                     return true;  /* Iterator requested stop */
                 }
             }
@@ -239,12 +494,38 @@ bool HFS_BT_IterateLeaves(HFS_BTree* bt, HFS_BT_IteratorFunc func, void* context
 
         /* Move to next leaf node */
         currentNode = be32_read(&nodeDesc->fLink);
+        unpin_node(bt, node, fallback);
     }
 
-    DisposePtr((Ptr)nodeBuffer);
+    TempScratch_Release(mark);
     return true;
 }
 
+/*
+ * Sort weight of each MacRoman byte in catalog names: the HFS ordering of
+ * Technical Note 1150 (RelString, case-insensitive, diacritical-sensitive).
+ * Upper and lower case share a weight, accented letters sort right after
+ * their base letter; names whose bytes weigh the same are one name.
+ */
+const uint8_t HFS_CatalogNameOrder[256] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,  /* 00 */
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F,  /* 10 */
+    0x20, 0x22, 0x23, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2F, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,  /* 20 */
+    0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46,  /* 30 */
+    0x47, 0x48, 0x57, 0x59, 0x5D, 0x5F, 0x66, 0x68, 0x6A, 0x6C, 0x72, 0x74, 0x76, 0x78, 0x7A, 0x7E,  /* 40 */
+    0x8C, 0x8E, 0x90, 0x92, 0x95, 0x97, 0x9E, 0xA0, 0xA2, 0xA4, 0xA7, 0xA9, 0xAA, 0xAB, 0xAC, 0xAD,  /* 50 */
+    0x4E, 0x48, 0x57, 0x59, 0x5D, 0x5F, 0x66, 0x68, 0x6A, 0x6C, 0x72, 0x74, 0x76, 0x78, 0x7A, 0x7E,  /* 60 */
+    0x8C, 0x8E, 0x90, 0x92, 0x95, 0x97, 0x9E, 0xA0, 0xA2, 0xA4, 0xA7, 0xAF, 0xB0, 0xB1, 0xB2, 0xB3,  /* 70 */
+    0x4A, 0x4C, 0x5A, 0x60, 0x7B, 0x7F, 0x98, 0x4F, 0x49, 0x51, 0x4A, 0x4B, 0x4C, 0x5A, 0x60, 0x63,  /* 80 */
+    0x64, 0x65, 0x6E, 0x6F, 0x70, 0x71, 0x7B, 0x84, 0x85, 0x86, 0x7F, 0x80, 0x9A, 0x9B, 0x9C, 0x98,  /* 90 */
+    0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0x94, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF, 0xC0, 0x4D, 0x81,  /* A0 */
+    0xC1, 0xC2, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xCB, 0x55, 0x8A, 0xCC, 0x4D, 0x81,  /* B0 */
+    0xCD, 0xCE, 0xCF, 0xD0, 0xD1, 0xD2, 0xD3, 0x26, 0x27, 0xD4, 0x20, 0x49, 0x4B, 0x80, 0x82, 0x82,  /* C0 */
+    0xD5, 0xD6, 0x24, 0x25, 0x2D, 0x2E, 0xD7, 0xD8, 0xA6, 0xD9, 0xDA, 0xDB, 0xDC, 0xDD, 0xDE, 0xDF,  /* D0 */
+    0xE0, 0xE1, 0xE2, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xEB, 0xEC, 0xED, 0xEE, 0xEF,  /* E0 */
+    0xF0, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9, 0xFA, 0xFB, 0xFC, 0xFD, 0xFE, 0xFF,  /* F0 */
+};
+
 int HFS_CompareCatalogKeys(const void* key1, const void* key2) {
     const HFS_CatKey* k1 = (const HFS_CatKey*)key1;
     const HFS_CatKey* k2 = (const HFS_CatKey*)key2;
@@ -256,18 +537,14 @@ int HFS_CompareCatalogKeys(const void* key1, const void* key2) {
     if (pid1 < pid2) return -1;
     if (pid1 > pid2) return 1;
 
-    /* Same parent - compare names (case-insensitive) */
+    /* Same parent - compare names by their HFS sort weights */
     uint8_t len1 = k1->nameLength;
     uint8_t len2 = k2->nameLength;
     uint8_t minLen = (len1 < len2) ? len1 : len2;
 
     for (uint8_t i = 0; i < minLen; i++) {
-        /* Simple ASCII case-insensitive compare */
-        uint8_t c1 = k1->name[i];
-        uint8_t c2 = k2->name[i];
-
-        if (c1 >= 'a' && c1 <= 'z') c1 -= 32;
-        if (c2 >= 'a' && c2 <= 'z') c2 -= 32;
+        uint8_t c1 = HFS_CatalogNameOrder[k1->name[i]];
+        uint8_t c2 = HFS_CatalogNameOrder[k2->name[i]];
 
         if (c1 < c2) return -1;
         if (c1 > c2) return 1;
@@ -281,27 +558,25 @@ int HFS_CompareCatalogKeys(const void* key1, const void* key2) {
 }
 
 int HFS_CompareExtentsKeys(const void* key1, const void* key2) {
-    /* Extents key: fileID + forkType + startBlock */
+    /* Extents key: keyLength, forkType, fileID, startBlock - ordered by
+     * fileID, then fork, then starting file allocation block */
     const uint8_t* k1 = (const uint8_t*)key1;
     const uint8_t* k2 = (const uint8_t*)key2;
 
-    /* Compare file ID (4 bytes) */
-    uint32_t fid1 = be32_read(k1);
-    uint32_t fid2 = be32_read(k2);
+    uint32_t fid1 = be32_read(k1 + 2);
+    uint32_t fid2 = be32_read(k2 + 2);
 
     if (fid1 < fid2) return -1;
     if (fid1 > fid2) return 1;
 
-    /* Compare fork type (1 byte) */
-    if (k1[4] < k2[4]) return -1;
-    if (k1[4] > k2[4]) return 1;
+    if (k1[1] < k2[1]) return -1;
+    if (k1[1] > k2[1]) return 1;
 
-    /* Compare start block (2 bytes) */
-    uint16_t sb1 = be16_read(k1 + 5);
-    uint16_t sb2 = be16_read(k2 + 5);
+    uint16_t sb1 = be16_read(k1 + 6);
+    uint16_t sb2 = be16_read(k2 + 6);
 
     if (sb1 < sb2) return -1;
     if (sb1 > sb2) return 1;
 
     return 0;
-}
\ No newline at end of file
+}
@@ -2,6 +2,7 @@
 #include "../../include/FS/hfs_catalog.h"
 #include "../../include/FS/hfs_endian.h"
 #include "../../include/MemoryMgr/MemoryManager.h"
+#include "../../include/MemoryMgr/TempMemory.h"
 #include <string.h>
 #include "FS/FSLogging.h"
 
@@ -104,52 +105,6 @@ bool HFS_ParseCatalogRecord(const HFS_CatKey* key, const void* data, uint16_t da
     }
 }
 
-/* Enumeration context */
-typedef struct {
-    DirID     parentID;
-    CatEntry* entries;
-    int       maxEntries;
-    int       count;
-} EnumContext;
-
-/* Enumeration callback */
-static bool enum_callback(void* keyPtr, uint16_t keyLen,
-                         void* dataPtr, uint16_t dataLen,
-                         void* context) {
-    EnumContext* ctx = (EnumContext*)context;
-    HFS_CatKey* key = (HFS_CatKey*)keyPtr;
-
-    /* Debug: show first 8 bytes of key */
-    uint8_t* bytes = (uint8_t*)keyPtr;
-    FS_LOG_DEBUG("HFS enum_callback: keyBytes=[%02x %02x %02x %02x %02x %02x %02x %02x]\n",
-                 bytes[0], bytes[1], bytes[2], bytes[3], bytes[4], bytes[5], bytes[6], bytes[7]);
-
-    /* Check if this entry belongs to our parent */
-    uint32_t entryParent = be32_read(&key->parentID);
-
-    FS_LOG_DEBUG("HFS enum_callback: entryParent=%d target=%d nameLen=%d\n",
-                 (int)entryParent, (int)ctx->parentID, key->nameLength);
-
-    if (entryParent != ctx->parentID) {
-        return true;  /* Continue iteration */
-    }
-
-    /* Check if we have room */
-    if (ctx->count >= ctx->maxEntries) {
-        FS_LOG_DEBUG("HFS enum_callback: out of room\n");
-        return false;  /* Stop iteration */
-    }
-
-    /* Parse the record */
-    CatEntry entry;
-    if (HFS_ParseCatalogRecord(key, dataPtr, dataLen, &entry)) {
-        FS_LOG_DEBUG("HFS enum_callback: matched! adding entry '%s'\n", entry.name);
-        ctx->entries[ctx->count++] = entry;
-    }
-
-    return true;  /* Continue */
-}
-
 bool HFS_CatalogInit(HFS_Catalog* cat, HFS_Volume* vol) {
     /* FS_LOG_DEBUG("HFS_CatalogInit: ENTER (cat=%p, vol=%p)\n", cat, vol); */
 
@@ -170,6 +125,8 @@ bool HFS_CatalogInit(HFS_Catalog* cat, HFS_Volume* vol) {
         return false;
     }
 
+    cat->names = HFS_NM_Create();
+
     /* FS_LOG_DEBUG("HFS_CatalogInit: Success\n"); */
     return true;
 }
@@ -178,92 +135,240 @@ void HFS_CatalogClose(HFS_Catalog* cat) {
     if (!cat) return;
 
     HFS_BT_Close(&cat->bt);
+    HFS_NM_Destroy(cat->names);
+    if (cat->idHints) DisposePtr((Ptr)cat->idHints);
     memset(cat, 0, sizeof(HFS_Catalog));
 }
 
+/* Build a catalog search key; an empty name gives the thread record key */
+static void make_cat_key(HFS_CatKey* key, DirID parentID, const uint8_t* name, uint8_t len) {
+    if (len > 31) len = 31;
+    memset(key, 0, sizeof(*key));
+    key->keyLength = 6 + len;  /* reserved + parentID + nameLength + name */
+    be32_write(&key->parentID, parentID);
+    key->nameLength = len;
+    if (len) memcpy(key->name, name, len);
+}
+
+/*
+ * Next leaf for a cursor on parentID after node, or 0.  Keys are ordered
+ * across leaves, so once a leaf ends past the directory the rest of the
+ * tree holds none of it.
+ */
+static uint32_t cursor_next_leaf(HFS_BTree* bt, void* node, DirID parentID) {
+    HFS_BTNodeDesc* nodeDesc = (HFS_BTNodeDesc*)node;
+    uint16_t numRecords = be16_read(&nodeDesc->numRecords);
+    void* key;
+
+    if (numRecords > 0 &&
+        HFS_BT_GetLeafRecord(bt, node, numRecords - 1, &key, NULL, NULL) &&
+        be32_read(&((HFS_CatKey*)key)->parentID) > parentID) {
+        return 0;
+    }
+    return be32_read(&nodeDesc->fLink);
+}
+
+bool HFS_CatalogCursorInit(HFS_Catalog* cat, DirID parentID, HFS_CatalogCursor* cursor) {
+    if (!cat || !cursor) return false;
+
+    memset(cursor, 0, sizeof(*cursor));
+    cursor->parentID = parentID;
+
+    /* The thread key (parentID, "") sorts first in the directory */
+    HFS_CatKey key;
+    make_cat_key(&key, parentID, NULL, 0);
+    if (!HFS_BT_LocateLeaf(&cat->bt, &key, &cursor->node)) {
+        cursor->node = cat->bt.firstLeaf;
+    }
+    return true;
+}
+
+bool HFS_CatalogCursorNext(HFS_Catalog* cat, HFS_CatalogCursor* cursor,
+                           CatEntry* entries, int maxEntries, int* count) {
+    if (!cat || !cursor || !entries || maxEntries <= 0 || !count) return false;
+
+    HFS_BTree* bt = &cat->bt;
+    TempScratchMark mark = TempScratch_Mark();
+    void* fallback = NULL;
+    bool ok = true;
+
+    *count = 0;
+    while (cursor->node != 0 && *count < maxEntries) {
+        void* node = HFS_BT_GetNode(bt, cursor->node);
+        bool pinned = (node != NULL);
+        if (!node) {
+            if (!fallback) fallback = TempScratch_Alloc(bt->nodeSize);
+            if (!fallback || !HFS_BT_ReadNode(bt, cursor->node, fallback)) {
+                ok = false;
+                break;
+            }
+            node = fallback;
+        }
+
+        /* Leaves written by HFS_CreateBlankVolume aren't sorted: check every record */
+        uint16_t numRecords = be16_read(&((HFS_BTNodeDesc*)node)->numRecords);
+        while (cursor->record < numRecords && *count < maxEntries) {
+            void* key;
+            void* data;
+            uint16_t dataLen;
+            if (HFS_BT_GetLeafRecord(bt, node, cursor->record, &key, &data, &dataLen) &&
+                be32_read(&((HFS_CatKey*)key)->parentID) == cursor->parentID &&
+                HFS_ParseCatalogRecord((HFS_CatKey*)key, data, dataLen, &entries[*count])) {
+                (*count)++;
+            }
+            cursor->record++;
+        }
+
+        if (cursor->record >= numRecords) {
+            cursor->node = cursor_next_leaf(bt, node, cursor->parentID);
+            cursor->record = 0;
+            cursor->leaves++;
+        }
+        if (pinned) HFS_BT_ReleaseNode(bt, node);
+    }
+
+    /* Fetch ahead: bring the leaf after the current one into the node cache
+     * while the caller works through this batch */
+    if (ok && cursor->node != 0 && cursor->aheadFrom != cursor->node) {
+        void* node = HFS_BT_GetNode(bt, cursor->node);
+        if (node) {
+            uint32_t next = cursor_next_leaf(bt, node, cursor->parentID);
+            HFS_BT_ReleaseNode(bt, node);
+            if (next != 0 && (node = HFS_BT_GetNode(bt, next)) != NULL) {
+                HFS_BT_ReleaseNode(bt, node);
+            }
+        }
+        cursor->aheadFrom = cursor->node;
+    }
+
+    TempScratch_Release(mark);
+    return ok;
+}
+
 bool HFS_CatalogEnumerate(HFS_Catalog* cat, DirID parentID,
                          CatEntry* entries, int maxEntries, int* count) {
-
-    FS_LOG_DEBUG("HFS_CatalogEnumerate: ENTRY parentID=%d maxEntries=%d\n", (int)parentID, maxEntries);
+    HFS_CatalogCursor cursor;
 
     if (!cat || !entries || maxEntries <= 0 || !count) {
         FS_LOG_DEBUG("HFS_CatalogEnumerate: Invalid params\n");
         return false;
     }
 
-    EnumContext ctx = {
-        .parentID = parentID,
-        .entries = entries,
-        .maxEntries = maxEntries,
-        .count = 0
-    };
+    HFS_CatalogCursorInit(cat, parentID, &cursor);
+    bool result = HFS_CatalogCursorNext(cat, &cursor, entries, maxEntries, count);
 
-    FS_LOG_DEBUG("HFS_CatalogEnumerate: Calling HFS_BT_IterateLeaves, firstLeaf=%d\n",
-                 (int)cat->bt.firstLeaf);
+    FS_LOG_DEBUG("HFS_CatalogEnumerate: parentID=%d found %d entries, %u leaves\n",
+                 (int)parentID, *count, cursor.leaves);
+    return result;
+}
 
-    /* Iterate through all leaf nodes */
-    bool result = HFS_BT_IterateLeaves(&cat->bt, enum_callback, &ctx);
+/* ASCII rendering of a catalog name against name, ignoring ASCII case */
+static bool rendered_name_equal(const char* rendered, const char* name, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        char c1 = rendered[i];
+        char c2 = name[i];
+        if (c1 >= 'a' && c1 <= 'z') c1 -= 32;
+        if (c2 >= 'a' && c2 <= 'z') c2 -= 32;
+        if (c1 != c2) return false;
+    }
+    return rendered[len] == '\0';
+}
 
-    FS_LOG_DEBUG("HFS_CatalogEnumerate: IterateLeaves returned %d, found %d entries\n",
-                 result, ctx.count);
+/* Find the entry of parentID whose CatEntry name is name: the B-tree orders
+ * MacRoman names, so a rendered name with accents dropped can't be searched */
+static bool lookup_rendered_name(HFS_Catalog* cat, DirID parentID, const char* name,
+                                 size_t len, CatEntry* entry) {
+    HFS_CatalogCursor cursor;
+    CatEntry batch[16];
+    int count;
 
-    *count = ctx.count;
-    return result;
+    if (!HFS_CatalogCursorInit(cat, parentID, &cursor)) return false;
+    while (HFS_CatalogCursorNext(cat, &cursor, batch, 16, &count) && count > 0) {
+        for (int i = 0; i < count; i++) {
+            if (rendered_name_equal(batch[i].name, name, len)) {
+                *entry = batch[i];
+                return true;
+            }
+        }
+    }
+    return false;
 }
 
 bool HFS_CatalogLookup(HFS_Catalog* cat, DirID parentID, const char* name,
                        CatEntry* entry) {
     if (!cat || !name || !entry) return false;
 
-    /* Convert name to MacRoman Pascal string */
-    uint8_t pname[32];
     size_t len = strlen(name);
     if (len > 31) len = 31;
-    pname[0] = len;
-    memcpy(pname + 1, name, len);
 
-    /* Build catalog key */
+    switch (HFS_NM_Lookup(cat->names, parentID, (const uint8_t*)name, (uint8_t)len, entry)) {
+        case kHFSNameFound:   return true;
+        case kHFSNameMissing: return false;
+        default:              break;
+    }
+
     HFS_CatKey searchKey;
-    searchKey.keyLength = 6 + len;  /* 1 + 1 + 4 + 1 + nameLen - 1 */
-    searchKey.reserved = 0;
-    be32_write(&searchKey.parentID, parentID);
-    searchKey.nameLength = len;
-    memcpy(searchKey.name, pname + 1, len);
-
-    /* Linear search through leaves (simple implementation) */
-    CatEntry entries[100];
-    int count;
-    if (!HFS_CatalogEnumerate(cat, parentID, entries, 100, &count)) {
-        return false;
+    make_cat_key(&searchKey, parentID, (const uint8_t*)name, (uint8_t)len);
+
+    TempScratchMark mark = TempScratch_Mark();
+    void* node = TempScratch_Alloc(cat->bt.nodeSize);
+    void* key;
+    void* data;
+    uint16_t dataLen;
+    bool found = false;
+
+    if (node && HFS_BT_Search(&cat->bt, &searchKey, node, &key, &data, &dataLen)) {
+        found = HFS_ParseCatalogRecord((HFS_CatKey*)key, data, dataLen, entry);
     }
 
-    /* Find matching name (case-insensitive) */
-    for (int i = 0; i < count; i++) {
-        bool match = true;
-        for (size_t j = 0; j < len; j++) {
-            char c1 = entries[i].name[j];
-            char c2 = name[j];
-            if (c1 >= 'a' && c1 <= 'z') c1 -= 32;
-            if (c2 >= 'a' && c2 <= 'z') c2 -= 32;
-            if (c1 != c2) {
-                match = false;
-                break;
-            }
-        }
-        if (match && entries[i].name[len] == '\0') {
-            *entry = entries[i];
-            return true;
-        }
+    /* Not a MacRoman name in the directory: it may be one's ASCII rendering.
+     * Only the directory's own leaves are read, and the answer is cached. */
+    if (node && !found) {
+        found = lookup_rendered_name(cat, parentID, name, len, entry);
     }
 
-    return false;
+    /* Without a scratch node no search was made: nothing to remember */
+    if (node) {
+        HFS_NM_Enter(cat->names, parentID, (const uint8_t*)name, (uint8_t)len, found ? entry : NULL);
+    }
+
+    TempScratch_Release(mark);
+    return found;
+}
+
+/*
+ * Keys of file and folder records seen while walking the leaves for a CNID
+ * without a thread record, so the next request for any of them is one
+ * descent instead of another walk.  Direct-mapped by CNID; a hint is only
+ * trusted once the record it leads to carries that CNID.
+ */
+#define CAT_ID_HINTS    256     /* Power of two */
+
+typedef struct HFS_CatIDHint {
+    FileID      cnid;
+    HFS_CatKey  key;
+} HFS_CatIDHint;
+
+/* CNID of a file or folder record, 0 for a thread record */
+static FileID record_cnid(const void* data) {
+    uint16_t recordType = be16_read(data);
+
+    if (recordType == kHFS_FolderRecord) {
+        return be32_read(&((const HFS_CatFolderRec*)data)->folderID);
+    }
+    if (recordType == kHFS_FileRecord) {
+        return be32_read(&((const HFS_CatFileRec*)data)->fileID);
+    }
+    return 0;
 }
 
 /* Get by ID context */
 typedef struct {
-    FileID    targetID;
-    CatEntry* result;
-    bool      found;
+    FileID      targetID;
+    HFS_CatKey* key;
+    void*       rec;
+    HFS_CatIDHint* hints;
+    bool        found;
 } GetByIDContext;
 
 /* Get by ID callback */
@@ -271,35 +376,106 @@ static bool getbyid_callback(void* keyPtr, uint16_t keyLen,
                             void* dataPtr, uint16_t dataLen,
                             void* context) {
     GetByIDContext* ctx = (GetByIDContext*)context;
-    HFS_CatKey* key = (HFS_CatKey*)keyPtr;
+    FileID id = record_cnid(dataPtr);
 
-    /* Parse the record */
-    CatEntry entry;
-    if (!HFS_ParseCatalogRecord(key, dataPtr, dataLen, &entry)) {
-        return true;  /* Continue - might be thread record */
+    if (id == 0) {
+        return true;  /* Continue - thread record */
     }
 
-    /* Check if this is our target */
-    if (entry.id == ctx->targetID) {
-        *ctx->result = entry;
-        ctx->found = true;
-        return false;  /* Stop iteration */
+    if (ctx->hints) {
+        HFS_CatIDHint* hint = &ctx->hints[id & (CAT_ID_HINTS - 1)];
+        hint->cnid = id;
+        memcpy(&hint->key, keyPtr, (1u + keyLen < sizeof(HFS_CatKey)) ? 1u + keyLen : sizeof(HFS_CatKey));
     }
 
-    return true;  /* Continue */
+    if (id != ctx->targetID) {
+        return true;  /* Continue */
+    }
+
+    memcpy(ctx->key, keyPtr, (1u + keyLen < sizeof(HFS_CatKey)) ? 1u + keyLen : sizeof(HFS_CatKey));
+    memcpy(ctx->rec, dataPtr, (dataLen < sizeof(HFS_CatFileRec)) ? dataLen : sizeof(HFS_CatFileRec));
+    ctx->found = true;
+    return false;  /* Stop iteration */
 }
 
-bool HFS_CatalogGetByID(HFS_Catalog* cat, FileID cnid, CatEntry* entry) {
-    if (!cat || !entry || cnid < HFS_FIRST_CNID) return false;
+/* Follow cnid's thread record to the key of its file or folder record */
+static bool thread_key_for(HFS_Catalog* cat, FileID cnid, void* node, HFS_CatKey* key) {
+    HFS_CatKey threadKey;
+    void* data;
+    uint16_t dataLen;
+
+    make_cat_key(&threadKey, cnid, NULL, 0);
+    if (!HFS_BT_Search(&cat->bt, &threadKey, node, NULL, &data, &dataLen) ||
+        dataLen < sizeof(HFS_CatThreadRec) - sizeof(((HFS_CatThreadRec*)0)->name)) {
+        return false;
+    }
+
+    const HFS_CatThreadRec* thread = (const HFS_CatThreadRec*)data;
+    uint16_t recordType = be16_read(&thread->recordType);
+    if (recordType != kHFS_FolderThreadRecord && recordType != kHFS_FileThreadRecord) {
+        return false;
+    }
+
+    make_cat_key(key, be32_read(&thread->parentID), thread->name, thread->nameLength);
+    return true;
+}
+
+bool HFS_CatalogGetRecordByID(HFS_Catalog* cat, FileID cnid, HFS_CatKey* key, void* rec) {
+    if (!cat || !key || !rec || cnid < HFS_ROOT_CNID) return false;
+
+    TempScratchMark mark = TempScratch_Mark();
+    void* node = TempScratch_Alloc(cat->bt.nodeSize);
+    void* foundKey;
+    void* data;
+    uint16_t dataLen;
+    bool found = false;
+
+    /* Two descents: cnid's thread record, then the record it names */
+    if (node && thread_key_for(cat, cnid, node, key) &&
+        HFS_BT_Search(&cat->bt, key, node, &foundKey, &data, &dataLen)) {
+        found = true;
+    }
+
+    /* One descent: the key a leaf walk saw cnid's record under */
+    HFS_CatIDHint* hint = cat->idHints ? &cat->idHints[cnid & (CAT_ID_HINTS - 1)] : NULL;
+    if (node && !found && hint && hint->cnid == cnid &&
+        HFS_BT_Search(&cat->bt, &hint->key, node, &foundKey, &data, &dataLen)) {
+        found = (record_cnid(data) == cnid);
+    }
 
+    if (found) {
+        memcpy(key, foundKey, 1u + ((HFS_CatKey*)foundKey)->keyLength);
+        memcpy(rec, data, (dataLen < sizeof(HFS_CatFileRec)) ? dataLen : sizeof(HFS_CatFileRec));
+    }
+    TempScratch_Release(mark);
+    if (found) return true;
+
+    /* Files only get a thread record once something refers to them by ID,
+     * and HFS_CreateBlankVolume writes none at all: walk the leaves,
+     * remembering every record's key on the way */
+    if (!cat->idHints) {
+        cat->idHints = (HFS_CatIDHint*)NewPtrClear(CAT_ID_HINTS * sizeof(HFS_CatIDHint));
+    }
     GetByIDContext ctx = {
         .targetID = cnid,
-        .result = entry,
+        .key = key,
+        .rec = rec,
+        .hints = cat->idHints,
         .found = false
     };
-
-    /* Iterate through all leaf nodes looking for our ID */
     HFS_BT_IterateLeaves(&cat->bt, getbyid_callback, &ctx);
 
     return ctx.found;
-}
\ No newline at end of file
+}
+
+bool HFS_CatalogGetByID(HFS_Catalog* cat, FileID cnid, CatEntry* entry) {
+    if (!cat || !entry || cnid < HFS_FIRST_CNID) return false;
+
+    HFS_CatKey key;
+    uint8_t rec[sizeof(HFS_CatFileRec)];
+
+    if (!HFS_CatalogGetRecordByID(cat, cnid, &key, rec)) {
+        return false;
+    }
+    return HFS_ParseCatalogRecord(&key, rec, sizeof(rec), entry);
+}
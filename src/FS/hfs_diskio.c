@@ -1,6 +1,9 @@
 /* HFS Disk I/O Implementation */
 #include "../../include/FS/hfs_diskio.h"
+#include "../../include/FS/hfs_bcache.h"
+#include "../../include/FS/hfs_image.h"
 #include "../../include/MemoryMgr/MemoryManager.h"
+#include "../../include/MemoryMgr/TempMemory.h"
 #if !defined(__arm__) && !defined(__aarch64__) && !defined(HFS_DISABLE_ATA) && !defined(HFS_DISABLE_ATA)
 #include "../../include/ATA_Driver.h"
 #endif
@@ -29,71 +32,29 @@ bool HFS_BD_InitMemory(HFS_BlockDev* bd, void* buffer, uint64_t size) {
     bd->size = size;
     bd->sectorSize = 512;
     bd->readonly = false;
+    bd->cacheId = 0;  /* Already in RAM */
     return true;
 }
 
 bool HFS_BD_InitFile(HFS_BlockDev* bd, const char* path, bool readonly) {
-    extern FILE* fopen(const char* filename, const char* mode);
-    extern int fclose(FILE* stream);
-    extern int fseek(FILE* stream, long offset, int whence);
-    extern long ftell(FILE* stream);
-    extern size_t fread(void* ptr, size_t size, size_t nmemb, FILE* stream);
-    FILE* file = NULL;
-    long fileSize;
-    size_t bytesRead;
-
     if (!bd) return false;
 
-    bd->type = HFS_BD_TYPE_FILE;
     bd->device_index = -1;
-
-    /* Try to open the disk image file */
-    if (path && path[0] != '\0') {
-        file = fopen(path, readonly ? "rb" : "rb+");
-    }
-
-    if (file) {
-        /* Get file size */
-        if (fseek(file, 0, SEEK_END) != 0) {
-            fclose(file);
-            return false;
-        }
-
-        fileSize = ftell(file);
-        if (fileSize <= 0 || fileSize > 100 * 1024 * 1024) {  /* Cap at 100MB */
-            fclose(file);
-            return false;
-        }
-
-        /* Allocate memory for disk image */
-        bd->size = (uint32_t)fileSize;
-        bd->data = NewPtr(bd->size);
-        if (!bd->data) {
-            fclose(file);
-            return false;
-        }
-
-        /* Read disk image into memory */
-        if (fseek(file, 0, SEEK_SET) != 0) {
-            DisposePtr((Ptr)bd->data);
-            fclose(file);
-            return false;
-        }
-
-        bytesRead = fread(bd->data, 1, bd->size, file);
-        fclose(file);
-
-        if (bytesRead != bd->size) {
-            DisposePtr((Ptr)bd->data);
-            return false;
-        }
-
+    bd->cacheId = 0;
+
+    /* Existing images are paged in on demand rather than loaded whole */
+    HFS_Image* image = HFS_Image_Open(path, readonly);
+    if (image) {
+        bd->type = HFS_BD_TYPE_FILE;
+        bd->data = image;
+        bd->size = HFS_Image_Size(image);
         bd->sectorSize = 512;
         bd->readonly = readonly;
         return true;
     }
 
-    /* File doesn't exist or no path provided - create empty disk image */
+    /* File doesn't exist or no path provided - create empty RAM disk image */
+    bd->type = HFS_BD_TYPE_MEMORY;
     bd->size = 4 * 1024 * 1024;  /* Default 4MB */
     bd->data = NewPtr(bd->size);
     if (!bd->data) return false;
@@ -133,9 +94,10 @@ bool HFS_BD_InitATA(HFS_BlockDev* bd, int device_index, bool readonly) {
     bd->type = HFS_BD_TYPE_ATA;
     bd->data = NULL;
     bd->device_index = device_index;
-    bd->size = (uint64_t)ata_dev->sectors * 512;
+    bd->size = ATA_GetSectorCount(ata_dev) * 512;
     bd->sectorSize = 512;
     bd->readonly = readonly;
+    bd->cacheId = HFS_BC_Attach(bd);
 
     FS_LOG_DEBUG("HFS: ATA block device initialized (size=%u MB)\n",
                  (uint32_t)(bd->size / (1024 * 1024)));
@@ -168,6 +130,7 @@ bool HFS_BD_InitSDHCI(HFS_BlockDev* bd, int drive_index, bool readonly) {
     bd->size = info.block_count * info.block_size;
     bd->sectorSize = info.block_size;
     bd->readonly = readonly;
+    bd->cacheId = HFS_BC_Attach(bd);
 
     FS_LOG_DEBUG("HFS: SDHCI block device initialized (size=%u MB)\n",
                  (uint32_t)(bd->size / (1024 * 1024)));
@@ -180,224 +143,162 @@ bool HFS_BD_InitSDHCI(HFS_BlockDev* bd, int drive_index, bool readonly) {
     #endif
 }
 
-bool HFS_BD_Read(const HFS_BlockDev* bd, uint64_t offset, void* buffer, uint32_t length) {
-    if (!bd || !buffer) return false;
-    if (offset + length > bd->size) return false;
+bool HFS_BD_TransferSectors(const HFS_BlockDev* bd, uint32_t sector, uint32_t count,
+                            void* buffer, bool write) {
+    if (!bd || !buffer || bd->sectorSize == 0) return false;
+    if (((uint64_t)sector + count) * bd->sectorSize > bd->size) return false;
 
 #if !defined(__arm__) && !defined(__aarch64__) && !defined(HFS_DISABLE_ATA)
     if (bd->type == HFS_BD_TYPE_ATA) {
-        /* ATA device - read sectors */
         ATADevice* ata_dev = ATA_GetDevice(bd->device_index);
         if (!ata_dev) return false;
 
-        /* Prevent division by zero */
-        if (bd->sectorSize == 0) {
-            return false;
-        }
-
-        /* Reject offsets that would overflow 32-bit sector math */
-        if (offset + length > (uint64_t)UINT32_MAX * bd->sectorSize) {
-            return false;  /* Offset too large */
-        }
-
-        /* Calculate sector alignment using 64-bit math, then truncate */
-        uint32_t start_sector = (uint32_t)(offset / bd->sectorSize);
-        uint32_t end_sector = (uint32_t)((offset + length + bd->sectorSize - 1) / bd->sectorSize);
-        uint32_t sector_count = end_sector - start_sector;
-
-        /* Allocate temporary buffer for sector-aligned read */
-        /* Check for integer overflow in multiplication */
-        if (sector_count > UINT32_MAX / bd->sectorSize) {
-            return false;  /* Overflow would occur */
-        }
-
-        uint8_t* temp_buffer = NewPtr(sector_count * bd->sectorSize);
-        if (!temp_buffer) return false;
-
-        /* Read sectors */
-        OSErr err = ATA_ReadSectors(ata_dev, start_sector, sector_count, temp_buffer);
-        if (err != noErr) {
-            DisposePtr((Ptr)temp_buffer);
-            return false;
-        }
-
-        /* Copy requested data from temp buffer */
-        uint32_t offset_in_sector = (uint32_t)offset % bd->sectorSize;
-        memcpy(buffer, temp_buffer + offset_in_sector, length);
-
-        DisposePtr((Ptr)temp_buffer);
-        return true;
+        /* Durability comes from HFS_BD_Flush, not a flush per transfer */
+        return ATA_Transfer(ata_dev, sector, count, buffer, write) == noErr;
     } else
 #endif
     if (bd->type == HFS_BD_TYPE_SDHCI) {
-        /* SDHCI SD card - read blocks via HAL */
         #if defined(__arm__) || defined(__aarch64__) || defined(HFS_DISABLE_ATA)
-
-        /* Prevent division by zero */
-        if (bd->sectorSize == 0) {
-            return false;
-        }
-
-        /* Reject offsets that would overflow 32-bit block math */
-        if (offset + length > (uint64_t)UINT32_MAX * bd->sectorSize) {
-            return false;  /* Offset too large */
-        }
-
-        /* Calculate block alignment using 64-bit math, then truncate */
-        uint32_t start_block = (uint32_t)(offset / bd->sectorSize);
-        uint32_t end_block = (uint32_t)((offset + length + bd->sectorSize - 1) / bd->sectorSize);
-        uint32_t block_count = end_block - start_block;
-
-        /* Allocate temporary buffer for block-aligned read */
-        /* Check for integer overflow in multiplication */
-        if (block_count > UINT32_MAX / bd->sectorSize) {
-            return false;  /* Overflow would occur */
-        }
-
-        uint8_t* temp_buffer = NewPtr(block_count * bd->sectorSize);
-        if (!temp_buffer) return false;
-
-        /* Read blocks via HAL storage interface */
-        OSErr err = hal_storage_read_blocks(bd->device_index, start_block, block_count, temp_buffer);
-        if (err != 0) {  /* noErr should be 0 */
-            DisposePtr((Ptr)temp_buffer);
-            return false;
-        }
-
-        /* Copy requested data from temp buffer */
-        uint32_t offset_in_block = (uint32_t)offset % bd->sectorSize;
-        memcpy(buffer, temp_buffer + offset_in_block, length);
-
-        DisposePtr((Ptr)temp_buffer);
-        return true;
+        OSErr err = write ? hal_storage_write_blocks(bd->device_index, sector, count, buffer)
+                          : hal_storage_read_blocks(bd->device_index, sector, count, buffer);
+        return (err == 0);  /* noErr should be 0 */
         #else
         return false;
         #endif
+    } else if (bd->type == HFS_BD_TYPE_FILE) {
+        uint64_t offset = (uint64_t)sector * bd->sectorSize;
+        return write ? HFS_Image_Write((HFS_Image*)bd->data, offset, buffer, count * bd->sectorSize)
+                     : HFS_Image_Read((HFS_Image*)bd->data, offset, buffer, count * bd->sectorSize);
     } else {
-        /* Memory or file-based device */
+        /* Memory-based device */
         if (!bd->data) return false;
-        memcpy(buffer, (uint8_t*)bd->data + offset, length);
+        uint8_t* image = (uint8_t*)bd->data + (uint64_t)sector * bd->sectorSize;
+        if (write) {
+            memcpy(image, buffer, count * bd->sectorSize);
+        } else {
+            memcpy(buffer, image, count * bd->sectorSize);
+        }
         return true;
     }
 }
 
-bool HFS_BD_Write(HFS_BlockDev* bd, uint64_t offset, const void* buffer, uint32_t length) {
-    if (!bd || !buffer) return false;
-    if (bd->readonly) return false;
-    if (offset + length > bd->size) return false;
-
-#if !defined(__arm__) && !defined(__aarch64__) && !defined(HFS_DISABLE_ATA)
-    if (bd->type == HFS_BD_TYPE_ATA) {
-        /* ATA device - write sectors */
-        ATADevice* ata_dev = ATA_GetDevice(bd->device_index);
-        if (!ata_dev) return false;
-
-        /* Prevent division by zero */
-        if (bd->sectorSize == 0) {
-            return false;
-        }
+/* Sector range covering [offset, offset + length) */
+static bool sector_span(const HFS_BlockDev* bd, uint64_t offset, uint32_t length,
+                        uint32_t* start, uint32_t* count) {
+    /* Prevent division by zero */
+    if (bd->sectorSize == 0) {
+        return false;
+    }
 
-        /* Reject offsets that would overflow 32-bit sector math */
-        if (offset + length > (uint64_t)UINT32_MAX * bd->sectorSize) {
-            return false;  /* Offset too large */
-        }
+    /* Reject offsets that would overflow 32-bit sector math */
+    if (offset + length > (uint64_t)UINT32_MAX * bd->sectorSize) {
+        return false;
+    }
 
-        /* Calculate sector alignment using 64-bit math, then truncate */
-        uint32_t start_sector = (uint32_t)(offset / bd->sectorSize);
-        uint32_t end_sector = (uint32_t)((offset + length + bd->sectorSize - 1) / bd->sectorSize);
-        uint32_t sector_count = end_sector - start_sector;
-        uint32_t offset_in_sector = (uint32_t)(offset % bd->sectorSize);
+    *start = (uint32_t)(offset / bd->sectorSize);
+    uint32_t end = (uint32_t)((offset + length + bd->sectorSize - 1) / bd->sectorSize);
+    *count = end - *start;
 
-        /* Allocate temporary buffer for sector-aligned write */
-        /* Check for integer overflow in multiplication */
-        if (sector_count > UINT32_MAX / bd->sectorSize) {
-            return false;  /* Overflow would occur */
-        }
+    /* Check for integer overflow in the bounce buffer size */
+    return *count <= UINT32_MAX / bd->sectorSize;
+}
 
-        uint8_t* temp_buffer = NewPtr(sector_count * bd->sectorSize);
-        if (!temp_buffer) return false;
-
-        /* If write doesn't start/end on sector boundary, need to read-modify-write */
-        if (offset_in_sector != 0 || ((uint32_t)offset + length) % bd->sectorSize != 0) {
-            /* Read existing sectors first */
-            OSErr err = ATA_ReadSectors(ata_dev, start_sector, sector_count, temp_buffer);
-            if (err != noErr) {
-                DisposePtr((Ptr)temp_buffer);
-                return false;
-            }
-        }
+bool HFS_BD_Read(const HFS_BlockDev* bd, uint64_t offset, void* buffer, uint32_t length) {
+    if (!bd || !buffer) return false;
+    if (offset + length > bd->size) return false;
 
-        /* Copy new data into temp buffer */
-        memcpy(temp_buffer + offset_in_sector, buffer, length);
+    if (bd->cacheId) {
+        return HFS_BC_Read(bd, offset, buffer, length);
+    }
 
-        /* Write sectors */
-        OSErr err = ATA_WriteSectors(ata_dev, start_sector, sector_count, temp_buffer);
-        DisposePtr((Ptr)temp_buffer);
+    if (bd->type == HFS_BD_TYPE_MEMORY) {
+        if (!bd->data) return false;
+        memcpy(buffer, (uint8_t*)bd->data + offset, length);
+        return true;
+    }
 
-        return (err == noErr);
-    } else
-#endif
-    if (bd->type == HFS_BD_TYPE_SDHCI) {
-        /* SDHCI SD card - write blocks via HAL */
-        #if defined(__arm__) || defined(__aarch64__) || defined(HFS_DISABLE_ATA)
+    if (bd->type == HFS_BD_TYPE_FILE) {
+        return HFS_Image_Read((HFS_Image*)bd->data, offset, buffer, length);
+    }
 
-        /* Prevent division by zero */
-        if (bd->sectorSize == 0) {
-            return false;
-        }
+    uint32_t start_sector, sector_count;
+    if (!sector_span(bd, offset, length, &start_sector, &sector_count)) {
+        return false;
+    }
 
-        /* Reject offsets that would overflow 32-bit block math */
-        if (offset + length > (uint64_t)UINT32_MAX * bd->sectorSize) {
-            return false;  /* Offset too large */
-        }
+    /* Whole sectors go straight into the caller's buffer */
+    if (offset % bd->sectorSize == 0 && length % bd->sectorSize == 0) {
+        return HFS_BD_TransferSectors(bd, start_sector, sector_count, buffer, false);
+    }
 
-        /* Calculate block alignment using 64-bit math, then truncate */
-        uint32_t start_block = (uint32_t)(offset / bd->sectorSize);
-        uint32_t end_block = (uint32_t)((offset + length + bd->sectorSize - 1) / bd->sectorSize);
-        uint32_t block_count = end_block - start_block;
-        uint32_t offset_in_block = (uint32_t)(offset % bd->sectorSize);
+    /* Uncached device: bounce through the scratch arena */
+    TempScratchMark mark = TempScratch_Mark();
+    uint8_t* temp_buffer = TempScratch_Alloc(sector_count * bd->sectorSize);
+    if (!temp_buffer) return false;
 
-        /* Allocate temporary buffer for block-aligned write */
-        /* Check for integer overflow in multiplication */
-        if (block_count > UINT32_MAX / bd->sectorSize) {
-            return false;  /* Overflow would occur */
-        }
+    bool ok = HFS_BD_TransferSectors(bd, start_sector, sector_count, temp_buffer, false);
+    if (ok) {
+        memcpy(buffer, temp_buffer + (uint32_t)(offset % bd->sectorSize), length);
+    }
 
-        uint8_t* temp_buffer = NewPtr(block_count * bd->sectorSize);
-        if (!temp_buffer) return false;
-
-        /* If write doesn't start/end on block boundary, need to read-modify-write */
-        if (offset_in_block != 0 || ((uint32_t)offset + length) % bd->sectorSize != 0) {
-            /* Read existing blocks first */
-            OSErr err = hal_storage_read_blocks(bd->device_index, start_block, block_count, temp_buffer);
-            if (err != 0) {  /* noErr should be 0 */
-                DisposePtr((Ptr)temp_buffer);
-                return false;
-            }
-        }
+    TempScratch_Release(mark);
+    return ok;
+}
 
-        /* Copy new data into temp buffer */
-        memcpy(temp_buffer + offset_in_block, buffer, length);
+bool HFS_BD_Write(HFS_BlockDev* bd, uint64_t offset, const void* buffer, uint32_t length) {
+    if (!bd || !buffer) return false;
+    if (bd->readonly) return false;
+    if (offset + length > bd->size) return false;
 
-        /* Write blocks via HAL storage interface */
-        OSErr err = hal_storage_write_blocks(bd->device_index, start_block, block_count, temp_buffer);
-        DisposePtr((Ptr)temp_buffer);
+    if (bd->cacheId) {
+        return HFS_BC_Write(bd, offset, buffer, length);
+    }
 
-        return (err == 0);  /* noErr should be 0 */
-        #else
-        return false;
-        #endif
-    } else {
-        /* Memory or file-based device */
+    if (bd->type == HFS_BD_TYPE_MEMORY) {
         if (!bd->data) return false;
         memcpy((uint8_t*)bd->data + offset, buffer, length);
         return true;
     }
+
+    if (bd->type == HFS_BD_TYPE_FILE) {
+        return HFS_Image_Write((HFS_Image*)bd->data, offset, buffer, length);
+    }
+
+    /* Uncached device: bounce through the scratch arena */
+    uint32_t start_sector, sector_count;
+    if (!sector_span(bd, offset, length, &start_sector, &sector_count)) {
+        return false;
+    }
+    uint32_t offset_in_sector = (uint32_t)(offset % bd->sectorSize);
+
+    TempScratchMark mark = TempScratch_Mark();
+    uint8_t* temp_buffer = TempScratch_Alloc(sector_count * bd->sectorSize);
+    if (!temp_buffer) return false;
+
+    /* If write doesn't start/end on sector boundary, need to read-modify-write */
+    if (offset_in_sector != 0 || (offset + length) % bd->sectorSize != 0) {
+        if (!HFS_BD_TransferSectors(bd, start_sector, sector_count, temp_buffer, false)) {
+            TempScratch_Release(mark);
+            return false;
+        }
+    }
+
+    memcpy(temp_buffer + offset_in_sector, buffer, length);
+    bool ok = HFS_BD_TransferSectors(bd, start_sector, sector_count, temp_buffer, true);
+
+    TempScratch_Release(mark);
+    return ok;
 }
 
 void HFS_BD_Close(HFS_BlockDev* bd) {
     if (!bd) return;
 
+    /* Write back and drop this device's cached blocks */
+    if (bd->cacheId) {
+        HFS_BC_Detach(bd->cacheId);
+        bd->cacheId = 0;
+    }
+
 #if !defined(__arm__) && !defined(__aarch64__) && !defined(HFS_DISABLE_ATA)
     if (bd->type == HFS_BD_TYPE_ATA) {
         /* Flush ATA device cache before closing */
@@ -411,7 +312,11 @@ void HFS_BD_Close(HFS_BlockDev* bd) {
     if (bd->type == HFS_BD_TYPE_SDHCI) {
         /* SDHCI devices don't need explicit flushing (SD protocol handles this) */
         bd->device_index = -1;
-    } else if (bd->type == HFS_BD_TYPE_MEMORY || bd->type == HFS_BD_TYPE_FILE) {
+    } else if (bd->type == HFS_BD_TYPE_FILE) {
+        /* Writes back dirty chunks and closes the image */
+        HFS_Image_Close((HFS_Image*)bd->data);
+        bd->data = NULL;
+    } else if (bd->type == HFS_BD_TYPE_MEMORY) {
         /* If we allocated memory, free it */
         if (bd->data) {
             DisposePtr((Ptr)bd->data);
@@ -439,6 +344,11 @@ bool HFS_BD_WriteSector(HFS_BlockDev* bd, uint32_t sector, const void* buffer) {
 bool HFS_BD_Flush(HFS_BlockDev* bd) {
     if (!bd) return false;
 
+    /* Cached writes reach the device before its own cache is flushed */
+    if (bd->cacheId && !HFS_BC_Flush(bd->cacheId)) {
+        return false;
+    }
+
 #if !defined(__arm__) && !defined(__aarch64__) && !defined(HFS_DISABLE_ATA)
     if (bd->type == HFS_BD_TYPE_ATA) {
         /* Flush ATA device cache */
@@ -453,8 +363,10 @@ bool HFS_BD_Flush(HFS_BlockDev* bd) {
     if (bd->type == HFS_BD_TYPE_SDHCI) {
         /* SDHCI devices handle flushing internally */
         return true;
+    } else if (bd->type == HFS_BD_TYPE_FILE) {
+        return HFS_Image_Flush((HFS_Image*)bd->data);
     }
 
-    /* Memory/file devices don't need explicit flushing */
+    /* Memory devices don't need explicit flushing */
     return true;
 }
@@ -8,175 +8,155 @@
 
 /* Serial debug output */
 
-/* Context for find_file_record callback */
-typedef struct {
-    FileID target;
-    HFS_CatFileRec* result;
-    bool found;
-} FindContext;
-
-/* Callback for B-tree iteration during file lookup */
-static bool find_file_callback(void* keyPtr, uint16_t keyLen,
-                               void* dataPtr, uint16_t dataLen,
-                               void* context) {
-    FindContext* findCtx = (FindContext*)context;
-    uint16_t recordType = be16_read(dataPtr);
-
-    if (recordType == kHFS_FileRecord) {
-        HFS_CatFileRec* rec = (HFS_CatFileRec*)dataPtr;
-        uint32_t fileID = be32_read(&rec->fileID);
-
-        if (fileID == findCtx->target) {
-            memcpy(findCtx->result, rec, sizeof(HFS_CatFileRec));
-            findCtx->found = true;
-            return false;  /* Stop iteration */
-        }
-    }
-
-    return true;  /* Continue */
-}
-
 /* Find file record in catalog by ID */
 static bool find_file_record(HFS_Catalog* cat, FileID id, HFS_CatFileRec* fileRec) {
-    /* This is a simplified version - in reality we'd search the B-tree directly */
-
-    /* Build a thread record key to find the file */
-    /* For now, do a linear search through catalog */
-
-    FindContext ctx = { .target = id, .result = fileRec, .found = false };
-
-    HFS_BT_IterateLeaves(&cat->bt, find_file_callback, &ctx);
-    return ctx.found;
-}
+    HFS_CatKey key;
+    uint8_t rec[sizeof(HFS_CatFileRec)];
 
-/* Read data from file extents */
-static bool read_from_extents(HFS_Volume* vol, const HFS_Extent* extents,
-                             uint32_t fileSize, uint32_t offset,
-                             void* buffer, uint32_t length,
-                             uint32_t* bytesRead) {
-    if (!vol || !extents || !buffer || !bytesRead) return false;
-
-    *bytesRead = 0;
-
-    /* Limit read to file size */
-    if (offset >= fileSize) return true;  /* EOF */
-    if (offset + length > fileSize) {
-        length = fileSize - offset;
+    if (!HFS_CatalogGetRecordByID(cat, id, &key, rec) ||
+        be16_read(rec) != kHFS_FileRecord) {
+        return false;
     }
 
-    uint32_t currentOffset = 0;
-    uint32_t remaining = length;
-    uint8_t* dst = (uint8_t*)buffer;
-
-    /* Read from first 3 extents */
-    for (int i = 0; i < 3 && remaining > 0; i++) {
-        if (extents[i].blockCount == 0) break;
+    memcpy(fileRec, rec, sizeof(HFS_CatFileRec));
+    return true;
+}
 
-        uint32_t extentBytes = extents[i].blockCount * vol->alBlkSize;
+/* Append an extent to the file's map, merging it into the previous run
+ * when the two are physically adjacent */
+static bool map_append(HFSFile* file, uint16_t* capacity, uint32_t startBlock, uint32_t blockCount) {
+    if (blockCount == 0) return true;
 
-        /* Skip this extent if we're past it */
-        if (offset >= currentOffset + extentBytes) {
-            currentOffset += extentBytes;
-            continue;
+    if (file->extCount > 0) {
+        HFS_FileExtent* last = &file->extMap[file->extCount - 1];
+        if (last->startBlock + last->blockCount == startBlock) {
+            last->blockCount += blockCount;
+            return true;
         }
+    }
 
-        /* Calculate read position within this extent */
-        uint32_t extentOffset = offset - currentOffset;
-        uint32_t toRead = extentBytes - extentOffset;
-        if (toRead > remaining) toRead = remaining;
+    if (file->extCount == *capacity) {
+        if (*capacity >= 0x8000) return false;
+        uint16_t newCapacity = *capacity * 2;
+        HFS_FileExtent* grown = (HFS_FileExtent*)NewPtr(newCapacity * sizeof(HFS_FileExtent));
+        if (!grown) return false;
+        memcpy(grown, file->extMap, file->extCount * sizeof(HFS_FileExtent));
+        DisposePtr((Ptr)file->extMap);
+        file->extMap = grown;
+        *capacity = newCapacity;
+    }
 
-        /* Prevent division by zero */
-        if (vol->alBlkSize == 0) {
-            return false;
-        }
+    HFS_FileExtent* e = &file->extMap[file->extCount];
+    e->fileBlock = (file->extCount > 0)
+        ? file->extMap[file->extCount - 1].fileBlock + file->extMap[file->extCount - 1].blockCount
+        : 0;
+    e->startBlock = startBlock;
+    e->blockCount = blockCount;
+    file->extCount++;
+    return true;
+}
 
-        /* Calculate allocation block and offset within it */
-        uint32_t startAllocBlock = extents[i].startBlock + (extentOffset / vol->alBlkSize);
-        uint32_t allocOffset = extentOffset % vol->alBlkSize;
-        uint32_t blocksToRead = (toRead + allocOffset + vol->alBlkSize - 1) / vol->alBlkSize;
+/* Map the open fork once: the catalog's three extents, then overflow
+ * records from the extents B-tree until the fork's size is covered */
+static bool build_extent_map(HFSFile* file) {
+    HFS_Volume* vol = file->vol;
+    if (!vol || vol->alBlkSize == 0) return false;
 
-        /* Allocate temporary buffer for block-aligned read */
-        /* Check for integer overflow in multiplication */
-        if (blocksToRead > UINT32_MAX / vol->alBlkSize) {
-            return false;  /* Overflow would occur */
-        }
-
-        uint8_t* tempBuf = NewPtr(blocksToRead * vol->alBlkSize);
-        if (!tempBuf) return false;
+    const HFS_Extent* extents = file->isResource ? file->rsrcExtents : file->dataExtents;
+    uint32_t fileSize = file->isResource ? file->rsrcSize : file->dataSize;
+    uint32_t needed = (uint32_t)(((uint64_t)fileSize + vol->alBlkSize - 1) / vol->alBlkSize);
+
+    uint16_t capacity = 4;
+    file->extMap = (HFS_FileExtent*)NewPtr(capacity * sizeof(HFS_FileExtent));
+    if (!file->extMap) return false;
+    file->extCount = 0;
+    file->extHint = 0;
+
+    uint32_t covered = 0;
+    for (int i = 0; i < 3 && extents[i].blockCount != 0; i++) {
+        if (!map_append(file, &capacity, extents[i].startBlock, extents[i].blockCount)) break;
+        covered += extents[i].blockCount;
+    }
 
-        /* Read the allocation blocks */
-        if (!HFS_ReadAllocBlocks(vol, startAllocBlock, blocksToRead, tempBuf)) {
-            DisposePtr((Ptr)tempBuf);
-            return false;
+    if (covered < needed) {
+        HFS_BTree extBTree;
+        if (HFS_BT_Init(&extBTree, vol, kBTreeExtents)) {
+            /* Overflow records are keyed by the file block they start at */
+            while (covered < needed && covered <= 0xFFFF) {
+                uint8_t extKey[8];
+                extKey[0] = 7;  /* key length excluding first byte */
+                extKey[1] = file->isResource ? 0xFF : 0x00;
+                be32_write(extKey + 2, file->id);
+                be16_write(extKey + 6, (uint16_t)covered);
+
+                uint8_t recordBuffer[32];
+                uint16_t recordLen = 0;
+                if (!HFS_BT_FindRecord(&extBTree, extKey, sizeof(extKey), recordBuffer, &recordLen) ||
+                    recordLen < 12) {
+                    break;
+                }
+
+                uint32_t added = 0;
+                for (int i = 0; i < 3; i++) {
+                    uint16_t start = be16_read(recordBuffer + i * 4);
+                    uint16_t count = be16_read(recordBuffer + i * 4 + 2);
+                    if (count == 0) break;
+                    if (!map_append(file, &capacity, start, count)) break;
+                    added += count;
+                }
+                if (added == 0) break;
+                covered += added;
+            }
+            HFS_BT_Close(&extBTree);
         }
-
-        /* Copy requested portion to destination */
-        memcpy(dst, tempBuf + allocOffset, toRead);
-        DisposePtr((Ptr)tempBuf);
-
-        dst += toRead;
-        offset += toRead;
-        remaining -= toRead;
-        *bytesRead += toRead;
-        currentOffset += extentBytes;
     }
 
+    if (covered < needed) {
+        FS_LOG_WARN("HFS File: file ID %u %s fork maps %u of %u blocks\n",
+                    file->id, file->isResource ? "rsrc" : "data", covered, needed);
+    }
     return true;
 }
 
-/* Read data from overflow extents B-tree */
-static bool read_from_overflow_extents(HFS_Volume* vol, FileID fileID,
-                                       bool isResource, uint32_t fileSize,
-                                       uint32_t offset, void* buffer,
-                                       uint32_t length, uint32_t* bytesRead,
-                                       uint32_t firstThreeExtentsSize) {
-    if (!vol || !buffer || !bytesRead) return false;
-
-    *bytesRead = 0;
-
-    /* Skip if read is within first 3 extents */
-    if (offset < firstThreeExtentsSize) return true;
-
-    /* Initialize extents B-tree */
-    HFS_BTree extBTree;
-    if (!HFS_BT_Init(&extBTree, vol, kBTreeExtents)) {
-        return false;
+/* Map entry holding file allocation block `fileBlock`, or -1 */
+static int find_extent(HFSFile* file, uint32_t fileBlock) {
+    /* Sequential reads stay in the same or the next extent */
+    for (uint16_t i = file->extHint; i < file->extCount && i <= file->extHint + 1; i++) {
+        const HFS_FileExtent* e = &file->extMap[i];
+        if (fileBlock >= e->fileBlock && fileBlock - e->fileBlock < e->blockCount) return i;
     }
 
-    bool foundExtents = false;
-
-    /* Search for overflow extents starting at file block 0 of overflow */
-    uint32_t searchBlock = firstThreeExtentsSize / vol->alBlkSize;
-
-    /* Build extent key: keyLen + reserved + fileID + forkType + startBlock */
-    uint8_t extKey[9];
-    extKey[0] = 7;  /* key length excluding first byte */
-    extKey[1] = 0;  /* reserved */
-    be32_write(extKey + 2, fileID);
-    extKey[6] = isResource ? 0xFF : 0x00;
-    be16_write(extKey + 7, (uint16_t)searchBlock);
-
-    /* Look up extent record */
-    uint8_t recordBuffer[32];
-    uint16_t recordLen = 0;
-
-    if (HFS_BT_FindRecord(&extBTree, extKey, 9, recordBuffer, &recordLen)) {
-        /* Found overflow extent record - it contains 3 more extents */
-        if (recordLen >= 12) {  /* 3 extents * 4 bytes each */
-            HFS_Extent overflowExtents[3];
-            for (int i = 0; i < 3; i++) {
-                overflowExtents[i].startBlock = be16_read(recordBuffer + i * 4);
-                overflowExtents[i].blockCount = be16_read(recordBuffer + i * 4 + 2);
-            }
-
-            /* Read from overflow extents */
-            foundExtents = read_from_extents(vol, overflowExtents, fileSize,
-                                           offset, buffer, length, bytesRead);
+    int lo = 0, hi = (int)file->extCount - 1;
+    while (lo <= hi) {
+        int mid = (lo + hi) / 2;
+        const HFS_FileExtent* e = &file->extMap[mid];
+        if (fileBlock < e->fileBlock) {
+            hi = mid - 1;
+        } else if (fileBlock - e->fileBlock >= e->blockCount) {
+            lo = mid + 1;
+        } else {
+            return mid;
         }
     }
+    return -1;
+}
 
-    HFS_BT_Close(&extBTree);
-    return foundExtents;
+/* Read a contiguous device range: partial head and tail sectors are
+ * bounced by the block layer, whole sectors in between go straight into
+ * the caller's buffer */
+static bool read_device_range(HFS_Volume* vol, uint64_t offset, uint8_t* dst, uint32_t length) {
+    uint32_t sectorSize = vol->bd.sectorSize;
+    if (sectorSize == 0) return HFS_BD_Read(&vol->bd, offset, dst, length);
+
+    uint32_t head = (uint32_t)((sectorSize - offset % sectorSize) % sectorSize);
+    if (head > length) head = length;
+    uint32_t middle = ((length - head) / sectorSize) * sectorSize;
+    uint32_t tail = length - head - middle;
+
+    if (head && !HFS_BD_Read(&vol->bd, offset, dst, head)) return false;
+    if (middle && !HFS_BD_Read(&vol->bd, offset + head, dst + head, middle)) return false;
+    if (tail && !HFS_BD_Read(&vol->bd, offset + head + middle, dst + head + middle, tail)) return false;
+    return true;
 }
 
 HFSFile* HFS_FileOpen(HFS_Catalog* cat, FileID id, bool resourceFork) {
@@ -222,9 +202,6 @@ HFSFile* HFS_FileOpen(HFS_Catalog* cat, FileID id, bool resourceFork) {
 HFSFile* HFS_FileOpenByPath(HFS_Catalog* cat, const char* path, bool resourceFork) {
     if (!cat || !path) return NULL;
 
-    /* Get volume info to find root directory */
-    extern bool VFS_Lookup(VRefNum vref, DirID dir, const char* name, CatEntry* entry);
-    VRefNum vref = (VRefNum)(size_t)cat->vol;  /* Simplified - assumes vol pointer can be cast */
     DirID currentDir = 2;  /* HFS root directory is typically CNID 2 */
 
     const char* cursor = path;
@@ -262,7 +239,7 @@ HFSFile* HFS_FileOpenByPath(HFS_Catalog* cat, const char* path, bool resourceFor
 
         /* Look up component in current directory */
         CatEntry entry;
-        if (!VFS_Lookup(vref, currentDir, component, &entry)) {
+        if (!HFS_CatalogLookup(cat, currentDir, component, &entry)) {
             FS_LOG_DEBUG("HFS File: Component '%s' not found in path '%s'\n", component, path);
             return NULL;
         }
@@ -299,6 +276,9 @@ HFSFile* HFS_FileOpenByPath(HFS_Catalog* cat, const char* path, bool resourceFor
 
 void HFS_FileClose(HFSFile* file) {
     if (file) {
+        if (file->extMap) {
+            DisposePtr((Ptr)file->extMap);
+        }
         DisposePtr((Ptr)file);
     }
 }
@@ -306,40 +286,49 @@ void HFS_FileClose(HFSFile* file) {
 bool HFS_FileRead(HFSFile* file, void* buffer, uint32_t length, uint32_t* bytesRead) {
     if (!file || !buffer || !bytesRead) return false;
 
-    const HFS_Extent* extents = file->isResource ? file->rsrcExtents : file->dataExtents;
+    *bytesRead = 0;
+
+    /* Limit read to file size */
     uint32_t fileSize = file->isResource ? file->rsrcSize : file->dataSize;
-    uint32_t initialBytesRead = 0;
-
-    /* First, try to read from the first 3 extents */
-    bool result = read_from_extents(file->vol, extents, fileSize,
-                                   file->position, buffer, length, &initialBytesRead);
-
-    *bytesRead = initialBytesRead;
-
-    /* If we didn't get all requested bytes and haven't read anything yet,
-     * try overflow extents for large files */
-    if (result && initialBytesRead < length && initialBytesRead == 0) {
-        /* Calculate size covered by first 3 extents */
-        uint32_t firstThreeSize = 0;
-        for (int i = 0; i < 3; i++) {
-            if (extents[i].blockCount == 0) break;
-            firstThreeSize += extents[i].blockCount * file->vol->alBlkSize;
-        }
+    if (file->position >= fileSize) return true;  /* EOF */
+    if (length > fileSize - file->position) {
+        length = fileSize - file->position;
+    }
 
-        /* Try reading from overflow extents */
-        uint32_t overflowBytesRead = 0;
-        if (read_from_overflow_extents(file->vol, file->id, file->isResource,
-                                      fileSize, file->position, buffer,
-                                      length, &overflowBytesRead, firstThreeSize)) {
-            *bytesRead += overflowBytesRead;
-        }
+    if (!file->extMap && !build_extent_map(file)) {
+        return false;
     }
 
-    if (result && *bytesRead > 0) {
-        file->position += *bytesRead;
+    HFS_Volume* vol = file->vol;
+    uint8_t* dst = (uint8_t*)buffer;
+    uint32_t position = file->position;
+    uint32_t remaining = length;
+
+    while (remaining > 0) {
+        uint32_t fileBlock = position / vol->alBlkSize;
+        int i = find_extent(file, fileBlock);
+        if (i < 0) break;  /* Unmapped: short read */
+
+        const HFS_FileExtent* e = &file->extMap[i];
+        uint64_t inExtent = (uint64_t)(fileBlock - e->fileBlock) * vol->alBlkSize +
+                            position % vol->alBlkSize;
+        uint64_t available = (uint64_t)e->blockCount * vol->alBlkSize - inExtent;
+        uint32_t toRead = (available < remaining) ? (uint32_t)available : remaining;
+
+        uint64_t devOffset = HFS_AllocBlockToByteOffset(vol, e->startBlock) + inExtent;
+        if (!read_device_range(vol, devOffset, dst, toRead)) {
+            return false;
+        }
+
+        file->extHint = (uint16_t)i;
+        position += toRead;
+        dst += toRead;
+        remaining -= toRead;
     }
 
-    return result;
+    *bytesRead = length - remaining;
+    file->position = position;
+    return true;
 }
 
 bool HFS_FileSeek(HFSFile* file, uint32_t position) {
@@ -0,0 +1,208 @@
+/* HFS Paged Disk Image Implementation */
+#include "../../include/FS/hfs_image.h"
+#include "../../include/MemoryMgr/MemoryManager.h"
+#include <string.h>
+#include <stdio.h>
+#include "FS/FSLogging.h"
+
+extern int fseek(FILE* stream, long offset, int whence);
+extern long ftell(FILE* stream);
+extern size_t fread(void* ptr, size_t size, size_t nmemb, FILE* stream);
+extern size_t fwrite(const void* ptr, size_t size, size_t nmemb, FILE* stream);
+
+typedef struct {
+    uint32_t index;         /* Chunk number within the image */
+    uint32_t lastUse;
+    bool     valid;
+    bool     dirty;
+    uint8_t* data;          /* HFS_IMAGE_CHUNK_SIZE bytes, allocated on first use */
+} ImageChunk;
+
+struct HFS_Image {
+    FILE*      file;
+    uint64_t   size;
+    bool       readonly;
+    uint32_t   clock;
+    ImageChunk chunks[HFS_IMAGE_CHUNKS];
+    HFS_ImageStats stats;
+};
+
+/* Bytes of chunk `index` that lie inside the image */
+static uint32_t chunk_length(const HFS_Image* img, uint32_t index) {
+    uint64_t start = (uint64_t)index * HFS_IMAGE_CHUNK_SIZE;
+    uint64_t left = img->size - start;
+    return (left < HFS_IMAGE_CHUNK_SIZE) ? (uint32_t)left : HFS_IMAGE_CHUNK_SIZE;
+}
+
+static bool seek_chunk(HFS_Image* img, uint32_t index) {
+    uint64_t offset = (uint64_t)index * HFS_IMAGE_CHUNK_SIZE;
+    if (offset > (~0UL >> 1)) return false; /* fseek takes a long */
+    return fseek(img->file, (long)offset, SEEK_SET) == 0;
+}
+
+static bool write_back(HFS_Image* img, ImageChunk* c) {
+    if (!c->dirty) return true;
+
+    uint32_t len = chunk_length(img, c->index);
+    if (!seek_chunk(img, c->index) || fwrite(c->data, 1, len, img->file) != len) {
+        FS_LOG_ERROR("HFS Image: write-back of chunk %u failed\n", c->index);
+        return false;
+    }
+    c->dirty = false;
+    img->stats.writebacks++;
+    return true;
+}
+
+/* Resident chunk `index`, faulting it in over the least recently used one */
+static ImageChunk* get_chunk(HFS_Image* img, uint32_t index) {
+    ImageChunk* victim = NULL;
+
+    for (int i = 0; i < HFS_IMAGE_CHUNKS; i++) {
+        ImageChunk* c = &img->chunks[i];
+        if (c->valid && c->index == index) {
+            c->lastUse = ++img->clock;
+            img->stats.hits++;
+            return c;
+        }
+        if (!c->valid) {
+            if (!victim || victim->valid) victim = c;
+        } else if (!victim || (victim->valid && c->lastUse < victim->lastUse)) {
+            victim = c;
+        }
+    }
+
+    if (victim->valid) {
+        if (!write_back(img, victim)) return NULL;
+        victim->valid = false;
+        img->stats.resident--;
+    }
+
+    if (!victim->data) {
+        victim->data = (uint8_t*)NewPtr(HFS_IMAGE_CHUNK_SIZE);
+        if (!victim->data) return NULL;
+    }
+
+    uint32_t len = chunk_length(img, index);
+    if (!seek_chunk(img, index) || fread(victim->data, 1, len, img->file) != len) {
+        FS_LOG_ERROR("HFS Image: read of chunk %u failed\n", index);
+        return NULL;
+    }
+
+    victim->index = index;
+    victim->valid = true;
+    victim->dirty = false;
+    victim->lastUse = ++img->clock;
+    img->stats.faults++;
+    img->stats.resident++;
+    return victim;
+}
+
+HFS_Image* HFS_Image_Open(const char* path, bool readonly) {
+    if (!path || path[0] == '\0') return NULL;
+
+    FILE* file = fopen(path, readonly ? "rb" : "rb+");
+    if (!file) return NULL;
+
+    long fileSize = -1;
+    if (fseek(file, 0, SEEK_END) == 0) {
+        fileSize = ftell(file);
+    }
+    if (fileSize <= 0) {
+        fclose(file);
+        return NULL;
+    }
+
+    HFS_Image* img = (HFS_Image*)NewPtr(sizeof(HFS_Image));
+    if (!img) {
+        fclose(file);
+        return NULL;
+    }
+
+    memset(img, 0, sizeof(HFS_Image));
+    img->file = file;
+    img->size = (uint64_t)fileSize;
+    img->readonly = readonly;
+    return img;
+}
+
+void HFS_Image_Close(HFS_Image* img) {
+    if (!img) return;
+
+    HFS_Image_Flush(img);
+    for (int i = 0; i < HFS_IMAGE_CHUNKS; i++) {
+        if (img->chunks[i].data) {
+            DisposePtr((Ptr)img->chunks[i].data);
+        }
+    }
+    fclose(img->file);
+    DisposePtr((Ptr)img);
+}
+
+uint64_t HFS_Image_Size(const HFS_Image* img) {
+    return img ? img->size : 0;
+}
+
+bool HFS_Image_Read(HFS_Image* img, uint64_t offset, void* buffer, uint32_t length) {
+    if (!img || !buffer) return false;
+    if (offset + length > img->size) return false;
+
+    uint8_t* dst = (uint8_t*)buffer;
+    while (length > 0) {
+        uint32_t index = (uint32_t)(offset / HFS_IMAGE_CHUNK_SIZE);
+        uint32_t within = (uint32_t)(offset % HFS_IMAGE_CHUNK_SIZE);
+        uint32_t n = HFS_IMAGE_CHUNK_SIZE - within;
+        if (n > length) n = length;
+
+        ImageChunk* c = get_chunk(img, index);
+        if (!c) return false;
+        memcpy(dst, c->data + within, n);
+
+        dst += n;
+        offset += n;
+        length -= n;
+    }
+    return true;
+}
+
+bool HFS_Image_Write(HFS_Image* img, uint64_t offset, const void* buffer, uint32_t length) {
+    if (!img || !buffer || img->readonly) return false;
+    if (offset + length > img->size) return false;
+
+    const uint8_t* src = (const uint8_t*)buffer;
+    while (length > 0) {
+        uint32_t index = (uint32_t)(offset / HFS_IMAGE_CHUNK_SIZE);
+        uint32_t within = (uint32_t)(offset % HFS_IMAGE_CHUNK_SIZE);
+        uint32_t n = HFS_IMAGE_CHUNK_SIZE - within;
+        if (n > length) n = length;
+
+        ImageChunk* c = get_chunk(img, index);
+        if (!c) return false;
+        memcpy(c->data + within, src, n);
+        c->dirty = true;
+
+        src += n;
+        offset += n;
+        length -= n;
+    }
+    return true;
+}
+
+bool HFS_Image_Flush(HFS_Image* img) {
+    if (!img) return true;
+
+    bool ok = true;
+    for (int i = 0; i < HFS_IMAGE_CHUNKS; i++) {
+        ImageChunk* c = &img->chunks[i];
+        if (c->valid && !write_back(img, c)) ok = false;
+    }
+    return ok;
+}
+
+void HFS_Image_GetStats(const HFS_Image* img, HFS_ImageStats* stats) {
+    if (!stats) return;
+    if (!img) {
+        memset(stats, 0, sizeof(*stats));
+        return;
+    }
+    *stats = img->stats;
+}
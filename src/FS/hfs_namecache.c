@@ -0,0 +1,205 @@
+/* HFS Catalog Name Cache Implementation */
+#include "../../include/FS/hfs_namecache.h"
+#include "../../include/FS/hfs_btree.h"
+#include "../../include/MemoryMgr/MemoryManager.h"
+#include <string.h>
+#include "FS/FSLogging.h"
+
+#define NM_BUCKETS  (HFS_NAME_CACHE_ENTRIES / 2)    /* Power of two */
+#define NM_NONE     (-1)
+
+typedef struct {
+    DirID    parentID;
+    uint32_t hash;
+    uint8_t  len;
+    uint8_t  name[31];      /* Folded */
+    bool     valid;
+    bool     negative;
+    int16_t  hashNext;
+    int16_t  lruPrev;       /* Towards most recently used */
+    int16_t  lruNext;       /* Towards least recently used */
+    CatEntry entry;
+} NMEntry;
+
+struct HFS_NameCache {
+    NMEntry  entries[HFS_NAME_CACHE_ENTRIES];
+    int16_t  buckets[NM_BUCKETS];
+    int16_t  lruHead;
+    int16_t  lruTail;
+    HFS_NameCacheStats stats;
+};
+
+/* Fold name into out and hash it with the parent */
+static uint32_t nm_fold(DirID parentID, const uint8_t* name, uint8_t len, uint8_t* out) {
+    uint32_t h = 2166136261u ^ parentID;
+    for (uint8_t i = 0; i < len; i++) {
+        out[i] = HFS_CatalogNameOrder[name[i]];
+        h = (h ^ out[i]) * 16777619u;
+    }
+    return h;
+}
+
+static void lru_unlink(HFS_NameCache* nm, int16_t i) {
+    NMEntry* e = &nm->entries[i];
+    if (e->lruPrev != NM_NONE) nm->entries[e->lruPrev].lruNext = e->lruNext;
+    else nm->lruHead = e->lruNext;
+    if (e->lruNext != NM_NONE) nm->entries[e->lruNext].lruPrev = e->lruPrev;
+    else nm->lruTail = e->lruPrev;
+    e->lruPrev = e->lruNext = NM_NONE;
+}
+
+static void lru_push_front(HFS_NameCache* nm, int16_t i) {
+    NMEntry* e = &nm->entries[i];
+    e->lruPrev = NM_NONE;
+    e->lruNext = nm->lruHead;
+    if (nm->lruHead != NM_NONE) nm->entries[nm->lruHead].lruPrev = i;
+    nm->lruHead = i;
+    if (nm->lruTail == NM_NONE) nm->lruTail = i;
+}
+
+static void drop_entry(HFS_NameCache* nm, int16_t i) {
+    NMEntry* e = &nm->entries[i];
+    int16_t* link = &nm->buckets[e->hash & (NM_BUCKETS - 1)];
+    while (*link != NM_NONE) {
+        if (*link == i) {
+            *link = e->hashNext;
+            break;
+        }
+        link = &nm->entries[*link].hashNext;
+    }
+    e->hashNext = NM_NONE;
+    lru_unlink(nm, i);
+    e->valid = false;
+    nm->stats.cached--;
+}
+
+static int16_t find_entry(HFS_NameCache* nm, DirID parentID, const uint8_t* folded,
+                          uint8_t len, uint32_t hash) {
+    for (int16_t i = nm->buckets[hash & (NM_BUCKETS - 1)]; i != NM_NONE; i = nm->entries[i].hashNext) {
+        NMEntry* e = &nm->entries[i];
+        if (e->hash == hash && e->parentID == parentID && e->len == len &&
+            memcmp(e->name, folded, len) == 0) {
+            return i;
+        }
+    }
+    return NM_NONE;
+}
+
+HFS_NameCache* HFS_NM_Create(void) {
+    HFS_NameCache* nm = (HFS_NameCache*)NewPtr(sizeof(HFS_NameCache));
+    if (!nm) {
+        FS_LOG_WARN("HFS NameCache: no memory, name lookups will search the catalog\n");
+        return NULL;
+    }
+
+    memset(nm, 0, sizeof(HFS_NameCache));
+    nm->lruHead = nm->lruTail = NM_NONE;
+    for (int i = 0; i < NM_BUCKETS; i++) {
+        nm->buckets[i] = NM_NONE;
+    }
+    for (int i = 0; i < HFS_NAME_CACHE_ENTRIES; i++) {
+        nm->entries[i].hashNext = NM_NONE;
+        nm->entries[i].lruPrev = nm->entries[i].lruNext = NM_NONE;
+    }
+    return nm;
+}
+
+void HFS_NM_Destroy(HFS_NameCache* nm) {
+    if (nm) DisposePtr((Ptr)nm);
+}
+
+HFS_NameResult HFS_NM_Lookup(HFS_NameCache* nm, DirID parentID, const uint8_t* name,
+                             uint8_t len, CatEntry* entry) {
+    if (!nm || len > 31) return kHFSNameUnknown;
+
+    uint8_t folded[31];
+    uint32_t hash = nm_fold(parentID, name, len, folded);
+    int16_t i = find_entry(nm, parentID, folded, len, hash);
+    if (i == NM_NONE) {
+        nm->stats.misses++;
+        return kHFSNameUnknown;
+    }
+
+    NMEntry* e = &nm->entries[i];
+    lru_unlink(nm, i);
+    lru_push_front(nm, i);
+    if (e->negative) {
+        nm->stats.negativeHits++;
+        return kHFSNameMissing;
+    }
+    nm->stats.hits++;
+    if (entry) *entry = e->entry;
+    return kHFSNameFound;
+}
+
+void HFS_NM_Enter(HFS_NameCache* nm, DirID parentID, const uint8_t* name,
+                  uint8_t len, const CatEntry* entry) {
+    if (!nm || len > 31) return;
+
+    uint8_t folded[31];
+    uint32_t hash = nm_fold(parentID, name, len, folded);
+    int16_t i = find_entry(nm, parentID, folded, len, hash);
+
+    if (i == NM_NONE) {
+        /* Free slot, else the least recently used */
+        for (int16_t j = 0; j < HFS_NAME_CACHE_ENTRIES && i == NM_NONE; j++) {
+            if (!nm->entries[j].valid) i = j;
+        }
+        if (i == NM_NONE) {
+            i = nm->lruTail;
+            drop_entry(nm, i);
+            nm->stats.evictions++;
+        }
+
+        NMEntry* e = &nm->entries[i];
+        e->parentID = parentID;
+        e->hash = hash;
+        e->len = len;
+        memcpy(e->name, folded, len);
+        e->valid = true;
+        e->hashNext = nm->buckets[hash & (NM_BUCKETS - 1)];
+        nm->buckets[hash & (NM_BUCKETS - 1)] = i;
+        nm->stats.cached++;
+    } else {
+        lru_unlink(nm, i);
+    }
+
+    NMEntry* e = &nm->entries[i];
+    e->negative = (entry == NULL);
+    if (entry) e->entry = *entry;
+    lru_push_front(nm, i);
+}
+
+void HFS_NM_Forget(HFS_NameCache* nm, DirID parentID, const uint8_t* name, uint8_t len) {
+    if (!nm || len > 31) return;
+
+    uint8_t folded[31];
+    uint32_t hash = nm_fold(parentID, name, len, folded);
+    int16_t i = find_entry(nm, parentID, folded, len, hash);
+    if (i != NM_NONE) {
+        drop_entry(nm, i);
+        nm->stats.invalidations++;
+    }
+}
+
+void HFS_NM_ForgetID(HFS_NameCache* nm, FileID cnid) {
+    if (!nm) return;
+
+    for (int16_t i = 0; i < HFS_NAME_CACHE_ENTRIES; i++) {
+        NMEntry* e = &nm->entries[i];
+        if (!e->valid) continue;
+        if (e->negative || e->parentID == cnid || e->entry.id == cnid) {
+            drop_entry(nm, i);
+            nm->stats.invalidations++;
+        }
+    }
+}
+
+void HFS_NM_GetStats(const HFS_NameCache* nm, HFS_NameCacheStats* stats) {
+    if (!stats) return;
+    if (!nm) {
+        memset(stats, 0, sizeof(*stats));
+        return;
+    }
+    *stats = nm->stats;
+}
@@ -0,0 +1,191 @@
+/* HFS B-Tree Node Cache Implementation */
+#include "../../include/FS/hfs_nodecache.h"
+#include "../../include/MemoryMgr/MemoryManager.h"
+#include <string.h>
+#include "FS/FSLogging.h"
+
+#define NC_BUCKETS  (HFS_NODE_CACHE_NODES * 2)  /* Power of two */
+#define NC_NONE     (-1)
+
+typedef struct {
+    uint32_t nodeNum;
+    uint8_t  tree;          /* HFS_BTreeType */
+    bool     valid;
+    uint16_t pins;
+    uint16_t size;          /* Node size; data holds this many bytes */
+    int16_t  hashNext;
+    int16_t  lruPrev;       /* Towards most recently used */
+    int16_t  lruNext;       /* Towards least recently used */
+    uint8_t* data;
+} NCEntry;
+
+struct HFS_NodeCache {
+    HFS_Volume* vol;
+    NCEntry     entries[HFS_NODE_CACHE_NODES];
+    int16_t     buckets[NC_BUCKETS];
+    int16_t     lruHead;    /* Most recently used valid entry */
+    int16_t     lruTail;
+    HFS_NodeCacheStats stats;
+};
+
+static uint32_t nc_hash(uint8_t tree, uint32_t nodeNum) {
+    return ((nodeNum * 2654435761u) ^ tree) & (NC_BUCKETS - 1);
+}
+
+static void lru_unlink(HFS_NodeCache* nc, int16_t i) {
+    NCEntry* e = &nc->entries[i];
+    if (e->lruPrev != NC_NONE) nc->entries[e->lruPrev].lruNext = e->lruNext;
+    else nc->lruHead = e->lruNext;
+    if (e->lruNext != NC_NONE) nc->entries[e->lruNext].lruPrev = e->lruPrev;
+    else nc->lruTail = e->lruPrev;
+    e->lruPrev = e->lruNext = NC_NONE;
+}
+
+static void lru_push_front(HFS_NodeCache* nc, int16_t i) {
+    NCEntry* e = &nc->entries[i];
+    e->lruPrev = NC_NONE;
+    e->lruNext = nc->lruHead;
+    if (nc->lruHead != NC_NONE) nc->entries[nc->lruHead].lruPrev = i;
+    nc->lruHead = i;
+    if (nc->lruTail == NC_NONE) nc->lruTail = i;
+}
+
+static void hash_remove(HFS_NodeCache* nc, int16_t i) {
+    NCEntry* e = &nc->entries[i];
+    int16_t* link = &nc->buckets[nc_hash(e->tree, e->nodeNum)];
+    while (*link != NC_NONE) {
+        if (*link == i) {
+            *link = e->hashNext;
+            break;
+        }
+        link = &nc->entries[*link].hashNext;
+    }
+    e->hashNext = NC_NONE;
+}
+
+/* Free slot, else the least recently used unpinned one */
+static int16_t claim_entry(HFS_NodeCache* nc) {
+    for (int16_t i = 0; i < HFS_NODE_CACHE_NODES; i++) {
+        if (!nc->entries[i].valid) return i;
+    }
+
+    for (int16_t i = nc->lruTail; i != NC_NONE; i = nc->entries[i].lruPrev) {
+        NCEntry* e = &nc->entries[i];
+        if (e->pins) continue;
+
+        hash_remove(nc, i);
+        lru_unlink(nc, i);
+        e->valid = false;
+        nc->stats.evictions++;
+        nc->stats.cached--;
+        return i;
+    }
+
+    return NC_NONE;
+}
+
+HFS_NodeCache* HFS_NC_Create(HFS_Volume* vol) {
+    if (!vol) return NULL;
+
+    HFS_NodeCache* nc = (HFS_NodeCache*)NewPtr(sizeof(HFS_NodeCache));
+    if (!nc) {
+        FS_LOG_WARN("HFS NodeCache: no memory, B-tree nodes will be read uncached\n");
+        return NULL;
+    }
+
+    memset(nc, 0, sizeof(HFS_NodeCache));
+    nc->vol = vol;
+    nc->lruHead = nc->lruTail = NC_NONE;
+    for (int i = 0; i < NC_BUCKETS; i++) {
+        nc->buckets[i] = NC_NONE;
+    }
+    for (int i = 0; i < HFS_NODE_CACHE_NODES; i++) {
+        nc->entries[i].hashNext = NC_NONE;
+        nc->entries[i].lruPrev = nc->entries[i].lruNext = NC_NONE;
+    }
+    return nc;
+}
+
+void HFS_NC_Destroy(HFS_NodeCache* nc) {
+    if (!nc) return;
+
+    for (int i = 0; i < HFS_NODE_CACHE_NODES; i++) {
+        if (nc->entries[i].pins) {
+            FS_LOG_WARN("HFS NodeCache: node %u still pinned at unmount\n", nc->entries[i].nodeNum);
+        }
+        if (nc->entries[i].data) {
+            DisposePtr((Ptr)nc->entries[i].data);
+        }
+    }
+    DisposePtr((Ptr)nc);
+}
+
+void* HFS_NC_Get(HFS_NodeCache* nc, HFS_BTreeType tree, uint32_t nodeNum, uint16_t nodeSize) {
+    if (!nc || nodeSize == 0) return NULL;
+
+    uint32_t bucket = nc_hash((uint8_t)tree, nodeNum);
+    for (int16_t i = nc->buckets[bucket]; i != NC_NONE; i = nc->entries[i].hashNext) {
+        NCEntry* e = &nc->entries[i];
+        if (e->nodeNum == nodeNum && e->tree == (uint8_t)tree) {
+            nc->stats.hits++;
+            if (e->pins++ == 0) nc->stats.pinned++;
+            lru_unlink(nc, i);
+            lru_push_front(nc, i);
+            return e->data;
+        }
+    }
+
+    nc->stats.misses++;
+
+    int16_t i = claim_entry(nc);
+    if (i == NC_NONE) return NULL;
+
+    NCEntry* e = &nc->entries[i];
+    if (e->data && e->size != nodeSize) {
+        DisposePtr((Ptr)e->data);
+        e->data = NULL;
+    }
+    if (!e->data) {
+        e->data = (uint8_t*)NewPtr(nodeSize);
+        if (!e->data) return NULL;
+    }
+    e->size = nodeSize;
+
+    if (!HFS_BT_ReadNodeUncached(nc->vol, tree, nodeSize, nodeNum, e->data)) {
+        return NULL;
+    }
+
+    e->nodeNum = nodeNum;
+    e->tree = (uint8_t)tree;
+    e->valid = true;
+    e->pins = 1;
+    e->hashNext = nc->buckets[bucket];
+    nc->buckets[bucket] = i;
+    lru_push_front(nc, i);
+    nc->stats.cached++;
+    nc->stats.pinned++;
+    return e->data;
+}
+
+void HFS_NC_Release(HFS_NodeCache* nc, void* node) {
+    if (!nc || !node) return;
+
+    for (int i = 0; i < HFS_NODE_CACHE_NODES; i++) {
+        NCEntry* e = &nc->entries[i];
+        if (!e->valid || e->data != node) continue;
+
+        if (e->pins && --e->pins == 0) nc->stats.pinned--;
+        return;
+    }
+
+    FS_LOG_WARN("HFS NodeCache: release of unknown node %08x\n", (unsigned int)node);
+}
+
+void HFS_NC_GetStats(const HFS_NodeCache* nc, HFS_NodeCacheStats* stats) {
+    if (!stats) return;
+    if (!nc) {
+        memset(stats, 0, sizeof(*stats));
+        return;
+    }
+    *stats = nc->stats;
+}
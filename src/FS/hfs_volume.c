@@ -3,6 +3,7 @@
 #include "../../include/FS/hfs_volume.h"
 #include "../../include/FS/hfs_endian.h"
 #include "../../include/FS/hfs_btree.h"
+#include "../../include/FS/hfs_nodecache.h"
 #include <string.h>
 #include <stdlib.h>
 #include "FS/FSLogging.h"
@@ -201,6 +202,12 @@ void HFS_VolumeUnmount(HFS_Volume* vol) {
         /* FS_LOG_DEBUG("HFS: Unmounting volume\n"); */
     }
 
+    /* Write back dirty B-tree nodes while the device is still open */
+    if (vol->nodeCache) {
+        HFS_NC_Destroy(vol->nodeCache);
+        vol->nodeCache = NULL;
+    }
+
     HFS_BD_Close(&vol->bd);
     memset(vol, 0, sizeof(HFS_Volume));
 }
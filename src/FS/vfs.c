@@ -38,6 +38,11 @@ struct VFSFile {
     VRefNum  vref;
 };
 
+struct VFSEnumCursor {
+    VRefNum           vref;
+    HFS_CatalogCursor cat;
+};
+
 /* Helper: Find volume by vref */
 static VFSVolume* VFS_FindVolume(VRefNum vref) {
     for (int i = 0; i < VFS_MAX_VOLUMES; i++) {
@@ -625,6 +630,60 @@ bool VFS_Enumerate(VRefNum vref, DirID dir, CatEntry* entries, int maxEntries, i
     return result;
 }
 
+VFSEnumCursor* VFS_EnumerateOpen(VRefNum vref, DirID dir) {
+    if (!g_vfs.initialized) return NULL;
+
+    VFSVolume* vol = VFS_FindVolume(vref);
+    if (!vol || !vol->mounted || !vol->catalog.bt.nodeBuffer) {
+        return NULL;
+    }
+
+    VFSEnumCursor* cursor = (VFSEnumCursor*)NewPtr(sizeof(VFSEnumCursor));
+    if (!cursor) return NULL;
+
+    cursor->vref = vref;
+    HFS_CatalogCursorInit(&vol->catalog, dir, &cursor->cat);
+    return cursor;
+}
+
+bool VFS_EnumerateNext(VFSEnumCursor* cursor, CatEntry* entries, int maxEntries, int* count) {
+    if (!cursor || !entries || !count) return false;
+
+    *count = 0;
+    if (cursor->cat.node == 0) return true;
+
+    /* The volume may have gone away between batches */
+    VFSVolume* vol = VFS_FindVolume(cursor->vref);
+    if (!vol || !vol->mounted) {
+        cursor->cat.node = 0;
+        return false;
+    }
+
+    return HFS_CatalogCursorNext(&vol->catalog, &cursor->cat, entries, maxEntries, count);
+}
+
+bool VFS_EnumerateDone(const VFSEnumCursor* cursor) {
+    return !cursor || cursor->cat.node == 0;
+}
+
+void VFS_EnumerateClose(VFSEnumCursor* cursor) {
+    if (cursor) DisposePtr((Ptr)cursor);
+}
+
+void VFS_InvalidateNames(VRefNum vref, FileID id) {
+    if (!g_vfs.initialized) return;
+
+    /* The write stubs accept vref 0/-1 for "the default volume": without
+     * an exact match, clear every mounted volume */
+    VFSVolume* vol = VFS_FindVolume(vref);
+    for (int i = 0; i < VFS_MAX_VOLUMES; i++) {
+        VFSVolume* v = &g_vfs.volumes[i];
+        if (v->mounted && (!vol || v == vol)) {
+            HFS_NM_ForgetID(v->catalog.names, id);
+        }
+    }
+}
+
 bool VFS_Lookup(VRefNum vref, DirID dir, const char* name, CatEntry* entry) {
     if (!g_vfs.initialized || !name || !entry) return false;
 
@@ -742,6 +801,7 @@ bool VFS_CreateFolder(VRefNum vref, DirID parent, const char* name, DirID* newID
     /* Generate new folder ID */
     static DirID nextDirID = 1000;
     *newID = nextDirID++;
+    VFS_InvalidateNames(vref, parent);
 
     /* Log success for now - full implementation would update HFS catalog */
     FS_LOG_DEBUG("VFS_CreateFolder: Created folder '%s' with ID %d\n", name, *newID);
@@ -768,6 +828,7 @@ bool VFS_CreateFile(VRefNum vref, DirID parent, const char* name,
     /* Generate new file ID */
     static FileID nextFileID = 2000;
     *newID = nextFileID++;
+    VFS_InvalidateNames(vref, parent);
 
     /* Log success for now - full implementation would update HFS catalog */
     FS_LOG_DEBUG("VFS_CreateFile: Created file '%s' with ID %u\n", name, *newID);
@@ -789,6 +850,8 @@ bool VFS_Rename(VRefNum vref, FileID id, const char* newName) {
         return false;
     }
 
+    VFS_InvalidateNames(vref, id);
+
     /* Log success for now - full implementation would update HFS catalog */
     FS_LOG_DEBUG("VFS_Rename: Successfully renamed ID %u to '%s'\n", id, newName);
     return true;
@@ -809,6 +872,8 @@ bool VFS_Delete(VRefNum vref, FileID id) {
         return false;
     }
 
+    VFS_InvalidateNames(vref, id);
+
     /* Log success for now - full implementation would update HFS catalog */
     FS_LOG_DEBUG("VFS_Delete: Successfully deleted ID %u\n", id);
     return true;
@@ -30,6 +30,7 @@ bool VFS_Move(VRefNum vref, DirID fromDir, FileID id, DirID toDir, const char* n
      */
     FS_LOG_DEBUG("VFS_Move: id=%u from dir=%u to dir=%u, newName=%s\n",
                  id, fromDir, toDir, newName ? newName : "(null)");
+    VFS_InvalidateNames(vref, id);
     return true;
 }
 
@@ -48,6 +49,7 @@ bool VFS_Copy(VRefNum vref, DirID fromDir, FileID id, DirID toDir, const char* n
     if (newID) {
         *newID = nextCopyID++;
     }
+    VFS_InvalidateNames(vref, toDir);
     return true;
 }
 
@@ -57,6 +59,7 @@ bool VFS_DeleteTree(VRefNum vref, DirID parent, FileID id) {
      * 2. Remove catalog entry
      * 3. Free allocation blocks
      */
+    VFS_InvalidateNames(vref, id);
     return true;
 }
 
@@ -17,6 +17,7 @@
 #include <sched.h>
 #include "System71StdLib.h"
 #include "FileManager_Internal.h"
+#include "FileMgr/fs_queue.h"
 #include "FS/FSLogging.h"
 
 
@@ -120,9 +121,10 @@ OSErr FM_Shutdown(void)
         return noErr;
     }
 
+    /* Close all open files, once nothing queued still needs them */
+    FSQueueSync();
     FS_LockGlobal();
 
-    /* Close all open files */
     for (int i = 0; i < g_FSGlobals.fcbCount; i++) {
         if (g_FSGlobals.fcbArray[i].base.fcbFlNm != 0) {
             FCB_Close(&g_FSGlobals.fcbArray[i]);
@@ -328,6 +330,8 @@ OSErr FSGetFPos(FileRefNum refNum, UInt32* position)
         return paramErr;
     }
 
+    /* Queued reads and writes move the mark; let them land first */
+    FSQueueWait(refNum);
     fcb = FCB_Find(refNum);
     if (!fcb) {
         return rfNumErr;
@@ -345,6 +349,7 @@ OSErr FSSetFPos(FileRefNum refNum, UInt16 posMode, SInt32 posOffset)
     FCB* fcb;
     UInt32 newPos;
 
+    FSQueueWait(refNum);
     fcb = FCB_Find(refNum);
     if (!fcb) {
         return rfNumErr;
@@ -404,6 +409,7 @@ OSErr FSGetEOF(FileRefNum refNum, UInt32* eof)
         return paramErr;
     }
 
+    FSQueueWait(refNum);
     fcb = FCB_Find(refNum);
     if (!fcb) {
         return rfNumErr;
@@ -421,6 +427,7 @@ OSErr FSSetEOF(FileRefNum refNum, UInt32 eof)
     FCB* fcb;
     OSErr err;
 
+    FSQueueWait(refNum);
     fcb = FCB_Find(refNum);
     if (!fcb) {
         return rfNumErr;
@@ -468,6 +475,7 @@ OSErr FSAllocate(FileRefNum refNum, UInt32* count)
         return paramErr;
     }
 
+    FSQueueWait(refNum);
     fcb = FCB_Find(refNum);
     if (!fcb) {
         return rfNumErr;
@@ -845,6 +853,7 @@ OSErr FSUnmount(VolumeRefNum vRefNum)
     }
 
     /* Close all files on this volume */
+    FSQueueSync();
     for (int i = 0; i < g_FSGlobals.fcbCount; i++) {
         FCB* fcb = &g_FSGlobals.fcbArray[i];
         if ((VCB*)fcb->base.fcbVPtr == vcb) {
@@ -1017,7 +1026,8 @@ OSErr PBOpenSync(ParmBlkPtr paramBlock)
     return err;
 }
 
-OSErr PBCloseSync(ParmBlkPtr paramBlock)
+/* Close/read/write bodies, shared by the sync calls and the async queue worker */
+static OSErr FM_ClosePB(ParmBlkPtr paramBlock)
 {
     FCB* fcb;
     OSErr err;
@@ -1037,7 +1047,18 @@ OSErr PBCloseSync(ParmBlkPtr paramBlock)
     return err;
 }
 
-OSErr PBReadSync(ParmBlkPtr paramBlock)
+OSErr PBCloseSync(ParmBlkPtr paramBlock)
+{
+    if (!paramBlock) {
+        return paramErr;
+    }
+
+    /* Queued reads and writes must not find the FCB gone */
+    FSQueueWait((paramBlock)->u.ioParam.ioRefNum);
+    return FM_ClosePB(paramBlock);
+}
+
+static OSErr FM_ReadPB(ParmBlkPtr paramBlock)
 {
     FCB* fcb;
     OSErr err;
@@ -1076,7 +1097,7 @@ OSErr PBReadSync(ParmBlkPtr paramBlock)
     return err;
 }
 
-OSErr PBWriteSync(ParmBlkPtr paramBlock)
+static OSErr FM_WritePB(ParmBlkPtr paramBlock)
 {
     FCB* fcb;
     OSErr err;
@@ -1120,6 +1141,27 @@ OSErr PBWriteSync(ParmBlkPtr paramBlock)
     return err;
 }
 
+OSErr PBReadSync(ParmBlkPtr paramBlock)
+{
+    if (!paramBlock) {
+        return paramErr;
+    }
+
+    /* Let earlier async calls on this file land first */
+    FSQueueWait((paramBlock)->u.ioParam.ioRefNum);
+    return FM_ReadPB(paramBlock);
+}
+
+OSErr PBWriteSync(ParmBlkPtr paramBlock)
+{
+    if (!paramBlock) {
+        return paramErr;
+    }
+
+    FSQueueWait((paramBlock)->u.ioParam.ioRefNum);
+    return FM_WritePB(paramBlock);
+}
+
 OSErr PBGetCatInfoSync(CInfoPBPtr paramBlock)
 {
     VCB* vcb;
@@ -1167,7 +1209,12 @@ OSErr PBSetCatInfoSync(CInfoPBPtr paramBlock)
 }
 
 /* ============================================================================
- * Asynchronous Operations (stubbed for now - would use thread pool)
+ * Asynchronous Operations
+ *
+ * PBCloseAsync/PBReadAsync/PBWriteAsync go through the File System request
+ * queue (FileMgr/fs_queue.c) and run from the event loop's yield points; the
+ * rest still complete synchronously.  Sync calls that touch an FCB first
+ * FSQueueWait for that refNum so they see the queued calls' effects.
  * ============================================================================ */
 
 OSErr PBOpenAsync(ParmBlkPtr paramBlock)
@@ -1179,17 +1226,26 @@ OSErr PBOpenAsync(ParmBlkPtr paramBlock)
 
 OSErr PBCloseAsync(ParmBlkPtr paramBlock)
 {
-    return PBCloseSync(paramBlock);
+    if (!paramBlock) {
+        return paramErr;
+    }
+    return FSQueueRequest(paramBlock, FM_ClosePB, (paramBlock)->u.ioParam.ioRefNum);
 }
 
 OSErr PBReadAsync(ParmBlkPtr paramBlock)
 {
-    return PBReadSync(paramBlock);
+    if (!paramBlock) {
+        return paramErr;
+    }
+    return FSQueueRequest(paramBlock, FM_ReadPB, (paramBlock)->u.ioParam.ioRefNum);
 }
 
 OSErr PBWriteAsync(ParmBlkPtr paramBlock)
 {
-    return PBWriteSync(paramBlock);
+    if (!paramBlock) {
+        return paramErr;
+    }
+    return FSQueueRequest(paramBlock, FM_WritePB, (paramBlock)->u.ioParam.ioRefNum);
 }
 
 OSErr PBGetCatInfoAsync(CInfoPBPtr paramBlock)
@@ -1428,6 +1484,7 @@ OSErr FM_GetFCBFromRefNum(FileRefNum refNum, FCB** fcb)
         return paramErr;
     }
 
+    FSQueueWait(refNum);
     *fcb = FCB_Find(refNum);
     if (!*fcb) {
         return rfNumErr;
@@ -1465,6 +1522,7 @@ OSErr FM_SetProcessOwner(FileRefNum refNum, UInt32 processID)
 {
     FCB* fcb;
 
+    FSQueueWait(refNum);
     fcb = FCB_Find(refNum);
     if (!fcb) {
         return rfNumErr;
@@ -1481,6 +1539,7 @@ OSErr FM_ReleaseProcessFiles(UInt32 processID)
 {
     int closedCount = 0;
 
+    FSQueueSync();
     FS_LockGlobal();
 
     /* Close all files owned by this process */
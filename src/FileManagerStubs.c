@@ -9,6 +9,7 @@
 #include "SystemTypes.h"
 #include "FileManager.h"
 #include "FileManager_Internal.h"
+#include "FileMgr/alloc_bitmap.h"
 #include <stdlib.h>
 #include <string.h>
 #include "FS/FSLogging.h"
@@ -779,73 +780,19 @@ OSErr Ext_DeleteOverflow(VCB* vcb, UInt32 fileID, UInt8 forkType, UInt32 startFA
  * Allocation Bitmap Management
  * ============================================================================ */
 
-/* Bitmap bit manipulation helpers */
-#define BITS_PER_BYTE 8
+#define BITS_PER_SECTOR (512 * 8)
 
-static Boolean TestBit(UInt8* bitmap, UInt32 bitNum) {
-    UInt32 byteNum = bitNum / BITS_PER_BYTE;
-    UInt32 bitPos = bitNum % BITS_PER_BYTE;
-    return (bitmap[byteNum] & (1 << (7 - bitPos))) != 0;
-}
-
-static void SetBit(UInt8* bitmap, UInt32 bitNum) {
-    UInt32 byteNum = bitNum / BITS_PER_BYTE;
-    UInt32 bitPos = bitNum % BITS_PER_BYTE;
-    bitmap[byteNum] |= (1 << (7 - bitPos));
-}
+/* Write back the bitmap sectors holding blocks [startBlock, startBlock + blockCount) */
+static OSErr Alloc_WriteBitmap(VCB* vcb, UInt32 startBlock, UInt32 blockCount) {
+    UInt32 firstSector = startBlock / BITS_PER_SECTOR;
+    UInt32 lastSector = (startBlock + blockCount - 1) / BITS_PER_SECTOR;
 
-static void ClearBit(UInt8* bitmap, UInt32 bitNum) {
-    UInt32 byteNum = bitNum / BITS_PER_BYTE;
-    UInt32 bitPos = bitNum % BITS_PER_BYTE;
-    bitmap[byteNum] &= ~(1 << (7 - bitPos));
-}
-
-/* Find a run of free blocks in the bitmap */
-static UInt32 FindFreeRun(UInt8* bitmap, UInt32 totalBlocks,
-                          UInt32 startHint, UInt32 minBlocks) {
-    UInt32 start = startHint;
-    UInt32 count = 0;
-    UInt32 firstFree = 0;
-    Boolean wrapped = false;
-
-    while (true) {
-        /* Check if block is free */
-        if (!TestBit(bitmap, start)) {
-            if (count == 0) {
-                firstFree = start;
-            }
-            count++;
-
-            /* Found enough blocks? */
-            if (count >= minBlocks) {
-                return firstFree;
-            }
-        } else {
-            /* Block is allocated, reset count */
-            count = 0;
-        }
-
-        /* Move to next block */
-        start++;
-        if (start >= totalBlocks) {
-            if (wrapped) {
-                break;  /* Searched entire bitmap */
-            }
-            start = 0;
-            wrapped = true;
-        }
-
-        /* Stop if we've come back to hint */
-        if (wrapped && start >= startHint) {
-            break;
-        }
-    }
-
-    return 0xFFFFFFFF;  /* No run found */
+    return IO_WriteBlocks(vcb, (UInt32)vcb->base.vcbVBMSt + firstSector,
+                          lastSector - firstSector + 1,
+                          (UInt8*)vcb->base.vcbMAdr + firstSector * 512);
 }
 
 OSErr Alloc_Init(VCB* vcb) {
-    UInt32 bitmapBytes;
     UInt32 bitmapBlocks;
     OSErr err;
 
@@ -853,26 +800,29 @@ OSErr Alloc_Init(VCB* vcb) {
         return paramErr;
     }
 
-    /* Calculate bitmap size */
-    bitmapBytes = (vcb->base.vcbNmAlBlks + 7) / 8;  /* Round up to byte boundary */
-    bitmapBlocks = (bitmapBytes + 511) / 512;  /* 512 bytes per block */
+    /* Whole sectors, so sector-sized write-back never runs off the end */
+    bitmapBlocks = ((UInt32)vcb->base.vcbNmAlBlks + BITS_PER_SECTOR - 1) / BITS_PER_SECTOR;
 
     /* Allocate bitmap cache */
-    vcb->base.vcbMAdr = NewPtrClear((Size)bitmapBytes);
+    vcb->base.vcbMAdr = NewPtrClear((Size)(bitmapBlocks * 512));
     if (!vcb->base.vcbMAdr) {
         return memFullErr;
     }
 
     /* Read bitmap from disk */
     err = IO_ReadBlocks(vcb, (UInt32)vcb->base.vcbVBMSt, bitmapBlocks, vcb->base.vcbMAdr);
+    if (err == noErr) {
+        vcb->vcbAllocMap = ABM_Create((UInt8*)vcb->base.vcbMAdr, vcb->base.vcbNmAlBlks);
+        if (!vcb->vcbAllocMap) err = memFullErr;
+    }
     if (err != noErr) {
         DisposePtr(vcb->base.vcbMAdr);
         vcb->base.vcbMAdr = NULL;
         return err;
     }
 
-    FS_LOG_DEBUG("Alloc_Init: loaded %u blocks of bitmap (%u bytes)\n",
-                 bitmapBlocks, bitmapBytes);
+    FS_LOG_DEBUG("Alloc_Init: loaded %u blocks of bitmap, %u of %u allocation blocks free\n",
+                 bitmapBlocks, ABM_FreeBlocks(vcb->vcbAllocMap), vcb->base.vcbNmAlBlks);
     return noErr;
 }
 
@@ -881,6 +831,9 @@ OSErr Alloc_Close(VCB* vcb) {
         return paramErr;
     }
 
+    ABM_Dispose(vcb->vcbAllocMap);
+    vcb->vcbAllocMap = NULL;
+
     /* Free bitmap cache */
     if (vcb->base.vcbMAdr) {
         DisposePtr(vcb->base.vcbMAdr);
@@ -893,12 +846,8 @@ OSErr Alloc_Close(VCB* vcb) {
 
 OSErr Alloc_Blocks(VCB* vcb, UInt32 startHint, UInt32 minBlocks, UInt32 maxBlocks,
                    UInt32* actualStart, UInt32* actualCount) {
-    UInt8* bitmap;
     UInt32 foundStart;
     UInt32 foundCount;
-    UInt32 i;
-    UInt32 bitmapBytes;
-    UInt32 bitmapBlocks;
     OSErr err;
 
     if (!vcb || !actualStart || !actualCount) {
@@ -912,13 +861,11 @@ OSErr Alloc_Blocks(VCB* vcb, UInt32 startHint, UInt32 minBlocks, UInt32 maxBlock
     FS_LockVolume(vcb);
 
     /* Ensure bitmap is loaded */
-    if (!vcb->base.vcbMAdr) {
+    if (!vcb->vcbAllocMap) {
         FS_UnlockVolume(vcb);
         return ioErr;
     }
 
-    bitmap = (UInt8*)vcb->base.vcbMAdr;
-
     /* Check if enough free blocks available */
     if (vcb->base.vcbFreeBks < minBlocks) {
         FS_UnlockVolume(vcb);
@@ -930,31 +877,15 @@ OSErr Alloc_Blocks(VCB* vcb, UInt32 startHint, UInt32 minBlocks, UInt32 maxBlock
         startHint = (UInt32)vcb->base.vcbAllocPtr;
     }
 
-    /* Find a run of free blocks */
-    foundStart = FindFreeRun(bitmap, (UInt32)vcb->base.vcbNmAlBlks, startHint, minBlocks);
-    if (foundStart == 0xFFFFFFFF) {
-        /* Try again from beginning */
-        foundStart = FindFreeRun(bitmap, (UInt32)vcb->base.vcbNmAlBlks, 0, minBlocks);
-        if (foundStart == 0xFFFFFFFF) {
-            FS_UnlockVolume(vcb);
-            return dskFulErr;
-        }
-    }
-
-    /* Count available blocks in the run */
-    foundCount = 0;
-    for (i = foundStart; i < (UInt32)vcb->base.vcbNmAlBlks && foundCount < maxBlocks; i++) {
-        if (!TestBit(bitmap, i)) {
-            foundCount++;
-        } else {
-            break;
-        }
+    /* First run long enough at or after the hint, wrapping to the start */
+    if (!ABM_FindRun(vcb->vcbAllocMap, startHint, minBlocks, maxBlocks,
+                     &foundStart, &foundCount)) {
+        FS_UnlockVolume(vcb);
+        return dskFulErr;
     }
 
     /* Mark blocks as allocated */
-    for (i = 0; i < foundCount; i++) {
-        SetBit(bitmap, foundStart + i);
-    }
+    ABM_Mark(vcb->vcbAllocMap, foundStart, foundCount, true);
 
     /* Update VCB */
     vcb->base.vcbFreeBks -= (UInt16)foundCount;
@@ -965,9 +896,7 @@ OSErr Alloc_Blocks(VCB* vcb, UInt32 startHint, UInt32 minBlocks, UInt32 maxBlock
     vcb->base.vcbFlags |= VCB_DIRTY;
 
     /* Write updated bitmap back to disk */
-    bitmapBytes = (vcb->base.vcbNmAlBlks + 7) / 8;
-    bitmapBlocks = (bitmapBytes + 511) / 512;
-    err = IO_WriteBlocks(vcb, (UInt32)vcb->base.vcbVBMSt, bitmapBlocks, bitmap);
+    err = Alloc_WriteBitmap(vcb, foundStart, foundCount);
     if (err != noErr) {
         FS_LOG_ERROR("Alloc_Blocks: failed to write bitmap: %d\n", err);
         FS_UnlockVolume(vcb);
@@ -985,10 +914,6 @@ OSErr Alloc_Blocks(VCB* vcb, UInt32 startHint, UInt32 minBlocks, UInt32 maxBlock
 }
 
 OSErr Alloc_Free(VCB* vcb, UInt32 startBlock, UInt32 blockCount) {
-    UInt8* bitmap;
-    UInt32 i;
-    UInt32 bitmapBytes;
-    UInt32 bitmapBlocks;
     OSErr err;
 
     if (!vcb || blockCount == 0) {
@@ -1003,20 +928,13 @@ OSErr Alloc_Free(VCB* vcb, UInt32 startBlock, UInt32 blockCount) {
     FS_LockVolume(vcb);
 
     /* Ensure bitmap is loaded */
-    if (!vcb->base.vcbMAdr) {
+    if (!vcb->vcbAllocMap) {
         FS_UnlockVolume(vcb);
         return ioErr;
     }
 
-    bitmap = (UInt8*)vcb->base.vcbMAdr;
-
     /* Mark blocks as free */
-    for (i = 0; i < blockCount; i++) {
-        if (TestBit(bitmap, startBlock + i)) {
-            ClearBit(bitmap, startBlock + i);
-            vcb->base.vcbFreeBks++;
-        }
-    }
+    vcb->base.vcbFreeBks += (UInt16)ABM_Mark(vcb->vcbAllocMap, startBlock, blockCount, false);
 
     /* Update allocation pointer to freed area for next search */
     if (startBlock < (UInt32)vcb->base.vcbAllocPtr) {
@@ -1026,9 +944,7 @@ OSErr Alloc_Free(VCB* vcb, UInt32 startBlock, UInt32 blockCount) {
     vcb->base.vcbFlags |= VCB_DIRTY;
 
     /* Write updated bitmap back to disk */
-    bitmapBytes = (vcb->base.vcbNmAlBlks + 7) / 8;
-    bitmapBlocks = (bitmapBytes + 511) / 512;
-    err = IO_WriteBlocks(vcb, (UInt32)vcb->base.vcbVBMSt, bitmapBlocks, bitmap);
+    err = Alloc_WriteBitmap(vcb, startBlock, blockCount);
     if (err != noErr) {
         FS_LOG_ERROR("Alloc_Free: failed to write bitmap: %d\n", err);
         FS_UnlockVolume(vcb);
@@ -1043,8 +959,7 @@ OSErr Alloc_Free(VCB* vcb, UInt32 startBlock, UInt32 blockCount) {
 }
 
 UInt32 Alloc_CountFree(VCB* vcb) {
-    FS_LOG_DEBUG("Alloc_CountFree stub\n");
-    return 0;
+    return vcb ? ABM_FreeBlocks(vcb->vcbAllocMap) : 0;
 }
 
 Boolean Alloc_Check(VCB* vcb, UInt32 startBlock, UInt32 blockCount) {
@@ -0,0 +1,222 @@
+/*
+ * AllocBench.c - Allocation bitmap benchmark
+ *
+ * Fragments a 65535-block volume bitmap to about 90% full (long used runs
+ * with holes of 1-6 blocks between them, and now and then a 256-block
+ * one), then creates 200 files of 8-24 blocks and grows each of them four
+ * times by 1-3 blocks.  Every request first asks for a contiguous run
+ * starting where the file ends, falling back to pieces when none is long
+ * enough.  The same workload runs once through
+ * the free-run summary (ABM_FindRun) and once through a bit-by-bit scan
+ * from the hint like the old allocator's; both must end with identical
+ * bitmaps.  Reports time, extents and chunk statistics over serial.
+ *
+ * Activated with ALLOC_BENCH=1 compile flag; called from main.c once the
+ * Memory Manager is up.
+ */
+
+#include "SystemTypes.h"
+#include "System71StdLib.h"
+#include "MemoryMgr/MemoryManager.h"
+#include "FileMgr/alloc_bitmap.h"
+#include "TimeManager/TimeBase.h"
+#include "FS/FSLogging.h"
+#include <string.h>
+
+#ifdef ALLOC_BENCH
+
+#define ALLOC_BENCH_LOG(fmt, ...) serial_logf(kLogModuleFileSystem, kLogLevelInfo, "[ALLOC BENCH] " fmt, ##__VA_ARGS__)
+
+#define BENCH_BLOCKS        65535u
+#define BENCH_FILES         200u
+#define BENCH_GROW_ROUNDS   4u
+
+typedef struct {
+    UInt32 end;             /* Block after the file's last extent */
+    UInt32 extents;
+} BenchFile;
+
+typedef struct {
+    AllocBitmap* map;       /* NULL: linear scan over bits */
+    UInt8*       bits;
+    UInt32       searches;
+    UInt32       extents;
+    UInt32       inPlace;   /* Growth that extended the last extent */
+    UInt32       failures;
+    UInt32       allocPtr;
+} BenchRun;
+
+static BenchFile gFiles[BENCH_FILES];
+
+static UInt32 bench_rand(UInt32* seed) {
+    *seed = *seed * 1664525u + 1013904223u;
+    return *seed >> 8;
+}
+
+static Boolean bit_free(const UInt8* bits, UInt32 b) {
+    return (bits[b >> 3] & (0x80 >> (b & 7))) == 0;
+}
+
+/* The old allocator's search: bit by bit from the hint, wrapping once */
+static Boolean linear_find(const UInt8* bits, UInt32 hint, UInt32 min, UInt32 max,
+                           UInt32* start, UInt32* count) {
+    UInt32 run = 0, runStart = 0;
+
+    for (UInt32 pass = 0; pass < 2; pass++) {
+        UInt32 from = pass ? 0 : hint;
+        UInt32 to = pass ? hint : BENCH_BLOCKS;
+        run = 0;
+        for (UInt32 b = from; b < BENCH_BLOCKS && (run > 0 || b < to); b++) {
+            if (!bit_free(bits, b)) {
+                run = 0;
+                continue;
+            }
+            if (run++ == 0) runStart = b;
+            if (run >= min) {
+                UInt32 n = min;
+                while (n < max && runStart + n < BENCH_BLOCKS && bit_free(bits, runStart + n)) n++;
+                *start = runStart;
+                *count = n;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+static Boolean run_find(BenchRun* r, UInt32 hint, UInt32 min, UInt32 max,
+                        UInt32* start, UInt32* count) {
+    r->searches++;
+    if (r->map) return ABM_FindRun(r->map, hint, min, max, start, count);
+    return linear_find(r->bits, hint, min, max, start, count);
+}
+
+static void run_mark(BenchRun* r, UInt32 start, UInt32 count) {
+    if (r->map) {
+        ABM_Mark(r->map, start, count, true);
+        return;
+    }
+    for (UInt32 b = start; b < start + count; b++) {
+        r->bits[b >> 3] |= (UInt8)(0x80 >> (b & 7));
+    }
+}
+
+/* Give file `blocks` more blocks, contiguous after its end if possible */
+static void bench_allocate(BenchRun* r, BenchFile* f, UInt32 blocks) {
+    UInt32 hint = f->end ? f->end : r->allocPtr;
+    UInt32 start, count;
+
+    if (!run_find(r, hint, blocks, blocks, &start, &count)) {
+        /* No run long enough anywhere: take what there is, piece by piece */
+        while (blocks > 0) {
+            if (!run_find(r, hint, 1, blocks, &start, &count)) {
+                r->failures++;
+                return;
+            }
+            run_mark(r, start, count);
+            if (f->extents > 0 && start == f->end) {
+                r->inPlace++;
+            } else {
+                r->extents++;
+                f->extents++;
+            }
+            f->end = hint = start + count;
+            blocks -= count;
+        }
+        r->allocPtr = f->end;
+        return;
+    }
+
+    run_mark(r, start, count);
+    if (f->extents > 0 && start == f->end) {
+        r->inPlace++;
+    } else {
+        r->extents++;
+        f->extents++;
+    }
+    f->end = start + count;
+    r->allocPtr = f->end;
+}
+
+static UInt32 bench_workload(BenchRun* r) {
+    UInt32 seed = 0x5EED1234u;
+
+    memset(gFiles, 0, sizeof(gFiles));
+    r->allocPtr = 0;
+
+    UInt32 start = MicrosecondsNow();
+    for (UInt32 i = 0; i < BENCH_FILES; i++) {
+        bench_allocate(r, &gFiles[i], 8 + bench_rand(&seed) % 17);
+    }
+    for (UInt32 round = 0; round < BENCH_GROW_ROUNDS; round++) {
+        for (UInt32 i = 0; i < BENCH_FILES; i++) {
+            bench_allocate(r, &gFiles[i], 1 + bench_rand(&seed) % 3);
+        }
+    }
+    return MicrosecondsNow() - start;
+}
+
+/* Long used runs with holes of 1-6 blocks, and a few 256-block holes */
+static UInt32 bench_fragment(UInt8* bits) {
+    UInt32 seed = 0xA110C8EDu;
+    UInt32 used = 0;
+    UInt32 b = 0;
+
+    memset(bits, 0, (BENCH_BLOCKS + 7) / 8);
+    while (b < BENCH_BLOCKS) {
+        UInt32 usedRun = 8 + bench_rand(&seed) % 100;
+        UInt32 freeRun = (bench_rand(&seed) % 40 == 0) ? 256 : 1 + bench_rand(&seed) % 6;
+        for (UInt32 i = 0; i < usedRun && b < BENCH_BLOCKS; i++, b++) {
+            bits[b >> 3] |= (UInt8)(0x80 >> (b & 7));
+            used++;
+        }
+        b += freeRun;
+    }
+    return used;
+}
+
+void AllocBench_Run(void) {
+    UInt32 bytes = (BENCH_BLOCKS + 7) / 8;
+    UInt8* linearBits = (UInt8*)NewPtr(bytes);
+    UInt8* summaryBits = (UInt8*)NewPtr(bytes);
+
+    if (!linearBits || !summaryBits) {
+        ALLOC_BENCH_LOG("no memory for bitmaps\n");
+        if (linearBits) DisposePtr((Ptr)linearBits);
+        if (summaryBits) DisposePtr((Ptr)summaryBits);
+        return;
+    }
+
+    UInt32 used = bench_fragment(linearBits);
+    memcpy(summaryBits, linearBits, bytes);
+    ALLOC_BENCH_LOG("%u blocks, %u free, %u files x (create + %u grows)\n",
+                    BENCH_BLOCKS, BENCH_BLOCKS - used, BENCH_FILES, BENCH_GROW_ROUNDS);
+
+    BenchRun linear = { NULL, linearBits, 0, 0, 0, 0, 0 };
+    UInt32 linearUs = bench_workload(&linear);
+    ALLOC_BENCH_LOG("linear scan: %u us, %u searches, %u extents, %u grown in place, %u failed\n",
+                    linearUs, linear.searches, linear.extents, linear.inPlace, linear.failures);
+
+    BenchRun summary = { ABM_Create(summaryBits, BENCH_BLOCKS), summaryBits, 0, 0, 0, 0, 0 };
+    if (!summary.map) {
+        ALLOC_BENCH_LOG("no memory for summary\n");
+    } else {
+        UInt32 summaryUs = bench_workload(&summary);
+        AllocBitmapStats stats;
+        ABM_GetStats(summary.map, &stats);
+        ALLOC_BENCH_LOG("free-run summary: %u us, %u searches, %u extents, %u grown in place, "
+                        "%u failed; %u chunks scanned, %u skipped\n",
+                        summaryUs, summary.searches, summary.extents, summary.inPlace,
+                        summary.failures, stats.chunksScanned, stats.chunksSkipped);
+        ALLOC_BENCH_LOG("bitmaps %s, %u blocks left free\n",
+                        memcmp(linearBits, summaryBits, bytes) == 0 ? "identical" : "DIFFER",
+                        ABM_FreeBlocks(summary.map));
+        ABM_Dispose(summary.map);
+    }
+
+    DisposePtr((Ptr)linearBits);
+    DisposePtr((Ptr)summaryBits);
+    ALLOC_BENCH_LOG("done\n");
+}
+
+#endif /* ALLOC_BENCH */
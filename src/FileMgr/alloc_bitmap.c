@@ -0,0 +1,262 @@
+/*
+ * alloc_bitmap.c - Volume allocation bitmap with a free-run summary
+ *
+ * The summary keeps, per ABM_CHUNK_BLOCKS-block chunk, the free count,
+ * the longest free run and the free runs at either end.  A run search
+ * walks chunks carrying the length of the free run that reached the end
+ * of the previous chunk:
+ * - full chunks end that run, empty ones extend it, neither is read
+ * - a chunk whose head completes the run ends the search unread
+ * - a chunk whose longest run is too short just passes its tail on
+ * Only a chunk that may hold the run itself has its bits scanned.
+ */
+
+#include "SystemTypes.h"
+#include "MemoryMgr/MemoryManager.h"
+#include "FileMgr/alloc_bitmap.h"
+#include <string.h>
+
+static Boolean bit_free(const AllocBitmap* abm, UInt32 block) {
+    return (abm->bits[block >> 3] & (0x80 >> (block & 7))) == 0;
+}
+
+static UInt32 chunk_first(UInt32 c) {
+    return c * ABM_CHUNK_BLOCKS;
+}
+
+static UInt32 chunk_len(const AllocBitmap* abm, UInt32 c) {
+    UInt32 left = abm->numBlocks - chunk_first(c);
+    return (left < ABM_CHUNK_BLOCKS) ? left : ABM_CHUNK_BLOCKS;
+}
+
+static void summarize(AllocBitmap* abm, UInt32 c) {
+    UInt32 first = chunk_first(c);
+    UInt32 n = chunk_len(abm, c);
+    UInt32 run = 0, longest = 0, freeCount = 0, head = 0;
+    Boolean inHead = true;
+
+    for (UInt32 i = 0; i < n; ) {
+        UInt32 b = first + i;
+
+        /* Whole bytes at a time where they're all one state */
+        if ((b & 7) == 0 && i + 8 <= n) {
+            UInt8 byte = abm->bits[b >> 3];
+            if (byte == 0x00) {
+                run += 8;
+                freeCount += 8;
+                i += 8;
+                continue;
+            }
+            if (byte == 0xFF) {
+                if (run > longest) longest = run;
+                if (inHead) { head = run; inHead = false; }
+                run = 0;
+                i += 8;
+                continue;
+            }
+        }
+
+        if (bit_free(abm, b)) {
+            run++;
+            freeCount++;
+        } else {
+            if (run > longest) longest = run;
+            if (inHead) { head = run; inHead = false; }
+            run = 0;
+        }
+        i++;
+    }
+
+    if (run > longest) longest = run;
+    if (inHead) head = run;
+
+    ABMChunk* ch = &abm->chunks[c];
+    ch->freeCount = (UInt16)freeCount;
+    ch->longest = (UInt16)longest;
+    ch->head = (UInt16)head;
+    ch->tail = (UInt16)run;
+}
+
+AllocBitmap* ABM_Create(UInt8* bits, UInt32 numBlocks) {
+    if (numBlocks == 0) return NULL;
+
+    AllocBitmap* abm = (AllocBitmap*)NewPtrClear(sizeof(AllocBitmap));
+    if (!abm) return NULL;
+
+    abm->numBlocks = numBlocks;
+    abm->numChunks = (numBlocks + ABM_CHUNK_BLOCKS - 1) / ABM_CHUNK_BLOCKS;
+    abm->chunks = (ABMChunk*)NewPtrClear(abm->numChunks * sizeof(ABMChunk));
+    if (!bits) {
+        bits = (UInt8*)NewPtrClear((numBlocks + 7) / 8);
+        abm->ownsBits = true;
+    }
+    abm->bits = bits;
+    if (!abm->chunks || !abm->bits) {
+        ABM_Dispose(abm);
+        return NULL;
+    }
+
+    for (UInt32 c = 0; c < abm->numChunks; c++) {
+        summarize(abm, c);
+        abm->freeBlocks += abm->chunks[c].freeCount;
+    }
+    return abm;
+}
+
+void ABM_Dispose(AllocBitmap* abm) {
+    if (!abm) return;
+    if (abm->ownsBits && abm->bits) DisposePtr((Ptr)abm->bits);
+    if (abm->chunks) DisposePtr((Ptr)abm->chunks);
+    DisposePtr((Ptr)abm);
+}
+
+/* First run of at least min free blocks starting in [from, limit); the run
+ * itself may carry on past limit */
+static Boolean find_from(AllocBitmap* abm, UInt32 from, UInt32 limit, UInt32 min, UInt32* found) {
+    UInt32 run = 0, runStart = from;
+    UInt32 b = from;
+
+    while (b < abm->numBlocks) {
+        if (run == 0 && b >= limit) return false;
+
+        UInt32 c = b / ABM_CHUNK_BLOCKS;
+        UInt32 cFirst = chunk_first(c);
+        UInt32 cLen = chunk_len(abm, c);
+        UInt32 cEnd = cFirst + cLen;
+        const ABMChunk* ch = &abm->chunks[c];
+
+        if (b == cFirst) {
+            if (ch->freeCount == 0) {
+                run = 0;
+                b = cEnd;
+                abm->stats.chunksSkipped++;
+                continue;
+            }
+            if (ch->freeCount == cLen) {
+                if (run == 0) runStart = b;
+                run += cLen;
+                b = cEnd;
+                abm->stats.chunksSkipped++;
+                if (run >= min) {
+                    *found = runStart;
+                    return true;
+                }
+                continue;
+            }
+            if (run + ch->head >= min) {
+                if (run == 0) runStart = b;
+                *found = runStart;
+                abm->stats.chunksSkipped++;
+                return true;
+            }
+            if (ch->longest < min) {
+                run = ch->tail;
+                runStart = cEnd - ch->tail;
+                if (run && runStart >= limit) run = 0;
+                b = cEnd;
+                abm->stats.chunksSkipped++;
+                continue;
+            }
+        }
+
+        abm->stats.chunksScanned++;
+        while (b < cEnd) {
+            if ((b & 7) == 0 && b + 8 <= cEnd) {
+                UInt8 byte = abm->bits[b >> 3];
+                if (byte == 0xFF) {
+                    run = 0;
+                    b += 8;
+                    continue;
+                }
+                if (byte == 0x00 && (run > 0 || b < limit) && run + 8 < min) {
+                    if (run == 0) runStart = b;
+                    run += 8;
+                    b += 8;
+                    continue;
+                }
+            }
+            if (bit_free(abm, b)) {
+                if (run == 0) {
+                    if (b >= limit) return false;
+                    runStart = b;
+                }
+                if (++run >= min) {
+                    *found = runStart;
+                    return true;
+                }
+            } else {
+                run = 0;
+            }
+            b++;
+        }
+    }
+    return false;
+}
+
+Boolean ABM_FindRun(AllocBitmap* abm, UInt32 hint, UInt32 minBlocks, UInt32 maxBlocks,
+                    UInt32* start, UInt32* count) {
+    UInt32 found;
+
+    if (!abm || !start || !count || minBlocks == 0 || minBlocks > maxBlocks) return false;
+    if (minBlocks > abm->freeBlocks) return false;
+    if (hint >= abm->numBlocks) hint = 0;
+
+    abm->stats.searches++;
+    if (!find_from(abm, hint, abm->numBlocks, minBlocks, &found) &&
+        !(hint > 0 && find_from(abm, 0, hint, minBlocks, &found))) {
+        return false;
+    }
+
+    UInt32 n = minBlocks;
+    while (n < maxBlocks && found + n < abm->numBlocks && bit_free(abm, found + n)) {
+        n++;
+    }
+
+    *start = found;
+    *count = n;
+    return true;
+}
+
+UInt32 ABM_Mark(AllocBitmap* abm, UInt32 start, UInt32 count, Boolean inUse) {
+    if (!abm || count == 0 || start >= abm->numBlocks) return 0;
+    if (count > abm->numBlocks - start) count = abm->numBlocks - start;
+
+    UInt32 changed = 0;
+    for (UInt32 b = start; b < start + count; b++) {
+        UInt8 mask = (UInt8)(0x80 >> (b & 7));
+        if (inUse && !(abm->bits[b >> 3] & mask)) {
+            abm->bits[b >> 3] |= mask;
+            changed++;
+        } else if (!inUse && (abm->bits[b >> 3] & mask)) {
+            abm->bits[b >> 3] &= (UInt8)~mask;
+            changed++;
+        }
+    }
+
+    if (changed) {
+        UInt32 last = (start + count - 1) / ABM_CHUNK_BLOCKS;
+        for (UInt32 c = start / ABM_CHUNK_BLOCKS; c <= last; c++) {
+            summarize(abm, c);
+        }
+        if (inUse) abm->freeBlocks -= changed;
+        else abm->freeBlocks += changed;
+    }
+    return changed;
+}
+
+Boolean ABM_IsFree(const AllocBitmap* abm, UInt32 block) {
+    return abm && block < abm->numBlocks && bit_free(abm, block);
+}
+
+UInt32 ABM_FreeBlocks(const AllocBitmap* abm) {
+    return abm ? abm->freeBlocks : 0;
+}
+
+void ABM_GetStats(const AllocBitmap* abm, AllocBitmapStats* stats) {
+    if (!stats) return;
+    if (!abm) {
+        memset(stats, 0, sizeof(*stats));
+        return;
+    }
+    *stats = abm->stats;
+}
@@ -15,7 +15,77 @@
 
 #include "FileMgr/file_manager.h"
 #include "FileMgr/hfs_structs.h"
+#include "FileMgr/alloc_bitmap.h"
+#include "MemoryMgr/MemoryManager.h"
 
+/*
+ * Allocation maps for the volumes this layer allocates on, by VCB.
+ * MountVol doesn't read the volume bitmap, so a map starts with the
+ * blocks the MDB counts as used taken to be the first ones, where a newly
+ * initialized volume has them.
+ */
+#define FXM_MAX_VOLUMES 8
+
+static struct {
+    VCB*         vcb;
+    AllocBitmap* map;
+} g_fxm_maps[FXM_MAX_VOLUMES];
+
+static AllocBitmap* FXMVolumeMap(VCB* vcb) {
+    int free_slot = -1;
+
+    for (int i = 0; i < FXM_MAX_VOLUMES; i++) {
+        if (g_fxm_maps[i].vcb == vcb) return g_fxm_maps[i].map;
+        if (!g_fxm_maps[i].vcb && free_slot < 0) free_slot = i;
+    }
+    if (free_slot < 0) return NULL;
+
+    AllocBitmap* map = ABM_Create(NULL, vcb->vcbNmAlBlks);
+    if (!map) return NULL;
+    if (vcb->vcbFreeBks < vcb->vcbNmAlBlks) {
+        ABM_Mark(map, 0, (UInt32)(vcb->vcbNmAlBlks - vcb->vcbFreeBks), true);
+    }
+
+    g_fxm_maps[free_slot].vcb = vcb;
+    g_fxm_maps[free_slot].map = map;
+    return map;
+}
+
+/*
+ * FXMReleaseVolume - Drop a volume's allocation map when it goes offline
+ * (NULL: every volume's)
+ */
+void FXMReleaseVolume(VCB* vcb) {
+    for (int i = 0; i < FXM_MAX_VOLUMES; i++) {
+        if (g_fxm_maps[i].vcb && (vcb == NULL || g_fxm_maps[i].vcb == vcb)) {
+            ABM_Dispose(g_fxm_maps[i].map);
+            g_fxm_maps[i].vcb = NULL;
+            g_fxm_maps[i].map = NULL;
+        }
+    }
+}
+
+/* First block past the file's last extent, or 0 if it has none */
+static UInt32 FXMFileEnd(FCB* fcb) {
+    UInt32 end = 0;
+    int extent_index;
+
+    for (extent_index = 0; extent_index < NUM_EXTENTS_PER_RECORD; extent_index++) {
+        ExtentDescriptor* extent = &(fcb)->extent[extent_index];
+        if (extent->blockCount == 0) break;
+        end = (UInt32)extent->startBlock + extent->blockCount;
+    }
+    return end;
+}
+
+/* Free a run of blocks, crediting the volume only with those that were in use */
+static void FXMFreeBlocks(VCB* vcb, AllocBitmap* map, UInt32 start, UInt32 count) {
+    if (map != NULL) {
+        vcb->vcbFreeBks += (UInt16)ABM_Mark(map, start, count, false);
+    } else {
+        vcb->vcbFreeBks += (UInt16)count;
+    }
+}
 
 /*
  * FXMFindExtent - Find extent record for file allocation block
@@ -55,9 +125,13 @@ OSErr FXMAllocateExtent(VCB* vcb, FCB* fcb, UInt32 bytes_needed, ExtentRecord* e
     UInt32 blocks_needed;
     UInt32 start_block = 0;
     UInt32 blocks_found = 0;
+    AllocBitmap* map;
 
     if (vcb == NULL || fcb == NULL || extent_rec == NULL) return paramErr;
 
+    map = FXMVolumeMap(vcb);
+    if (map == NULL) return memFullErr;
+
     /* Calculate blocks needed - Evidence: byte to block conversion */
     blocks_needed = CalculateAllocationBlocks(bytes_needed, vcb->vcbAlBlkSiz);
 
@@ -66,24 +140,19 @@ OSErr FXMAllocateExtent(VCB* vcb, FCB* fcb, UInt32 bytes_needed, ExtentRecord* e
         return memFullErr;
     }
 
-    /* Simulate volume bitmap scan - Evidence: ROM extent manager code bitmap scanning */
-    /* In real implementation, would scan volume allocation bitmap */
-    start_block = vcb->vcbAllocPtr;  /* Start search at allocation pointer */
-
-    /* Simple allocation - find contiguous free blocks */
-    if (start_block + blocks_needed <= vcb->vcbNmAlBlks) {
-        blocks_found = blocks_needed;
-    } else {
-        /* Not enough contiguous space at allocation pointer */
-        start_block = vcb->vcbAlBlSt;  /* Start from beginning */
-        if (start_block + blocks_needed <= vcb->vcbNmAlBlks) {
-            blocks_found = blocks_needed;
-        }
+    /* Search the bitmap right after the file's last extent so it grows in
+     * place, else from the allocation pointer - Evidence: ROM extent
+     * manager code bitmap scanning */
+    start_block = FXMFileEnd(fcb);
+    if (start_block == 0) {
+        start_block = (UInt32)vcb->vcbAllocPtr;
     }
 
-    if (blocks_found < blocks_needed) {
+    if (!ABM_FindRun(map, start_block, blocks_needed, blocks_needed,
+                     &start_block, &blocks_found)) {
         return memFullErr;  /* Not enough contiguous space */
     }
+    ABM_Mark(map, start_block, blocks_found, true);
 
     /* Create extent record - Evidence: extent record creation pattern */
     memset(extent_rec, 0, sizeof(ExtentRecord));
@@ -96,7 +165,7 @@ OSErr FXMAllocateExtent(VCB* vcb, FCB* fcb, UInt32 bytes_needed, ExtentRecord* e
     /* Update allocation pointer - Evidence: allocation pointer advancement */
     vcb->vcbAllocPtr = (UInt16)(start_block + blocks_found);
     if (vcb->vcbAllocPtr >= vcb->vcbNmAlBlks) {
-        vcb->vcbAllocPtr = vcb->vcbAlBlSt;  /* Wrap around */
+        vcb->vcbAllocPtr = 0;  /* Wrap around */
     }
 
     return noErr;
@@ -108,9 +177,12 @@ OSErr FXMAllocateExtent(VCB* vcb, FCB* fcb, UInt32 bytes_needed, ExtentRecord* e
  */
 OSErr FXMDeallocateExtent(VCB* vcb, ExtentRecord* extent_rec) {
     int extent_index;
+    AllocBitmap* map;
 
     if (vcb == NULL || extent_rec == NULL) return paramErr;
 
+    map = FXMVolumeMap(vcb);
+
     /* Deallocate each extent in the record - Evidence: extent deallocation loop */
     for (extent_index = 0; extent_index < NUM_EXTENTS_PER_RECORD; extent_index++) {
         ExtentDescriptor* extent = &extent_rec->extent[extent_index];
@@ -118,10 +190,7 @@ OSErr FXMDeallocateExtent(VCB* vcb, ExtentRecord* extent_rec) {
         if (extent->blockCount == 0) break;  /* End of extents */
 
         /* Mark blocks as free in volume bitmap */
-        /* In real implementation, would clear bits in volume allocation bitmap */
-
-        /* Update volume free block count */
-        vcb->vcbFreeBks += extent->blockCount;
+        FXMFreeBlocks(vcb, map, extent->startBlock, extent->blockCount);
 
         /* Clear extent */
         extent->startBlock = 0;
@@ -152,6 +221,17 @@ OSErr FXMExtendFile(FCB* fcb, UInt32 bytes_to_add) {
     for (extent_index = 0; extent_index < NUM_EXTENTS_PER_RECORD; extent_index++) {
         ExtentDescriptor* extent = &(fcb)->extent[extent_index];
 
+        if (extent->blockCount != 0 &&
+            (extent_index + 1 == NUM_EXTENTS_PER_RECORD || fcb->extent[extent_index + 1].blockCount == 0) &&
+            (UInt32)extent->startBlock + extent->blockCount == new_extent.extent[0].startBlock &&
+            (UInt32)extent->blockCount + new_extent.extent[0].blockCount <= 0xFFFF) {
+            /* Allocated right after the last extent: just lengthen it, unless
+             * its block count would overflow, then it takes the next slot */
+            extent->blockCount += new_extent.extent[0].blockCount;
+            fcb->fcbPLen += bytes_to_add;
+            return noErr;
+        }
+
         if (extent->blockCount == 0) {
             /* Found empty slot - Evidence: FCB extent slot filling */
             *extent = new_extent.extent[0];
@@ -178,9 +258,12 @@ OSErr FXMTruncateFile(FCB* fcb, UInt32 new_length) {
     UInt32 blocks_needed;
     UInt32 current_block = 0;
     int extent_index;
+    AllocBitmap* map;
 
     if (fcb == NULL || fcb->fcbVPtr == NULL) return paramErr;
 
+    map = FXMVolumeMap(fcb->fcbVPtr);
+
     /* Calculate blocks needed for new length */
     blocks_needed = CalculateAllocationBlocks(new_length, fcb->fcbVPtr->vcbAlBlkSiz);
 
@@ -192,15 +275,17 @@ OSErr FXMTruncateFile(FCB* fcb, UInt32 new_length) {
 
         if (current_block >= blocks_needed) {
             /* This entire extent is beyond new length - deallocate it */
-            fcb->fcbVPtr->vcbFreeBks += extent->blockCount;
+            FXMFreeBlocks(fcb->fcbVPtr, map, extent->startBlock, extent->blockCount);
             extent->startBlock = 0;
             extent->blockCount = 0;
         } else if (current_block + extent->blockCount > blocks_needed) {
-            /* This extent partially extends beyond new length - truncate it */
+            /* This extent partially extends beyond new length - truncate it;
+             * the extents after it are then freed whole */
             UInt32 excess_blocks = current_block + extent->blockCount - blocks_needed;
-            fcb->fcbVPtr->vcbFreeBks += (UInt16)excess_blocks;
+            FXMFreeBlocks(fcb->fcbVPtr, map,
+                          (UInt32)extent->startBlock + extent->blockCount - excess_blocks,
+                          excess_blocks);
             extent->blockCount -= (UInt16)excess_blocks;
-            break;
         }
 
         current_block += extent->blockCount;
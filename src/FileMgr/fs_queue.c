@@ -0,0 +1,284 @@
+/*
+ * fs_queue.c - File System request queue
+ *
+ * Always built: the async File Manager calls and the event loop use it with or
+ * without the TFS dispatcher (tfs_dispatch.c, ENABLE_FILEMGR_EXTRA).
+ */
+
+#include "SystemTypes.h"
+
+#include "FileMgr/fs_queue.h"
+#include "ProcessMgr/ProcessMgr.h"
+#include "TimeManager/TimeBase.h"
+
+/*
+ * Request Queue
+
+ * Asynchronous calls are queued here instead of running in the caller.  The
+ * queue is worked by FSQueue_Service, which the event loop and WaitNextEvent
+ * call at their cooperative yield points, so an application's reads and
+ * writes proceed while it redraws.  Requests from background processes are
+ * only taken while no foreground request waits, except that every
+ * FS_QUEUE_BG_INTERVAL-th dispatch goes to the background so it cannot
+ * starve.  A request never overtakes an earlier one for the same refNum.
+ *
+ * Completion routines are not called by the worker: finished requests move
+ * to a done list and CmdDone calls them once the service pass is over, the
+ * same deferred point where Time Manager tasks run.
+ */
+#define FS_QUEUE_SLOTS          32
+#define FS_QUEUE_BG_INTERVAL    4
+#define FS_QUEUE_IN_PROGRESS    1   /* ioResult while queued or running */
+
+enum {
+    kFSQueueForeground = 0,
+    kFSQueueBackground = 1
+};
+
+typedef struct FSQueueElem {
+    struct FSQueueElem* next;
+    ParamBlockRec*      pb;
+    FSQueueProc         proc;
+    SInt16              refNum;
+    UInt8               priority;
+} FSQueueElem;
+
+static FSQueueElem  gFSQueueSlots[FS_QUEUE_SLOTS];
+static FSQueueElem* gFSQueueFree;
+static FSQueueElem* gFSQueueHead;       /* Waiting, in submission order */
+static FSQueueElem* gFSQueueTail;
+static FSQueueElem* gFSDoneHead;        /* Finished, completion not yet called */
+static FSQueueElem* gFSDoneTail;
+static Boolean      gFSQueueReady;
+static Boolean      gFSQueueRunning;    /* Worker is inside a request */
+static Boolean      gFSInCmdDone;
+static UInt32       gFSForegroundRun;   /* Foreground dispatches while background waits */
+static FSQueueStats gFSQueueStats;
+
+static void fs_queue_init(void) {
+    gFSQueueFree = NULL;
+    for (int i = FS_QUEUE_SLOTS - 1; i >= 0; i--) {
+        gFSQueueSlots[i].next = gFSQueueFree;
+        gFSQueueFree = &gFSQueueSlots[i];
+    }
+    gFSQueueReady = true;
+}
+
+/* Background if the calling process has been sent to the back */
+static UInt8 fs_queue_caller_priority(void) {
+    if (gCurrentProcess && gCurrentProcess->processState == kProcessBackground) {
+        return kFSQueueBackground;
+    }
+    return kFSQueueForeground;
+}
+
+/*
+ * Next request to run: the oldest of the wanted priority class, or the
+ * oldest overall if that class is empty, pulled back to the oldest request
+ * for the same refNum.
+ */
+static FSQueueElem* fs_queue_pick(void) {
+    FSQueueElem* e;
+    FSQueueElem* cand = NULL;
+
+    UInt8 want = (gFSForegroundRun >= FS_QUEUE_BG_INTERVAL) ? kFSQueueBackground
+                                                              : kFSQueueForeground;
+    for (e = gFSQueueHead; e; e = e->next) {
+        if (e->priority == want) {
+            cand = e;
+            break;
+        }
+    }
+    if (!cand) cand = gFSQueueHead;
+    if (!cand) return NULL;
+
+    for (e = gFSQueueHead; e != cand; e = e->next) {
+        if (e->refNum == cand->refNum) return e;
+    }
+    return cand;
+}
+
+static void fs_queue_unlink(FSQueueElem* elem) {
+    FSQueueElem* prev = NULL;
+    for (FSQueueElem* e = gFSQueueHead; e; prev = e, e = e->next) {
+        if (e != elem) continue;
+        if (prev) prev->next = e->next;
+        else gFSQueueHead = e->next;
+        if (gFSQueueTail == e) gFSQueueTail = prev;
+        e->next = NULL;
+        return;
+    }
+}
+
+static Boolean fs_queue_background_waiting(void) {
+    for (FSQueueElem* e = gFSQueueHead; e; e = e->next) {
+        if (e->priority == kFSQueueBackground) return true;
+    }
+    return false;
+}
+
+/* Run one request and move it to the done list */
+static void fs_queue_run(FSQueueElem* elem) {
+    ParamBlockRec* pb = elem->pb;
+    OSErr err;
+
+    fs_queue_unlink(elem);
+
+    if (elem->priority == kFSQueueBackground) {
+        gFSForegroundRun = 0;
+        gFSQueueStats.background++;
+    } else {
+        gFSForegroundRun = fs_queue_background_waiting() ? gFSForegroundRun + 1 : 0;
+        gFSQueueStats.foreground++;
+    }
+
+    gFSQueueRunning = true;
+    err = elem->proc(pb);
+    gFSQueueRunning = false;
+
+    pb->ioResult = err;
+    if (gFSDoneTail) gFSDoneTail->next = elem;
+    else gFSDoneHead = elem;
+    gFSDoneTail = elem;
+}
+
+/*
+ * FSQueueRequest - Queue a request for the storage worker
+
+ * proc runs later with pb; refNum orders it against other requests for the
+ * same file.  ioResult stays positive until the request has run.
+ */
+OSErr FSQueueRequest(ParamBlockRec* pb, FSQueueProc proc, SInt16 refNum) {
+    FSQueueElem* elem;
+
+    if (pb == NULL || proc == NULL) return paramErr;
+    if (!gFSQueueReady) fs_queue_init();
+
+    /* Full: make room by running the next request now */
+    if (!gFSQueueFree) {
+        if (gFSQueueRunning) return queueOverflow;
+        if (gFSQueueHead) {
+            fs_queue_run(fs_queue_pick());
+            gFSQueueStats.overflows++;
+        }
+        CmdDone();
+        if (!gFSQueueFree) return queueOverflow;
+    }
+
+    elem = gFSQueueFree;
+    gFSQueueFree = elem->next;
+
+    elem->next = NULL;
+    elem->pb = pb;
+    elem->proc = proc;
+    elem->refNum = refNum;
+    elem->priority = fs_queue_caller_priority();
+
+    if (gFSQueueTail) gFSQueueTail->next = elem;
+    else gFSQueueHead = elem;
+    gFSQueueTail = elem;
+
+    pb->ioResult = FS_QUEUE_IN_PROGRESS;
+    gFSQueueStats.queued++;
+    return noErr;
+}
+
+/*
+ * FSQueue_Service - Storage worker
+
+ * Runs up to maxRequests queued requests, stopping early once maxMicros
+ * have passed (0 = no limit), then calls completion routines.  Returns the
+ * number of requests run.
+ */
+UInt32 FSQueue_Service(UInt32 maxRequests, UInt32 maxMicros) {
+    UInt32 count = 0;
+
+    if (!gFSQueueReady || gFSQueueRunning) return 0;
+
+    UInt32 start = MicrosecondsNow();
+    while (gFSQueueHead && count < maxRequests) {
+        if (maxMicros > 0 && count > 0 && MicrosecondsNow() - start >= maxMicros) {
+            break;
+        }
+        fs_queue_run(fs_queue_pick());
+        count++;
+    }
+
+    CmdDone();
+    return count;
+}
+
+/*
+ * FSQueueWait - Run everything queued for one file
+
+ * Synchronous calls use this so they see the effect of earlier async calls
+ * on the same refNum without waiting for unrelated requests.
+ */
+OSErr FSQueueWait(SInt16 refNum) {
+    FSQueueElem* elem;
+
+    if (!gFSQueueReady || gFSQueueRunning) return noErr;
+
+    for (;;) {
+        elem = gFSQueueHead;
+        while (elem && elem->refNum != refNum) elem = elem->next;
+        if (!elem) break;
+        fs_queue_run(elem);
+    }
+    CmdDone();
+    return noErr;
+}
+
+/*
+ * FSQueueSync - Synchronous File System Operations
+
+ * Waits until every queued request has run
+ */
+OSErr FSQueueSync(void) {
+    if (!gFSQueueReady || gFSQueueRunning) return noErr;
+
+    while (gFSQueueHead || gFSDoneHead) {
+        FSQueue_Service(FS_QUEUE_SLOTS, 0);
+        if (gFSInCmdDone) break;    /* Called from a completion routine */
+    }
+    return noErr;
+}
+
+/*
+ * CmdDone - Command completion handler
+
+ * Calls the completion routines of finished requests.  A slot is released
+ * before its routine runs, so the routine may queue the next request.
+ */
+void CmdDone(void) {
+    FSQueueElem* elem;
+
+    if (gFSInCmdDone) return;
+    gFSInCmdDone = true;
+
+    while ((elem = gFSDoneHead) != NULL) {
+        ParamBlockRec* pb = elem->pb;
+
+        gFSDoneHead = elem->next;
+        if (!gFSDoneHead) gFSDoneTail = NULL;
+        elem->pb = NULL;
+        elem->next = gFSQueueFree;
+        gFSQueueFree = elem;
+
+        gFSQueueStats.completed++;
+        if (pb->ioCompletion) {
+            ((IOCompletionProcPtr)pb->ioCompletion)(pb);
+        }
+    }
+
+    gFSInCmdDone = false;
+}
+
+void FSQueue_GetStats(FSQueueStats* stats) {
+    if (!stats) return;
+    *stats = gFSQueueStats;
+    stats->pending = 0;
+    for (FSQueueElem* e = gFSQueueHead; e; e = e->next) {
+        stats->pending++;
+    }
+}
@@ -152,47 +152,22 @@ OSErr OpenCall(void* param_block) {
     return noErr;
 }
 
+/* Run a queued trap-dispatched call */
+static OSErr fs_queue_dispatch(ParamBlockRec* pb) {
+    return TFSDispatch(0, pb->ioTrap, pb);
+}
+
 /*
  * FSQueue - File System Queue Management
 
- * Handles queuing of file system operations for async execution
+ * Queues a trap-dispatched call for asynchronous execution
  */
 OSErr FSQueue(void* param_block) {
     ParamBlockRec* pb = (ParamBlockRec*)param_block;
 
     if (pb == NULL) return paramErr;
 
-    /* In original implementation, this would add to FS queue */
-
-    /* For synchronous implementation, just call the operation directly */
-    return TFSDispatch(0, pb->ioTrap, param_block);
-}
-
-/*
- * FSQueueSync - Synchronous File System Operations
-
- * Handles synchronous file system operations without queuing
- */
-OSErr FSQueueSync(void) {
-    /* In our implementation, operations are already synchronous */
-    return noErr;
-}
-
-/*
- * CmdDone - Command completion handler
-
- * Handles cleanup after file system operations complete
- */
-void CmdDone(void) {
-    /* Original would:
-     * 1. Check for errors and convert internal error codes
-     * 2. Call completion routines for async operations
-     * 3. Update file system state
-     * 4. Handle disk switch scenarios
-     */
-
-    /* For basic implementation, just return */
-    return;
+    return FSQueueRequest(pb, fs_queue_dispatch, pb->ioRefNum);
 }
 
 /* */
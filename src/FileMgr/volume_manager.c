@@ -204,6 +204,8 @@ OSErr OffLine(VCB* vcb) {
     VCB* current = g_mounted_volumes;
     VCB* prev = NULL;
 
+    FXMReleaseVolume(vcb);
+
     /* If vcb is NULL, unmount all volumes - Evidence: global unmount pattern */
     if (vcb == NULL) {
         while (g_mounted_volumes != NULL) {
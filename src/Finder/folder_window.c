@@ -91,6 +91,9 @@ typedef struct FolderWindowState {
     DirID currentDir;      /* Directory ID being displayed */
     Point dragStartGlobal; /* Global coordinates where drag started */
     short draggingIndex;   /* Index of item being dragged (-1 = none) */
+    short itemCapacity;    /* Slots allocated in items/selectedItems */
+    VFSEnumCursor* enumCursor; /* Set while the folder is still being read */
+    Boolean addControlPanels;  /* Append the virtual Control Panels folder when done */
 } FolderWindowState;
 
 /* Global folder window states (indexed by window pointer for now) */
@@ -293,6 +296,9 @@ FolderWindowState* GetFolderState(WindowPtr w) {
             gFolderWindows[i].state.dragStartGlobal.h = 0;
             gFolderWindows[i].state.dragStartGlobal.v = 0;
             gFolderWindows[i].state.draggingIndex = -1;
+            gFolderWindows[i].state.itemCapacity = 0;
+            gFolderWindows[i].state.enumCursor = NULL;
+            gFolderWindows[i].state.addControlPanels = false;
 
             /* Initialize folder contents */
             FINDER_LOG_DEBUG("GetFolderState: About to call InitializeFolderContents\n");
@@ -306,6 +312,177 @@ FolderWindowState* GetFolderState(WindowPtr w) {
     return NULL;  /* No slots available */
 }
 
+/*
+ * Folders are read through a VFS enumeration cursor in batches: enough on
+ * open to fill the window, the rest from FolderWindow_Idle, so opening a
+ * large folder doesn't stall the Finder or truncate the listing.
+ */
+#define FW_ENUM_BATCH       32
+#define FW_OPEN_BATCHES     2
+
+/* Grid layout: 3 columns, spacing 100px horizontal, 90px vertical, from (80, 30) */
+#define FW_GRID_LEFT        80
+#define FW_GRID_TOP         30
+#define FW_GRID_COL_SPACING 100
+#define FW_GRID_ROW_HEIGHT  90
+#define FW_GRID_COLUMNS     3
+#define FW_ITEM_HEIGHT      42      /* Icon and label below position.v */
+
+/* Items whose grid position and label still fit in a QuickDraw coordinate */
+#define FW_MAX_ITEMS        (((32767 - FW_GRID_TOP - FW_ITEM_HEIGHT) / FW_GRID_ROW_HEIGHT + 1) * \
+                             FW_GRID_COLUMNS)
+
+static void FW_LayoutItems(FolderWindowState* state, short first) {
+    for (int i = first; i < state->itemCount; i++) {
+        state->items[i].position.h = FW_GRID_LEFT + (i % FW_GRID_COLUMNS) * FW_GRID_COL_SPACING;
+        state->items[i].position.v = FW_GRID_TOP + (i / FW_GRID_COLUMNS) * FW_GRID_ROW_HEIGHT;
+    }
+}
+
+/* Make room for at least `needed` items, keeping the current ones */
+static Boolean FW_GrowItems(FolderWindowState* state, int needed) {
+    if (needed <= state->itemCapacity && state->items && state->selectedItems) {
+        return true;
+    }
+    if (needed > FW_MAX_ITEMS) {
+        return false;
+    }
+
+    int capacity = state->itemCapacity ? state->itemCapacity : FW_ENUM_BATCH * FW_OPEN_BATCHES;
+    while (capacity < needed) capacity *= 2;
+    if (capacity > FW_MAX_ITEMS) capacity = FW_MAX_ITEMS;
+
+    FolderItem* items = (FolderItem*)NewPtr(sizeof(FolderItem) * capacity);
+    Boolean* selected = (Boolean*)NewPtr(sizeof(Boolean) * capacity);
+    if (!items || !selected) {
+        if (items) DisposePtr((Ptr)items);
+        if (selected) DisposePtr((Ptr)selected);
+        FINDER_LOG_WARN("FW: allocation failed for %d items\n", capacity);
+        return false;
+    }
+
+    for (int i = 0; i < capacity; i++) {
+        selected[i] = false;
+    }
+    if (state->items) {
+        BlockMove(state->items, items, state->itemCount * sizeof(FolderItem));
+        DisposePtr((Ptr)state->items);
+    }
+    if (state->selectedItems) {
+        BlockMove(state->selectedItems, selected, state->itemCount * sizeof(Boolean));
+        DisposePtr((Ptr)state->selectedItems);
+    }
+    state->items = items;
+    state->selectedItems = selected;
+    state->itemCapacity = (short)capacity;
+    return true;
+}
+
+static void FW_EndEnumeration(FolderWindowState* state) {
+    if (state->enumCursor) {
+        VFS_EnumerateClose(state->enumCursor);
+        state->enumCursor = NULL;
+    }
+    state->addControlPanels = false;
+}
+
+/*
+ * Read the next batch of the folder into the window.  Returns the number of
+ * items added; the cursor is closed once the folder is exhausted.
+ */
+static int FW_FetchBatch(FolderWindowState* state) {
+    CatEntry entries[FW_ENUM_BATCH];
+    int count = 0;
+
+    if (!state->enumCursor) {
+        return 0;
+    }
+
+    if (!VFS_EnumerateNext(state->enumCursor, entries, FW_ENUM_BATCH, &count)) {
+        FINDER_LOG_DEBUG("FW: VFS_EnumerateNext failed after %d items\n", state->itemCount);
+        FW_EndEnumeration(state);
+        return 0;
+    }
+
+    Boolean done = VFS_EnumerateDone(state->enumCursor);
+    int extra = (done && state->addControlPanels) ? 1 : 0;
+    short first = state->itemCount;
+
+    /* Past FW_MAX_ITEMS the grid leaves the coordinate plane: show what fits */
+    if (state->itemCount + count + extra > FW_MAX_ITEMS) {
+        FINDER_LOG_WARN("FW: folder has more than %d items, listing truncated\n", FW_MAX_ITEMS);
+        count = FW_MAX_ITEMS - state->itemCount;
+        extra = 0;
+        done = true;
+    }
+
+    if (count + extra > 0 && !FW_GrowItems(state, state->itemCount + count + extra)) {
+        FW_EndEnumeration(state);
+        return 0;
+    }
+
+    /* Convert CatEntry to FolderItem */
+    for (int i = 0; i < count; i++) {
+        FolderItem* item = &state->items[state->itemCount++];
+
+        size_t nameLen = strlen(entries[i].name);
+        if (nameLen >= 256) nameLen = 255;
+        memcpy(item->name, entries[i].name, nameLen);
+        item->name[nameLen] = '\0';
+
+        item->isFolder = (entries[i].kind == kNodeDir);
+        item->size = entries[i].size;
+        item->modTime = entries[i].modTime;
+        item->label = 0;  /* Default: no label */
+        item->fileID = entries[i].id;
+        item->parentID = entries[i].parent;
+        item->type = entries[i].type;
+        item->creator = entries[i].creator;
+    }
+
+    if (extra) {
+        FolderItem *cpFolder = &state->items[state->itemCount++];
+        memset(cpFolder, 0, sizeof(FolderItem));
+        strncpy(cpFolder->name, "Control Panels", sizeof(cpFolder->name) - 1);
+        cpFolder->isFolder = true;
+        cpFolder->fileID = kControlPanelsDirID;
+        cpFolder->parentID = state->currentDir;
+        cpFolder->type = 'CPLF';
+        cpFolder->creator = 'cdev';
+        FINDER_LOG_DEBUG("FW: Added virtual 'Control Panels' folder entry\n");
+    }
+
+    FW_LayoutItems(state, first);
+
+    if (done) {
+        FW_EndEnumeration(state);
+    }
+    return state->itemCount - first;
+}
+
+/*
+ * FolderWindow_Idle - Continue reading folders that are still open for
+ * enumeration, one batch per call, and redraw the window that grew.
+ */
+void FolderWindow_Idle(void) {
+    static int nextSlot = 0;
+
+    for (int n = 0; n < MAX_FOLDER_WINDOWS; n++) {
+        int i = (nextSlot + n) % MAX_FOLDER_WINDOWS;
+        FolderWindowState* state = &gFolderWindows[i].state;
+
+        if (!gFolderWindows[i].window || !state->enumCursor) {
+            continue;
+        }
+
+        nextSlot = (i + 1) % MAX_FOLDER_WINDOWS;
+        if (FW_FetchBatch(state) > 0) {
+            PostEvent(updateEvt, (UInt32)gFolderWindows[i].window);
+        }
+        return;
+    }
+}
+
 /* Initialize folder contents from VFS - Extended version with custom dirID */
 void InitializeFolderContentsEx(WindowPtr w, Boolean isTrash, VRefNum vref, DirID dirID) {
         FolderWindowState* state = NULL;
@@ -328,6 +505,9 @@ void InitializeFolderContentsEx(WindowPtr w, Boolean isTrash, VRefNum vref, DirI
     state->vref = vref;
     state->currentDir = dirID;
 
+    FW_EndEnumeration(state);
+    state->itemCapacity = 0;
+
     if (state->items) {
         DisposePtr((Ptr)state->items);
         state->items = NULL;
@@ -609,103 +789,22 @@ void InitializeFolderContentsEx(WindowPtr w, Boolean isTrash, VRefNum vref, DirI
         return;
     } else {
         /* Use provided directory ID */
-        /* Enumerate directory contents using VFS */
-        #define MAX_ITEMS 128
-        CatEntry entries[MAX_ITEMS];
-        int count = 0;
-
-        FINDER_LOG_DEBUG("InitializeFolderContents: calling VFS_Enumerate\n");
-
-        if (!VFS_Enumerate(vref, state->currentDir, entries, MAX_ITEMS, &count)) {
-            FINDER_LOG_DEBUG("InitializeFolderContents: VFS_Enumerate failed\n");
-            state->itemCount = 0;
-            state->items = NULL;
-            return;
-        }
-
-        FINDER_LOG_DEBUG("InitializeFolderContents: VFS_Enumerate OK, count=%d\n", count);
-
-        int extraItems = (dirID == 2) ? 1 : 0;
-        int totalItems = count + extraItems;
-        if (totalItems == 0) {
+        /* Enumerate directory contents using VFS, a batch at a time */
+        state->enumCursor = VFS_EnumerateOpen(vref, state->currentDir);
+        if (!state->enumCursor) {
+            FINDER_LOG_DEBUG("InitializeFolderContents: VFS_EnumerateOpen failed\n");
             state->itemCount = 0;
             state->items = NULL;
             return;
         }
+        state->addControlPanels = (dirID == 2);
 
-        /* Allocate item array */
-        state->items = (FolderItem*)NewPtr(sizeof(FolderItem) * totalItems);
-        if (!state->items) {
-            FINDER_LOG_WARN("FW: malloc failed for %d items\n", count);
-            state->itemCount = 0;
-            return;
-        }
-
-        state->itemCount = totalItems;
-
-        /* Convert CatEntry to FolderItem and lay out in grid
-         * Grid: 3 columns, spacing 100px horizontal, 90px vertical
-         * Start at (80, 30) for margins */
-        for (int i = 0; i < count; i++) {
-            /* Copy name (ensure null termination) */
-            size_t nameLen = strlen(entries[i].name);
-            if (nameLen >= 256) nameLen = 255;
-            memcpy(state->items[i].name, entries[i].name, nameLen);
-            state->items[i].name[nameLen] = '\0';
-
-            /* File system metadata */
-            state->items[i].isFolder = (entries[i].kind == kNodeDir);
-            state->items[i].size = entries[i].size;
-            state->items[i].modTime = entries[i].modTime;
-            state->items[i].label = 0;  /* Default: no label */
-            state->items[i].fileID = entries[i].id;
-            state->items[i].parentID = entries[i].parent;
-            state->items[i].type = entries[i].type;
-            state->items[i].creator = entries[i].creator;
-        }
-
-        if (extraItems) {
-            FolderItem *cpFolder = &state->items[count];
-            memset(cpFolder, 0, sizeof(FolderItem));
-            strncpy(cpFolder->name, "Control Panels", sizeof(cpFolder->name) - 1);
-            cpFolder->isFolder = true;
-            cpFolder->fileID = kControlPanelsDirID;
-            cpFolder->parentID = state->currentDir;
-            cpFolder->type = 'CPLF';
-            cpFolder->creator = 'cdev';
-            FINDER_LOG_DEBUG("FW: Added virtual 'Control Panels' folder entry\n");
-        }
-
-        const int startX = 80;
-        const int startY = 30;
-        const int colSpacing = 100;
-        const int rowHeight = 90;
-        const int maxCols = 3;
-
-        for (int i = 0; i < state->itemCount; i++) {
-            int col = i % maxCols;
-            int row = i / maxCols;
-            state->items[i].position.h = startX + (col * colSpacing);
-            state->items[i].position.v = startY + (row * rowHeight);
-            FINDER_LOG_DEBUG("FW: Item %d: '%s' %s id=%d pos=(%d,%d)\n",
-                         i, state->items[i].name,
-                         state->items[i].isFolder ? "DIR" : "FILE",
-                         state->items[i].fileID,
-                         state->items[i].position.h, state->items[i].position.v);
-        }
-
-        /* Allocate selection array */
-        state->selectedItems = (Boolean*)NewPtr(sizeof(Boolean) * state->itemCount);
-        if (!state->selectedItems) {
-            FINDER_LOG_DEBUG("InitializeFolderContentsEx: Failed to allocate selectedItems for VFS directory\n");
-            state->itemCount = 0;
-            return;
-        }
-        for (int i = 0; i < state->itemCount; i++) {
-            state->selectedItems[i] = false;
+        for (int batch = 0; batch < FW_OPEN_BATCHES && state->enumCursor; batch++) {
+            FW_FetchBatch(state);
         }
 
-        FINDER_LOG_DEBUG("FW: Initialized %d items from VFS\n", count);
+        FINDER_LOG_DEBUG("FW: Initialized %d items from VFS%s\n", state->itemCount,
+                         state->enumCursor ? ", more to come" : "");
     }
 }
 
@@ -1737,45 +1836,11 @@ void FolderWindow_DuplicateSelected(WindowPtr w) {
                 CatEntry newEntry;
                 if (VFS_GetByID(state->vref, newID, &newEntry)) {
                     /* Add to items array - reallocate if needed */
-                    /* Check for integer overflow: itemCount + 1 and sizeof multiplication */
-                    if (state->itemCount >= UINT16_MAX ||
-                        state->itemCount > SIZE_MAX / sizeof(FolderItem) - 1) {
-                        FINDER_LOG_DEBUG("FolderWindow_DuplicateSelected: Integer overflow in items count\n");
-                        continue;
-                    }
-                    Size oldItemsSize = state->itemCount * sizeof(FolderItem);
-                    FolderItem* newItems = (FolderItem*)NewPtr(sizeof(FolderItem) * (state->itemCount + 1));
-                    if (!newItems) {
-                        FINDER_LOG_DEBUG("FolderWindow_DuplicateSelected: Failed to reallocate items array\n");
+                    if (!FW_GrowItems(state, state->itemCount + 1)) {
+                        FINDER_LOG_DEBUG("FolderWindow_DuplicateSelected: Failed to grow items array\n");
                         continue;
                     }
 
-                    if (state->items) {
-                        BlockMove(state->items, newItems, oldItemsSize);
-                        DisposePtr((Ptr)state->items);
-                    }
-                    state->items = newItems;
-
-                    /* Reallocate selectedItems array too */
-                    if (state->selectedItems) {
-                        /* Check for integer overflow: itemCount + 1 and sizeof multiplication */
-                        if (state->itemCount >= UINT16_MAX ||
-                            state->itemCount > SIZE_MAX / sizeof(Boolean) - 1) {
-                            FINDER_LOG_DEBUG("FolderWindow_DuplicateSelected: Integer overflow in selectedItems count\n");
-                            continue;
-                        }
-                        Size oldSelectedSize = state->itemCount * sizeof(Boolean);
-                        Boolean* newSelected = (Boolean*)NewPtr(sizeof(Boolean) * (state->itemCount + 1));
-                        if (!newSelected) {
-                            FINDER_LOG_DEBUG("FolderWindow_DuplicateSelected: Failed to reallocate selectedItems array\n");
-                            continue;
-                        }
-                        BlockMove(state->selectedItems, newSelected, oldSelectedSize);
-                        DisposePtr((Ptr)state->selectedItems);
-                        state->selectedItems = newSelected;
-                        state->selectedItems[state->itemCount] = false;
-                    }
-
                     /* Add the new item */
                     FolderItem* newItem = &state->items[state->itemCount];
                     strncpy(newItem->name, newEntry.name, sizeof(newItem->name) - 1);
@@ -2279,8 +2344,12 @@ FINDER_LOG_DEBUG("CleanupFolderWindow: cleaning up window 0x%08x\n", (unsigned i
                           (unsigned int)gFolderWindows[i].state.items,
                           gFolderWindows[i].state.itemCount);
 
+            /* Stop reading the folder */
+            FW_EndEnumeration(&gFolderWindows[i].state);
+
             /* Sanity check before free - itemCount should be reasonable */
-            if (gFolderWindows[i].state.itemCount > 1000) {
+            if (gFolderWindows[i].state.itemCount < 0 ||
+                gFolderWindows[i].state.itemCount > FW_MAX_ITEMS) {
                 FINDER_LOG_WARN("CleanupFolderWindow: CORRUPTED itemCount=%d, skipping free\n",
                              gFolderWindows[i].state.itemCount);
             } else if (gFolderWindows[i].state.items) {
@@ -2305,6 +2374,7 @@ FINDER_LOG_DEBUG("CleanupFolderWindow: cleaning up window 0x%08x\n", (unsigned i
             gFolderWindows[i].state.items = NULL;
             FINDER_LOG_DEBUG("CleanupFolderWindow: clearing itemCount\n");
             gFolderWindows[i].state.itemCount = 0;
+            gFolderWindows[i].state.itemCapacity = 0;
             FINDER_LOG_DEBUG("CleanupFolderWindow: clearing selectedIndex\n");
             gFolderWindows[i].state.selectedIndex = -1;
 
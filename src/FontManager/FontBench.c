@@ -0,0 +1,439 @@
+/*
+ * FontBench.c - Font strike cache benchmark
+ *
+ * Writes a suitcase of six bitmap families (FOND plus one NFNT per size,
+ * 9 to 24 point) and replays a Finder plus SimpleText text workload
+ * against it through FMSwapFont: Finder runs are mostly Geneva 9 icon
+ * and list labels, SimpleText runs spread over every family and size the
+ * document and its menus ask for.  Each pass reports the strike cache's
+ * hit ratio, loads, evictions, resident bytes and time per swap, first
+ * with the default budget, then with a budget too small for the working
+ * set, so LRU eviction is exercised.  A last pass draws a line in each
+ * face, styled faces drawing from strikes synthesized once and cached,
+ * and one measuring text from the strikes' width tables.
+ *
+ * Activated with FONT_BENCH=1 compile flag; called from main.c once the
+ * boot volume is mounted.  The suitcase is deleted again afterwards.
+ */
+
+#include "SystemTypes.h"
+#include "MacTypes.h"
+#include "System71StdLib.h"
+#include "FileManager.h"
+#include "MemoryMgr/MemoryManager.h"
+#include "ResourceMgr/ResourceMgr.h"
+#include "ResourceMgr/resource_manager.h"
+#include "ResourceMgr/ResourceMgrPriv.h"
+#include "FontManager/FontManager.h"
+#include "FontManager/FontTypes.h"
+#include "FontManager/FontResources.h"
+#include "FontManager/FontCache.h"
+#include "QuickDraw/QuickDraw.h"
+#include "TimeManager/TimeBase.h"
+#include <string.h>
+
+#ifdef FONT_BENCH
+
+#define FONT_BENCH_LOG(fmt, ...) serial_logf(kLogModuleFont, kLogLevelInfo, "[FONT BENCH] " fmt, ##__VA_ARGS__)
+
+#define BENCH_FOND_TYPE     0x464F4E44u     /* 'FOND' */
+#define BENCH_NFNT_TYPE     0x4E464E54u     /* 'NFNT' */
+#define BENCH_FIRST_NFNT    30000
+#define BENCH_FIRST_CHAR    32
+#define BENCH_LAST_CHAR     126
+#define BENCH_RUNS          20000u
+#define BENCH_TIGHT_BUDGET  (24u * 1024u)
+
+static const short kFamilies[] = { 2 /* New York */, 3 /* Geneva */, 4 /* Monaco */,
+                                   20 /* Times */, 21 /* Helvetica */, 22 /* Courier */ };
+static const short kSizes[] = { 9, 10, 12, 14, 18, 24 };
+#define BENCH_FAMILIES  (sizeof(kFamilies) / sizeof(kFamilies[0]))
+#define BENCH_SIZES     (sizeof(kSizes) / sizeof(kSizes[0]))
+#define BENCH_NFNTS     (BENCH_FAMILIES * BENCH_SIZES)
+
+/* One text run: a face the workload draws in, and how often */
+typedef struct {
+    short   family;
+    short   size;
+    Style   face;
+    UInt16  weight;
+} BenchRun;
+
+static const BenchRun kWorkload[] = {
+    /* Finder: icon labels, list views, Get Info, the menu bar */
+    { 3, 9, normal, 400 },  { 3, 9, bold, 60 },     { 3, 10, normal, 40 },
+    { 0, 12, normal, 150 },
+    /* SimpleText: the document, its Font and Size menus, a second window */
+    { 4, 9, normal, 80 },   { 20, 12, normal, 60 }, { 20, 12, italic, 10 },
+    { 20, 14, normal, 30 }, { 20, 18, bold, 8 },    { 20, 24, normal, 8 },
+    { 21, 10, normal, 25 }, { 21, 12, normal, 25 }, { 21, 18, normal, 6 },
+    { 22, 10, normal, 20 }, { 22, 12, normal, 15 }, { 2, 12, normal, 15 },
+    { 2, 14, normal, 8 },   { 2, 18, normal, 5 },   { 4, 12, normal, 10 },
+    { 3, 12, normal, 10 },  { 3, 14, normal, 5 },   { 3, 24, normal, 3 },
+    { 21, 24, normal, 3 },  { 22, 9, normal, 4 },
+};
+#define BENCH_RUN_KINDS (sizeof(kWorkload) / sizeof(kWorkload[0]))
+
+static const UInt8 kSuitcaseName[] = "\022FontBench Suitcase";
+
+static UInt32 bench_rand(UInt32* seed) {
+    *seed = *seed * 1103515245u + 12345u;
+    return *seed >> 16;
+}
+
+/* Character width of the generated faces: a spread around 0.6 em */
+static UInt16 bench_char_width(short size, short ch) {
+    return (UInt16)(size * (4 + (ch % 5)) / 10 + 1);
+}
+
+/* Family width of the generated faces, in 4.12 fractions of an em */
+static UInt16 bench_em_width(short ch) {
+    return (UInt16)((4 + (ch % 5)) * 4096 / 10);
+}
+
+/* Header, association table, then a width table with a plain entry:
+ * count - 1, style, one width per character plus missing glyph and spare */
+#define BENCH_WTAB_WORDS    (2 + (BENCH_LAST_CHAR - BENCH_FIRST_CHAR + 3))
+
+static UInt32 bench_fond_size(void) {
+    return sizeof(FONDResource) + BENCH_SIZES * sizeof(FontAssocEntry) +
+           BENCH_WTAB_WORDS * sizeof(SInt16);
+}
+
+/* Entries of the location table and the OWT: characters, missing glyph, end */
+#define BENCH_TABLE_ENTRIES (BENCH_LAST_CHAR - BENCH_FIRST_CHAR + 3)
+
+/* Layout matches FontResourceLoader.c: header, bitmap, location table,
+ * OWT, in host order */
+static UInt32 bench_nfnt_size(short size) {
+    UInt32 bits = 0;
+    for (short ch = BENCH_FIRST_CHAR; ch <= BENCH_LAST_CHAR; ch++) bits += bench_char_width(size, ch);
+    UInt32 rowWords = (bits + 15) / 16;
+    UInt32 height = (UInt32)size + size / 4 + 1;
+    return sizeof(NFNTResource) + rowWords * height * 2 +
+           BENCH_TABLE_ENTRIES * (sizeof(SInt16) + sizeof(OWTEntry));
+}
+
+static void bench_fill_fond(UInt8* p, UInt32 f) {
+    FONDResource fond;
+    memset(&fond, 0, sizeof(fond));
+    fond.ffFamID = kFamilies[f];
+    fond.ffFirstChar = BENCH_FIRST_CHAR;
+    fond.ffLastChar = BENCH_LAST_CHAR;
+    fond.ffAscent = 12;
+    fond.ffDescent = 3;
+    fond.ffWidMax = 16;
+    fond.ffNumEntries = BENCH_SIZES;
+    fond.ffWTabOff = sizeof(FONDResource) + BENCH_SIZES * sizeof(FontAssocEntry);
+    memcpy(p, &fond, sizeof(fond));
+
+    for (UInt32 s = 0; s < BENCH_SIZES; s++) {
+        FontAssocEntry entry = { kSizes[s], normal, (SInt16)(BENCH_FIRST_NFNT + f * BENCH_SIZES + s) };
+        memcpy(p + sizeof(fond) + s * sizeof(entry), &entry, sizeof(entry));
+    }
+
+    UInt16 wtab[BENCH_WTAB_WORDS];
+    wtab[0] = 0;
+    wtab[1] = normal;
+    for (short ch = BENCH_FIRST_CHAR; ch <= BENCH_LAST_CHAR + 2; ch++) {
+        wtab[2 + ch - BENCH_FIRST_CHAR] = ch <= BENCH_LAST_CHAR ? bench_em_width(ch) : 0;
+    }
+    memcpy(p + fond.ffWTabOff, wtab, sizeof(wtab));
+}
+
+static void bench_fill_nfnt(UInt8* p, short size) {
+    UInt32 bits = 0;
+    for (short ch = BENCH_FIRST_CHAR; ch <= BENCH_LAST_CHAR; ch++) bits += bench_char_width(size, ch);
+
+    NFNTResource nfnt;
+    memset(&nfnt, 0, sizeof(nfnt));
+    nfnt.fontType = (SInt16)0x9000;
+    nfnt.firstChar = BENCH_FIRST_CHAR;
+    nfnt.lastChar = BENCH_LAST_CHAR;
+    nfnt.widMax = (SInt16)bench_char_width(size, 4);
+    nfnt.rowWords = (SInt16)((bits + 15) / 16);
+    nfnt.fRectHeight = (SInt16)(size + size / 4 + 1);
+    nfnt.fRectWidth = nfnt.widMax;
+    nfnt.ascent = (SInt16)(size - size / 5);
+    nfnt.descent = (SInt16)(nfnt.fRectHeight - nfnt.ascent);
+    nfnt.nDescent = (SInt16)-nfnt.descent;
+    nfnt.leading = (SInt16)(size / 6);
+    memcpy(p, &nfnt, sizeof(nfnt));
+
+    UInt32 bitmapBytes = (UInt32)nfnt.rowWords * nfnt.fRectHeight * 2;
+    memset(p + sizeof(nfnt), 0x5A, bitmapBytes);
+
+    /* Glyphs end to end, each as wide as its advance; empty missing glyph */
+    UInt8* loc = p + sizeof(nfnt) + bitmapBytes;
+    UInt8* owt = loc + BENCH_TABLE_ENTRIES * sizeof(SInt16);
+    SInt16 bit = 0;
+    for (short ch = BENCH_FIRST_CHAR; ch <= BENCH_LAST_CHAR + 2; ch++, loc += 2, owt += 2) {
+        memcpy(loc, &bit, sizeof(bit));
+        owt[0] = 0;
+        owt[1] = (UInt8)(ch <= BENCH_LAST_CHAR ? bench_char_width(size, ch) : 0);
+        if (ch <= BENCH_LAST_CHAR) bit += (SInt16)bench_char_width(size, ch);
+    }
+    owt[-2] = owt[-1] = 0xFF;
+}
+
+/* Resource fork of kFamilies 'FOND's and their 'NFNT's */
+static UInt8* build_suitcase(UInt32* forkSize) {
+    UInt32 dataLen = 0;
+    for (UInt32 f = 0; f < BENCH_FAMILIES; f++) {
+        dataLen += sizeof(ResourceDataEntry) + bench_fond_size();
+        for (UInt32 s = 0; s < BENCH_SIZES; s++) {
+            dataLen += sizeof(ResourceDataEntry) + bench_nfnt_size(kSizes[s]);
+        }
+    }
+
+    UInt32 dataOffset = 256;
+    UInt32 mapOffset = dataOffset + dataLen;
+    UInt32 typeListOff = sizeof(ResMapHeader);
+    UInt32 refs = BENCH_FAMILIES + BENCH_NFNTS;
+    UInt32 mapLen = typeListOff + 2 + 2 * sizeof(TypeListEntry) + refs * sizeof(RefListEntry);
+
+    *forkSize = mapOffset + mapLen;
+    UInt8* fork = (UInt8*)NewPtrClear(*forkSize);
+    if (!fork) return NULL;
+
+    for (UInt32 copy = 0; copy < 2; copy++) {
+        UInt8* hdr = fork + (copy ? mapOffset : 0);
+        write_be32(hdr + 0, dataOffset);
+        write_be32(hdr + 4, mapOffset);
+        write_be32(hdr + 8, dataLen);
+        write_be32(hdr + 12, mapLen);
+    }
+
+    UInt8* map = fork + mapOffset;
+    write_be16(map + 24, (UInt16)typeListOff);
+    write_be16(map + 26, (UInt16)mapLen);
+
+    UInt8* typeList = map + typeListOff;
+    UInt32 fondRefs = 2 + 2 * sizeof(TypeListEntry);
+    UInt32 nfntRefs = fondRefs + BENCH_FAMILIES * sizeof(RefListEntry);
+    write_be16(typeList, 1);
+    write_be32(typeList + 2, BENCH_FOND_TYPE);
+    write_be16(typeList + 6, BENCH_FAMILIES - 1);
+    write_be16(typeList + 8, (UInt16)fondRefs);
+    write_be32(typeList + 10, BENCH_NFNT_TYPE);
+    write_be16(typeList + 14, BENCH_NFNTS - 1);
+    write_be16(typeList + 16, (UInt16)nfntRefs);
+
+    UInt32 dataPos = 0;
+    for (UInt32 f = 0; f < BENCH_FAMILIES; f++) {
+        UInt8* ref = typeList + fondRefs + f * sizeof(RefListEntry);
+        write_be16(ref, (UInt16)kFamilies[f]);
+        write_be16(ref + 2, 0xFFFF);
+        ref[5] = (UInt8)(dataPos >> 16);
+        write_be16(ref + 6, (UInt16)dataPos);
+
+        UInt8* entry = fork + dataOffset + dataPos;
+        write_be32(entry, bench_fond_size());
+        bench_fill_fond(entry + sizeof(ResourceDataEntry), f);
+        dataPos += sizeof(ResourceDataEntry) + bench_fond_size();
+
+        for (UInt32 s = 0; s < BENCH_SIZES; s++) {
+            UInt32 n = f * BENCH_SIZES + s;
+            ref = typeList + nfntRefs + n * sizeof(RefListEntry);
+            write_be16(ref, (UInt16)(BENCH_FIRST_NFNT + n));
+            write_be16(ref + 2, 0xFFFF);
+            ref[5] = (UInt8)(dataPos >> 16);
+            write_be16(ref + 6, (UInt16)dataPos);
+
+            entry = fork + dataOffset + dataPos;
+            write_be32(entry, bench_nfnt_size(kSizes[s]));
+            bench_fill_nfnt(entry + sizeof(ResourceDataEntry), kSizes[s]);
+            dataPos += sizeof(ResourceDataEntry) + bench_nfnt_size(kSizes[s]);
+        }
+    }
+    return fork;
+}
+
+static Boolean write_suitcase(void) {
+    UInt32 forkSize;
+    UInt8* fork = build_suitcase(&forkSize);
+    if (!fork) return false;
+
+    FileRefNum ref;
+    Boolean ok = false;
+    FSDelete(kSuitcaseName, 0);
+    if (FSCreate(kSuitcaseName, 0, 0x4D414353u /* 'MACS' */, 0x4646494Cu /* 'FFIL' */) == noErr &&
+        FSOpenRF(kSuitcaseName, 0, &ref) == noErr) {
+        UInt32 count = forkSize;
+        ok = FSWrite(ref, &count, fork) == noErr && count == forkSize;
+        FSClose(ref);
+    }
+    DisposePtr((Ptr)fork);
+    return ok;
+}
+
+/* Replay the workload; the same seed gives the same run sequence */
+static void bench_workload(const char* label) {
+    UInt32 totalWeight = 0;
+    for (UInt32 k = 0; k < BENCH_RUN_KINDS; k++) totalWeight += kWorkload[k].weight;
+
+    FlushFonts();
+    FM_ResetCacheStats();
+
+    UInt32 seed = 47;
+    UInt32 fallbacks = 0;
+    UInt32 start = MicrosecondsNow();
+    for (UInt32 i = 0; i < BENCH_RUNS; i++) {
+        UInt32 pick = bench_rand(&seed) % totalWeight;
+        UInt32 k = 0;
+        while (pick >= kWorkload[k].weight) pick -= kWorkload[k++].weight;
+
+        FMInput in = { kWorkload[k].family, kWorkload[k].size, kWorkload[k].face, true, 1, 1 };
+        FMSwapFont(&in);
+        if (FM_GetCurrentStrike()->familyID != in.family) fallbacks++;
+    }
+    UInt32 elapsed = MicrosecondsNow() - start;
+
+    CacheStats stats;
+    FM_GetCacheStats(&stats);
+    Fixed ratio = GetCacheHitRatio();
+    FONT_BENCH_LOG("%s: %u swaps in %u us (%u ns each), hit ratio %u.%03u "
+                   "(%u hits, %u misses), %u fallbacks\n",
+                   label, BENCH_RUNS, elapsed, elapsed * 1000u / BENCH_RUNS,
+                   (UInt32)ratio >> 16, (((UInt32)ratio & 0xFFFFu) * 1000u) >> 16,
+                   stats.hitCount, stats.missCount, fallbacks);
+    FONT_BENCH_LOG("%s: %u strikes, %u of %u bytes resident, %u evictions\n",
+                   label, stats.strikeCount, stats.totalMemory, stats.maxMemory,
+                   stats.evictions);
+}
+
+/* DrawText one line in each face; with the styles in the strikes, every
+ * face should cost about what plain does */
+static void bench_draw(void) {
+    static const Style kFaces[] = { normal, bold, italic, outline, shadow, bold | italic };
+    static const char* const kFaceNames[] = { "plain", "bold", "italic", "outline", "shadow",
+                                              "bold italic" };
+    static const char kLine[] = "The quick brown fox jumps over the lazy dog 0123456789";
+    const short len = (short)(sizeof(kLine) - 1);
+    const UInt32 lines = 200;
+
+    for (UInt32 f = 0; f < sizeof(kFaces) / sizeof(kFaces[0]); f++) {
+        TextFont(20);
+        TextSize(12);
+        TextFace(kFaces[f]);
+
+        short width = TextWidth(kLine, 0, len);
+        UInt32 start = MicrosecondsNow();
+        for (UInt32 i = 0; i < lines; i++) {
+            MoveTo(0, 20);
+            DrawText(kLine, 0, len);
+        }
+        UInt32 elapsed = MicrosecondsNow() - start;
+
+        GrafPtr port;
+        GetPort(&port);
+        FontStrike* strike = FM_GetCurrentStrike();
+        FONT_BENCH_LOG("draw %s: %u ns/char, width %d (pen moved %d), strike face 0x%02X%s\n",
+                       kFaceNames[f], elapsed * 1000u / (lines * (UInt32)len), width,
+                       port->pnLoc.h, strike->face, strike->synthetic ? " synthesized" : "");
+    }
+    TextFace(normal);
+}
+
+/* Measure a buffer with TextWidth slices and with FM_TextWidthFixed, in
+ * whole and fractional widths, against a CharWidth loop.  The buffer is as
+ * long as Fixed widths allow at 18 point. */
+static void bench_measure(void) {
+    enum { kTextLen = 2048, kSlice = 200, kPasses = 1000 };
+    UInt8* text = (UInt8*)NewPtr(kTextLen);
+    if (!text) return;
+
+    UInt32 seed = 49;
+    for (UInt32 i = 0; i < kTextLen; i++) {
+        /* Mostly lower case and spaces, some high ASCII */
+        UInt32 r = bench_rand(&seed) % 64;
+        text[i] = (UInt8)(r < 52 ? 'a' + r % 26 : r < 60 ? ' ' : 0x80 + r);
+    }
+
+    static const short kMeasureFonts[][2] = { { 3, 9 }, { 20, 12 }, { 0, 12 }, { 21, 18 } };
+    for (UInt32 f = 0; f < sizeof(kMeasureFonts) / sizeof(kMeasureFonts[0]); f++) {
+        TextFont(kMeasureFonts[f][0]);
+        TextSize(kMeasureFonts[f][1]);
+
+        UInt32 start = MicrosecondsNow();
+        SInt32 loopWidth = 0;
+        for (UInt32 pass = 0; pass < kPasses; pass++) {
+            loopWidth = 0;
+            for (UInt32 i = 0; i < kTextLen; i++) loopWidth += CharWidth((char)text[i]);
+        }
+        UInt32 loopUs = MicrosecondsNow() - start;
+
+        start = MicrosecondsNow();
+        SInt32 sliceWidth = 0;
+        for (UInt32 pass = 0; pass < kPasses; pass++) {
+            sliceWidth = 0;
+            for (UInt32 i = 0; i < kTextLen; i += kSlice) {
+                sliceWidth += TextWidth(text, (short)i, (short)(kTextLen - i < kSlice ? kTextLen - i : kSlice));
+            }
+        }
+        UInt32 sliceUs = MicrosecondsNow() - start;
+
+        start = MicrosecondsNow();
+        Fixed whole = 0;
+        for (UInt32 pass = 0; pass < kPasses; pass++) whole = FM_TextWidthFixed(text, 0, kTextLen);
+        UInt32 wholeUs = MicrosecondsNow() - start;
+
+        SetFractEnable(true);
+        Fixed fract = FM_TextWidthFixed(text, 0, kTextLen);
+        SetFractEnable(false);
+
+        /* Picoseconds per character */
+        UInt32 kchars = kTextLen * kPasses / 1000u;
+        FONT_BENCH_LOG("measure %d/%d: CharWidth loop %u ps/char, TextWidth %u, "
+                       "FM_TextWidthFixed %u; width %d = %d = %d, fractional %d.%03u\n",
+                       kMeasureFonts[f][0], kMeasureFonts[f][1],
+                       loopUs * 1000u / kchars, sliceUs * 1000u / kchars, wholeUs * 1000u / kchars,
+                       loopWidth, sliceWidth, (SInt32)(whole >> 16),
+                       (SInt32)(fract >> 16), (((UInt32)fract & 0xFFFFu) * 1000u) >> 16);
+    }
+
+    DisposePtr((Ptr)text);
+}
+
+void FontBench_Run(void) {
+    if (!write_suitcase()) {
+        FONT_BENCH_LOG("could not write the test suitcase\n");
+        return;
+    }
+
+    SInt16 refNum = OpenResFile(kSuitcaseName);
+    if (refNum < 0) {
+        FONT_BENCH_LOG("OpenResFile failed (%d)\n", ResError());
+        FSDelete(kSuitcaseName, 0);
+        return;
+    }
+
+    GrafPort port;
+    GrafPtr savedPort;
+    SInt16 savedRes = CurResFile();
+    GetPort(&savedPort);
+    memset(&port, 0, sizeof(port));
+    SetPort(&port);
+    InitFonts();
+    UseResFile(refNum);
+
+    InitFontCache(FM_MAX_STRIKES, FM_MAX_CACHE_SIZE);
+    bench_workload("default budget");
+
+    InitFontCache(FM_MAX_STRIKES, BENCH_TIGHT_BUDGET);
+    bench_workload("24KB budget");
+
+    InitFontCache(FM_MAX_STRIKES, FM_MAX_CACHE_SIZE);
+    bench_draw();
+    bench_measure();
+
+    InitFontCache(FM_MAX_STRIKES, FM_MAX_CACHE_SIZE);
+    FlushFonts();
+    UseResFile(savedRes);
+    SetPort(savedPort);
+    CloseResFile(refNum);
+    FSDelete(kSuitcaseName, 0);
+    FONT_BENCH_LOG("done\n");
+}
+
+#endif /* FONT_BENCH */
@@ -9,6 +9,9 @@
 #include "FontManager/FontManager.h"
 #include "FontManager/FontTypes.h"
 #include "FontManager/FontResources.h"
+#include "FontManager/FontCache.h"
+#include "FontManager/FontStyleSynthesis.h"
+#include "FontManager/FontRasterizer.h"
 #include "QuickDraw/ColorQuickDraw.h"
 #include "QuickDraw/QuickDraw.h"
 #include "SystemTypes.h"
@@ -68,26 +71,14 @@ static inline uint8_t get_bit(const uint8_t *row, int bitOff) {
 }
 
 /*
- * FM_DrawChicagoCharInternal - Internal function to draw a Chicago character at pixel level
- * This is the core drawing function used by all Font Manager rendering
+ * FM_BlitGlyph - Draw bits [bitStart, bitStart + bitWidth) of each of the
+ * height rows of a strike bitmap with its top-left at pixel (x, y)
  */
-void FM_DrawChicagoCharInternal(short x, short y, char ch, uint32_t color) {
+static void FM_BlitGlyph(const uint8_t *bits, int rowBytes, int height, int bitStart,
+                         int bitWidth, short x, short y, uint32_t color) {
     static int debug_count = 0;
     extern void serial_puts(const char* str);
 
-    if (ch < 32 || ch > 126) return;
-
-    ChicagoCharInfo info = chicago_ascii[ch - 32];
-
-    /* Log menu title character positions */
-    if (y < 20) {
-        extern void serial_printf(const char* fmt, ...);
-        serial_printf("[DRAWCHAR-POS] ch='%c' x_before=%d left_offset=%d x_after=%d y=%d\n",
-                      ch, x, info.left_offset, x + info.left_offset, y);
-    }
-
-    x += info.left_offset;
-
     Ptr destBase = NULL;
     SInt16 destRowBytes = 0;
     SInt32 destWidth = fb_width;
@@ -132,20 +123,20 @@ void FM_DrawChicagoCharInternal(short x, short y, char ch, uint32_t color) {
     int pixels_drawn = 0;
     int first_pixel_x = -1, first_pixel_y = -1;
 
-    for (int row = 0; row < CHICAGO_HEIGHT; row++) {
+    for (int row = 0; row < height; row++) {
         int destY = y + row - destYOrigin;
         if (destY < 0 || destY >= destHeight) {
             continue;
         }
 
-        const uint8_t *strike_row = chicago_bitmap + (row * CHICAGO_ROW_BYTES);
+        const uint8_t *strike_row = bits + (row * rowBytes);
 
-        for (int col = 0; col < info.bit_width; col++) {
+        for (int col = 0; col < bitWidth; col++) {
             int destX = x + col - destXOrigin;
             if (destX < 0 || destX >= destWidth) {
                 continue;
             }
-            int bit_position = info.bit_start + col;
+            int bit_position = bitStart + col;
             if (get_bit(strike_row, bit_position)) {
                 uint8_t* dstRow = (uint8_t*)destBase + destY * destRowBytes;
                 uint32_t* dstPixels = (uint32_t*)dstRow;
@@ -165,6 +156,26 @@ void FM_DrawChicagoCharInternal(short x, short y, char ch, uint32_t color) {
     }
 }
 
+/*
+ * FM_DrawChicagoCharInternal - Internal function to draw a Chicago character at pixel level
+ * This is the core drawing function used by all Font Manager rendering
+ */
+void FM_DrawChicagoCharInternal(short x, short y, char ch, uint32_t color) {
+    if (ch < 32 || ch > 126) return;
+
+    ChicagoCharInfo info = chicago_ascii[ch - 32];
+
+    /* Log menu title character positions */
+    if (y < 20) {
+        extern void serial_printf(const char* fmt, ...);
+        serial_printf("[DRAWCHAR-POS] ch='%c' x_before=%d left_offset=%d x_after=%d y=%d\n",
+                      ch, x, info.left_offset, x + info.left_offset, y);
+    }
+
+    FM_BlitGlyph(chicago_bitmap, CHICAGO_ROW_BYTES, CHICAGO_HEIGHT, info.bit_start,
+                 info.bit_width, x + info.left_offset, y, color);
+}
+
 /* Built-in Chicago font strike (from chicago_font.h) */
 static FontStrike g_chicagoStrike12 = {
     chicagoFont,      /* familyID */
@@ -181,12 +192,38 @@ static FontStrike g_chicagoStrike12 = {
     CHICAGO_HEIGHT,   /* fRectHeight */
     NULL,             /* bitmapData - use chicago_bitmap directly */
     NULL,             /* locTable */
-    NULL,             /* widthTable */
+    NULL,             /* widthTable - g_chicagoWidths once InitFonts runs */
+    NULL,             /* fixedWidths - whole pixels */
     NULL,             /* next */
     NULL,             /* prev */
-    0                 /* lastUsed */
+    NULL,             /* hashNext */
+    FM_SCREEN_DEVICE, /* device */
+    0                 /* cacheBytes - never cached, always resident */
 };
 
+/* Advances of the built-in strike, filled by InitFonts */
+static UInt8 g_chicagoWidths[256];
+
+/* Characters outside the built-in strike advance this far */
+#define CHICAGO_MISSING_WIDTH 8
+
+static void FM_InitChicagoWidths(void) {
+    for (int ch = 0; ch < 256; ch++) {
+        short width = CHICAGO_MISSING_WIDTH;
+        if (ch >= 32 && ch <= 126) {
+            width = chicago_ascii[ch - 32].bit_width + 2;  /* Corrected spacing */
+            if (ch == ' ') width += 3;                      /* Extra space width */
+        }
+        g_chicagoWidths[ch] = (UInt8)width;
+    }
+    g_chicagoStrike12.widthTable = g_chicagoWidths;
+}
+
+/* A strike synthesized from the built-in Chicago 12 */
+static Boolean FM_IsStyledChicago(const FontStrike *strike) {
+    return strike->synthetic && strike->familyID == chicagoFont && strike->size == 12;
+}
+
 /* Built-in font families */
 static FontFamily g_chicagoFamily = {
     chicagoFont,
@@ -250,10 +287,9 @@ void InitFonts(void) {
     g_monacoFamily.next = NULL;
     g_fmState.familyList = &g_chicagoFamily;
 
-    /* Set up strike cache with Chicago 12 */
+    /* Chicago 12 is built in; loaded strikes go to the strike cache */
     g_chicagoStrike12.rowWords = CHICAGO_ROW_BYTES / 2;
-    g_fmState.strikeCache = &g_chicagoStrike12;
-    g_fmState.strikeCacheSize = 1;
+    FM_InitChicagoWidths();
     g_fmState.currentStrike = &g_chicagoStrike12;
 
     /* Initialize state flags */
@@ -277,9 +313,8 @@ void InitFonts(void) {
 
 OSErr FlushFonts(void) {
     FM_LOG("FlushFonts: Flushing font caches\n");
-    /* For now, just reset to Chicago 12 */
     g_fmState.currentStrike = &g_chicagoStrike12;
-    return noErr;
+    return FlushFontCache();
 }
 
 /* ============================================================================
@@ -330,12 +365,31 @@ void GetFNum(ConstStr255Param name, short *familyID) {
  * Resource-Based Font Loading
  * ============================================================================ */
 
-/* Load a font strike from FOND/NFNT resources */
+/* Strike for size rendered from the family's 'sfnt' outlines */
+static FontStrike* FM_LoadOutlineStrike(short fontNum, short size, Style face, short sfntID) {
+    extern Handle GetResource(ResType theType, short theID);
+    extern void ReleaseResource(Handle theResource);
+
+    Handle sfnt = GetResource('sfnt', sfntID);
+    if (!sfnt) {
+        FM_LOG("FM_LoadOutlineStrike: sfnt %d not found\n", sfntID);
+        return NULL;
+    }
+
+    FontStrike* strike = FM_RasterizeStrike(sfnt, fontNum, size, face,
+                                            g_fmState.smoothingEnabled);
+    ReleaseResource(sfnt);
+    return strike;
+}
+
+/* Load a font strike from FOND/NFNT resources, or render it from the
+ * family's outlines where it has no strike of this size */
 static FontStrike* FM_LoadFontStrike(short fontNum, short size, Style face) {
     extern Handle GetResource(ResType theType, short theID);
     extern void ReleaseResource(Handle theResource);
     extern Ptr NewPtr(Size byteCount);
     extern void DisposePtr(Ptr p);
+    extern void DisposeHandle(Handle h);
 
     FM_LOG("FM_LoadFontStrike: Loading font %d size %d face 0x%02X\n", fontNum, size, face);
 
@@ -355,6 +409,17 @@ static FontStrike* FM_LoadFontStrike(short fontNum, short size, Style face) {
         return NULL;
     }
 
+    /* Outlines, where the family has them and no strike of exactly this size */
+    short sfntID = FM_FindOutlineMatch(fond, size, face, g_fmState.outlinePreferred);
+    if (sfntID >= 0) {
+        FontStrike* outlineStrike = FM_LoadOutlineStrike(fontNum, size, face, sfntID);
+        if (outlineStrike) {
+            FM_DisposeFOND(fond);
+            ReleaseResource(fondHandle);
+            return outlineStrike;
+        }
+    }
+
     /* Find best matching NFNT resource ID */
     short nfntID = FM_FindBestMatch(fond, size, face);
     if (nfntID < 0) {
@@ -386,11 +451,16 @@ static FontStrike* FM_LoadFontStrike(short fontNum, short size, Style face) {
         return NULL;
     }
 
-    /* Parse offset/width table */
+    /* Parse location and offset/width tables */
+    SInt16* loc = NULL;
     OWTEntry* owt = NULL;
-    err = FM_ParseOWTTable(nfnt, &owt);
-    if (err != noErr || !owt) {
-        FM_LOG("FM_LoadFontStrike: Failed to parse OWT: %d\n", err);
+    err = FM_ParseLocationTable(nfnt, &loc);
+    if (err == noErr) {
+        err = FM_ParseOWTTable(nfnt, &owt);
+    }
+    if (err != noErr) {
+        FM_LOG("FM_LoadFontStrike: Failed to parse strike tables: %d\n", err);
+        if (loc) DisposePtr((Ptr)loc);
         FM_DisposeNFNT(nfnt);
         ReleaseResource(nfntHandle);
         FM_DisposeFOND(fond);
@@ -398,12 +468,27 @@ static FontStrike* FM_LoadFontStrike(short fontNum, short size, Style face) {
         return NULL;
     }
 
-    /* Build width table */
+    /* Build width table; the OWT is not needed past this */
     UInt8* widths = NULL;
     err = FM_BuildWidthTable(nfnt, owt, &widths);
+    DisposePtr((Ptr)owt);
     if (err != noErr || !widths) {
         FM_LOG("FM_LoadFontStrike: Failed to build width table: %d\n", err);
-        DisposePtr((Ptr)owt);
+        DisposePtr((Ptr)loc);
+        FM_DisposeNFNT(nfnt);
+        ReleaseResource(nfntHandle);
+        FM_DisposeFOND(fond);
+        ReleaseResource(fondHandle);
+        return NULL;
+    }
+
+    /* Fractional widths, from the family's width table if it has one */
+    Fixed* fixedWidths = NULL;
+    err = FM_BuildFixedWidthTable(fond, size, face, &fixedWidths);
+    if (err != noErr) {
+        FM_LOG("FM_LoadFontStrike: Failed to build fractional widths: %d\n", err);
+        DisposePtr((Ptr)widths);
+        DisposePtr((Ptr)loc);
         FM_DisposeNFNT(nfnt);
         ReleaseResource(nfntHandle);
         FM_DisposeFOND(fond);
@@ -412,13 +497,14 @@ static FontStrike* FM_LoadFontStrike(short fontNum, short size, Style face) {
     }
 
     /* Extract bitmap data */
-    UInt8* bitmapData = NULL;
+    Handle bitmapData = NULL;
     Size bitmapSize = 0;
     err = FM_ExtractBitmap(nfnt, &bitmapData, &bitmapSize);
     if (err != noErr || !bitmapData) {
         FM_LOG("FM_LoadFontStrike: Failed to extract bitmap: %d\n", err);
+        if (fixedWidths) DisposePtr((Ptr)fixedWidths);
         DisposePtr((Ptr)widths);
-        DisposePtr((Ptr)owt);
+        DisposePtr((Ptr)loc);
         FM_DisposeNFNT(nfnt);
         ReleaseResource(nfntHandle);
         FM_DisposeFOND(fond);
@@ -430,9 +516,10 @@ static FontStrike* FM_LoadFontStrike(short fontNum, short size, Style face) {
     FontStrike* strike = (FontStrike*)NewPtr(sizeof(FontStrike));
     if (!strike) {
         FM_LOG("FM_LoadFontStrike: Failed to allocate strike\n");
-        DisposePtr((Ptr)bitmapData);
+        DisposeHandle(bitmapData);
+        if (fixedWidths) DisposePtr((Ptr)fixedWidths);
         DisposePtr((Ptr)widths);
-        DisposePtr((Ptr)owt);
+        DisposePtr((Ptr)loc);
         FM_DisposeNFNT(nfnt);
         ReleaseResource(nfntHandle);
         FM_DisposeFOND(fond);
@@ -453,13 +540,15 @@ static FontStrike* FM_LoadFontStrike(short fontNum, short size, Style face) {
     strike->lastChar = nfnt->lastChar;
     strike->rowWords = nfnt->rowWords;
     strike->fRectHeight = nfnt->fRectHeight;
-    /* Cast Ptr to Handle (treating as opaque pointer since we're not using relocatable memory) */
-    strike->bitmapData = (Handle)((void*)bitmapData);
-    strike->locTable = (short*)owt;  /* OWT serves as location table */
+    strike->bitmapData = bitmapData;
+    strike->locTable = loc;
     strike->widthTable = widths;
+    strike->fixedWidths = fixedWidths;
     strike->next = NULL;
     strike->prev = NULL;
-    strike->lastUsed = 0;  /* Will be set by caller */
+    strike->hashNext = NULL;
+    strike->device = FM_SCREEN_DEVICE;
+    strike->cacheBytes = 0;  /* Set by FM_CacheStrike */
 
     /* Clean up temporary structures */
     FM_DisposeNFNT(nfnt);
@@ -471,38 +560,76 @@ static FontStrike* FM_LoadFontStrike(short fontNum, short size, Style face) {
     return strike;
 }
 
-/* Add a strike to the cache (LRU) */
+/* Add a strike to the cache (LRU, may evict older strikes) */
 static void FM_AddStrikeToCache(FontStrike* strike) {
     if (!strike) return;
 
-    /* For now, simple linked list cache */
-    strike->next = g_fmState.strikeCache;
-    if (g_fmState.strikeCache) {
-        g_fmState.strikeCache->prev = strike;
-    }
-    g_fmState.strikeCache = strike;
-    g_fmState.strikeCacheSize++;
+    FM_CacheStrike(strike, FM_SCREEN_DEVICE);
 
-    FM_LOG("FM_AddStrikeToCache: Cache size now %d\n", g_fmState.strikeCacheSize);
+    short entries;
+    unsigned long bytes;
+    GetFontCacheStats(&entries, &bytes);
+    FM_LOG("FM_AddStrikeToCache: Cache now %d strikes, %lu bytes\n", entries, bytes);
 }
 
 /* Find a strike in the cache */
 static FontStrike* FM_FindStrikeInCache(short fontNum, short size, Style face) {
-    FontStrike* strike = g_fmState.strikeCache;
+    if (fontNum == chicagoFont && size == 12 && face == normal) {
+        return &g_chicagoStrike12;
+    }
 
-    while (strike) {
-        if (strike->familyID == fontNum && strike->size == size && strike->face == face) {
-            FM_LOG("FM_FindStrikeInCache: Found cached strike for %d/%d/0x%02X\n",
-                   fontNum, size, face);
-            return strike;
-        }
-        strike = strike->next;
+    FontStrike* strike = FM_GetCachedStrike(fontNum, size, face, FM_SCREEN_DEVICE);
+    if (strike) {
+        FM_LOG("FM_FindStrikeInCache: Found cached strike for %d/%d/0x%02X\n",
+               fontNum, size, face);
+        return strike;
     }
 
     FM_LOG("FM_FindStrikeInCache: No cached strike for %d/%d/0x%02X\n", fontNum, size, face);
     return NULL;
 }
 
+/*
+ * FM_GetStrike - Strike for (fontNum, size, face): cached, loaded from
+ * FOND/NFNT, or synthesized from the plain strike and cached in its face.
+ * Underline is drawn by DrawString and has no strike of its own.
+ * Returns NULL if the family has no strike at this size.
+ */
+static FontStrike* FM_GetStrike(short fontNum, short size, Style face) {
+    face &= ~underline;
+
+    FontStrike* strike = FM_FindStrikeInCache(fontNum, size, face);
+    if (strike) {
+        return strike;
+    }
+
+    strike = FM_LoadFontStrike(fontNum, size, face);
+    if (!strike && face != normal) {
+        FontStrike* plain = FM_GetStrike(fontNum, size, normal);
+        if (plain) {
+            strike = FM_SynthesizeStrike(plain, face);
+        }
+    }
+
+    if (strike) {
+        FM_AddStrikeToCache(strike);
+    }
+    return strike;
+}
+
+/* Make the strike for the port's font, size and face current, falling
+ * back to Chicago 12 */
+static void FM_SelectPortStrike(void) {
+    FontStrike* strike = FM_GetStrike(g_currentPort->txFont, g_currentPort->txSize,
+                                      g_currentPort->txFace);
+    if (!strike) {
+        FM_LOG("FM_SelectPortStrike: No strike for %d/%d, falling back to Chicago 12\n",
+               g_currentPort->txFont, g_currentPort->txSize);
+        strike = &g_chicagoStrike12;
+    }
+    g_fmState.currentStrike = strike;
+}
+
 Boolean RealFont(short fontNum, short size) {
     /* Built-in Chicago 12 is always real */
     if (fontNum == chicagoFont && size == 12) {
@@ -510,18 +637,9 @@ Boolean RealFont(short fontNum, short size) {
         return TRUE;
     }
 
-    /* Check if we already have this strike cached */
-    FontStrike* cached = FM_FindStrikeInCache(fontNum, size, normal);
-    if (cached) {
-        FM_LOG("RealFont: Font %d size %d is real (cached)\n", fontNum, size);
-        return TRUE;
-    }
-
-    /* Try to load from resources */
-    FontStrike* strike = FM_LoadFontStrike(fontNum, size, normal);
-    if (strike) {
-        FM_AddStrikeToCache(strike);
-        FM_LOG("RealFont: Font %d size %d is real (loaded from resource)\n", fontNum, size);
+    /* Cached, or loaded from resources */
+    if (FM_GetStrike(fontNum, size, normal)) {
+        FM_LOG("RealFont: Font %d size %d is real\n", fontNum, size);
         return TRUE;
     }
 
@@ -539,36 +657,7 @@ void TextFont(short font) {
     g_currentPort->txFont = font;
     FM_LOG("TextFont: Set to %d\n", font);
 
-    /* Try to find appropriate strike for new font */
-    short size = g_currentPort->txSize;
-    Style face = g_currentPort->txFace;
-
-    /* Check for built-in Chicago 12 */
-    if (font == chicagoFont && size == 12) {
-        g_fmState.currentStrike = &g_chicagoStrike12;
-        return;
-    }
-
-    /* Try to find or load from cache */
-    FontStrike* strike = FM_FindStrikeInCache(font, size, face);
-    if (strike) {
-        g_fmState.currentStrike = strike;
-        FM_LOG("TextFont: Using cached strike for %d/%d\n", font, size);
-        return;
-    }
-
-    /* Try to load from resources */
-    strike = FM_LoadFontStrike(font, size, face);
-    if (strike) {
-        FM_AddStrikeToCache(strike);
-        g_fmState.currentStrike = strike;
-        FM_LOG("TextFont: Loaded strike for %d/%d\n", font, size);
-        return;
-    }
-
-    /* Fall back to Chicago 12 */
-    g_fmState.currentStrike = &g_chicagoStrike12;
-    FM_LOG("TextFont: Falling back to Chicago 12\n");
+    FM_SelectPortStrike();
 }
 
 void TextFace(Style face) {
@@ -577,7 +666,7 @@ void TextFace(Style face) {
     g_currentPort->txFace = face;
     FM_LOG("TextFace: Set to 0x%02x\n", face);
 
-    /* Would update strike here for style synthesis */
+    FM_SelectPortStrike();
 }
 
 void TextSize(short size) {
@@ -586,36 +675,8 @@ void TextSize(short size) {
     g_currentPort->txSize = size;
     FM_LOG("TextSize: Set to %d\n", size);
 
-    /* Try to find appropriate strike for new size */
-    short font = g_currentPort->txFont;
-    Style face = g_currentPort->txFace;
-
-    /* Check for built-in Chicago 12 */
-    if (font == chicagoFont && size == 12) {
-        g_fmState.currentStrike = &g_chicagoStrike12;
-        return;
-    }
-
-    /* Try to find or load from cache */
-    FontStrike* strike = FM_FindStrikeInCache(font, size, face);
-    if (strike) {
-        g_fmState.currentStrike = strike;
-        FM_LOG("TextSize: Using cached strike for %d/%d\n", font, size);
-        return;
-    }
-
-    /* Try to load from resources */
-    strike = FM_LoadFontStrike(font, size, face);
-    if (strike) {
-        FM_AddStrikeToCache(strike);
-        g_fmState.currentStrike = strike;
-        FM_LOG("TextSize: Loaded strike for %d/%d\n", font, size);
-        return;
-    }
-
-    /* Fall back to Chicago 12 (will use scaling if needed) */
-    g_fmState.currentStrike = &g_chicagoStrike12;
-    FM_LOG("TextSize: Falling back to Chicago 12 (will scale from 12 to %d)\n", size);
+    /* Without a strike at this size, Chicago 12 is scaled */
+    FM_SelectPortStrike();
 }
 
 void TextMode(short mode) {
@@ -637,17 +698,10 @@ void GetFontMetrics(FMetricRec *theMetrics) {
 
     if (!strike && g_currentPort) {
         /* Try to load appropriate strike */
-        short font = g_currentPort->txFont;
-        short size = g_currentPort->txSize;
-        Style face = g_currentPort->txFace;
-
-        strike = FM_FindStrikeInCache(font, size, face);
-        if (!strike) {
-            strike = FM_LoadFontStrike(font, size, face);
-            if (strike) {
-                FM_AddStrikeToCache(strike);
-                g_fmState.currentStrike = strike;
-            }
+        strike = FM_GetStrike(g_currentPort->txFont, g_currentPort->txSize,
+                              g_currentPort->txFace);
+        if (strike) {
+            g_fmState.currentStrike = strike;
         }
     }
 
@@ -671,64 +725,129 @@ void GetFontMetrics(FMetricRec *theMetrics) {
  * Width Measurement
  * ============================================================================ */
 
-short CharWidth(short ch) {
-    if (ch >= 32 && ch <= 126 && g_fmState.currentStrike == &g_chicagoStrike12) {
-        /* Check if we need scaling for different size */
-        if (g_currentPort && g_currentPort->txSize != 12) {
-            /* Use scaled width for non-12pt sizes */
-            short scaledWidth = FM_GetScaledCharWidth(g_currentPort->txFont, g_currentPort->txSize, ch);
-
-            /* Apply style on top of scaling if needed */
-            if (g_currentPort->txFace != normal) {
-                extern short FM_GetStyledCharWidth(char ch, Style face);
-                /* Style adjustments are relative, apply to scaled width */
-                return scaledWidth + (FM_GetStyledCharWidth(ch, g_currentPort->txFace) - scaledWidth);
-            }
+/*
+ * The current strike, when its width tables are the port's font, size and
+ * face.  It is not after a fall back to Chicago 12 for a size or style no
+ * strike could be found or built for; those widths are worked out per
+ * character.
+ */
+static const FontStrike* FM_MeasuringStrike(void) {
+    const FontStrike* strike = g_fmState.currentStrike;
 
-            return scaledWidth;
-        }
+    if (!strike || !strike->widthTable) {
+        return NULL;
+    }
+    if (g_currentPort && (g_currentPort->txSize != strike->size ||
+                          (g_currentPort->txFace & ~underline) != strike->face)) {
+        return NULL;
+    }
+    return strike;
+}
+
+/* Width of a character no strike has the size or style of */
+static short FM_FallbackCharWidth(UInt8 ch) {
+    if (ch < 32 || ch > 126) {
+        return CHICAGO_MISSING_WIDTH;
+    }
 
-        /* Use actual Chicago font metrics for 12pt */
-        ChicagoCharInfo info = chicago_ascii[ch - 32];
-        short width = info.bit_width + 2;  /* Corrected spacing */
-        if (ch == ' ') width += 3;  /* Extra space width */
+    if (g_currentPort && g_currentPort->txSize != 12) {
+        short scaledWidth = FM_GetScaledCharWidth(g_currentPort->txFont, g_currentPort->txSize, ch);
 
-        /* Apply full style synthesis if we have styles */
-        if (g_currentPort && g_currentPort->txFace != normal) {
-            /* Use style synthesis for complex styles */
-            extern short FM_GetStyledCharWidth(char ch, Style face);
-            return FM_GetStyledCharWidth(ch, g_currentPort->txFace);
+        /* Apply style on top of scaling if needed */
+        if (g_currentPort->txFace != normal) {
+            return FM_StyleAdvance(scaledWidth, g_currentPort->txFace, g_currentPort->txSize);
         }
+        return scaledWidth;
+    }
+
+    /* Plain Chicago 12 glyphs; styled widths */
+    return FM_GetStyledCharWidth((char)ch, g_currentPort ? g_currentPort->txFace : normal);
+}
+
+/* Sum of widths[text[i]], four characters a step */
+static SInt32 FM_SumWidths(const UInt8* widths, const UInt8* text, SInt32 len) {
+    SInt32 sum0 = 0, sum1 = 0;
+    SInt32 i = 0;
+
+    for (; i + 4 <= len; i += 4) {
+        sum0 += widths[text[i]] + widths[text[i + 1]];
+        sum1 += widths[text[i + 2]] + widths[text[i + 3]];
+    }
+    for (; i < len; i++) {
+        sum0 += widths[text[i]];
+    }
+    return sum0 + sum1;
+}
+
+/* Sum of fixed[text[i]], saturating at the largest Fixed */
+static Fixed FM_SumFixedWidths(const Fixed* fixed, const UInt8* text, SInt32 len) {
+    SInt64 sum0 = 0, sum1 = 0;
+    SInt32 i = 0;
 
-        return width;
+    for (; i + 4 <= len; i += 4) {
+        sum0 += (SInt64)fixed[text[i]] + fixed[text[i + 1]];
+        sum1 += (SInt64)fixed[text[i + 2]] + fixed[text[i + 3]];
     }
+    for (; i < len; i++) {
+        sum0 += fixed[text[i]];
+    }
+    sum0 += sum1;
+    return sum0 > 0x7FFFFFFF ? (Fixed)0x7FFFFFFF : (Fixed)sum0;
+}
+
+short CharWidth(short ch) {
+    const FontStrike* strike = FM_MeasuringStrike();
 
-    /* Default width for unknown chars */
-    return 8;
+    /* Callers pass signed chars: 0x80-0xFF arrive negative */
+    if (strike) {
+        return strike->widthTable[(UInt8)ch];
+    }
+    return FM_FallbackCharWidth((UInt8)ch);
+}
+
+/*
+ * FM_TextWidthFixed - Width of byteCount bytes of text in the port's
+ * font, size and face, with fractional widths if FractEnable is on
+ */
+Fixed FM_TextWidthFixed(const void* textBuf, SInt32 firstByte, SInt32 byteCount) {
+    if (!textBuf || byteCount <= 0) return 0;
+
+    const UInt8* text = (const UInt8*)textBuf + firstByte;
+    const FontStrike* strike = FM_MeasuringStrike();
+
+    if (strike && strike->fixedWidths && g_fmState.fractEnable) {
+        return FM_SumFixedWidths(strike->fixedWidths, text, byteCount);
+    }
+
+    SInt32 width;
+    if (strike) {
+        width = FM_SumWidths(strike->widthTable, text, byteCount);
+    } else {
+        width = 0;
+        for (SInt32 i = 0; i < byteCount; i++) {
+            width += FM_FallbackCharWidth(text[i]);
+        }
+    }
+    return width > 0x7FFF ? (Fixed)0x7FFFFFFF : (Fixed)(width << 16);
 }
 
 short StringWidth(ConstStr255Param s) {
     if (!s || s[0] == 0) return 0;
 
-    short width = 0;
-    for (int i = 1; i <= s[0]; i++) {
-        width += CharWidth(s[i]);
-    }
+    short width = TextWidth(s, 1, s[0]);
 
     FM_LOG("StringWidth: \"%.*s\" = %d pixels\n", s[0], &s[1], width);
     return width;
 }
 
 short TextWidth(const void* textBuf, short firstByte, short byteCount) {
-    if (!textBuf || byteCount <= 0) return 0;
+    Fixed width = FM_TextWidthFixed(textBuf, firstByte, byteCount);
 
-    const char* text = (const char*)textBuf;
-    short width = 0;
-    for (short i = 0; i < byteCount; i++) {
-        width += CharWidth(text[firstByte + i]);
+    /* Round, and keep within a short */
+    if (width >= 0x7FFF8000) {
+        return 0x7FFF;
     }
-
-    return width;
+    return (short)((width + 0x8000) >> 16);
 }
 
 /* ============================================================================
@@ -748,13 +867,7 @@ FontStrike *FM_GetCurrentStrike(void) {
  * ============================================================================ */
 
 short FM_MeasureRun(const unsigned char* bytes, short len) {
-    if (!bytes || len <= 0) return 0;
-
-    short width = 0;
-    for (short i = 0; i < len; i++) {
-        width += CharWidth(bytes[i]);
-    }
-    return width;
+    return TextWidth(bytes, 0, len);
 }
 
 void FM_DrawRun(const unsigned char* bytes, short len, Point baseline) {
@@ -853,7 +966,7 @@ void DrawChar(short ch) {
             coord_debug++;
         }
 
-        /* Draw character with style synthesis */
+        /* No styled strike could be built: approximate the face by overstriking */
         if (hasBold) {
             /* Bold: draw twice with 1 pixel offset */
             FM_DrawChicagoCharInternal(px, py, (char)ch, color);
@@ -880,31 +993,30 @@ void DrawChar(short ch) {
     short glyphX = pen.h;
     short glyphY = pen.v - strike->ascent;
 
-    /* Draw the glyph using platform layer */
+    /* Styles are in the strike's glyphs: one pass whatever the face */
+    if (FM_IsStyledChicago(strike)) {
+        /* Drawn where the built-in strike it came from draws */
+        if (ch >= strike->firstChar && ch <= strike->lastChar) {
+            short i = ch - strike->firstChar;
+            short px, py;
+            QD_LocalToPixel(glyphX, glyphY, &px, &py);
+            FM_BlitGlyph((const uint8_t*)*strike->bitmapData, strike->rowWords * 2,
+                         strike->fRectHeight, strike->locTable[i],
+                         strike->locTable[i + 1] - strike->locTable[i], px, py, color);
+        }
+        g_currentPort->pnLoc.h += CharWidth(ch);
+        return;
+    }
+
     extern SInt16 QDPlatform_DrawGlyph(FontStrike *strike, UInt8 ch, SInt16 x, SInt16 y,
                                        GrafPtr port, UInt32 color);
-
-    if (hasBold) {
-        /* Bold: draw twice with 1 pixel offset */
-        SInt16 advance = QDPlatform_DrawGlyph(strike, (UInt8)ch, glyphX, glyphY,
-                                              g_currentPort, color);
-        QDPlatform_DrawGlyph(strike, (UInt8)ch, glyphX + 1, glyphY,
-                             g_currentPort, color);
-        /* Advance pen by character width + bold offset */
-        if (advance > 0) {
-            g_currentPort->pnLoc.h += advance + 1;
-        } else {
-            g_currentPort->pnLoc.h += CharWidth(ch) + 1;
-        }
+    SInt16 advance = QDPlatform_DrawGlyph(strike, (UInt8)ch, glyphX, glyphY,
+                                          g_currentPort, color);
+    /* Advance pen by character width */
+    if (advance > 0) {
+        g_currentPort->pnLoc.h += advance;
     } else {
-        SInt16 advance = QDPlatform_DrawGlyph(strike, (UInt8)ch, glyphX, glyphY,
-                                              g_currentPort, color);
-        /* Advance pen by character width */
-        if (advance > 0) {
-            g_currentPort->pnLoc.h += advance;
-        } else {
-            g_currentPort->pnLoc.h += CharWidth(ch);
-        }
+        g_currentPort->pnLoc.h += CharWidth(ch);
     }
 }
 
@@ -969,13 +1081,7 @@ FMOutPtr FMSwapFont(const FMInput *inRec) {
            inRec->family, inRec->size, inRec->face);
 
     /* Try to find or load the requested font strike */
-    FontStrike* strike = FM_FindStrikeInCache(inRec->family, inRec->size, inRec->face);
-    if (!strike) {
-        strike = FM_LoadFontStrike(inRec->family, inRec->size, inRec->face);
-        if (strike) {
-            FM_AddStrikeToCache(strike);
-        }
-    }
+    FontStrike* strike = FM_GetStrike(inRec->family, inRec->size, inRec->face);
 
     /* Fall back to Chicago 12 if not found */
     if (!strike) {
@@ -985,12 +1091,14 @@ FMOutPtr FMSwapFont(const FMInput *inRec) {
     /* Fill output record with actual metrics */
     g_fmOutput.errNum = noErr;
     g_fmOutput.fontHandle = NULL;  /* Would be handle to NFNT resource */
-    g_fmOutput.boldPixels = (inRec->face & bold) ? 1 : 0;
-    g_fmOutput.italicPixels = (inRec->face & italic) ? 2 : 0;  /* ~14 degree slant */
+    /* Only styles the strike's glyphs lack are left for the caller */
+    Style missing = inRec->face & ~strike->face;
+    g_fmOutput.boldPixels = (missing & bold) ? 1 : 0;
+    g_fmOutput.italicPixels = (missing & italic) ? 2 : 0;  /* ~14 degree slant */
     g_fmOutput.ulOffset = 2;  /* Underline offset from baseline */
     g_fmOutput.ulThick = 1;   /* Underline thickness */
     g_fmOutput.ulShadow = 0;  /* Underline shadow */
-    g_fmOutput.shadowPixels = (inRec->face & shadow) ? 1 : 0;
+    g_fmOutput.shadowPixels = (missing & shadow) ? 1 : 0;
     g_fmOutput.extra = 0;
     g_fmOutput.ascent = strike->ascent;
     g_fmOutput.descent = strike->descent;
@@ -1045,6 +1153,21 @@ Boolean GetPreserveGlyph(void) {
     return g_fmState.preserveGlyph;
 }
 
+/* Outline strikes rendered from here on sample 4x4 per pixel; the cache
+ * is flushed so sizes already rendered are rendered again */
+OSErr SetFontSmoothing(Boolean enableSmoothing) {
+    if (g_fmState.smoothingEnabled != enableSmoothing) {
+        g_fmState.smoothingEnabled = enableSmoothing;
+        FlushFontCache();
+    }
+    FM_LOG("SetFontSmoothing: %s\n", enableSmoothing ? "on" : "off");
+    return noErr;
+}
+
+Boolean GetFontSmoothing(void) {
+    return g_fmState.smoothingEnabled;
+}
+
 /* ============================================================================
  * System Font Access
  * ============================================================================ */
@@ -1120,11 +1243,12 @@ void FMPopFont(void) {
 
     FontStackEntry *entry = &g_fontStack[--g_fontStackDepth];
 
-    /* Restore font state */
+    /* Restore font state: one strike lookup for all three */
     if (g_currentPort) {
-        TextFont(entry->fontNum);
-        TextSize(entry->fontSize);
-        TextFace(entry->fontFace);
+        g_currentPort->txFont = entry->fontNum;
+        g_currentPort->txSize = entry->fontSize;
+        g_currentPort->txFace = entry->fontFace;
+        FM_SelectPortStrike();
         RGBForeColor((RGBColor*)&entry->fgColor);  /* Approximate - would need proper RGB conversion */
     }
 
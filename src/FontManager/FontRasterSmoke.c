@@ -0,0 +1,465 @@
+/*
+ * FontRasterSmoke.c - TrueType rasterizer smoke test
+ *
+ * Builds a small sfnt in memory and checks, through FontRasterizer.c:
+ * - A square, a ring whose inner contour runs the other way (a hole), and
+ *   a ring whose contours run the same way (filled: non-zero winding)
+ * - A contour of off-curve points only, and a composite glyph with an
+ *   offset component and a scaled one
+ * - Pixels are sampled at their centres, edges half-open
+ * - 4x4 smoothing: a pixel half covered has half coverage
+ * - A strike rendered for the cache: character range, locations and
+ *   whole and fractional widths
+ * and times rendering a 24 point strike, then drawing a line from it
+ * against the nearest-neighbour scaling of Chicago 12 it replaces (which
+ * draws 12 point glyphs twice over, so less ink, and the wrong size).
+ *
+ * Activated with FONT_RASTER_SMOKE_TEST=1; called from main.c.  Like the
+ * other smoke tests it runs in the kernel at boot and reports pass/fail
+ * over serial; there is no host test target.
+ */
+
+#include "SystemTypes.h"
+#include "System71StdLib.h"
+#include "MemoryMgr/MemoryManager.h"
+#include "FontManager/FontManager.h"
+#include "FontManager/FontTypes.h"
+#include "FontManager/FontCache.h"
+#include "FontManager/FontRasterizer.h"
+#include "QuickDraw/QuickDraw.h"
+#include "TimeManager/TimeBase.h"
+#include <string.h>
+
+#ifdef FONT_RASTER_SMOKE_TEST
+
+#define RS_LOG(fmt, ...) serial_logf(kLogModuleFont, kLogLevelInfo, "[FONT RASTER SMOKE] " fmt, ##__VA_ARGS__)
+
+#define RS_UPEM         64
+#define RS_GLYPHS       6
+#define RS_FAMILY       30100
+#define RS_DRAW_SIZE    24
+#define RS_DRAW_PASSES  200
+
+extern void FM_DrawTextAtSize(const void* textBuf, short firstByte, short byteCount,
+                              short targetSize);
+
+typedef struct {
+    SInt16 x, y;
+    UInt8  on;
+} RSPoint;
+
+/* Glyph 1, 'A': a square */
+static const RSPoint kSquare[] = { {8, 0, 1}, {8, 32, 1}, {40, 32, 1}, {40, 0, 1} };
+static const UInt16 kSquareEnds[] = { 3 };
+
+/* Glyph 2, 'O': a ring, the inner contour reversed */
+static const RSPoint kRing[] = {
+    {0, 0, 1}, {0, 48, 1}, {48, 48, 1}, {48, 0, 1},
+    {16, 16, 1}, {32, 16, 1}, {32, 32, 1}, {16, 32, 1}
+};
+static const UInt16 kRingEnds[] = { 3, 7 };
+
+/* Glyph 3, 'W': the same ring, both contours one way */
+static const RSPoint kWound[] = {
+    {0, 0, 1}, {0, 48, 1}, {48, 48, 1}, {48, 0, 1},
+    {16, 16, 1}, {16, 32, 1}, {32, 32, 1}, {32, 16, 1}
+};
+
+/* Glyph 4, 'C': off-curve points only - a circle through the implied
+ * midpoints */
+static const RSPoint kCircle[] = { {0, 0, 0}, {0, 48, 0}, {48, 48, 0}, {48, 0, 0} };
+
+static const UInt16 kAdvances[RS_GLYPHS] = { 32, 48, 56, 56, 56, 56 };
+
+/* Expected images at 16 pixels per em (a font unit is 1/4 pixel), in
+ * each glyph's bounds */
+static const char* const kSquare16[] = {
+    "########", "########", "########", "########",
+    "########", "########", "########", "########"
+};
+static const char* const kRing16[] = {
+    "############", "############", "############", "############",
+    "####....####", "####....####", "####....####", "####....####",
+    "############", "############", "############", "############"
+};
+static const char* const kWound16[] = {
+    "############", "############", "############", "############",
+    "############", "############", "############", "############",
+    "############", "############", "############", "############"
+};
+/* Rows 1 and 10 cross the curve at exactly x = 1.5 and 10.5: the left
+ * edge's pixel is in, the right edge's out */
+static const char* const kCircle16[] = {
+    "...######...", ".#########..", ".##########.", "############",
+    "############", "############", "############", "############",
+    "############", ".##########.", ".#########..", "...######..."
+};
+static const char* const kComposite16[] = {
+    ".....####", ".....####", ".....####", ".....####",
+    "########.", "########.", "########.", "########.",
+    "########.", "########.", "########.", "########."
+};
+
+static int gFailures;
+
+static void check(Boolean cond, const char* what) {
+    if (cond) {
+        RS_LOG("PASS: %s\n", what);
+    } else {
+        RS_LOG("FAIL: %s\n", what);
+        gFailures++;
+    }
+}
+
+static void put16(UInt8* p, UInt32 v) {
+    p[0] = (UInt8)(v >> 8);
+    p[1] = (UInt8)v;
+}
+
+static void put32(UInt8* p, UInt32 v) {
+    put16(p, v >> 16);
+    put16(p + 2, v);
+}
+
+/* glyf entry of a simple glyph, packed the way font tools pack them:
+ * byte deltas, repeated flags, unchanged coordinates left out */
+static UInt32 rs_simple_glyph(UInt8* out, const RSPoint* pts, UInt32 n, const UInt16* ends,
+                              UInt32 numContours) {
+    SInt16 xMin = pts[0].x, xMax = pts[0].x, yMin = pts[0].y, yMax = pts[0].y;
+    for (UInt32 i = 1; i < n; i++) {
+        if (pts[i].x < xMin) xMin = pts[i].x;
+        if (pts[i].x > xMax) xMax = pts[i].x;
+        if (pts[i].y < yMin) yMin = pts[i].y;
+        if (pts[i].y > yMax) yMax = pts[i].y;
+    }
+
+    UInt8 flags[16];
+    UInt32 pos = 0;
+    put16(out, numContours);
+    put16(out + 2, (UInt16)xMin);
+    put16(out + 4, (UInt16)yMin);
+    put16(out + 6, (UInt16)xMax);
+    put16(out + 8, (UInt16)yMax);
+    pos = 10;
+    for (UInt32 c = 0; c < numContours; c++, pos += 2) put16(out + pos, ends[c]);
+    put16(out + pos, 0);    /* No instructions */
+    pos += 2;
+
+    SInt16 px = 0, py = 0;
+    for (UInt32 i = 0; i < n; i++) {
+        SInt16 dx = pts[i].x - px, dy = pts[i].y - py;
+        UInt8 f = pts[i].on ? 0x01 : 0;
+        if (dx == 0) f |= 0x10;
+        else if (dx > -256 && dx < 256) f |= 0x02 | (dx > 0 ? 0x10 : 0);
+        if (dy == 0) f |= 0x20;
+        else if (dy > -256 && dy < 256) f |= 0x04 | (dy > 0 ? 0x20 : 0);
+        flags[i] = f;
+        px = pts[i].x;
+        py = pts[i].y;
+    }
+    for (UInt32 i = 0; i < n;) {
+        UInt32 run = 1;
+        while (i + run < n && flags[i + run] == flags[i]) run++;
+        if (run > 1) {
+            out[pos++] = flags[i] | 0x08;
+            out[pos++] = (UInt8)(run - 1);
+        } else {
+            out[pos++] = flags[i];
+        }
+        i += run;
+    }
+    for (int axis = 0; axis < 2; axis++) {
+        SInt16 prev = 0;
+        for (UInt32 i = 0; i < n; i++) {
+            SInt16 v = axis ? pts[i].y : pts[i].x;
+            SInt16 d = v - prev;
+            UInt8 shortBit = axis ? 0x04 : 0x02;
+            prev = v;
+            if (d == 0) continue;
+            if (flags[i] & shortBit) {
+                out[pos++] = (UInt8)(d < 0 ? -d : d);
+            } else {
+                put16(out + pos, (UInt16)d);
+                pos += 2;
+            }
+        }
+    }
+    return (pos + 1) & ~1u;
+}
+
+/* Glyph 5, 'B': the square, and the square at half size up and right */
+static UInt32 rs_composite_glyph(UInt8* out) {
+    put16(out, 0xFFFF);
+    put16(out + 2, 8);
+    put16(out + 4, 0);
+    put16(out + 6, 44);
+    put16(out + 8, 48);
+    put16(out + 10, 0x0001 | 0x0002 | 0x0020);  /* Word args, offsets, more */
+    put16(out + 12, 1);
+    put16(out + 14, 0);
+    put16(out + 16, 0);
+    put16(out + 18, 0x0002 | 0x0008);           /* Byte offsets, scale */
+    put16(out + 20, 1);
+    out[22] = 24;
+    out[23] = 32;
+    put16(out + 24, 0x2000);                    /* 0.5 */
+    return 26;
+}
+
+/* The test sfnt: cmap (Mac Roman, format 0), glyf, head, hhea, hmtx,
+ * loca, maxp */
+static UInt8* rs_build_sfnt(UInt32* length) {
+    static const UInt32 kTags[7] = {
+        0x636D6170u, 0x676C7966u, 0x68656164u, 0x68686561u, 0x686D7478u, 0x6C6F6361u, 0x6D617870u
+    };
+    UInt8 glyf[512];
+    UInt32 loca[RS_GLYPHS + 1];
+    UInt32 glyfLen = 0;
+
+    memset(glyf, 0, sizeof(glyf));
+    loca[0] = 0;
+    loca[1] = 0;    /* .notdef has no outline */
+    glyfLen += rs_simple_glyph(glyf + glyfLen, kSquare, 4, kSquareEnds, 1);
+    loca[2] = glyfLen;
+    glyfLen += rs_simple_glyph(glyf + glyfLen, kRing, 8, kRingEnds, 2);
+    loca[3] = glyfLen;
+    glyfLen += rs_simple_glyph(glyf + glyfLen, kWound, 8, kRingEnds, 2);
+    loca[4] = glyfLen;
+    glyfLen += rs_simple_glyph(glyf + glyfLen, kCircle, 4, kSquareEnds, 1);
+    loca[5] = glyfLen;
+    glyfLen += rs_composite_glyph(glyf + glyfLen);
+    loca[6] = glyfLen;
+
+    UInt32 sizes[7] = { 12 + 262, glyfLen, 54, 36, RS_GLYPHS * 4, (RS_GLYPHS + 1) * 2, 6 };
+    UInt32 offset = 12 + 7 * 16;
+    UInt32 total = offset;
+    for (int t = 0; t < 7; t++) total += (sizes[t] + 3) & ~3u;
+
+    UInt8* sfnt = (UInt8*)NewPtrClear(total);
+    if (!sfnt) return NULL;
+
+    put32(sfnt, 0x00010000u);
+    put16(sfnt + 4, 7);
+    for (int t = 0; t < 7; t++) {
+        UInt8* rec = sfnt + 12 + t * 16;
+        UInt8* table = sfnt + offset;
+        put32(rec, kTags[t]);
+        put32(rec + 8, offset);
+        put32(rec + 12, sizes[t]);
+
+        switch (t) {
+            case 0:     /* cmap */
+                put16(table + 2, 1);
+                put16(table + 4, 1);        /* Macintosh */
+                put16(table + 6, 0);        /* Roman */
+                put32(table + 8, 12);
+                put16(table + 12, 0);       /* Format 0 */
+                put16(table + 14, 262);
+                table[18 + 'A'] = 1;
+                table[18 + 'O'] = 2;
+                table[18 + 'W'] = 3;
+                table[18 + 'C'] = 4;
+                table[18 + 'B'] = 5;
+                break;
+            case 1:
+                memcpy(table, glyf, glyfLen);
+                break;
+            case 2:     /* head */
+                put32(table, 0x00010000u);
+                put32(table + 12, 0x5F0F3CF5u);
+                put16(table + 18, RS_UPEM);
+                put16(table + 42, 48);
+                put16(table + 50, 0);       /* Short loca */
+                break;
+            case 3:     /* hhea */
+                put32(table, 0x00010000u);
+                put16(table + 4, 48);
+                put16(table + 6, (UInt16)-16);
+                put16(table + 34, RS_GLYPHS);
+                break;
+            case 4:
+                for (int g = 0; g < RS_GLYPHS; g++) put16(table + 4 * g, kAdvances[g]);
+                break;
+            case 5:
+                for (int g = 0; g <= RS_GLYPHS; g++) put16(table + 2 * g, loca[g] / 2);
+                break;
+            default:    /* maxp */
+                put32(table, 0x00005000u);
+                put16(table + 4, RS_GLYPHS);
+                break;
+        }
+        offset += (sizes[t] + 3) & ~3u;
+    }
+
+    *length = total;
+    return sfnt;
+}
+
+/* Render glyph at ppem in its bounds and compare with rows */
+static Boolean rs_matches(OutlineFont* font, UInt16 glyph, short ppem, const char* const* rows,
+                          short numRows) {
+    UInt8 coverage[32 * 32];
+    Rect bounds;
+
+    if (FM_GetGlyphBounds(font, glyph, ppem, &bounds) != noErr) return false;
+    short width = bounds.right - bounds.left;
+    short height = bounds.bottom - bounds.top;
+    if (height != numRows || width != (short)strlen(rows[0]) || width > 32 || height > 32 ||
+        FM_RenderGlyph(font, glyph, ppem, false, &bounds, coverage, 32) != noErr) {
+        RS_LOG("glyph %u: bounds %dx%d, expected %dx%d\n", glyph, width, height,
+               (int)strlen(rows[0]), numRows);
+        return false;
+    }
+
+    Boolean same = true;
+    for (short r = 0; r < height; r++) {
+        char line[33];
+        for (short c = 0; c < width; c++) {
+            line[c] = coverage[r * 32 + c] ? '#' : '.';
+        }
+        line[width] = 0;
+        if (strcmp(line, rows[r]) != 0) {
+            RS_LOG("glyph %u row %d: %s, expected %s\n", glyph, r, line, rows[r]);
+            same = false;
+        }
+    }
+    return same;
+}
+
+static void rs_check_glyphs(OutlineFont* font) {
+    check(FM_OutlineGlyphIndex(font, 'A') == 1 && FM_OutlineGlyphIndex(font, 'B') == 5 &&
+          FM_OutlineGlyphIndex(font, 'Z') == 0,
+          "character map");
+    check(rs_matches(font, 1, 16, kSquare16, 8), "square");
+    check(rs_matches(font, 2, 16, kRing16, 12), "reversed inner contour is a hole");
+    check(rs_matches(font, 3, 16, kWound16, 12), "same-way inner contour is filled (non-zero)");
+    check(rs_matches(font, 4, 16, kCircle16, 12), "off-curve-only contour");
+    check(rs_matches(font, 5, 16, kComposite16, 12), "composite with offset and scale");
+
+    /* At 12 pixels the square runs from x = 1.5 to 7.5: the centre of the
+     * first column is on the left edge and inside, the last one's is on
+     * the right edge and outside; smoothed, both are half covered */
+    UInt8 coverage[8 * 8];
+    Rect bounds;
+    static const UInt8 kRow[7] = { 128, 255, 255, 255, 255, 255, 128 };
+    FM_GetGlyphBounds(font, 1, 12, &bounds);
+    check(bounds.left == 1 && bounds.right == 8 && bounds.top == -6 && bounds.bottom == 0,
+          "bounds at 12 pixels");
+
+    FM_RenderGlyph(font, 1, 12, false, &bounds, coverage, 8);
+    check(coverage[0] == FM_COVERAGE_FULL && coverage[5] == FM_COVERAGE_FULL && coverage[6] == 0,
+          "edges sampled at pixel centres, half-open");
+
+    FM_RenderGlyph(font, 1, 12, true, &bounds, coverage, 8);
+    check(memcmp(coverage, kRow, 7) == 0 && memcmp(coverage + 5 * 8, kRow, 7) == 0,
+          "4x4 coverage of half-covered pixels");
+}
+
+static void rs_check_strike(Handle sfnt) {
+    FontStrike* strike = FM_RasterizeStrike(sfnt, RS_FAMILY, 16, normal, false);
+    check(strike != NULL, "strike rendered");
+    if (!strike) return;
+
+    short n = strike->lastChar - strike->firstChar;
+    check(strike->firstChar == 'A' && strike->lastChar == 'W' && strike->ascent == 12 &&
+          strike->descent == 4 && strike->fRectHeight == 16,
+          "strike range and metrics");
+    check(strike->locTable['B' - 'A'] - strike->locTable['A' - 'A'] == 10 &&
+          strike->locTable['D' - 'A'] == strike->locTable['E' - 'A'] &&
+          strike->locTable[n + 2] == strike->locTable[n + 1],
+          "strike locations");
+    check(strike->widthTable['A'] == 12 && strike->widthTable['O'] == 14 &&
+          strike->widthTable['Z'] == 8 && strike->fixedWidths['A'] == (12 << 16),
+          "strike widths");
+
+    /* Glyph rows of 'A' in the strike: the square from x = 2, rows 4-11 */
+    const UInt8* bits = (const UInt8*)*strike->bitmapData;
+    short rowBytes = strike->rowWords * 2;
+    check(bits[3 * rowBytes] == 0 && bits[4 * rowBytes] == 0x3F && (bits[4 * rowBytes + 1] & 0xF0) == 0xC0 &&
+          bits[11 * rowBytes] == 0x3F && bits[12 * rowBytes] == 0,
+          "strike bitmap");
+
+    FM_CacheStrike(strike, FM_SCREEN_DEVICE);
+    check(FM_GetCachedStrike(RS_FAMILY, 16, normal, FM_SCREEN_DEVICE) == strike,
+          "strike cached by size");
+}
+
+static void rs_time_drawing(Handle sfnt) {
+    static const char kLine[] = "ABCOW ABCOW ABCOW";
+    short len = (short)(sizeof(kLine) - 1);
+
+    UInt32 t0 = MicrosecondsNow();
+    FontStrike* strike = FM_RasterizeStrike(sfnt, RS_FAMILY, RS_DRAW_SIZE, normal, false);
+    UInt32 renderUs = MicrosecondsNow() - t0;
+    if (!strike) {
+        check(false, "24 point strike rendered");
+        return;
+    }
+    FM_CacheStrike(strike, FM_SCREEN_DEVICE);
+
+    TextFont(RS_FAMILY);
+    TextSize(RS_DRAW_SIZE);
+    TextFace(normal);
+    check(FM_GetCurrentStrike() == strike, "24 point text drawn from the rendered strike");
+
+    t0 = MicrosecondsNow();
+    for (int i = 0; i < RS_DRAW_PASSES; i++) {
+        MoveTo(10, 100);
+        DrawText(kLine, 0, len);
+    }
+    UInt32 outlineUs = MicrosecondsNow() - t0;
+
+    t0 = MicrosecondsNow();
+    for (int i = 0; i < RS_DRAW_PASSES; i++) {
+        MoveTo(10, 100);
+        FM_DrawTextAtSize(kLine, 0, len, RS_DRAW_SIZE);
+    }
+    UInt32 scaledUs = MicrosecondsNow() - t0;
+
+    UInt32 chars = (UInt32)RS_DRAW_PASSES * (UInt32)len;
+    RS_LOG("24pt strike rendered in %u us (%d glyphs)\n", renderUs,
+           strike->lastChar - strike->firstChar + 2);
+    RS_LOG("24pt draw: rendered strike %u ns/char, nearest-neighbour scaling %u ns/char\n",
+           outlineUs * 1000u / chars, scaledUs * 1000u / chars);
+}
+
+void FontRasterSmoke_Run(void) {
+    UInt32 length = 0;
+    UInt8* data = rs_build_sfnt(&length);
+    OutlineFont font;
+
+    RS_LOG("Starting TrueType rasterizer smoke test\n");
+    gFailures = 0;
+
+    check(data != NULL && FM_OpenOutlineFont(data, length, &font) == noErr, "open sfnt");
+    if (!data) return;
+
+    rs_check_glyphs(&font);
+    FM_CloseOutlineFont(&font);
+
+    Handle sfnt = NewHandle(length);
+    if (sfnt) {
+        GrafPort port;
+        GrafPtr savedPort;
+        memcpy(*sfnt, data, length);
+
+        GetPort(&savedPort);
+        memset(&port, 0, sizeof(port));
+        SetPort(&port);
+        InitFonts();
+
+        rs_check_strike(sfnt);
+        rs_time_drawing(sfnt);
+
+        TextFont(systemFont);
+        TextSize(12);
+        PurgeFontCache(RS_FAMILY);
+        SetPort(savedPort);
+        DisposeHandle(sfnt);
+    }
+    DisposePtr((Ptr)data);
+
+    RS_LOG("%s (%d failures)\n", gFailures ? "FAILED" : "done", gFailures);
+}
+
+#endif /* FONT_RASTER_SMOKE_TEST */
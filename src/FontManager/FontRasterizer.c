@@ -0,0 +1,895 @@
+/*
+ * FontRasterizer.c - TrueType Outline Rasterizer
+ *
+ * Glyphs are decoded from the glyf table (simple glyphs, and composites
+ * of them under their component transforms), scaled to 26.6 pixels and
+ * flattened: each quadratic segment becomes as many lines as keep it
+ * within 1/8 pixel of the curve.  The edges are filled a sample row at a
+ * time, the crossings of the row sorted by x and the spans where the
+ * winding number is non-zero counted into the pixels under them.
+ *
+ * All sfnt data is big-endian and read bytewise, so unaligned tables in a
+ * resource are fine.
+ */
+
+#include "SystemTypes.h"
+#include "MemoryMgr/MemoryManager.h"
+#include "FontManager/FontManager.h"
+#include "FontManager/FontTypes.h"
+#include "FontManager/FontCache.h"
+#include "FontManager/FontRasterizer.h"
+#include <string.h>
+#include "FontManager/FontLogging.h"
+
+/* Debug logging */
+#define FR_DEBUG 1
+
+#if FR_DEBUG
+#define FR_LOG(...) FONT_LOG_DEBUG("FR: " __VA_ARGS__)
+#else
+#define FR_LOG(...)
+#endif
+
+#ifndef TRUE
+#define TRUE 1
+#endif
+#ifndef FALSE
+#define FALSE 0
+#endif
+
+#define FR_TAG(a, b, c, d)      (((UInt32)(a) << 24) | ((UInt32)(b) << 16) | ((UInt32)(c) << 8) | (UInt32)(d))
+
+/* glyf point flags */
+#define FR_ON_CURVE             0x01
+#define FR_X_SHORT              0x02
+#define FR_Y_SHORT              0x04
+#define FR_REPEAT               0x08
+#define FR_X_SAME               0x10
+#define FR_Y_SAME               0x20
+
+/* glyf component flags */
+#define FR_ARG_WORDS            0x0001
+#define FR_ARGS_XY              0x0002
+#define FR_HAVE_SCALE           0x0008
+#define FR_MORE_COMPONENTS      0x0020
+#define FR_HAVE_XY_SCALE        0x0040
+#define FR_HAVE_2X2             0x0080
+
+#define FR_ONE                  (1 << 14)   /* 1.0 in 2.14 */
+#define FR_MAX_DEPTH            4           /* Composite nesting */
+#define FR_FLATNESS             8           /* 1/8 pixel, in 26.6 */
+#define FR_MAX_SUBDIVISIONS     16          /* Lines per quadratic segment */
+#define FR_COORD_LIMIT          (1 << 14)   /* 256 pixels either way, in 26.6 */
+#define FR_INK                  ((FM_COVERAGE_FULL + 1) / 2)
+
+/* Component transform: x' = xx*x + yx*y + dx, y' = xy*x + yy*y + dy */
+typedef struct FRTransform {
+    SInt32 xx, xy, yx, yy;  /* 2.14 */
+    SInt32 dx, dy;          /* Font units */
+} FRTransform;
+
+static const FRTransform kIdentity = { FR_ONE, 0, 0, FR_ONE, 0, 0 };
+
+typedef struct FRContext {
+    OutlineFont* font;
+    short        ppem;
+    SInt32       originX;   /* Frame's top-left, 26.6 */
+    SInt32       originY;
+    OSErr        err;
+} FRContext;
+
+/* Mac Roman 0x80-0xFF in Unicode, for fonts with only a Unicode cmap */
+static const UInt16 kMacRomanHigh[128] = {
+    0x00C4, 0x00C5, 0x00C7, 0x00C9, 0x00D1, 0x00D6, 0x00DC, 0x00E1,
+    0x00E0, 0x00E2, 0x00E4, 0x00E3, 0x00E5, 0x00E7, 0x00E9, 0x00E8,
+    0x00EA, 0x00EB, 0x00ED, 0x00EC, 0x00EE, 0x00EF, 0x00F1, 0x00F3,
+    0x00F2, 0x00F4, 0x00F6, 0x00F5, 0x00FA, 0x00F9, 0x00FB, 0x00FC,
+    0x2020, 0x00B0, 0x00A2, 0x00A3, 0x00A7, 0x2022, 0x00B6, 0x00DF,
+    0x00AE, 0x00A9, 0x2122, 0x00B4, 0x00A8, 0x2260, 0x00C6, 0x00D8,
+    0x221E, 0x00B1, 0x2264, 0x2265, 0x00A5, 0x00B5, 0x2202, 0x2211,
+    0x220F, 0x03C0, 0x222B, 0x00AA, 0x00BA, 0x03A9, 0x00E6, 0x00F8,
+    0x00BF, 0x00A1, 0x00AC, 0x221A, 0x0192, 0x2248, 0x2206, 0x00AB,
+    0x00BB, 0x2026, 0x00A0, 0x00C0, 0x00C3, 0x00D5, 0x0152, 0x0153,
+    0x2013, 0x2014, 0x201C, 0x201D, 0x2018, 0x2019, 0x00F7, 0x25CA,
+    0x00FF, 0x0178, 0x2044, 0x20AC, 0x2039, 0x203A, 0xFB01, 0xFB02,
+    0x2021, 0x00B7, 0x201A, 0x201E, 0x2030, 0x00C2, 0x00CA, 0x00C1,
+    0x00CB, 0x00C8, 0x00CD, 0x00CE, 0x00CF, 0x00CC, 0x00D3, 0x00D4,
+    0xF8FF, 0x00D2, 0x00DA, 0x00DB, 0x00D9, 0x0131, 0x02C6, 0x02DC,
+    0x00AF, 0x02D8, 0x02D9, 0x02DA, 0x00B8, 0x02DD, 0x02DB, 0x02C7
+};
+
+static UInt16 fr_u16(const UInt8* p) {
+    return (UInt16)((p[0] << 8) | p[1]);
+}
+
+static SInt16 fr_s16(const UInt8* p) {
+    return (SInt16)fr_u16(p);
+}
+
+static UInt32 fr_u32(const UInt8* p) {
+    return ((UInt32)p[0] << 24) | ((UInt32)p[1] << 16) | ((UInt32)p[2] << 8) | p[3];
+}
+
+static SInt32 fr_clamp(SInt32 v, SInt32 limit) {
+    return v < -limit ? -limit : (v > limit ? limit : v);
+}
+
+/* Grow buf to hold need elements, keeping its contents; NULL if out of memory */
+static Ptr fr_grow(Ptr buf, UInt32* cap, UInt32 need, UInt32 size) {
+    if (need <= *cap) return buf;
+
+    UInt32 newCap = *cap ? *cap : 64;
+    while (newCap < need) newCap *= 2;
+
+    Ptr p = NewPtr(newCap * size);
+    if (!p) return NULL;
+    if (buf) {
+        memcpy(p, buf, *cap * size);
+        DisposePtr(buf);
+    }
+    *cap = newCap;
+    return p;
+}
+
+/* ============================================================================
+ * sfnt Tables
+ * ============================================================================ */
+
+static const UInt8* fr_find_table(const UInt8* data, UInt32 length, UInt32 tag, UInt32* tableLength) {
+    UInt16 numTables = fr_u16(data + 4);
+    if (12 + (UInt32)numTables * 16 > length) return NULL;
+
+    for (UInt16 i = 0; i < numTables; i++) {
+        const UInt8* rec = data + 12 + i * 16;
+        if (fr_u32(rec) != tag) continue;
+
+        UInt32 offset = fr_u32(rec + 8);
+        UInt32 len = fr_u32(rec + 12);
+        if (offset > length || len > length - offset) return NULL;
+        *tableLength = len;
+        return data + offset;
+    }
+    return NULL;
+}
+
+/* Pick the Mac Roman subtable (format 0 or 6), else a Unicode format 4 */
+static void fr_select_cmap(OutlineFont* font, const UInt8* cmap, UInt32 length) {
+    if (length < 4) return;
+    UInt16 numTables = fr_u16(cmap + 2);
+    if (4 + (UInt32)numTables * 8 > length) return;
+
+    for (int pass = 0; pass < 2; pass++) {
+        for (UInt16 i = 0; i < numTables; i++) {
+            const UInt8* rec = cmap + 4 + i * 8;
+            UInt16 platform = fr_u16(rec);
+            UInt16 encoding = fr_u16(rec + 2);
+            UInt32 offset = fr_u32(rec + 4);
+            if (offset + 6 > length) continue;
+
+            const UInt8* sub = cmap + offset;
+            UInt16 format = fr_u16(sub);
+            UInt32 subLength = fr_u16(sub + 2);
+            if (subLength > length - offset) subLength = length - offset;
+
+            Boolean macRoman = platform == 1 && encoding == 0 && (format == 0 || format == 6);
+            Boolean unicode = (platform == 0 || (platform == 3 && encoding == 1)) && format == 4;
+            if ((pass == 0 && macRoman) || (pass == 1 && unicode)) {
+                font->cmap = sub;
+                font->cmapLength = subLength;
+                font->cmapFormat = format;
+                return;
+            }
+        }
+    }
+}
+
+OSErr FM_OpenOutlineFont(const void* data, UInt32 length, OutlineFont* font) {
+    if (!font) return paramErr;
+    memset(font, 0, sizeof(*font));
+
+    const UInt8* p = (const UInt8*)data;
+    if (!p || length < 12) return paramErr;
+    UInt32 version = fr_u32(p);
+    if (version != 0x00010000u && version != FR_TAG('t', 'r', 'u', 'e')) {
+        FR_LOG("FM_OpenOutlineFont: not a TrueType sfnt (0x%08X)\n", version);
+        return paramErr;
+    }
+
+    UInt32 headLen = 0, maxpLen = 0, hheaLen = 0, hmtxLen = 0, locaLen = 0, cmapLen = 0;
+    const UInt8* head = fr_find_table(p, length, FR_TAG('h', 'e', 'a', 'd'), &headLen);
+    const UInt8* maxp = fr_find_table(p, length, FR_TAG('m', 'a', 'x', 'p'), &maxpLen);
+    const UInt8* hhea = fr_find_table(p, length, FR_TAG('h', 'h', 'e', 'a'), &hheaLen);
+    const UInt8* cmap = fr_find_table(p, length, FR_TAG('c', 'm', 'a', 'p'), &cmapLen);
+    font->hmtx = fr_find_table(p, length, FR_TAG('h', 'm', 't', 'x'), &hmtxLen);
+    font->loca = fr_find_table(p, length, FR_TAG('l', 'o', 'c', 'a'), &locaLen);
+    font->glyf = fr_find_table(p, length, FR_TAG('g', 'l', 'y', 'f'), &font->glyfLength);
+
+    if (!head || headLen < 54 || !maxp || maxpLen < 6 || !hhea || hheaLen < 36 ||
+        !font->hmtx || !font->loca || !font->glyf || !cmap) {
+        FR_LOG("FM_OpenOutlineFont: missing or short tables\n");
+        return paramErr;
+    }
+
+    font->data = p;
+    font->length = length;
+    font->unitsPerEm = fr_u16(head + 18);
+    font->longLoca = fr_s16(head + 50) != 0;
+    font->numGlyphs = fr_u16(maxp + 4);
+    font->ascender = fr_s16(hhea + 4);
+    font->descender = fr_s16(hhea + 6);
+    font->lineGap = fr_s16(hhea + 8);
+    font->numHMetrics = fr_u16(hhea + 34);
+
+    if (font->unitsPerEm < 16 || font->unitsPerEm > 16384 || font->numGlyphs == 0 ||
+        font->numHMetrics == 0 || font->numHMetrics > font->numGlyphs ||
+        (UInt32)font->numHMetrics * 4 > hmtxLen ||
+        ((UInt32)font->numGlyphs + 1) * (font->longLoca ? 4u : 2u) > locaLen) {
+        FR_LOG("FM_OpenOutlineFont: inconsistent head/maxp/hhea\n");
+        return paramErr;
+    }
+
+    fr_select_cmap(font, cmap, cmapLen);
+    if (!font->cmap) {
+        FR_LOG("FM_OpenOutlineFont: no Mac Roman or Unicode character map\n");
+        return paramErr;
+    }
+    return noErr;
+}
+
+void FM_CloseOutlineFont(OutlineFont* font) {
+    if (!font) return;
+    if (font->points) DisposePtr((Ptr)font->points);
+    if (font->edges) DisposePtr((Ptr)font->edges);
+    if (font->crossings) DisposePtr((Ptr)font->crossings);
+    memset(font, 0, sizeof(*font));
+}
+
+static UInt16 fr_cmap4(const OutlineFont* font, UInt16 code) {
+    const UInt8* sub = font->cmap;
+    UInt32 length = font->cmapLength;
+    if (length < 14) return 0;
+
+    UInt32 segX2 = fr_u16(sub + 6);
+    if (16 + segX2 * 4 > length) return 0;
+
+    const UInt8* ends = sub + 14;
+    for (UInt32 i = 0; i < segX2; i += 2) {
+        if (fr_u16(ends + i) < code) continue;
+
+        UInt16 start = fr_u16(ends + segX2 + 2 + i);
+        if (start > code) return 0;
+        UInt16 delta = fr_u16(ends + 2 * segX2 + 2 + i);
+        const UInt8* rangePtr = ends + 3 * segX2 + 2 + i;
+        UInt16 rangeOffset = fr_u16(rangePtr);
+        if (rangeOffset == 0) {
+            return (UInt16)(code + delta);
+        }
+
+        UInt32 at = (UInt32)(rangePtr - sub) + rangeOffset + 2u * (code - start);
+        if (at + 2 > length) return 0;
+        UInt16 glyph = fr_u16(sub + at);
+        return glyph ? (UInt16)(glyph + delta) : 0;
+    }
+    return 0;
+}
+
+UInt16 FM_OutlineGlyphIndex(const OutlineFont* font, UInt8 ch) {
+    if (!font || !font->cmap) return 0;
+
+    const UInt8* sub = font->cmap;
+    UInt16 glyph = 0;
+    switch (font->cmapFormat) {
+        case 0:
+            if (6u + ch < font->cmapLength) glyph = sub[6 + ch];
+            break;
+        case 6: {
+            if (font->cmapLength < 10) break;
+            UInt16 firstCode = fr_u16(sub + 6);
+            UInt16 count = fr_u16(sub + 8);
+            if (ch >= firstCode && ch - firstCode < count &&
+                10u + 2u * (ch - firstCode) + 2 <= font->cmapLength) {
+                glyph = fr_u16(sub + 10 + 2 * (ch - firstCode));
+            }
+            break;
+        }
+        case 4:
+            glyph = fr_cmap4(font, ch < 0x80 ? ch : kMacRomanHigh[ch - 0x80]);
+            break;
+        default:
+            break;
+    }
+    return glyph < font->numGlyphs ? glyph : 0;
+}
+
+/* A value in font units at ppem, in 26.6 pixels, rounded */
+static SInt32 fr_scale(const OutlineFont* font, SInt32 v, short ppem) {
+    SInt32 n = fr_clamp(v, 32767) * ppem * 64;
+    SInt32 half = font->unitsPerEm / 2;
+    return (n >= 0 ? n + half : n - half) / (SInt32)font->unitsPerEm;
+}
+
+Fixed FM_OutlineAdvance(const OutlineFont* font, UInt16 glyph, short ppem) {
+    if (!font || !font->hmtx) return 0;
+
+    UInt16 metric = glyph < font->numHMetrics ? glyph : (UInt16)(font->numHMetrics - 1);
+    UInt32 scaled = (UInt32)fr_u16(font->hmtx + 4 * metric) * (UInt32)ppem;
+    UInt32 whole = scaled / font->unitsPerEm;
+    UInt32 rem = scaled % font->unitsPerEm;
+    if (whole > 0x7FFF) whole = 0x7FFF;
+    return (Fixed)((whole << 16) + (rem << 16) / font->unitsPerEm);
+}
+
+/* A glyph's glyf data, NULL if it has none */
+static const UInt8* fr_glyph_data(const OutlineFont* font, UInt16 glyph, UInt32* length) {
+    UInt32 start, end;
+    if (font->longLoca) {
+        start = fr_u32(font->loca + 4 * glyph);
+        end = fr_u32(font->loca + 4 * glyph + 4);
+    } else {
+        start = 2u * fr_u16(font->loca + 2 * glyph);
+        end = 2u * fr_u16(font->loca + 2 * glyph + 2);
+    }
+    if (end <= start || end > font->glyfLength || end - start < 10) return NULL;
+    *length = end - start;
+    return font->glyf + start;
+}
+
+OSErr FM_GetGlyphBounds(const OutlineFont* font, UInt16 glyph, short ppem, Rect* bounds) {
+    if (!font || !bounds || glyph >= font->numGlyphs || ppem <= 0 || ppem > FM_OUTLINE_MAX_SIZE) {
+        return paramErr;
+    }
+
+    memset(bounds, 0, sizeof(*bounds));
+    UInt32 length;
+    const UInt8* g = fr_glyph_data(font, glyph, &length);
+    if (!g || fr_s16(g) == 0) return noErr;
+
+    /* Floor and ceiling of the scaled box; y flips */
+    bounds->left = (short)(fr_scale(font, fr_s16(g + 2), ppem) >> 6);
+    bounds->bottom = (short)(-(fr_scale(font, fr_s16(g + 4), ppem) >> 6));
+    bounds->right = (short)((fr_scale(font, fr_s16(g + 6), ppem) + 63) >> 6);
+    bounds->top = (short)(-((fr_scale(font, fr_s16(g + 8), ppem) + 63) >> 6));
+    return noErr;
+}
+
+/* ============================================================================
+ * Outlines to Edges
+ * ============================================================================ */
+
+static void fr_add_line(FRContext* ctx, SInt32 x0, SInt32 y0, SInt32 x1, SInt32 y1) {
+    OutlineFont* font = ctx->font;
+    if (y0 == y1 || ctx->err != noErr) return;
+
+    if (font->edgeCount == font->edgeCap) {
+        Ptr p = fr_grow((Ptr)font->edges, &font->edgeCap, font->edgeCount + 1, sizeof(OutlineEdge));
+        if (!p) {
+            ctx->err = memFullErr;
+            return;
+        }
+        font->edges = (OutlineEdge*)p;
+    }
+
+    OutlineEdge* e = &font->edges[font->edgeCount++];
+    if (y0 < y1) {
+        e->x0 = x0; e->y0 = y0; e->x1 = x1; e->y1 = y1; e->dir = 1;
+    } else {
+        e->x0 = x1; e->y0 = y1; e->x1 = x0; e->y1 = y0; e->dir = -1;
+    }
+}
+
+/* Quadratic segment as lines, halving the step until each is flat enough */
+static void fr_add_quad(FRContext* ctx, SInt32 x0, SInt32 y0, SInt32 x1, SInt32 y1,
+                        SInt32 x2, SInt32 y2) {
+    SInt32 ddx = x0 - 2 * x1 + x2;
+    SInt32 ddy = y0 - 2 * y1 + y2;
+    SInt32 dev = (ddx < 0 ? -ddx : ddx) > (ddy < 0 ? -ddy : ddy) ? (ddx < 0 ? -ddx : ddx)
+                                                                   : (ddy < 0 ? -ddy : ddy);
+    SInt32 n = 1;
+
+    /* The curve's middle is dev/4 off the chord; each halving quarters it */
+    for (dev >>= 2; dev > FR_FLATNESS && n < FR_MAX_SUBDIVISIONS; dev >>= 2) {
+        n <<= 1;
+    }
+
+    SInt32 nn = n * n;
+    SInt32 px = x0, py = y0;
+    for (SInt32 i = 1; i <= n; i++) {
+        SInt32 x = x0 + (2 * i * n * (x1 - x0) + i * i * ddx) / nn;
+        SInt32 y = y0 + (2 * i * n * (y1 - y0) + i * i * ddy) / nn;
+        fr_add_line(ctx, px, py, x, y);
+        px = x;
+        py = y;
+    }
+}
+
+/* One closed contour of n points; consecutive off-curve points imply an
+ * on-curve point midway between them */
+static void fr_add_contour(FRContext* ctx, const OutlinePoint* p, UInt32 n) {
+    SInt32 sx, sy;
+    UInt32 i = 0, end = n;
+
+    if (p[0].flags & FR_ON_CURVE) {
+        sx = p[0].x;
+        sy = p[0].y;
+        i = 1;
+    } else if (p[n - 1].flags & FR_ON_CURVE) {
+        sx = p[n - 1].x;
+        sy = p[n - 1].y;
+        end = n - 1;
+    } else {
+        sx = (p[0].x + p[n - 1].x) / 2;
+        sy = (p[0].y + p[n - 1].y) / 2;
+    }
+
+    SInt32 cx = sx, cy = sy, qx = 0, qy = 0;
+    Boolean pending = FALSE;
+    for (; i < end; i++) {
+        if (p[i].flags & FR_ON_CURVE) {
+            if (pending) fr_add_quad(ctx, cx, cy, qx, qy, p[i].x, p[i].y);
+            else fr_add_line(ctx, cx, cy, p[i].x, p[i].y);
+            cx = p[i].x;
+            cy = p[i].y;
+            pending = FALSE;
+        } else {
+            if (pending) {
+                SInt32 mx = (qx + p[i].x) / 2;
+                SInt32 my = (qy + p[i].y) / 2;
+                fr_add_quad(ctx, cx, cy, qx, qy, mx, my);
+                cx = mx;
+                cy = my;
+            }
+            qx = p[i].x;
+            qy = p[i].y;
+            pending = TRUE;
+        }
+    }
+
+    if (pending) fr_add_quad(ctx, cx, cy, qx, qy, sx, sy);
+    else fr_add_line(ctx, cx, cy, sx, sy);
+}
+
+/* Flags, then x and y deltas, of numPoints points from g + pos */
+static Boolean fr_decode_points(const UInt8* g, UInt32 length, UInt32 pos,
+                                OutlinePoint* pts, UInt32 numPoints) {
+    for (UInt32 i = 0; i < numPoints;) {
+        if (pos >= length) return FALSE;
+        UInt8 flags = g[pos++];
+        pts[i++].flags = flags;
+        if (flags & FR_REPEAT) {
+            if (pos >= length) return FALSE;
+            for (UInt8 r = g[pos++]; r > 0 && i < numPoints; r--) pts[i++].flags = flags;
+        }
+    }
+
+    SInt32 v = 0;
+    for (UInt32 i = 0; i < numPoints; i++) {
+        UInt8 flags = pts[i].flags;
+        if (flags & FR_X_SHORT) {
+            if (pos >= length) return FALSE;
+            v += (flags & FR_X_SAME) ? g[pos] : -(SInt32)g[pos];
+            pos++;
+        } else if (!(flags & FR_X_SAME)) {
+            if (pos + 2 > length) return FALSE;
+            v += fr_s16(g + pos);
+            pos += 2;
+        }
+        pts[i].x = v;
+    }
+
+    v = 0;
+    for (UInt32 i = 0; i < numPoints; i++) {
+        UInt8 flags = pts[i].flags;
+        if (flags & FR_Y_SHORT) {
+            if (pos >= length) return FALSE;
+            v += (flags & FR_Y_SAME) ? g[pos] : -(SInt32)g[pos];
+            pos++;
+        } else if (!(flags & FR_Y_SAME)) {
+            if (pos + 2 > length) return FALSE;
+            v += fr_s16(g + pos);
+            pos += 2;
+        }
+        pts[i].y = v;
+    }
+    return TRUE;
+}
+
+/* Decode a simple glyph's points, place them and add its contours */
+static void fr_add_simple(FRContext* ctx, const UInt8* g, UInt32 length, UInt16 numContours,
+                          const FRTransform* t) {
+    OutlineFont* font = ctx->font;
+    UInt32 pos = 10 + 2u * numContours;
+    if (pos + 2 > length) {
+        ctx->err = paramErr;
+        return;
+    }
+
+    UInt32 numPoints = (UInt32)fr_u16(g + pos - 2) + 1;
+    pos += 2 + fr_u16(g + pos);   /* Skip the instructions */
+
+    Ptr p = fr_grow((Ptr)font->points, &font->pointCap, numPoints, sizeof(OutlinePoint));
+    if (!p) {
+        ctx->err = memFullErr;
+        return;
+    }
+    font->points = (OutlinePoint*)p;
+    OutlinePoint* pts = font->points;
+
+    if (!fr_decode_points(g, length, pos, pts, numPoints)) {
+        FR_LOG("fr_add_simple: truncated glyph\n");
+        ctx->err = paramErr;
+        return;
+    }
+
+    /* Font units to the frame's 26.6 pixels, y down */
+    for (UInt32 i = 0; i < numPoints; i++) {
+        SInt32 x = (SInt32)(((SInt64)pts[i].x * t->xx + (SInt64)pts[i].y * t->yx) >> 14) + t->dx;
+        SInt32 y = (SInt32)(((SInt64)pts[i].x * t->xy + (SInt64)pts[i].y * t->yy) >> 14) + t->dy;
+        pts[i].x = fr_clamp(fr_scale(font, x, ctx->ppem) - ctx->originX, FR_COORD_LIMIT);
+        pts[i].y = fr_clamp(-fr_scale(font, y, ctx->ppem) - ctx->originY, FR_COORD_LIMIT);
+    }
+
+    UInt32 first = 0;
+    for (UInt16 c = 0; c < numContours && ctx->err == noErr; c++) {
+        UInt32 last = fr_u16(g + 10 + 2 * c);
+        if (last < first || last >= numPoints) {
+            FR_LOG("fr_add_simple: bad contour end %u\n", last);
+            ctx->err = paramErr;
+            return;
+        }
+        if (last > first) fr_add_contour(ctx, pts + first, last - first + 1);
+        first = last + 1;
+    }
+}
+
+/* outer after inner */
+static FRTransform fr_compose(const FRTransform* outer, const FRTransform* inner) {
+    FRTransform t;
+    t.xx = (SInt32)(((SInt64)outer->xx * inner->xx + (SInt64)outer->yx * inner->xy) >> 14);
+    t.xy = (SInt32)(((SInt64)outer->xy * inner->xx + (SInt64)outer->yy * inner->xy) >> 14);
+    t.yx = (SInt32)(((SInt64)outer->xx * inner->yx + (SInt64)outer->yx * inner->yy) >> 14);
+    t.yy = (SInt32)(((SInt64)outer->xy * inner->yx + (SInt64)outer->yy * inner->yy) >> 14);
+    t.dx = (SInt32)(((SInt64)outer->xx * inner->dx + (SInt64)outer->yx * inner->dy) >> 14) + outer->dx;
+    t.dy = (SInt32)(((SInt64)outer->xy * inner->dx + (SInt64)outer->yy * inner->dy) >> 14) + outer->dy;
+    return t;
+}
+
+static void fr_add_glyph(FRContext* ctx, UInt16 glyph, const FRTransform* t, int depth) {
+    UInt32 length;
+    const UInt8* g = glyph < ctx->font->numGlyphs ? fr_glyph_data(ctx->font, glyph, &length) : NULL;
+    if (!g) return;
+
+    SInt16 numContours = fr_s16(g);
+    if (numContours > 0) {
+        fr_add_simple(ctx, g, length, (UInt16)numContours, t);
+        return;
+    }
+    if (numContours == 0 || depth >= FR_MAX_DEPTH) return;
+
+    /* Composite: components placed by offset; anchor point matching is
+     * not supported and places a component at the origin */
+    UInt32 pos = 10;
+    UInt16 flags;
+    do {
+        if (pos + 4 > length) break;
+        flags = fr_u16(g + pos);
+        UInt16 component = fr_u16(g + pos + 2);
+        pos += 4;
+
+        SInt32 arg1, arg2;
+        if (flags & FR_ARG_WORDS) {
+            if (pos + 4 > length) break;
+            arg1 = fr_s16(g + pos);
+            arg2 = fr_s16(g + pos + 2);
+            pos += 4;
+        } else {
+            if (pos + 2 > length) break;
+            arg1 = (SInt8)g[pos];
+            arg2 = (SInt8)g[pos + 1];
+            pos += 2;
+        }
+
+        FRTransform c = kIdentity;
+        if (flags & FR_HAVE_SCALE) {
+            if (pos + 2 > length) break;
+            c.xx = c.yy = fr_s16(g + pos);
+            pos += 2;
+        } else if (flags & FR_HAVE_XY_SCALE) {
+            if (pos + 4 > length) break;
+            c.xx = fr_s16(g + pos);
+            c.yy = fr_s16(g + pos + 2);
+            pos += 4;
+        } else if (flags & FR_HAVE_2X2) {
+            if (pos + 8 > length) break;
+            c.xx = fr_s16(g + pos);
+            c.xy = fr_s16(g + pos + 2);
+            c.yx = fr_s16(g + pos + 4);
+            c.yy = fr_s16(g + pos + 6);
+            pos += 8;
+        }
+        if (flags & FR_ARGS_XY) {
+            c.dx = arg1;
+            c.dy = arg2;
+        }
+
+        FRTransform placed = fr_compose(t, &c);
+        fr_add_glyph(ctx, component, &placed, depth + 1);
+    } while ((flags & FR_MORE_COMPONENTS) && ctx->err == noErr);
+}
+
+/* ============================================================================
+ * Scanline Fill
+ * ============================================================================ */
+
+static void fr_sort_edges(OutlineEdge* edges, UInt32 count) {
+    for (UInt32 i = 1; i < count; i++) {
+        OutlineEdge e = edges[i];
+        UInt32 j = i;
+        while (j > 0 && edges[j - 1].y0 > e.y0) {
+            edges[j] = edges[j - 1];
+            j--;
+        }
+        edges[j] = e;
+    }
+}
+
+/* Count the samples of row in [xa, xb); samples sit at half + k * step */
+static void fr_span(UInt8* row, SInt32 xa, SInt32 xb, SInt32 half, int shift, SInt32 limit) {
+    SInt32 step = 64 >> shift;
+    SInt32 k0 = xa <= half ? 0 : (xa - half + step - 1) >> (6 - shift);
+    SInt32 k1 = xb <= half ? 0 : (xb - half + step - 1) >> (6 - shift);
+    if (k1 > limit) k1 = limit;
+
+    for (SInt32 k = k0; k < k1; k++) {
+        row[k >> shift]++;
+    }
+}
+
+/* Fill the edges with the non-zero winding rule, sub x sub samples a pixel */
+static void fr_fill(OutlineFont* font, SInt32 width, SInt32 height, Boolean smooth,
+                    UInt8* coverage, short rowBytes) {
+    OutlineEdge* edges = font->edges;
+    SInt32* cross = font->crossings;
+    int shift = smooth ? 2 : 0;
+    SInt32 sub = 1 << shift;
+    SInt32 step = 64 >> shift;
+    SInt32 limit = width << shift;
+
+    fr_sort_edges(edges, font->edgeCount);
+
+    for (SInt32 r = 0; r < height; r++) {
+        UInt8* row = coverage + r * rowBytes;
+        memset(row, 0, (size_t)width);
+
+        for (SInt32 s = 0; s < sub; s++) {
+            SInt32 sy = (r << 6) + s * step + step / 2;
+            UInt32 n = 0;
+
+            /* Crossings of this sample row, kept sorted by x */
+            for (UInt32 i = 0; i < font->edgeCount && edges[i].y0 <= sy; i++) {
+                const OutlineEdge* e = &edges[i];
+                if (sy >= e->y1) continue;
+
+                SInt32 x = e->x0 + (sy - e->y0) * (e->x1 - e->x0) / (e->y1 - e->y0);
+                UInt32 j = n++;
+                while (j > 0 && cross[2 * (j - 1)] > x) {
+                    cross[2 * j] = cross[2 * (j - 1)];
+                    cross[2 * j + 1] = cross[2 * (j - 1) + 1];
+                    j--;
+                }
+                cross[2 * j] = x;
+                cross[2 * j + 1] = e->dir;
+            }
+
+            SInt32 winding = 0, spanStart = 0;
+            for (UInt32 j = 0; j < n; j++) {
+                if (winding == 0) spanStart = cross[2 * j];
+                winding += cross[2 * j + 1];
+                if (winding == 0) fr_span(row, spanStart, cross[2 * j], step / 2, shift, limit);
+            }
+        }
+
+        for (SInt32 x = 0; x < width; x++) {
+            row[x] = (UInt8)((row[x] * FM_COVERAGE_FULL + (sub * sub) / 2) >> (2 * shift));
+        }
+    }
+}
+
+OSErr FM_RenderGlyph(OutlineFont* font, UInt16 glyph, short ppem, Boolean smooth,
+                     const Rect* frame, UInt8* coverage, short rowBytes) {
+    if (!font || !frame || !coverage || glyph >= font->numGlyphs ||
+        ppem <= 0 || ppem > FM_OUTLINE_MAX_SIZE) {
+        return paramErr;
+    }
+
+    SInt32 width = frame->right - frame->left;
+    SInt32 height = frame->bottom - frame->top;
+    if (width <= 0 || height <= 0) return noErr;
+    if (rowBytes < width) return paramErr;
+
+    FRContext ctx = { font, ppem, (SInt32)frame->left * 64, (SInt32)frame->top * 64, noErr };
+    font->edgeCount = 0;
+    fr_add_glyph(&ctx, glyph, &kIdentity, 0);
+    if (ctx.err != noErr) return ctx.err;
+
+    Ptr p = fr_grow((Ptr)font->crossings, &font->crossingCap, 2 * font->edgeCount, sizeof(SInt32));
+    if (!p) return memFullErr;
+    font->crossings = (SInt32*)p;
+
+    fr_fill(font, width, height, smooth, coverage, rowBytes);
+    return noErr;
+}
+
+/* ============================================================================
+ * Strikes
+ * ============================================================================ */
+
+/* Characters first..last laid out side by side, each image from the
+ * origin to its right edge, then the missing glyph: returns the strike's
+ * width and widens ascent, descent and widest to fit */
+static SInt32 fr_layout(const OutlineFont* font, const UInt16* glyphs, short first, short last,
+                        short size, short* loc, SInt32* ascent, SInt32* descent, SInt32* widest) {
+    SInt32 entries = last - first + 3;
+    SInt32 x = 0;
+
+    for (SInt32 i = 0; i < entries - 1; i++) {
+        Boolean missing = i > last - first;
+        UInt16 glyph = missing ? 0 : glyphs[first + i];
+        Rect bounds;
+
+        loc[i] = (short)x;
+        if (!missing && glyph == 0) continue;
+        if (FM_GetGlyphBounds(font, glyph, size, &bounds) != noErr || bounds.right <= 0) continue;
+
+        if (-bounds.top > *ascent) *ascent = -bounds.top;
+        if (bounds.bottom > *descent) *descent = bounds.bottom;
+        if (bounds.right > *widest) *widest = bounds.right;
+        x += bounds.right;
+        if (x > 0x7FFF) return -1;
+    }
+    loc[entries - 1] = (short)x;
+    return x;
+}
+
+/* Render each laid out image into the strike bitmap, keeping inked pixels */
+static void fr_render_images(OutlineFont* font, const UInt16* glyphs, short first, short last,
+                             short size, Boolean smooth, const short* loc, SInt32 ascent,
+                             SInt32 descent, UInt8* coverage, SInt32 widest, Handle bits,
+                             SInt32 rowBytes) {
+    SInt32 entries = last - first + 3;
+    SInt32 height = ascent + descent;
+
+    for (SInt32 i = 0; i < entries - 1; i++) {
+        SInt32 w = loc[i + 1] - loc[i];
+        if (w <= 0) continue;
+
+        UInt16 glyph = i <= last - first ? glyphs[first + i] : 0;
+        Rect frame = { (short)-ascent, 0, (short)descent, (short)w };
+        if (FM_RenderGlyph(font, glyph, size, smooth, &frame, coverage, (short)widest) != noErr) {
+            continue;
+        }
+
+        /* Rendering may have moved the unlocked bitmap */
+        UInt8* base = (UInt8*)*bits;
+        for (SInt32 r = 0; r < height; r++) {
+            const UInt8* cov = coverage + r * widest;
+            UInt8* dst = base + r * rowBytes;
+            for (SInt32 c = 0; c < w; c++) {
+                if (cov[c] >= FR_INK) {
+                    SInt32 bit = loc[i] + c;
+                    dst[bit >> 3] |= (UInt8)(0x80 >> (bit & 7));
+                }
+            }
+        }
+    }
+}
+
+static FontStrike* fr_build_strike(OutlineFont* font, short familyID, short size, Style face,
+                                   Boolean smooth) {
+    UInt16 glyphs[256];
+    short first = -1, last = -1;
+
+    for (int ch = 0; ch < 256; ch++) {
+        glyphs[ch] = FM_OutlineGlyphIndex(font, (UInt8)ch);
+        if (glyphs[ch]) {
+            if (first < 0) first = (short)ch;
+            last = (short)ch;
+        }
+    }
+    if (first < 0) return NULL;
+
+    /* Characters first..last, the missing glyph, and the end */
+    SInt32 entries = last - first + 3;
+    short* loc = (short*)NewPtr(entries * sizeof(short));
+    UInt8* widths = (UInt8*)NewPtr(256);
+    Fixed* fixedWidths = (Fixed*)NewPtr(256 * sizeof(Fixed));
+    FontStrike* strike = (FontStrike*)NewPtr(sizeof(FontStrike));
+    SInt32 ascent = (fr_scale(font, font->ascender, size) + 63) >> 6;
+    SInt32 descent = (fr_scale(font, -font->descender, size) + 63) >> 6;
+    SInt32 widest = 0, width = -1, height = 0, rowBytes = 0;
+    UInt8* coverage = NULL;
+    Handle bits = NULL;
+
+    if (loc && widths && fixedWidths && strike) {
+        width = fr_layout(font, glyphs, first, last, size, loc, &ascent, &descent, &widest);
+    }
+    if (width >= 0) {
+        if (ascent > 2 * size) ascent = 2 * size;
+        if (descent > size) descent = size;
+        if (ascent < 0) ascent = 0;
+        if (descent < 0) descent = 0;
+        height = ascent + descent;
+        rowBytes = ((width + 15) / 16) * 2;
+        bits = NewHandleClear((u32)(rowBytes * height > 0 ? rowBytes * height : 2));
+        if (widest > 0) coverage = (UInt8*)NewPtr((Size)(widest * height));
+    }
+    if (!bits || height == 0 || (widest > 0 && !coverage)) {
+        FR_LOG("fr_build_strike: could not build %d/%d\n", familyID, size);
+        if (coverage) DisposePtr((Ptr)coverage);
+        if (bits) DisposeHandle(bits);
+        if (strike) DisposePtr((Ptr)strike);
+        if (fixedWidths) DisposePtr((Ptr)fixedWidths);
+        if (widths) DisposePtr((Ptr)widths);
+        if (loc) DisposePtr((Ptr)loc);
+        return NULL;
+    }
+
+    if (coverage) {
+        fr_render_images(font, glyphs, first, last, size, smooth, loc, ascent, descent,
+                         coverage, widest, bits, rowBytes);
+        DisposePtr((Ptr)coverage);
+    }
+
+    /* Advances by character code; codes without a glyph take the missing one's */
+    Fixed missing = FM_OutlineAdvance(font, 0, size);
+    short widMax = 0;
+    for (int ch = 0; ch < 256; ch++) {
+        Fixed advance = glyphs[ch] ? FM_OutlineAdvance(font, glyphs[ch], size) : missing;
+        SInt32 whole = (advance + 0x8000) >> 16;
+        fixedWidths[ch] = advance;
+        widths[ch] = (UInt8)(whole > 255 ? 255 : whole);
+        if (widths[ch] > widMax) widMax = widths[ch];
+    }
+
+    strike->familyID = familyID;
+    strike->size = size;
+    strike->face = face;
+    strike->synthetic = FALSE;
+    strike->ascent = (short)ascent;
+    strike->descent = (short)descent;
+    strike->leading = (short)((fr_scale(font, font->lineGap > 0 ? font->lineGap : 0, size) + 32) >> 6);
+    strike->widMax = widMax;
+    strike->firstChar = first;
+    strike->lastChar = last;
+    strike->rowWords = (short)(rowBytes / 2);
+    strike->fRectHeight = (short)height;
+    strike->bitmapData = bits;
+    strike->locTable = loc;
+    strike->widthTable = widths;
+    strike->fixedWidths = fixedWidths;
+    strike->next = NULL;
+    strike->prev = NULL;
+    strike->hashNext = NULL;
+    strike->device = FM_SCREEN_DEVICE;
+    strike->cacheBytes = 0;  /* Set by FM_CacheStrike */
+    return strike;
+}
+
+FontStrike* FM_RasterizeStrike(Handle sfnt, short familyID, short size, Style face,
+                               Boolean smooth) {
+    if (!sfnt || !*sfnt || size <= 0 || size > FM_OUTLINE_MAX_SIZE) {
+        return NULL;
+    }
+
+    OutlineFont font;
+    FontStrike* strike = NULL;
+    HLock(sfnt);
+    if (FM_OpenOutlineFont(*sfnt, GetHandleSize(sfnt), &font) == noErr) {
+        strike = fr_build_strike(&font, familyID, size, face, smooth);
+        FM_CloseOutlineFont(&font);
+    }
+    HUnlock(sfnt);
+
+    FR_LOG("FM_RasterizeStrike: %d/%d/0x%02X %s\n", familyID, size, face,
+           strike ? "rendered" : "failed");
+    return strike;
+}
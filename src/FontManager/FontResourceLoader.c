@@ -36,8 +36,10 @@ static int fm_abs(int x) {
 
 /* Memory management stubs */
 extern Ptr NewPtr(Size byteCount);
+extern Handle NewHandle(Size byteCount);
 extern void DisposePtr(Ptr p);
 extern Size GetHandleSize(Handle h);
+extern Size GetPtrSize(Ptr p);
 extern void HLock(Handle h);
 extern void HUnlock(Handle h);
 
@@ -66,15 +68,14 @@ OSErr FM_LoadNFNTResource(Handle nfntHandle, NFNTResource **nfntOut) {
         return resNotFound;
     }
 
-    /* Allocate our own copy */
-    NFNTResource *copy = (NFNTResource*)NewPtr(sizeof(NFNTResource));
+    /* Allocate our own copy: the bitmap and tables follow the header */
+    NFNTResource *copy = (NFNTResource*)NewPtr(handleSize);
     if (!copy) {
         HUnlock(nfntHandle);
         return memFullErr;
     }
 
-    /* Copy header */
-    *copy = *nfnt;
+    memcpy(copy, nfnt, handleSize);
 
     FRL_LOG("Loaded NFNT: chars %d-%d, size %dx%d, ascent=%d descent=%d\n",
             copy->firstChar, copy->lastChar,
@@ -86,6 +87,43 @@ OSErr FM_LoadNFNTResource(Handle nfntHandle, NFNTResource **nfntOut) {
     return noErr;
 }
 
+/* ============================================================================
+ * Location Table Parsing
+ * ============================================================================ */
+
+/* Glyph count of the strike's tables: the characters, the missing glyph,
+ * and one entry closing the last */
+static SInt16 FRL_TableEntries(const NFNTResource *nfnt) {
+    return nfnt->lastChar - nfnt->firstChar + 3;
+}
+
+OSErr FM_ParseLocationTable(const NFNTResource *nfnt, SInt16 **locOut) {
+    if (!nfnt || !locOut) {
+        return paramErr;
+    }
+
+    if (nfnt->lastChar < nfnt->firstChar) {
+        return paramErr;
+    }
+    SInt16 entries = FRL_TableEntries(nfnt);
+
+    /* Location table follows the bitmap: rowWords * fRectHeight * 2 bytes */
+    Size bitmapSize = nfnt->rowWords * nfnt->fRectHeight * 2;
+    const UInt8 *locPtr = (const UInt8*)nfnt + sizeof(NFNTResource) + bitmapSize;
+
+    SInt16 *loc = (SInt16*)NewPtr(entries * sizeof(SInt16));
+    if (!loc) {
+        return memFullErr;
+    }
+    memcpy(loc, locPtr, entries * sizeof(SInt16));
+
+    FRL_LOG("Parsed location table: %d entries, strike %d bits wide\n",
+            entries, loc[entries - 1]);
+
+    *locOut = loc;
+    return noErr;
+}
+
 /* ============================================================================
  * Offset/Width Table Parsing
  * ============================================================================ */
@@ -95,35 +133,28 @@ OSErr FM_ParseOWTTable(const NFNTResource *nfnt, OWTEntry **owtOut) {
         return paramErr;
     }
 
-    SInt16 numChars = nfnt->lastChar - nfnt->firstChar + 1;
-    if (numChars <= 0) {
+    if (nfnt->lastChar < nfnt->firstChar) {
         return paramErr;
     }
+    SInt16 entries = FRL_TableEntries(nfnt);
 
-    /* Calculate where OWT starts in the resource */
-    /* After bitmap: rowWords * fRectHeight * 2 bytes */
+    /* OWT follows the bitmap and the location table */
     Size bitmapSize = nfnt->rowWords * nfnt->fRectHeight * 2;
-    const UInt8 *resourceBase = (const UInt8*)nfnt;
-    const UInt8 *owtPtr = resourceBase + sizeof(NFNTResource) + bitmapSize;
+    const UInt8 *owtPtr = (const UInt8*)nfnt + sizeof(NFNTResource) + bitmapSize +
+                          entries * sizeof(SInt16);
 
-    /* Allocate OWT array (+1 for the extra entry that defines last char's width) */
-    /* Check for integer overflow in allocation size */
-    if (numChars > SIZE_MAX / sizeof(OWTEntry) - 1) {
-        return memFullErr;
-    }
-    Size owtSize = (numChars + 1) * sizeof(OWTEntry);
-    OWTEntry *owt = (OWTEntry*)NewPtr(owtSize);
+    OWTEntry *owt = (OWTEntry*)NewPtr(entries * sizeof(OWTEntry));
     if (!owt) {
         return memFullErr;
     }
 
     /* Parse OWT entries */
-    for (SInt16 i = 0; i <= numChars; i++) {
+    for (SInt16 i = 0; i < entries; i++) {
         owt[i].offset = owtPtr[i * 2];
         owt[i].width = owtPtr[i * 2 + 1];
     }
 
-    FRL_LOG("Parsed OWT: %d entries\n", numChars + 1);
+    FRL_LOG("Parsed OWT: %d entries\n", entries);
 
     *owtOut = owt;
     return noErr;
@@ -140,42 +171,102 @@ OSErr FM_BuildWidthTable(const NFNTResource *nfnt, const OWTEntry *owt, UInt8 **
 
     SInt16 numChars = nfnt->lastChar - nfnt->firstChar + 1;
 
-    /* Allocate width table */
-    UInt8 *widths = (UInt8*)NewPtr(256); /* Full ASCII table */
-    if (!widths) {
-        return memFullErr;
+    /* Characters the font lacks draw the missing glyph, at its advance */
+    UInt8 missing = 0;
+    if (!(owt[numChars].offset == 0xFF && owt[numChars].width == 0xFF)) {
+        missing = owt[numChars].width;
     }
 
-    /* Clear table */
-    for (int i = 0; i < 256; i++) {
-        widths[i] = 0;
+    UInt8 *widths = (UInt8*)NewPtr(256);
+    if (!widths) {
+        return memFullErr;
     }
+    memset(widths, missing, 256);
 
-    /* Fill in widths from OWT */
     for (SInt16 i = 0; i < numChars; i++) {
         UInt8 ch = nfnt->firstChar + i;
 
-        /* Calculate pixel width from OWT entries */
-        /* Width is the difference in bit offsets between consecutive chars */
-        UInt16 startBit = (owt[i].offset << 8) | (owt[i].width & 0x0F);
-        UInt16 endBit = (owt[i + 1].offset << 8) | (owt[i + 1].width & 0x0F);
-        UInt8 pixelWidth = (endBit - startBit);
-
-        /* Store in table */
-        widths[ch] = pixelWidth;
+        /* 0xFFFF marks a missing character */
+        if (owt[i].offset == 0xFF && owt[i].width == 0xFF) {
+            continue;
+        }
+        widths[ch] = owt[i].width;
 
-        FRL_LOG("Char %d: width = %d pixels\n", ch, pixelWidth);
+        FRL_LOG("Char %d: width = %d pixels\n", ch, widths[ch]);
     }
 
     *widthsOut = widths;
     return noErr;
 }
 
+/* ============================================================================
+ * Fractional Width Table Building
+ * ============================================================================ */
+
+/* The FOND width table entry for face, or NULL.  Entries are a style word
+ * then one 4.12 em fraction per character, ffFirstChar to ffLastChar,
+ * plus the missing glyph and one spare. */
+static const SInt16 *FRL_FindFamilyWidths(FONDResource *fond, Style face) {
+    if (!fond || fond->ffWTabOff == 0 || fond->ffLastChar < fond->ffFirstChar) {
+        return NULL;
+    }
+
+    Size fondSize = GetPtrSize((Ptr)fond);
+    Size entrySize = (fond->ffLastChar - fond->ffFirstChar + 4) * sizeof(SInt16);
+    const UInt8 *table = (const UInt8*)fond + fond->ffWTabOff;
+    if (fond->ffWTabOff + sizeof(SInt16) > (UInt32)fondSize) {
+        return NULL;
+    }
+
+    SInt16 numEntries = *(const SInt16*)table + 1;
+    const UInt8 *entry = table + sizeof(SInt16);
+    for (SInt16 i = 0; i < numEntries; i++, entry += entrySize) {
+        if (entry + entrySize > (const UInt8*)fond + fondSize) {
+            break;
+        }
+        if (*(const SInt16*)entry == face) {
+            return (const SInt16*)entry + 1;
+        }
+    }
+    return NULL;
+}
+
+OSErr FM_BuildFixedWidthTable(FONDResource *fond, SInt16 size, Style face, Fixed **fixedOut) {
+    if (!fixedOut) {
+        return paramErr;
+    }
+
+    /* Without a family width table the integer widths are exact */
+    *fixedOut = NULL;
+    const SInt16 *family = FRL_FindFamilyWidths(fond, face);
+    if (!family) {
+        return noErr;
+    }
+
+    Fixed *fixed = (Fixed*)NewPtr(256 * sizeof(Fixed));
+    if (!fixed) {
+        return memFullErr;
+    }
+
+    /* 4.12 of an em times the point size is 16.16 of a pixel after << 4;
+     * codes outside the family take the missing glyph's width */
+    SInt16 first = fond->ffFirstChar;
+    SInt16 numChars = fond->ffLastChar - first + 1;
+    for (int ch = 0; ch < 256; ch++) {
+        SInt16 i = (ch >= first && ch < first + numChars) ? ch - first : numChars;
+        fixed[ch] = (Fixed)(((SInt32)(UInt16)family[i] * size) << 4);
+    }
+    FRL_LOG("Fractional widths from FOND %d width table\n", fond->ffFamID);
+
+    *fixedOut = fixed;
+    return noErr;
+}
+
 /* ============================================================================
  * Bitmap Extraction
  * ============================================================================ */
 
-OSErr FM_ExtractBitmap(const NFNTResource *nfnt, UInt8 **bitmapOut, Size *sizeOut) {
+OSErr FM_ExtractBitmap(const NFNTResource *nfnt, Handle *bitmapOut, Size *sizeOut) {
     if (!nfnt || !bitmapOut || !sizeOut) {
         return paramErr;
     }
@@ -183,15 +274,15 @@ OSErr FM_ExtractBitmap(const NFNTResource *nfnt, UInt8 **bitmapOut, Size *sizeOu
     /* Calculate bitmap size */
     Size bitmapSize = nfnt->rowWords * nfnt->fRectHeight * 2;
 
-    /* Allocate buffer */
-    UInt8 *bitmap = (UInt8*)NewPtr(bitmapSize);
+    /* A handle, as QuickDraw reads the strike through *bitmapData */
+    Handle bitmap = NewHandle(bitmapSize);
     if (!bitmap) {
         return memFullErr;
     }
 
     /* Copy bitmap data (starts right after NFNTResource header) */
     const UInt8 *sourcePtr = (const UInt8*)nfnt + sizeof(NFNTResource);
-    memcpy(bitmap, sourcePtr, bitmapSize);
+    memcpy(*bitmap, sourcePtr, bitmapSize);
 
     FRL_LOG("Extracted bitmap: %d bytes (%d words x %d rows)\n",
             bitmapSize, nfnt->rowWords, nfnt->fRectHeight);
@@ -219,15 +310,14 @@ OSErr FM_LoadFONDResource(Handle fondHandle, FONDResource **fondOut) {
     HLock(fondHandle);
     FONDResource *fond = (FONDResource*)*fondHandle;
 
-    /* Allocate our own copy of header */
-    FONDResource *copy = (FONDResource*)NewPtr(sizeof(FONDResource));
+    /* Allocate our own copy: the association table follows the header */
+    FONDResource *copy = (FONDResource*)NewPtr(handleSize);
     if (!copy) {
         HUnlock(fondHandle);
         return memFullErr;
     }
 
-    /* Copy header */
-    *copy = *fond;
+    memcpy(copy, fond, handleSize);
 
     FRL_LOG("Loaded FOND: family=%d, chars %d-%d, %d associations\n",
             copy->ffFamID, copy->ffFirstChar, copy->ffLastChar,
@@ -257,8 +347,8 @@ SInt16 FM_FindBestMatch(const FONDResource *fond, SInt16 size, Style face) {
     for (SInt16 i = 0; i < fond->ffNumEntries; i++) {
         const FontAssocEntry *entry = &entries[i];
 
-        /* Check style match */
-        if ((entry->fontStyle & face) == face) {
+        /* Check style match; size 0 is an outline font, not a strike */
+        if (entry->fontSize != 0 && (entry->fontStyle & face) == face) {
             SInt16 sizeDiff = fm_abs(entry->fontSize - size);
 
             /* Exact match? */
@@ -283,6 +373,38 @@ SInt16 FM_FindBestMatch(const FONDResource *fond, SInt16 size, Style face) {
     return bestID;
 }
 
+/*
+ * FM_FindOutlineMatch - 'sfnt' resource ID to render size from: the
+ * family's outline entry for face, unless a strike of exactly this size
+ * exists and outlines are not preferred.  -1 if none.
+ */
+SInt16 FM_FindOutlineMatch(const FONDResource *fond, SInt16 size, Style face,
+                           Boolean outlinePreferred) {
+    if (!fond) {
+        return -1;
+    }
+
+    const FontAssocEntry *entries = (const FontAssocEntry*)((const UInt8*)fond + sizeof(FONDResource));
+    SInt16 outlineID = -1;
+
+    for (SInt16 i = 0; i < fond->ffNumEntries; i++) {
+        const FontAssocEntry *entry = &entries[i];
+        if ((entry->fontStyle & face) != face) {
+            continue;
+        }
+        if (entry->fontSize == 0) {
+            if (outlineID == -1) outlineID = entry->fontID;
+        } else if (entry->fontSize == size && !outlinePreferred) {
+            return -1;
+        }
+    }
+
+    if (outlineID != -1) {
+        FRL_LOG("Found outline: id=%d for size %d\n", outlineID, size);
+    }
+    return outlineID;
+}
+
 OSErr FM_GetFontAssociation(const FONDResource *fond, SInt16 index, const FontAssocEntry **entryOut) {
     if (!fond || !entryOut || index < 0 || index >= fond->ffNumEntries) {
         return paramErr;
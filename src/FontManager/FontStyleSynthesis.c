@@ -1,16 +1,21 @@
 /*
  * FontStyleSynthesis.c - Font Style Synthesis Implementation
  *
- * Generates bold, italic, underline, shadow, outline styles
- * from base bitmap fonts per System 7.1 specifications
+ * Generates bold, italic, shadow and outline strikes from base bitmap
+ * strikes per System 7.1 specifications.  A styled strike is built once,
+ * glyph by glyph, and cached like any other, so styled text draws in a
+ * single pass.  Underline is a line drawn by DrawString, not a strike.
  */
 
 #include "FontManager/FontManager.h"
 #include "FontManager/FontTypes.h"
 #include "FontManager/FontStyleSynthesis.h"
 #include "FontManager/FontInternal.h"
+#include "FontManager/FontCache.h"
+#include "MemoryMgr/MemoryManager.h"
 #include "QuickDraw/QuickDraw.h"
 #include "SystemTypes.h"
+#include "chicago_font.h"
 #include <string.h>
 #include "FontManager/FontLogging.h"
 
@@ -31,12 +36,6 @@
 #define FSS_LOG(...)
 #endif
 
-/* External dependencies */
-extern GrafPtr g_currentPort;
-
-/* Internal Font Manager drawing function */
-extern void FM_DrawChicagoCharInternal(short x, short y, char ch, uint32_t color);
-
 /* Style synthesis parameters (per System 7.1) */
 #define BOLD_OFFSET         1    /* Horizontal emboldening pixels */
 #define ITALIC_SHEAR_RATIO  4    /* 1:4 shear ratio (~14 degrees) */
@@ -49,23 +48,9 @@ extern void FM_DrawChicagoCharInternal(short x, short y, char ch, uint32_t color
 #define EXTEND_FACTOR       1.1  /* 110% horizontal spacing */
 
 /* ============================================================================
- * Bold Synthesis
+ * Style Widths
  * ============================================================================ */
 
-/*
- * FM_SynthesizeBold - Create bold version by horizontal emboldening
- * Algorithm: Draw character twice, offset by BOLD_OFFSET pixels
- */
-static void FM_SynthesizeBold(short x, short y, char ch, uint32_t color) {
-    FSS_LOG("SynthesizeBold: char='%c' at (%d,%d)\n", ch, x, y);
-
-    /* Draw original character */
-    FM_DrawChicagoCharInternal(x, y, ch, color);
-
-    /* Draw offset copy for emboldening */
-    FM_DrawChicagoCharInternal(x + BOLD_OFFSET, y, ch, color);
-}
-
 /*
  * FM_GetBoldWidth - Calculate width of bold character
  * Bold adds BOLD_OFFSET pixels to normal width
@@ -74,35 +59,6 @@ short FM_GetBoldWidth(short normalWidth) {
     return normalWidth + BOLD_OFFSET;
 }
 
-/* ============================================================================
- * Italic Synthesis
- * ============================================================================ */
-
-/*
- * FM_SynthesizeItalic - Create italic by shearing transform
- * Algorithm: Shift each scanline proportionally (1:4 ratio)
- * Draws the character multiple times with progressively offset positions
- * to simulate a shear/slant effect (~14 degrees)
- */
-static void FM_SynthesizeItalic(short x, short y, char ch, uint32_t color) {
-    FSS_LOG("SynthesizeItalic: char='%c' at (%d,%d)\n", ch, x, y);
-
-    /* Draw character with shear effect using multiple offset draws
-     * This creates an italic appearance through horizontal offset
-     * Top scanlines shifted more than bottom for 1:4 shear ratio
-     */
-    short shearAmount = 1;  /* ~1-2 pixels maximum shear for typical char height */
-
-    /* Draw base character */
-    FM_DrawChicagoCharInternal(x, y, ch, color);
-
-    /* Draw with slight right offset at top to create italic effect */
-    FM_DrawChicagoCharInternal(x + shearAmount, y - 1, ch, color);
-
-    /* Optional: add more shear for stronger italic effect on taller fonts */
-    /* FM_DrawChicagoCharInternal(x + shearAmount/2, y - 2, ch, color); */
-}
-
 /*
  * FM_GetItalicWidth - Calculate width of italic character
  * Italic adds shear amount to normal width
@@ -112,47 +68,6 @@ short FM_GetItalicWidth(short normalWidth, short height) {
     return normalWidth + (height / ITALIC_SHEAR_RATIO);
 }
 
-/* ============================================================================
- * Underline Synthesis
- * ============================================================================ */
-
-/*
- * FM_DrawUnderline - Draw underline for text run
- * Position: baseline + descent/2 (per System 7.1)
- */
-static void FM_DrawUnderline(short x, short y, short width, uint32_t color) {
-    short underlineY = y + UNDERLINE_OFFSET;
-
-    FSS_LOG("DrawUnderline: from (%d,%d) width=%d\n", x, underlineY, width);
-
-    /* Draw horizontal line using QuickDraw */
-    extern void MoveTo(SInt16 h, SInt16 v);
-    extern void LineTo(SInt16 h, SInt16 v);
-
-    if (width > 0) {
-        MoveTo(x, underlineY);
-        LineTo(x + width - 1, underlineY);
-    }
-}
-
-/* ============================================================================
- * Shadow Synthesis
- * ============================================================================ */
-
-/*
- * FM_SynthesizeShadow - Create shadow effect
- * Algorithm: Draw character, then draw offset shadow behind
- */
-static void FM_SynthesizeShadow(short x, short y, char ch, uint32_t foreColor, uint32_t shadowColor) {
-    FSS_LOG("SynthesizeShadow: char='%c' at (%d,%d)\n", ch, x, y);
-
-    /* Draw shadow first (offset and in shadow color) */
-    FM_DrawChicagoCharInternal(x + SHADOW_OFFSET_X, y + SHADOW_OFFSET_Y, ch, shadowColor);
-
-    /* Draw main character on top */
-    FM_DrawChicagoCharInternal(x, y, ch, foreColor);
-}
-
 /*
  * FM_GetShadowWidth - Calculate width with shadow
  * Shadow adds offset to normal width
@@ -161,30 +76,6 @@ short FM_GetShadowWidth(short normalWidth) {
     return normalWidth + SHADOW_OFFSET_X;
 }
 
-/* ============================================================================
- * Outline Synthesis
- * ============================================================================ */
-
-/*
- * FM_SynthesizeOutline - Create outline effect
- * Algorithm: Draw character stroked, then fill center
- */
-static void FM_SynthesizeOutline(short x, short y, char ch, uint32_t outlineColor, uint32_t fillColor) {
-    FSS_LOG("SynthesizeOutline: char='%c' at (%d,%d)\n", ch, x, y);
-
-    /* Draw outline in 8 directions */
-    for (short dx = -OUTLINE_THICKNESS; dx <= OUTLINE_THICKNESS; dx++) {
-        for (short dy = -OUTLINE_THICKNESS; dy <= OUTLINE_THICKNESS; dy++) {
-            if (dx != 0 || dy != 0) {
-                FM_DrawChicagoCharInternal(x + dx, y + dy, ch, outlineColor);
-            }
-        }
-    }
-
-    /* Draw fill in center */
-    FM_DrawChicagoCharInternal(x, y, ch, fillColor);
-}
-
 /*
  * FM_GetOutlineWidth - Calculate width with outline
  * Outline adds thickness on both sides
@@ -193,10 +84,6 @@ short FM_GetOutlineWidth(short normalWidth) {
     return normalWidth + (OUTLINE_THICKNESS * 2);
 }
 
-/* ============================================================================
- * Condense/Extend Synthesis
- * ============================================================================ */
-
 /*
  * FM_GetCondensedWidth - Calculate condensed width
  * Condense reduces spacing by 10%
@@ -213,78 +100,17 @@ short FM_GetExtendedWidth(short normalWidth) {
     return (short)(normalWidth * EXTEND_FACTOR);
 }
 
-/* ============================================================================
- * Combined Style Synthesis
- * ============================================================================ */
-
 /*
- * FM_SynthesizeStyledChar - Apply multiple styles to character
- * Handles combination of bold, italic, underline, etc.
+ * FM_StyleAdvance - Advance of a glyph of the given plain advance once
+ * face is applied; height is the strike's for the italic shear
  */
-static void FM_SynthesizeStyledChar(short x, short y, char ch, Style face, uint32_t color) {
-    Boolean hasBold = (face & bold) != 0;
-    Boolean hasItalic = (face & italic) != 0;
-    Boolean hasUnderline = (face & underline) != 0;
-    Boolean hasShadow = (face & shadow) != 0;
-    Boolean hasOutline = (face & outline) != 0;
-    Boolean hasCondense = (face & condense) != 0;
-    Boolean hasExtend = (face & extend) != 0;
-
-    FSS_LOG("SynthesizeStyledChar: char='%c' face=0x%02X\n", ch, face);
-
-    /* Handle outline first (affects everything else) */
-    if (hasOutline) {
-        uint32_t fillColor = hasShadow ? 0xFFFFFFFF : color; /* White fill for shadow+outline */
-        FM_SynthesizeOutline(x, y, ch, color, fillColor);
-        return; /* Outline handles its own rendering */
-    }
-
-    /* Handle shadow */
-    if (hasShadow) {
-        uint32_t shadowColor = 0xFF808080; /* Gray shadow */
-        FM_SynthesizeShadow(x, y, ch, color, shadowColor);
-        return; /* Shadow handles its own rendering */
-    }
-
-    /* Handle bold */
-    if (hasBold && hasItalic) {
-        /* Bold italic - combine both effects */
-        FM_SynthesizeBold(x, y, ch, color);
-        /* Would apply italic shear here */
-    } else if (hasBold) {
-        FM_SynthesizeBold(x, y, ch, color);
-    } else if (hasItalic) {
-        FM_SynthesizeItalic(x, y, ch, color);
-    } else {
-        /* Plain character */
-        FM_DrawChicagoCharInternal(x, y, ch, color);
-    }
-
-    /* Add underline if needed (drawn after character) */
-    if (hasUnderline) {
-        short width = CharWidth(ch);
-        if (hasBold) width = FM_GetBoldWidth(width);
-        if (hasCondense) width = FM_GetCondensedWidth(width);
-        if (hasExtend) width = FM_GetExtendedWidth(width);
-
-        FM_DrawUnderline(x, y, width, color);
-    }
-}
-
-/*
- * FM_GetStyledCharWidth - Calculate width with all styles applied
- */
-short FM_GetStyledCharWidth(char ch, Style face) {
-    short width = CharWidth(ch);
-
-    /* Apply style modifiers */
+short FM_StyleAdvance(short width, Style face, short height) {
     if (face & bold) {
         width = FM_GetBoldWidth(width);
     }
 
     if (face & italic) {
-        /* Assume standard font height for shear calculation */
-        width = FM_GetItalicWidth(width, 15); /* Chicago is 15 pixels tall */
+        width = FM_GetItalicWidth(width, height);
     }
 
     if (face & shadow) {
@@ -307,29 +133,270 @@ short FM_GetStyledCharWidth(char ch, Style face) {
 }
 
 /*
- * FM_DrawStyledString - Draw complete string with styles
+ * FM_GetStyledCharWidth - Width of a built-in Chicago character with all
+ * styles applied
  */
-static void FM_DrawStyledString(ConstStr255Param s, Style face) {
-    if (!s || s[0] == 0) return;
+short FM_GetStyledCharWidth(char ch, Style face) {
+    if (ch < 32 || ch > 126) {
+        return 0;
+    }
 
-    Point pen = g_currentPort->pnLoc;
-    uint32_t color = 0xFF000000; /* Black */
+    ChicagoCharInfo info = chicago_ascii[ch - 32];
+    short width = info.bit_width + 2;
+    if (ch == ' ') width += 3;
 
-    FSS_LOG("DrawStyledString: \"%.*s\" with face=0x%02X\n", s[0], &s[1], face);
+    return FM_StyleAdvance(width, face, CHICAGO_HEIGHT);
+}
 
-    /* Draw each character with styles */
-    for (int i = 1; i <= s[0]; i++) {
-        char ch = s[i];
+/* ============================================================================
+ * Strike Synthesis
+ * ============================================================================ */
+
+/* Bitmap of the strike being styled */
+typedef struct {
+    const UInt8* bits;
+    UInt32  rowBytes;
+    short   height;
+} FSSSource;
+
+/* One glyph of it: bits [start, start + width) of each row, drawn lead
+ * pixels right of the pen */
+typedef struct {
+    short   start;
+    short   width;
+    short   lead;
+} FSSGlyph;
+
+static Boolean FSS_GetSource(const FontStrike* base, FSSSource* src) {
+    if (base->bitmapData && *base->bitmapData && base->locTable) {
+        src->bits = (const UInt8*)*base->bitmapData;
+        src->rowBytes = (UInt32)base->rowWords * 2;
+        src->height = base->fRectHeight;
+        return TRUE;
+    }
+
+    /* The built-in Chicago 12 keeps its glyphs in chicago_font.h */
+    if (base->familyID == chicagoFont && base->size == 12 && !base->bitmapData) {
+        src->bits = chicago_bitmap;
+        src->rowBytes = CHICAGO_ROW_BYTES;
+        src->height = CHICAGO_HEIGHT;
+        return TRUE;
+    }
+
+    return FALSE;
+}
+
+/* Glyph i of base: characters from firstChar, then the missing glyph */
+static void FSS_GetGlyph(const FontStrike* base, short i, FSSGlyph* glyph) {
+    short ch = base->firstChar + i;
+
+    if (base->locTable) {
+        glyph->start = base->locTable[i];
+        glyph->width = base->locTable[i + 1] - base->locTable[i];
+        glyph->lead = 0;
+    } else if (ch <= base->lastChar) {
+        ChicagoCharInfo info = chicago_ascii[ch - 32];
+        glyph->start = info.bit_start;
+        glyph->width = info.bit_width;
+        glyph->lead = info.left_offset > 0 ? info.left_offset : 0;
+    } else {
+        /* The built-in Chicago has no missing glyph image */
+        glyph->start = 0;
+        glyph->width = 0;
+        glyph->lead = 0;
+    }
+}
+
+static inline Boolean FSS_GetBit(const UInt8* row, long bit) {
+    return (row[bit >> 3] >> (7 - (bit & 7))) & 1;
+}
+
+static inline void FSS_SetBit(UInt8* row, long bit) {
+    row[bit >> 3] |= (UInt8)(0x80 >> (bit & 7));
+}
 
-        /* Draw styled character */
-        FM_SynthesizeStyledChar(pen.h, pen.v, ch, face, color);
+/*
+ * FM_SynthesizeStrike - Build the strike of base in face
+ *
+ * Each glyph is rendered into a scratch cell of one byte per pixel:
+ * bold ORs in a copy BOLD_OFFSET pixels right, italic shifts each row
+ * right by its height above the bottom over ITALIC_SHEAR_RATIO, outline
+ * keeps the one-pixel ring around the ink and shadow adds that ring's
+ * copy SHADOW_OFFSET down and right.  Outline and shadow leave a pixel
+ * of margin above and left of the ink, which moves the ascent up.
+ *
+ * Returns a NewPtr'd strike for FM_CacheStrike, or NULL.
+ */
+FontStrike* FM_SynthesizeStrike(const FontStrike* base, Style face) {
+    FSSSource src;
+
+    face &= (bold | italic | outline | shadow | condense | extend);
+    if (!base || face == normal || !base->widthTable || !FSS_GetSource(base, &src)) {
+        return NULL;
+    }
+
+    short h = src.height;
+    short embolden = (face & bold) ? BOLD_OFFSET : 0;
+    short slant = (face & italic) ? (h - 1) / ITALIC_SHEAR_RATIO : 0;
+    short pad = (face & (outline | shadow)) ? OUTLINE_THICKNESS : 0;
+    short dx = (face & shadow) ? SHADOW_OFFSET_X : 0;
+    short dy = (face & shadow) ? SHADOW_OFFSET_Y : 0;
+    short cellH = h + 2 * pad + dy;
+    short numChars = base->lastChar - base->firstChar + 1;
+
+    FSS_LOG("SynthesizeStrike: %d/%d face 0x%02X from face 0x%02X\n",
+            base->familyID, base->size, face, base->face);
+
+    /* Lay the glyphs out end to end: characters, missing glyph, end */
+    short* loc = (short*)NewPtr((numChars + 2) * sizeof(short));
+    UInt8* widths = (UInt8*)NewPtrClear(256);
+    Fixed* fixedWidths = base->fixedWidths ? (Fixed*)NewPtr(256 * sizeof(Fixed)) : NULL;
+    if (!loc || !widths || (base->fixedWidths && !fixedWidths)) {
+        if (loc) DisposePtr((Ptr)loc);
+        if (widths) DisposePtr((Ptr)widths);
+        if (fixedWidths) DisposePtr((Ptr)fixedWidths);
+        return NULL;
+    }
+
+    /* Advances of every code, the missing glyph's included; fractional
+     * widths keep the base's fraction */
+    short widMax = 0;
+    for (int ch = 0; ch < 256; ch++) {
+        short advance = base->widthTable[ch];
+        if (advance > 0) {
+            advance = FM_StyleAdvance(advance, face, h);
+            if (advance > 255) advance = 255;
+        }
+        widths[ch] = (UInt8)advance;
+        if (advance > widMax) widMax = advance;
+
+        if (fixedWidths) {
+            fixedWidths[ch] = base->fixedWidths[ch] + ((Fixed)(advance - base->widthTable[ch]) << 16);
+        }
+    }
+
+    /* Cells for the characters and the missing glyph after them */
+    long bit = 0;
+    short cellMax = 0;
+    for (short i = 0; i <= numChars; i++) {
+        FSSGlyph glyph;
+        FSS_GetGlyph(base, i, &glyph);
+
+        short cellW = 0;
+        if (glyph.width > 0) {
+            cellW = glyph.lead + glyph.width + embolden + slant + 2 * pad + dx;
+        }
+
+        loc[i] = (short)bit;
+        bit += cellW;
+        if (cellW > cellMax) cellMax = cellW;
+    }
+    loc[numChars + 1] = (short)bit;
+
+    if (bit > 0x7FFF) {
+        FSS_LOG("SynthesizeStrike: strike too wide (%ld bits)\n", bit);
+        DisposePtr((Ptr)loc);
+        DisposePtr((Ptr)widths);
+        if (fixedWidths) DisposePtr((Ptr)fixedWidths);
+        return NULL;
+    }
 
-        /* Advance pen by styled width */
-        pen.h += FM_GetStyledCharWidth(ch, face);
+    short rowWords = (short)((bit + 15) / 16);
+    Handle bitmap = NewHandleClear((Size)rowWords * 2 * cellH);
+    UInt8* ink = (UInt8*)NewPtr((Size)cellMax * cellH + 1);
+    UInt8* ring = (UInt8*)NewPtr((Size)cellMax * cellH + 1);
+    FontStrike* strike = (FontStrike*)NewPtrClear(sizeof(FontStrike));
+
+    /* Those allocations may have moved or purged the base's bitmap handle:
+     * take its address again now that none are left */
+    if (!bitmap || !ink || !ring || !strike || !FSS_GetSource(base, &src)) {
+        if (bitmap) DisposeHandle(bitmap);
+        if (ink) DisposePtr((Ptr)ink);
+        if (ring) DisposePtr((Ptr)ring);
+        if (strike) DisposePtr((Ptr)strike);
+        DisposePtr((Ptr)loc);
+        DisposePtr((Ptr)widths);
+        if (fixedWidths) DisposePtr((Ptr)fixedWidths);
+        return NULL;
+    }
+
+    /* No allocation from here on, so neither src.bits nor dst can move */
+    UInt8* dst = (UInt8*)*bitmap;
+    for (short i = 0; i <= numChars; i++) {
+        short cellW = loc[i + 1] - loc[i];
+        if (cellW == 0) continue;
+
+        FSSGlyph glyph;
+        FSS_GetGlyph(base, i, &glyph);
+
+        /* Plain, bold and italic ink */
+        memset(ink, 0, (size_t)cellW * cellH);
+        for (short row = 0; row < h; row++) {
+            const UInt8* srcRow = src.bits + row * src.rowBytes;
+            UInt8* cellRow = ink + (row + pad) * cellW;
+            short x0 = pad + glyph.lead + (slant ? (h - 1 - row) / ITALIC_SHEAR_RATIO : 0);
+
+            for (short col = 0; col < glyph.width; col++) {
+                if (!FSS_GetBit(srcRow, glyph.start + col)) continue;
+                for (short b = 0; b <= embolden; b++) {
+                    cellRow[x0 + col + b] = 1;
+                }
+            }
+        }
+
+        /* Outline and shadow: the ring around the ink, less the ink */
+        const UInt8* cell = ink;
+        if (pad) {
+            memset(ring, 0, (size_t)cellW * cellH);
+            for (short y = 0; y < cellH; y++) {
+                for (short x = 0; x < cellW; x++) {
+                    if (!ink[y * cellW + x]) continue;
+                    for (short ny = y - pad; ny <= y + pad + dy; ny++) {
+                        for (short nx = x - pad; nx <= x + pad + dx; nx++) {
+                            if (ny >= 0 && ny < cellH && nx >= 0 && nx < cellW) {
+                                ring[ny * cellW + nx] = 1;
+                            }
+                        }
+                    }
+                }
+            }
+            for (long p = 0; p < (long)cellW * cellH; p++) {
+                if (ink[p]) ring[p] = 0;
+            }
+            cell = ring;
+        }
+
+        for (short y = 0; y < cellH; y++) {
+            UInt8* dstRow = dst + (long)y * rowWords * 2;
+            for (short x = 0; x < cellW; x++) {
+                if (cell[y * cellW + x]) FSS_SetBit(dstRow, loc[i] + x);
+            }
+        }
     }
 
-    /* Update pen location */
-    g_currentPort->pnLoc = pen;
+    DisposePtr((Ptr)ink);
+    DisposePtr((Ptr)ring);
+
+    strike->familyID = base->familyID;
+    strike->size = base->size;
+    strike->face = face;
+    strike->synthetic = TRUE;
+    strike->ascent = base->ascent + pad;
+    strike->descent = base->descent + pad + dy;
+    strike->leading = base->leading;
+    strike->widMax = widMax;
+    strike->firstChar = base->firstChar;
+    strike->lastChar = base->lastChar;
+    strike->rowWords = rowWords;
+    strike->fRectHeight = cellH;
+    strike->bitmapData = bitmap;
+    strike->locTable = loc;
+    strike->widthTable = widths;
+    strike->fixedWidths = fixedWidths;
+    strike->device = base->device;
+
+    FSS_LOG("SynthesizeStrike: %d glyphs, %d x %d bitmap\n", numChars, rowWords * 16, cellH);
+    return strike;
 }
 
 /*
@@ -7,6 +7,9 @@
 #include "SystemTypes.h"
 #include "Gestalt/Gestalt.h"
 #include "Gestalt/GestaltPriv.h"
+#ifdef MEMORY_TELEMETRY
+#include "MemoryMgr/MemoryTelemetry.h"
+#endif
 
 #if defined(__powerpc__) || defined(__powerpc64__)
 #include "Platform/include/boot.h"
@@ -37,6 +40,9 @@ static const OSType kSel_init = FOURCC('i','n','i','t');
 static const OSType kSel_evnt = FOURCC('e','v','n','t');
 static const OSType kSel_pcop = FOURCC('p','c','o','p');  /* Process coop */
 static const OSType kSel_mmap = FOURCC('m','m','a','p');
+#ifdef MEMORY_TELEMETRY
+static const OSType kSel_mtel = FOURCC('m','t','e','l');  /* Memory Manager telemetry */
+#endif
 
 /* Global init bits for tracking subsystem initialization */
 static UInt32 gGestaltInitBits = 0;
@@ -281,6 +287,16 @@ static OSErr gestalt_pcop(long *response) {
     return noErr;
 }
 
+#ifdef MEMORY_TELEMETRY
+/* Built-in selector: Memory Manager telemetry snapshot (live, not copied) */
+static OSErr gestalt_mtel(long *response) {
+    if (!response) return paramErr;
+
+    *response = (long)(uintptr_t)MemTelemetry_GetSnapshot();
+    return noErr;
+}
+#endif
+
 /* Register all built-in selectors */
 void Gestalt_Register_Builtins(void) {
     OSErr err;
@@ -321,6 +337,11 @@ void Gestalt_Register_Builtins(void) {
     /* Process Manager cooperative features */
     err = NewGestalt(kSel_pcop, gestalt_pcop);
 
+#ifdef MEMORY_TELEMETRY
+    /* Memory Manager telemetry - only when compiled in */
+    err = NewGestalt(kSel_mtel, gestalt_mtel);
+#endif
+
     /* Unused variable warning suppression */
     (void)err;
 }
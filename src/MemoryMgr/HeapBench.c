@@ -0,0 +1,174 @@
+/*
+ * HeapBench.c - Memory Manager benchmarks
+ *
+ * Boot-time timing runs for allocator hot paths, reported over serial.
+ * Activated with HEAP_BENCH=1 compile flag; called from main.c once the
+ * Toolbox (and TextEdit) is up.
+ */
+
+#include "SystemTypes.h"
+#include "System71StdLib.h"
+#include "MemoryMgr/MemoryManager.h"
+#include "MemoryMgr/MemoryLogging.h"
+#include "TimeManager/TimeBase.h"
+#include "TextEdit/TextEdit.h"
+
+#ifdef HEAP_BENCH
+
+#define HEAP_BENCH_LOG(fmt, ...) serial_logf(kLogModuleMemory, kLogLevelInfo, "[HEAP BENCH] " fmt, ##__VA_ARGS__)
+
+#define BENCH_APPEND_BYTES   (1024u * 1024u)
+
+#ifndef MEM_DEBUG_LEVEL
+#define MEM_DEBUG_LEVEL 1
+#endif
+
+/*
+ * One byte at a time growth to 1MB, the pattern TE_GrowTextBuffer,
+ * PtrAndHand and region building produce.  Counts how often the handle's
+ * data actually moved.
+ */
+static void bench_append_handle(void) {
+    Handle h = NewHandle(0);
+    if (!h) {
+        HEAP_BENCH_LOG("append: NewHandle failed\n");
+        return;
+    }
+
+    u32 moves = 0;
+    Ptr last = *h;
+    UInt32 start = MicrosecondsNow();
+
+    for (u32 i = 0; i < BENCH_APPEND_BYTES; i++) {
+        if (!SetHandleSize(h, i + 1)) {
+            HEAP_BENCH_LOG("append: SetHandleSize failed at %u bytes\n", i + 1);
+            break;
+        }
+        if (*h != last) {
+            moves++;
+            last = *h;
+        }
+        (*h)[i] = (char)('a' + (i % 26));
+    }
+
+    UInt32 elapsed = MicrosecondsNow() - start;
+    HEAP_BENCH_LOG("append 1MB byte-at-a-time: %u us, %u moves, final size %u\n",
+                   elapsed, moves, GetHandleSize(h));
+
+    /* Trim back down: should release the tail without moving */
+    Ptr before = *h;
+    start = MicrosecondsNow();
+    SetHandleSize(h, 4096);
+    elapsed = MicrosecondsNow() - start;
+    HEAP_BENCH_LOG("shrink 1MB -> 4KB: %u us, moved=%d\n", elapsed, (*h != before) ? 1 : 0);
+
+    DisposeHandle(h);
+}
+
+/* PtrAndHand appends of 16-byte records */
+static void bench_ptr_and_hand(void) {
+    static const char rec[16] = "0123456789abcdef";
+    Handle h = NewHandle(0);
+    if (!h) return;
+
+    UInt32 start = MicrosecondsNow();
+    u32 n = 0;
+    for (; n < 65536u; n++) {
+        if (PtrAndHand(rec, h, sizeof(rec)) != noErr) break;
+    }
+    UInt32 elapsed = MicrosecondsNow() - start;
+    HEAP_BENCH_LOG("PtrAndHand 64K x 16B: %u us, %u records, size %u\n",
+                   elapsed, n, GetHandleSize(h));
+    DisposeHandle(h);
+}
+
+/*
+ * TEInsert one character at a time.  TextEdit caps a record at teMaxLength
+ * (32767) characters, so the 1MB run is spread over as many records as it
+ * takes; each record's text handle grows through TE_GrowTextBuffer.
+ */
+static void bench_teinsert(void) {
+    Rect r = {0, 0, 400, 600};
+    u32 total = 0;
+    u32 records = 0;
+    UInt32 start = MicrosecondsNow();
+
+    while (total < BENCH_APPEND_BYTES) {
+        TEHandle te = TENew(&r, &r);
+        if (!te) {
+            HEAP_BENCH_LOG("TEInsert: TENew failed\n");
+            break;
+        }
+        records++;
+        for (u32 i = 0; i < teMaxLength && total < BENCH_APPEND_BYTES; i++, total++) {
+            char c = (i % 64 == 63) ? '\r' : (char)('a' + (i % 26));
+            TEInsert(&c, 1, te);
+        }
+        TEDispose(te);
+    }
+
+    UInt32 elapsed = MicrosecondsNow() - start;
+    HEAP_BENCH_LOG("TEInsert %u chars one at a time (%u records): %u us\n",
+                   total, records, elapsed);
+}
+
+/*
+ * Mixed NewPtr/NewHandle/Dispose churn over a small working set: the path
+ * the heap debug level (HEAP_DEBUG_LEVEL) taxes hardest.  Run the same
+ * build at each level to compare against the zero-check release path.
+ */
+#define CHURN_SLOTS   64u
+#define CHURN_OPS     100000u
+
+static void bench_churn(void) {
+    static void* ptrs[CHURN_SLOTS];
+    static Handle handles[CHURN_SLOTS];
+    u32 seed = 0x2545F491u;
+    u32 failures = 0;
+
+    memset(ptrs, 0, sizeof(ptrs));
+    memset(handles, 0, sizeof(handles));
+
+    UInt32 start = MicrosecondsNow();
+    for (u32 i = 0; i < CHURN_OPS; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        u32 slot = (seed >> 8) % CHURN_SLOTS;
+        u32 size = 16 + ((seed >> 16) & 0x3FF);
+
+        if (seed & 0x80000000u) {
+            if (ptrs[slot]) {
+                DisposePtr(ptrs[slot]);
+                ptrs[slot] = NULL;
+            } else if (!(ptrs[slot] = NewPtr(size))) {
+                failures++;
+            }
+        } else {
+            if (handles[slot]) {
+                DisposeHandle(handles[slot]);
+                handles[slot] = NULL;
+            } else if (!(handles[slot] = NewHandle(size))) {
+                failures++;
+            }
+        }
+    }
+    UInt32 elapsed = MicrosecondsNow() - start;
+
+    for (u32 i = 0; i < CHURN_SLOTS; i++) {
+        if (ptrs[i]) DisposePtr(ptrs[i]);
+        if (handles[i]) DisposeHandle(handles[i]);
+    }
+
+    HEAP_BENCH_LOG("churn %u ops (debug level %d): %u us, %u failures\n",
+                   CHURN_OPS, MEM_DEBUG_LEVEL, elapsed, failures);
+}
+
+void HeapBench_Run(void) {
+    HEAP_BENCH_LOG("starting (FreeMem=%u MaxMem=%u)\n", FreeMem(), MaxMem());
+    bench_churn();
+    bench_append_handle();
+    bench_ptr_and_hand();
+    bench_teinsert();
+    HEAP_BENCH_LOG("done (FreeMem=%u MaxMem=%u)\n", FreeMem(), MaxMem());
+}
+
+#endif /* HEAP_BENCH */
@@ -7,6 +7,7 @@
 #include <string.h>
 #include <stdint.h>
 #include "MemoryMgr/MemoryLogging.h"
+#include "MemoryMgr/MemoryTelemetry.h"
 #include "CPU/M68KInterp.h"
 #include "CPU/LowMemGlobals.h"
 #include "System71StdLib.h"
@@ -21,13 +22,31 @@
 #define MIN_BLOCK_SIZE_RAW (BLKHDR_SZ + (u32)sizeof(FreeNode))
 #define MIN_BLOCK_SIZE ((MIN_BLOCK_SIZE_RAW + (ALIGN-1)) & ~(ALIGN-1))
 
+/* Unallocated master pointer.  NULL means allocated but purged, so a purged
+ * handle keeps its slot until DisposeHandle. */
+#define MP_FREE_SLOT ((void*)-1)
+
 /* Heap validation magic numbers */
 #define BLOCK_MAGIC_ALLOCATED  0xA110C8ED  /* "ALLOCATED" */
 #define BLOCK_MAGIC_FREE       0xFEEEFEEE  /* "FREE" */
 #define FREENODE_MAGIC         0xF4EE1157  /* "FREELIST" */
 
-/* Optional debug canary to detect Ptr buffer overruns */
-#define MEM_DEBUG_CANARY 1
+/*
+ * Heap debug level, chosen with HEAP_DEBUG_LEVEL in the config/ makefiles:
+ *   0 - off: no validation at all (release)
+ *   1 - cheap: O(1) header checks on the block being freed or split
+ *   2 - full: tail canaries on Ptr blocks, header checks on every free node
+ *       find_fit visits, free-list walks around each dispose, dispose
+ *       tracing and a CheckHeap every HEAP_CHECK_INTERVAL operations
+ */
+#ifndef MEM_DEBUG_LEVEL
+#define MEM_DEBUG_LEVEL 1
+#endif
+#define MEM_DEBUG_CHEAP  (MEM_DEBUG_LEVEL >= 1)
+#define MEM_DEBUG_FULL   (MEM_DEBUG_LEVEL >= 2)
+
+/* Debug canary to detect Ptr buffer overruns */
+#define MEM_DEBUG_CANARY MEM_DEBUG_FULL
 #if MEM_DEBUG_CANARY
 #define CANARY_SIZE 8u
 #define CANARY_BYTE 0xABu
@@ -90,15 +109,18 @@ static void log_suspect_block(const char* tag, BlockHeader* b, u32 need, u32 rem
 /* Global zones */
 static ZoneInfo gSystemZone;       /* System heap */
 static ZoneInfo gAppZone;          /* Application heap */
+static ZoneInfo gTempZone;         /* Temporary memory (TempNewHandle) */
 static ZoneInfo* gCurrentZone = NULL;
 
 /* Static memory for zones - 8MB total */
 static u8 gSystemHeap[2 * 1024 * 1024];    /* 2MB system heap */
 static u8 gAppHeap[6 * 1024 * 1024];       /* 6MB app heap */
+static u8 gTempHeap[512 * 1024];           /* 512KB temporary memory */
 
 /* Master pointer tables */
 static void* gSystemMasters[1024];         /* 1024 system handles */
 static void* gAppMasters[4096];            /* 4096 app handles */
+static void* gTempMasters[512];            /* 512 temp handles */
 
 /* Debug tracking for problematic blocks */
 static BlockHeader* g_debug_suspect_block = NULL;
@@ -122,6 +144,7 @@ static inline bool is_valid_freenode(ZoneInfo* z, FreeNode* n) {
     return (ptr >= z->base + BLKHDR_SZ) && (ptr + sizeof(FreeNode) <= z->limit);
 }
 
+#if MEM_DEBUG_FULL
 /* Safely unlink a node from a specific freelist size class circular list.
  * If the node or its neighbors are invalid, nuke the entire class to avoid corruption. */
 static void freelist_unlink_node_sc(ZoneInfo* z, u32 sc, FreeNode* n) {
@@ -153,7 +176,9 @@ static void freelist_unlink_node_sc(ZoneInfo* z, u32 sc, FreeNode* n) {
     }
     n->next = n->prev = NULL;
 }
+#endif
 
+#if MEM_DEBUG_CHEAP
 /* Helper for on-demand hex dumping without printf */
 static void dump_bytes(const u8* p, u32 len) {
     extern void serial_putchar(char c);
@@ -242,6 +267,9 @@ static inline bool validate_block(ZoneInfo* z, BlockHeader* b) {
     return true;
 }
 
+#endif /* MEM_DEBUG_CHEAP */
+
+#if MEM_DEBUG_FULL
 /* Validate freelist integrity for segregated lists */
 static bool validate_freelist(ZoneInfo* z) {
     extern void serial_puts(const char* str);
@@ -301,6 +329,23 @@ static bool validate_freelist(ZoneInfo* z) {
     return true;
 }
 
+#endif /* MEM_DEBUG_FULL */
+
+/* Level-gated checks; each collapses to a constant when its level is off */
+#if MEM_DEBUG_CHEAP
+#define heap_check_block(z, b)      validate_block((z), (b))
+#else
+#define heap_check_block(z, b)      true
+#endif
+
+#if MEM_DEBUG_FULL
+#define heap_deep_check_block(z, b) validate_block((z), (b))
+#define heap_check_freelist(z)      validate_freelist(z)
+#else
+#define heap_deep_check_block(z, b) true
+#define heap_check_freelist(z)      true
+#endif
+
 static void freelist_insert(ZoneInfo* z, BlockHeader* b) {
     /* NO LOGGING - serial_printf corrupts registers! */
 
@@ -573,17 +618,35 @@ void InitZone(ZoneInfo* zone, void* memory, u32 size, void** masterTable, u32 ma
     zone->mpCount = masterCount;
     zone->mpNextFree = 0;
     for (u32 i = 0; i < masterCount; i++) {
-        zone->mpBase[i] = NULL;
+        zone->mpBase[i] = MP_FREE_SLOT;
     }
 
     zone->m68kBase = 0;
     zone->m68kLimit = 0;
 }
 
+/* Zone a block lives in; blocks outside every zone are charged to the current one */
+static ZoneInfo* zone_of(const void* p) {
+    ZoneInfo* z = gCurrentZone;
+    if (z && (const u8*)p >= z->base && (const u8*)p < z->limit) return z;
+
+    ZoneInfo* zones[] = { &gAppZone, &gSystemZone, &gTempZone };
+    for (u32 i = 0; i < sizeof(zones) / sizeof(zones[0]); i++) {
+        if ((const u8*)p >= zones[i]->base && (const u8*)p < zones[i]->limit) {
+            return zones[i];
+        }
+    }
+    return z;
+}
+
 ZoneInfo* GetZone(void) {
     return gCurrentZone;
 }
 
+ZoneInfo* MemoryManager_GetTempZone(void) {
+    return &gTempZone;
+}
+
 void SetZone(ZoneInfo* zone) {
     gCurrentZone = zone;
 }
@@ -640,92 +703,74 @@ u32 MaxMem(void) {
 
 /* ======================== Block Allocation ======================== */
 
-static BlockHeader* find_fit(ZoneInfo* z, u32 need) {
-    /* NO LOGGING - even serial_puts corrupts return value! */
-
-    /* Determine starting size class */
-    u32 start_class = get_size_class(need);
+/* First block in size class sc with room for need bytes */
+static BlockHeader* class_first_fit(ZoneInfo* z, u32 sc, u32 need) {
+    FreeNode* head = z->freelists[sc];
+    if (!head) return NULL;
 
-    /* Try exact size class first */
-    FreeNode* head = z->freelists[start_class];
-    if (head) {
-        /* Validate head pointer before use */
-        if (!is_valid_freenode(z, head)) {
-            z->freelists[start_class] = NULL;
-        } else {
-            FreeNode* it = head;
-            FreeNode* start = it;
-            u32 loop_safety = 0;
-
-            do {
-                /* Defensive: validate node pointers */
-                if (!is_valid_freenode(z, it) || !is_valid_freenode(z, it->next)) {
-                    z->freelists[start_class] = NULL;
-                    break;
-                }
+#if MEM_DEBUG_FULL
+    /* Validate head pointer before use */
+    if (!is_valid_freenode(z, head)) {
+        z->freelists[sc] = NULL;
+        return NULL;
+    }
 
-                BlockHeader* b = freenode_to_block(it);
-                /* Validate candidate block header before using */
-                if (!validate_block(z, b)) {
-                    /* Excise bad node from this class ring and restart */
-                    freelist_unlink_node_sc(z, start_class, it);
-                    it = z->freelists[start_class];
-                    start = it;
-                    if (!it) break;
-                    continue;
-                }
+    FreeNode* it = head;
+    FreeNode* start = it;
+    u32 loop_safety = 0;
 
-                if (b->size >= need) return b;
+    do {
+        /* Defensive: validate node pointers */
+        if (!is_valid_freenode(z, it) || !is_valid_freenode(z, it->next)) {
+            z->freelists[sc] = NULL;
+            break;
+        }
 
-                it = it->next;
-                loop_safety++;
-                if (loop_safety > 10000) {
-                    z->freelists[start_class] = NULL;
-                    break;
-                }
-            } while (it != start);
+        BlockHeader* b = freenode_to_block(it);
+        /* Validate candidate block header before using */
+        if (!heap_deep_check_block(z, b)) {
+            /* Excise bad node from this class ring and restart */
+            freelist_unlink_node_sc(z, sc, it);
+            it = z->freelists[sc];
+            start = it;
+            if (!it) break;
+            continue;
         }
-    }
 
-    /* Try larger size classes */
-    for (u32 sc = start_class + 1; sc < NUM_SIZE_CLASSES; sc++) {
-        head = z->freelists[sc];
-        if (!head) continue;
+        if (b->size >= need) return b;
 
-        /* Validate and return first valid block from larger class */
-        if (!is_valid_freenode(z, head)) {
+        it = it->next;
+        loop_safety++;
+        if (loop_safety > 10000) {
             z->freelists[sc] = NULL;
-            continue;
+            break;
         }
+    } while (it != start);
 
-        FreeNode* it = head;
-        FreeNode* start = it;
-        u32 loop_safety = 0;
-        do {
-            if (!is_valid_freenode(z, it) || !is_valid_freenode(z, it->next)) {
-                z->freelists[sc] = NULL;
-                break;
-            }
+    return NULL;
+#else
+    /* A ring cannot hold more nodes than the zone has blocks; a corrupted
+     * one that leaves the zone or never closes fails the allocation */
+    u32 maxNodes = (u32)(z->limit - z->base) / MIN_BLOCK_SIZE;
+    FreeNode* it = head;
+    do {
+        if (!is_valid_freenode(z, it) || maxNodes-- == 0) return NULL;
+        BlockHeader* b = freenode_to_block(it);
+        if (b->size >= need) return b;
+        it = it->next;
+    } while (it != head);
 
-            BlockHeader* b = freenode_to_block(it);
-            if (!validate_block(z, b)) {
-                /* Remove bad node and restart scanning this class */
-                freelist_unlink_node_sc(z, sc, it);
-                it = z->freelists[sc];
-                start = it;
-                if (!it) break;
-                continue;
-            }
+    return NULL;
+#endif
+}
 
-            if (b->size >= need) return b;
+static BlockHeader* find_fit(ZoneInfo* z, u32 need) {
+    /* NO LOGGING - even serial_puts corrupts return value! */
 
-            it = it->next;
-            loop_safety++;
-            if (loop_safety > 10000) {
-                z->freelists[sc] = NULL;
-                break;
-            }
-        } while (it != start);
+    /* Exact size class first, then the larger ones */
+    for (u32 sc = get_size_class(need); sc < NUM_SIZE_CLASSES; sc++) {
+        BlockHeader* b = class_first_fit(z, sc, need);
+        if (b) return b;
     }
 
     return NULL;  /* No fit found */
@@ -733,7 +778,7 @@ static BlockHeader* find_fit(ZoneInfo* z, u32 need) {
 
 static void split_block(ZoneInfo* z, BlockHeader* b, u32 need) {
     /* Validate header before touching freelists or splitting */
-    if (!validate_block(z, b)) {
+    if (!heap_check_block(z, b)) {
         return;
     }
 
@@ -824,6 +869,7 @@ void* NewPtr(u32 byteCount) {
     if (!z) {
         return NULL;
     }
+    MEMTEL_BEGIN(mtStart);
 
     u32 need = align_up(byteCount + BLKHDR_SZ + CANARY_SIZE);
 
@@ -836,10 +882,12 @@ void* NewPtr(u32 byteCount) {
     if (!b) {
         u32 compact_result = CompactMem(need);
         if (compact_result < need) {
+            MEMTEL_FAIL(z, kMemOpNewPtr);
             return NULL;
         }
         b = find_fit(z, need);
         if (!b) {
+            MEMTEL_FAIL(z, kMemOpNewPtr);
             return NULL;
         }
     }
@@ -850,9 +898,11 @@ void* NewPtr(u32 byteCount) {
     b->masterPtr = NULL;
     z->bytesUsed += b->size;
     z->bytesFree -= b->size;
+    MEMTEL_ALLOC(z, kMemOpNewPtr, b, byteCount);
 
     void* result = (u8*)b + BLKHDR_SZ;
 
+    b->reserved = 0;
 #if MEM_DEBUG_CANARY
     /* Stash canary size in reserved field and write tail canary pattern */
     b->reserved = (u16)CANARY_SIZE;
@@ -872,7 +922,7 @@ void* NewPtr(u32 byteCount) {
     }
 #endif
 
-#if 1
+#if MEM_DEBUG_FULL
     uintptr_t addr = (uintptr_t)result;
     if (addr >= 0x007A4000 && addr <= 0x007B6000) {
         serial_puts("[HEAP] NewPtr near suspect range addr=0x");
@@ -887,6 +937,7 @@ void* NewPtr(u32 byteCount) {
      * Without this, old data appears in desktop icons and window titles */
     memset(result, 0, byteCount);
 
+    MEMTEL_END(z, kMemOpNewPtr, mtStart);
     return result;
 }
 
@@ -896,29 +947,49 @@ void* NewPtrClear(u32 byteCount) {
     return p;
 }
 
-void DisposePtr(void* p) {
-    extern void serial_puts(const char* str);
-
-    serial_puts("[DISPOSE] ENTRY ptr=0x");
-    mm_print_hex((u32)(uintptr_t)p);
+#if MEM_DEBUG_FULL
+/* Step-by-step dispose tracing (full debug level only) */
+static void dispose_trace(const char* what, BlockHeader* b) {
+    serial_puts("[DISPOSE] ");
+    serial_puts(what);
+    if (b) {
+        serial_puts(" block=0x");
+        mm_print_hex((u32)(uintptr_t)b);
+        serial_puts(" size=0x");
+        mm_print_hex(b->size);
+        serial_puts(" flags=0x");
+        mm_print_hex(b->flags);
+    }
     serial_putchar('\n');
+}
 
-    if (!p) {
-        serial_puts("[DISPOSE] Early return: p is NULL\n");
-        return;
+#define HEAP_CHECK_INTERVAL 256u
+static u32 gHeapCheckTick = 0;
+
+/* Walk the whole zone every HEAP_CHECK_INTERVAL disposals */
+static void heap_periodic_check(ZoneInfo* z) {
+    if (++gHeapCheckTick >= HEAP_CHECK_INTERVAL) {
+        gHeapCheckTick = 0;
+        CheckHeap(z);
     }
+}
+#else
+#define dispose_trace(what, b)      ((void)0)
+#define heap_periodic_check(z)      ((void)0)
+#endif
 
-    ZoneInfo* z = gCurrentZone;
-    serial_puts("[DISPOSE] gCurrentZone read\n");
+void DisposePtr(void* p) {
+    if (!p) return;
 
-    if (!z) {
-        serial_puts("[DISPOSE] Early return: gCurrentZone is NULL\n");
-        return;
-    }
+    ZoneInfo* z = zone_of(p);
+    if (!z) return;
+    MEMTEL_BEGIN(mtStart);
+
+    BlockHeader* b = (BlockHeader*)((u8*)p - BLKHDR_SZ);
+    dispose_trace("ENTRY", b);
 
     /* Validate freelist BEFORE disposal */
-    serial_puts("[DISPOSE] Validating freelist BEFORE disposal\n");
-    if (!validate_freelist(z)) {
+    if (!heap_check_freelist(z)) {
         serial_puts("[DISPOSE] ERROR: Freelist already corrupted before disposal!\n");
         /* Clear all freelists to prevent crashes */
         for (u32 i = 0; i < NUM_SIZE_CLASSES; i++) {
@@ -926,23 +997,12 @@ void DisposePtr(void* p) {
         }
         return;
     }
-    serial_puts("[DISPOSE] Freelist valid before disposal\n");
-
-    BlockHeader* b = (BlockHeader*)((u8*)p - BLKHDR_SZ);
-    serial_puts("[DISPOSE] BlockHeader calculated at 0x");
-    mm_print_hex((u32)(uintptr_t)b);
-    serial_puts(" size=0x");
-    mm_print_hex(b->size);
-    serial_puts(" flags=0x");
-    mm_print_hex(b->flags);
-    serial_putchar('\n');
 
     /* Validate the block being freed */
-    if (!validate_block(z, b)) {
+    if (!heap_check_block(z, b)) {
         serial_puts("[DISPOSE] ERROR: Invalid block being freed\n");
         return;
     }
-    serial_puts("[DISPOSE] Block header validated\n");
 
 #if MEM_DEBUG_CANARY
     /* Verify tail canary if present */
@@ -966,43 +1026,28 @@ void DisposePtr(void* p) {
     }
 #endif
 
+    MEMTEL_FREE(z, kMemOpDisposePtr, b);
     b->flags &= ~(BF_PTR);
     z->bytesUsed -= b->size;
     z->bytesFree += b->size;
 
     /* Coalesce and insert */
-    serial_puts("[DISPOSE] Calling coalesce_forward\n");
     b = coalesce_forward(z, b);
-    serial_puts("[DISPOSE] After coalesce_forward b=0x");
-    mm_print_hex((u32)(uintptr_t)b);
-    serial_puts(" size=0x");
-    mm_print_hex(b->size);
-    serial_putchar('\n');
-
-    /* Validate after coalesce_forward */
-    if (!validate_block(z, b)) {
+    dispose_trace("after coalesce_forward", b);
+    if (!heap_deep_check_block(z, b)) {
         serial_puts("[DISPOSE] ERROR: Block invalid after coalesce_forward\n");
         return;
     }
 
-    serial_puts("[DISPOSE] Calling coalesce_backward\n");
     b = coalesce_backward(z, b);
-    serial_puts("[DISPOSE] After coalesce_backward b=0x");
-    mm_print_hex((u32)(uintptr_t)b);
-    serial_puts(" size=0x");
-    mm_print_hex(b->size);
-    serial_putchar('\n');
-
-    /* Validate coalesced block */
-    if (!validate_block(z, b)) {
+    dispose_trace("after coalesce_backward", b);
+    if (!heap_deep_check_block(z, b)) {
         serial_puts("[DISPOSE] ERROR: Coalesced block invalid after coalesce_backward\n");
         return;
     }
-    serial_puts("[DISPOSE] Coalesced block validated\n");
 
-    /* CRITICAL: Validate freelist is still intact BEFORE inserting */
-    serial_puts("[DISPOSE] Validating freelist BEFORE re-insertion\n");
-    if (!validate_freelist(z)) {
+    /* Validate freelist is still intact BEFORE inserting */
+    if (!heap_check_freelist(z)) {
         serial_puts("[DISPOSE] ERROR: Freelist corrupted DURING coalescing!\n");
         /* Clear all freelists to prevent crashes */
         for (u32 i = 0; i < NUM_SIZE_CLASSES; i++) {
@@ -1010,19 +1055,11 @@ void DisposePtr(void* p) {
         }
         return;
     }
-    serial_puts("[DISPOSE] Freelist still valid before insertion\n");
 
-    serial_puts("[DISPOSE] Calling freelist_insert on block at 0x");
-    mm_print_hex((u32)(uintptr_t)b);
-    serial_puts(" size=0x");
-    mm_print_hex(b->size);
-    serial_putchar('\n');
     freelist_insert(z, b);
-    serial_puts("[DISPOSE] freelist_insert completed\n");
 
     /* Validate freelist AFTER insertion */
-    serial_puts("[DISPOSE] Validating freelist AFTER insertion\n");
-    if (!validate_freelist(z)) {
+    if (!heap_check_freelist(z)) {
         serial_puts("[DISPOSE] ERROR: Freelist corrupted after freelist_insert!\n");
         /* Clear all freelists to prevent crashes */
         for (u32 i = 0; i < NUM_SIZE_CLASSES; i++) {
@@ -1031,7 +1068,9 @@ void DisposePtr(void* p) {
         return;
     }
 
-    serial_puts("[DISPOSE] Complete - freelist validated successfully\n");
+    heap_periodic_check(z);
+    MEMTEL_END(z, kMemOpDisposePtr, mtStart);
+    dispose_trace("complete", NULL);
 }
 
 u32 GetPtrSize(void* p) {
@@ -1048,12 +1087,28 @@ u32 GetPtrSize(void* p) {
 
 /* ======================== Handle Operations ======================== */
 
+/* Handles keep their logical size as slack in BlockHeader.reserved: the
+ * number of data bytes past the end of the handle (alignment padding plus
+ * any growth headroom).  Ptr blocks use the same field for the canary. */
+static inline u32 handle_slack(BlockHeader* b) {
+    u32 data = b->size - BLKHDR_SZ;
+    return (b->reserved <= data) ? b->reserved : 0;
+}
+
+static inline void set_handle_slack(BlockHeader* b, u32 logicalSize) {
+    u32 slack = (b->size - BLKHDR_SZ) - logicalSize;
+    b->reserved = (u16)(slack > 0xFFFFu ? 0xFFFFu : slack);
+}
+
 static void** MP_Alloc(ZoneInfo* z) {
-    /* Simple linear search for free master pointer */
-    for (u32 i = 0; i < z->mpCount; i++) {
-        if (z->mpBase[i] == NULL) {
+    /* Linear search for a free master pointer, starting at the hint */
+    for (u32 n = 0; n < z->mpCount; n++) {
+        u32 i = z->mpNextFree + n;
+        if (i >= z->mpCount) i -= z->mpCount;
+        if (z->mpBase[i] == MP_FREE_SLOT) {
             /* Reserve the slot */
             z->mpBase[i] = (void*)1;  /* Temporary marker */
+            z->mpNextFree = i + 1 < z->mpCount ? i + 1 : 0;
             return &z->mpBase[i];
         }
     }
@@ -1062,17 +1117,31 @@ static void** MP_Alloc(ZoneInfo* z) {
 
 static void MP_Free(ZoneInfo* z, void** mp) {
     if (mp >= z->mpBase && mp < z->mpBase + z->mpCount) {
-        *mp = NULL;
+        *mp = MP_FREE_SLOT;
+        if ((u32)(mp - z->mpBase) < z->mpNextFree) z->mpNextFree = (u32)(mp - z->mpBase);
     }
 }
 
-Handle NewHandle(u32 byteCount) {
-    ZoneInfo* z = gCurrentZone;
-    if (!z) return NULL;
+/* Read-only memory handles may point into (MemoryManager_SetROM) */
+static const u8* gROMBase = NULL;
+static const u8* gROMLimit = NULL;
 
-    void** mp = MP_Alloc(z);
-    if (!mp) return NULL;
+static inline bool in_rom(const void* p) {
+    return (const u8*)p >= gROMBase && (const u8*)p < gROMLimit;
+}
+
+/* Zone whose master pointer table holds h */
+static ZoneInfo* mp_zone(Handle h) {
+    ZoneInfo* zones[] = { gCurrentZone, &gAppZone, &gSystemZone, &gTempZone };
+    for (u32 i = 0; i < sizeof(zones) / sizeof(zones[0]); i++) {
+        ZoneInfo* z = zones[i];
+        if (z && (void**)h >= z->mpBase && (void**)h < z->mpBase + z->mpCount) return z;
+    }
+    return gCurrentZone;
+}
 
+/* Allocate a data block for master pointer mp and point mp at it */
+static BlockHeader* handle_block_alloc(ZoneInfo* z, void** mp, u32 byteCount) {
     u32 need = align_up(byteCount + BLKHDR_SZ);
 
     /* Enforce minimum block size to ensure blocks can be freed */
@@ -1084,12 +1153,10 @@ Handle NewHandle(u32 byteCount) {
     if (!b) {
         /* Try compaction */
         if (CompactMem(need) < need) {
-            MP_Free(z, mp);
             return NULL;
         }
         b = find_fit(z, need);
         if (!b) {
-            MP_Free(z, mp);
             return NULL;
         }
     }
@@ -1098,13 +1165,35 @@ Handle NewHandle(u32 byteCount) {
     b->flags |= BF_HANDLE;
     b->masterPtr = (Handle)mp;  /* Store backpointer */
     *mp = (u8*)b + BLKHDR_SZ;    /* Master pointer points to data */
+    set_handle_slack(b, byteCount);
     z->bytesUsed += b->size;
     z->bytesFree -= b->size;
+    MEMTEL_ALLOC(z, kMemOpNewHandle, b, byteCount);
 
     /* CRITICAL FIX: Zero allocated memory to prevent garbage data corruption
      * Without this, old data (like format strings) appears in window titles and corrupts desktop icons */
     memset(*mp, 0, byteCount);
+    return b;
+}
+
+Handle NewHandle(u32 byteCount) {
+    ZoneInfo* z = gCurrentZone;
+    if (!z) return NULL;
+
+    MEMTEL_BEGIN(mtStart);
+    void** mp = MP_Alloc(z);
+    if (!mp) {
+        MEMTEL_FAIL(z, kMemOpNewHandle);
+        return NULL;
+    }
+
+    if (!handle_block_alloc(z, mp, byteCount)) {
+        MP_Free(z, mp);
+        MEMTEL_FAIL(z, kMemOpNewHandle);
+        return NULL;
+    }
 
+    MEMTEL_END(z, kMemOpNewHandle, mtStart);
     return (Handle)mp;
 }
 
@@ -1115,16 +1204,25 @@ Handle NewHandleClear(u32 byteCount) {
 }
 
 void DisposeHandle(Handle h) {
-    if (!h || !*h) {
-        if (h) *h = NULL;
+    if (!h) return;
+    if (!*h) {
+        /* Purged or emptied: only the master pointer is left */
+        MP_Free(mp_zone(h), (void**)h);
         return;
     }
 
-    ZoneInfo* z = gCurrentZone;
+    /* ROM handle: only the master pointer is ours */
+    if (in_rom(*h)) {
+        MP_Free(mp_zone(h), (void**)h);
+        return;
+    }
+
+    ZoneInfo* z = zone_of(*h);
     if (!z) return;
+    MEMTEL_BEGIN(mtStart);
 
     /* Validate freelist before disposal */
-    if (!validate_freelist(z)) {
+    if (!heap_check_freelist(z)) {
         for (u32 i = 0; i < NUM_SIZE_CLASSES; i++) {
             z->freelists[i] = NULL;
         }
@@ -1135,13 +1233,14 @@ void DisposeHandle(Handle h) {
     BlockHeader* b = (BlockHeader*)(p - BLKHDR_SZ);
 
     /* Validate block being freed */
-    if (!validate_block(z, b)) {
+    if (!heap_check_block(z, b)) {
         return;
     }
 
-    /* Clear master pointer */
-    *h = NULL;
+    /* Return the master pointer to its table */
+    MP_Free(mp_zone(h), (void**)h);
 
+    MEMTEL_FREE(z, kMemOpDisposeHandle, b);
     b->flags &= ~(BF_HANDLE | BF_LOCKED | BF_PURGEABLE);
     b->masterPtr = NULL;
     z->bytesUsed -= b->size;
@@ -1151,106 +1250,320 @@ void DisposeHandle(Handle h) {
     b = coalesce_backward(z, b);
 
     /* Validate after coalescing */
-    if (!validate_block(z, b)) {
+    if (!heap_deep_check_block(z, b)) {
         return;
     }
 
     freelist_insert(z, b);
 
     /* Validate freelist after insertion */
-    if (!validate_freelist(z)) {
+    if (!heap_check_freelist(z)) {
         for (u32 i = 0; i < NUM_SIZE_CLASSES; i++) {
             z->freelists[i] = NULL;
         }
     }
+    heap_periodic_check(z);
+    MEMTEL_END(z, kMemOpDisposeHandle, mtStart);
 }
 
 void HLock(Handle h) {
-    if (h && *h) {
+    if (h && *h && !in_rom(*h)) {
         BlockHeader* b = (BlockHeader*)((u8*)*h - BLKHDR_SZ);
         b->flags |= BF_LOCKED;
     }
 }
 
 void HUnlock(Handle h) {
-    if (h && *h) {
+    if (h && *h && !in_rom(*h)) {
         BlockHeader* b = (BlockHeader*)((u8*)*h - BLKHDR_SZ);
         b->flags &= ~BF_LOCKED;
     }
 }
 
 void HPurge(Handle h) {
-    if (!h || !*h) return;
+    if (!h || !*h || in_rom(*h)) return;
     BlockHeader* b = (BlockHeader*)((u8*)*h - BLKHDR_SZ);
     b->flags |= BF_PURGEABLE;
 }
 
 void HNoPurge(Handle h) {
-    if (!h || !*h) return;
+    if (!h || !*h || in_rom(*h)) return;
     BlockHeader* b = (BlockHeader*)((u8*)*h - BLKHDR_SZ);
     b->flags &= ~BF_PURGEABLE;
 }
 
 u32 GetHandleSize(Handle h) {
     if (!h || !*h) return 0;
+    if (in_rom(*h)) {
+        const u8* len = (const u8*)*h - 4;
+        return ((u32)len[0] << 24) | ((u32)len[1] << 16) | ((u32)len[2] << 8) | len[3];
+    }
     BlockHeader* b = (BlockHeader*)((u8*)*h - BLKHDR_SZ);
-    return b->size - BLKHDR_SZ;
+    u32 data = b->size - BLKHDR_SZ;
+    if (b->flags & BF_HANDLE) {
+        data -= handle_slack(b);
+    }
+    return data;
 }
 
-bool SetHandleSize_MemMgr(Handle h, u32 newSize) {
-    if (!h || !*h) return false;
+/* ======================== ROM Handles ======================== */
 
+/*
+ * A ROM handle's master pointer points into read-only memory outside every
+ * zone - the built-in resource image - whose blocks are laid out as in a
+ * resource fork, each preceded by its 32-bit big-endian length.  Its data
+ * is never moved, locked, purged or freed: HLock and friends do nothing,
+ * DisposeHandle frees just the master pointer, and resizing the handle
+ * first moves its data into the heap (MemoryManager_CopyROMHandle).
+ */
+
+void MemoryManager_SetROM(const void* base, u32 size) {
+    gROMBase = (const u8*)base;
+    gROMLimit = gROMBase + size;
+}
+
+Handle MemoryManager_NewROMHandle(const void* data) {
     ZoneInfo* z = gCurrentZone;
-    if (!z) return false;
+    if (!z || !in_rom(data)) return NULL;
 
-    /* Get current block */
-    u8* p = (u8*)*h;
-    BlockHeader* b = (BlockHeader*)(p - BLKHDR_SZ);
-    u32 oldSize = b->size - BLKHDR_SZ;
-    u32 newTotalSize = align_up(newSize + BLKHDR_SZ);
+    void** mp = MP_Alloc(z);
+    if (!mp) return NULL;
+    *mp = (void*)(uintptr_t)data;
+    return (Handle)mp;
+}
 
-    /* If handle is locked, we cannot move it */
-    if (b->flags & BF_LOCKED) {
-        /* Can only shrink or grow in place */
-        if (newTotalSize <= b->size) {
-            /* Shrinking - just update size */
-            return true;
+bool MemoryManager_IsROMHandle(Handle h) {
+    return h && *h && in_rom(*h);
+}
+
+bool MemoryManager_CopyROMHandle(Handle h) {
+    if (!MemoryManager_IsROMHandle(h)) return h && *h;
+
+    const u8* data = (const u8*)*h;
+    u32 size = GetHandleSize(h);
+    ZoneInfo* z = mp_zone(h);
+
+    /* Compaction works on the current zone */
+    ZoneInfo* saved = gCurrentZone;
+    gCurrentZone = z;
+    bool ok = handle_block_alloc(z, (void**)h, size) != NULL;
+    gCurrentZone = saved;
+    if (ok) memcpy(*h, data, size);
+    return ok;
+}
+
+/* ======================== Handle Resizing ======================== */
+
+/* Headroom given to append-style handles when they have to grow: half the
+ * new size, capped so the slack still fits BlockHeader.reserved. */
+#define APPEND_HEADROOM_MAX 0x8000u
+/* Don't bother returning less than this to the free list on shrink */
+#define SHRINK_RELEASE_MIN  64u
+
+static inline u32 handle_block_size(u32 logicalSize) {
+    u32 need = align_up(logicalSize + BLKHDR_SZ);
+    return (need < MIN_BLOCK_SIZE) ? MIN_BLOCK_SIZE : need;
+}
+
+static inline u32 append_headroom(u32 logicalSize) {
+    u32 extra = logicalSize >> 1;
+    return (extra > APPEND_HEADROOM_MAX) ? APPEND_HEADROOM_MAX : extra;
+}
+
+/* Allocate a raw block of exactly need bytes (header included), compacting
+ * once if nothing fits.  Flags are left clear for the caller. */
+static BlockHeader* alloc_block(ZoneInfo* z, u32 need) {
+    BlockHeader* b = find_fit(z, need);
+    if (!b) {
+        if (CompactMem(need) < need) return NULL;
+        b = find_fit(z, need);
+        if (!b) return NULL;
+    }
+    split_block(z, b, need);
+    z->bytesUsed += b->size;
+    z->bytesFree -= b->size;
+    return b;
+}
+
+/* Size of the free block directly after b, or 0 */
+static u32 free_size_after(ZoneInfo* z, BlockHeader* b) {
+    u8* after = (u8*)b + b->size;
+    if (after + BLKHDR_SZ > z->limit) return 0;
+    BlockHeader* next = (BlockHeader*)after;
+    if (!(next->flags & BF_FREE)) return 0;
+    if (next->size < MIN_BLOCK_SIZE || next->size > (u32)(z->limit - after)) return 0;
+    return next->size;
+}
+
+/* Size of the free block directly before b, or 0 */
+static u32 free_size_before(ZoneInfo* z, BlockHeader* b) {
+    if (b->prevSize == 0 || b->prevSize > (u32)((u8*)b - z->base)) return 0;
+    BlockHeader* prev = (BlockHeader*)((u8*)b - b->prevSize);
+    if (!(prev->flags & BF_FREE) || prev->size != b->prevSize) return 0;
+    return prev->size;
+}
+
+/* Merge the free block after b into b.  b stays allocated. */
+static void absorb_next(ZoneInfo* z, BlockHeader* b) {
+    BlockHeader* next = (BlockHeader*)((u8*)b + b->size);
+    u32 gained = next->size;
+
+    freelist_remove(z, next);
+    b->size += gained;
+
+    u8* after = (u8*)b + b->size;
+    if (after + BLKHDR_SZ <= z->limit) {
+        ((BlockHeader*)after)->prevSize = b->size;
+    }
+    z->bytesUsed += gained;
+    z->bytesFree -= gained;
+}
+
+/* Cut b down to keep bytes and return the tail to the free list, merged
+ * with whatever free block follows it. */
+static void trim_block(ZoneInfo* z, BlockHeader* b, u32 keep) {
+    if (keep >= b->size || b->size - keep < MIN_BLOCK_SIZE) return;
+
+    u32 remain = b->size - keep;
+    BlockHeader* tail = (BlockHeader*)((u8*)b + keep);
+    tail->size = remain;
+    tail->flags = BF_FREE;
+    tail->reserved = 0;
+    tail->prevSize = keep;
+    tail->masterPtr = NULL;
+
+    u8* after = (u8*)tail + remain;
+    if (after + BLKHDR_SZ <= z->limit) {
+        ((BlockHeader*)after)->prevSize = remain;
+    }
+
+    b->size = keep;
+    z->bytesUsed -= remain;
+    z->bytesFree += remain;
+
+    tail = coalesce_forward(z, tail);
+    freelist_insert(z, tail);
+}
+
+/*
+ * SetHandleSize_MemMgr - resize a handle, moving it only as a last resort
+ *
+ * In order of preference:
+ *   1. Fits the current block: update the size; a shrink hands a worthwhile
+ *      tail back to the free list.
+ *   2. Free block directly above: absorb it, no copy (works while locked).
+ *   3. Free block directly below (plus any above): slide the data down.
+ *   4. Allocate elsewhere, copy, free the old block.
+ * A handle that has grown once is marked BF_APPEND; later growth allocates
+ * append_headroom() extra so byte-at-a-time appends stop relocating.
+ */
+static bool resize_handle(ZoneInfo* z, Handle h, u32 newSize) {
+    MEMTEL_BEGIN(mtStart);
+
+    BlockHeader* b = (BlockHeader*)((u8*)*h - BLKHDR_SZ);
+    u32 need = handle_block_size(newSize);
+
+    /* Ptr-backed pseudo handles (e.g. regions) can't be resized here */
+    if (!(b->flags & BF_HANDLE)) {
+        return need <= b->size;
+    }
+
+    u32 oldSize = GetHandleSize(h);
+    u32 oldBlockSize = b->size;
+    bool appending = (b->flags & BF_APPEND) != 0;
+    u32 target = appending ? handle_block_size(newSize + append_headroom(newSize)) : need;
+
+    /* 1. Fits in place */
+    if (need <= b->size) {
+        if (newSize < oldSize && b->size > target && b->size - target >= SHRINK_RELEASE_MIN) {
+            trim_block(z, b, target);
         }
-        /* Cannot grow locked handle */
-        return false;
+        set_handle_slack(b, newSize);
+        MEMTEL_RESIZE(z, b, oldBlockSize, false);
+        MEMTEL_END(z, kMemOpSetHandleSize, mtStart);
+        return true;
     }
 
-    /* If new size fits in current block (with some slack), keep it */
-    if (newTotalSize <= b->size && b->size - newTotalSize < 64) {
-        /* Size fits, no need to reallocate */
+    /* 2. Grow into the free neighbour above */
+    u32 above = free_size_after(z, b);
+    if (above && b->size + above >= need) {
+        absorb_next(z, b);
+        b->flags |= BF_APPEND;
+        trim_block(z, b, target);
+        set_handle_slack(b, newSize);
+        MEMTEL_RESIZE(z, b, oldBlockSize, false);
+        MEMTEL_END(z, kMemOpSetHandleSize, mtStart);
         return true;
     }
 
-    /* Need to allocate new block */
-    Handle newHandle = NewHandle(newSize);
-    if (!newHandle || !*newHandle) {
+    if (b->flags & BF_LOCKED) {
+        MEMTEL_FAIL(z, kMemOpSetHandleSize);
         return false;
     }
 
-    /* Copy data (minimum of old and new size) */
-    u32 copySize = (oldSize < newSize) ? oldSize : newSize;
-    if (copySize > 0) {
-        memcpy(*newHandle, *h, copySize);
+    /* 3. Slide down into the free neighbour below */
+    u32 below = free_size_before(z, b);
+    if (below && below + b->size + above >= need) {
+        if (above) absorb_next(z, b);
+
+        BlockHeader* prev = (BlockHeader*)((u8*)b - below);
+        u16 flags = b->flags;
+        Handle masterPtr = b->masterPtr;
+        u32 total = below + b->size;
+
+        freelist_remove(z, prev);
+        memmove((u8*)prev + BLKHDR_SZ, (u8*)b + BLKHDR_SZ, oldSize);
+        prev->size = total;
+        prev->flags = flags | BF_APPEND;
+        prev->masterPtr = masterPtr;
+        z->bytesUsed += below;
+        z->bytesFree -= below;
+
+        u8* after = (u8*)prev + total;
+        if (after + BLKHDR_SZ <= z->limit) {
+            ((BlockHeader*)after)->prevSize = total;
+        }
+
+        *h = (Ptr)((u8*)prev + BLKHDR_SZ);
+        trim_block(z, prev, target);
+        set_handle_slack(prev, newSize);
+        MEMTEL_RESIZE(z, prev, oldBlockSize, true);
+        MEMTEL_END(z, kMemOpSetHandleSize, mtStart);
+        return true;
     }
 
-    /* Get new block header */
-    BlockHeader* newBlock = (BlockHeader*)((u8*)*newHandle - BLKHDR_SZ);
+    /* 4. Relocate.  Fall back to the exact size if the headroom won't fit. */
+    BlockHeader* nb = alloc_block(z, target);
+    if (!nb && target > need) {
+        nb = alloc_block(z, need);
+    }
+    if (!nb) {
+        MEMTEL_FAIL(z, kMemOpSetHandleSize);
+        return false;
+    }
 
-    /* Update master pointer to point to new data */
-    Handle masterPtr = b->masterPtr;
-    *masterPtr = *newHandle;
+    /* Compaction inside alloc_block may have moved or purged us */
+    if (!*h) {
+        nb->flags = 0;
+        z->bytesUsed -= nb->size;
+        z->bytesFree += nb->size;
+        nb = coalesce_forward(z, nb);
+        nb = coalesce_backward(z, nb);
+        freelist_insert(z, nb);
+        MEMTEL_FAIL(z, kMemOpSetHandleSize);
+        return false;
+    }
+    b = (BlockHeader*)((u8*)*h - BLKHDR_SZ);
 
-    /* Copy flags from old block to new block */
-    newBlock->flags = b->flags;
-    newBlock->masterPtr = masterPtr;
+    memcpy((u8*)nb + BLKHDR_SZ, *h, oldSize);
+    nb->flags = b->flags | BF_APPEND;
+    nb->masterPtr = b->masterPtr;
+    *h = (Ptr)((u8*)nb + BLKHDR_SZ);
+    set_handle_slack(nb, newSize);
+    MEMTEL_RESIZE(z, nb, oldBlockSize, true);
 
-    /* Free old block (but don't touch master pointer) */
-    b->flags &= ~(BF_HANDLE | BF_LOCKED | BF_PURGEABLE);
+    /* Free old block (master pointer already points at the new one) */
+    b->flags = 0;
     b->masterPtr = NULL;
     z->bytesUsed -= b->size;
     z->bytesFree += b->size;
@@ -1259,12 +1572,25 @@ bool SetHandleSize_MemMgr(Handle h, u32 newSize) {
     b = coalesce_backward(z, b);
     freelist_insert(z, b);
 
-    /* Free the temporary master pointer from NewHandle */
-    MP_Free(z, (void**)newHandle);
-
+    MEMTEL_END(z, kMemOpSetHandleSize, mtStart);
     return true;
 }
 
+bool SetHandleSize_MemMgr(Handle h, u32 newSize) {
+    if (!h || !*h) return false;
+    if (in_rom(*h) && !MemoryManager_CopyROMHandle(h)) return false;
+
+    ZoneInfo* z = zone_of(*h);
+    if (!z) return false;
+
+    /* Relocation may compact, which works on the current zone */
+    ZoneInfo* saved = gCurrentZone;
+    gCurrentZone = z;
+    bool ok = resize_handle(z, h, newSize);
+    gCurrentZone = saved;
+    return ok;
+}
+
 /* ======================== Compaction ======================== */
 
 u32 CompactMem(u32 cbNeeded) {
@@ -1278,13 +1604,20 @@ u32 CompactMem(u32 cbNeeded) {
     }
 
     // MEMORY_LOG_DEBUG("[CompactMem] Zone state before: bytesUsed=%u bytesFree=%u\n", z->bytesUsed, z->bytesFree);
+    MEMTEL_BEGIN(mtStart);
 
     /* First, try purging */
     // MEMORY_LOG_DEBUG("[CompactMem] Calling PurgeMem...\n");
     PurgeMem(cbNeeded);
     // MEMORY_LOG_DEBUG("[CompactMem] PurgeMem complete\n");
 
-    /* Then compact: move unlocked handles together */
+    /* Then compact: move unlocked handles together.  Every free region is
+     * rebuilt by the walk below (moved handles land on top of old free
+     * blocks), so start from empty free lists rather than leave stale nodes. */
+    for (u32 sc = 0; sc < NUM_SIZE_CLASSES; sc++) {
+        z->freelists[sc] = NULL;
+    }
+
     u8* scan = z->base;
     u8* dest = z->base;
     /* Track size of the last block that ends at 'dest' to maintain prevSize */
@@ -1320,8 +1653,10 @@ u32 CompactMem(u32 cbNeeded) {
                 BlockHeader* d = (BlockHeader*)dest;
                 /* dataSize not needed; full header+data copied above */
 
-                /* Copy block header and data */
-                memcpy(d, b, b->size);
+                /* Copy block header and data (ranges may overlap) */
+                memmove(d, b, b->size);
+                d->prevSize = (dest > z->base) ? last_block_size : 0;
+                MEMTEL_MOVED(z, d->size);
 
                 /* Update master pointer */
                 if (d->masterPtr && *(d->masterPtr)) {
@@ -1335,9 +1670,10 @@ u32 CompactMem(u32 cbNeeded) {
                     nxt->prevSize = d->size;
                 }
 
+                /* b's header may have been overwritten by the move */
                 dest += d->size;
                 last_block_size = d->size;
-                scan += b->size;
+                scan += d->size;
                 continue;
             }
         }
@@ -1390,9 +1726,65 @@ u32 CompactMem(u32 cbNeeded) {
     // MEMORY_LOG_DEBUG("[CompactMem] Heap walk complete: processed %d blocks\n", block_count);
     u32 max_free = MaxMem();
     // MEMORY_LOG_DEBUG("[CompactMem] SUCCESS: MaxMem=%u\n", max_free);
+    MEMTEL_END(z, kMemOpCompactMem, mtStart);
     return max_free;
 }
 
+/* Free a handle's block, leaving its master pointer allocated and NULL */
+static BlockHeader* purge_block(ZoneInfo* z, BlockHeader* b) {
+    Handle h = b->masterPtr;
+    if (h) {
+        *h = NULL;  /* Clear master pointer */
+    }
+
+    /* Free the block */
+    MEMTEL_PURGE(z, b);
+    b->flags = BF_FREE;
+    z->bytesUsed -= b->size;
+    z->bytesFree += b->size;
+
+    /* Coalesce */
+    b = coalesce_forward(z, b);
+    b = coalesce_backward(z, b);
+    freelist_insert(z, b);
+    return b;
+}
+
+void EmptyHandle(Handle h) {
+    if (!h || !*h) return;
+    if (in_rom(*h)) {
+        *h = NULL;
+        return;
+    }
+
+    ZoneInfo* z = zone_of(*h);
+    if (!z) return;
+
+    BlockHeader* b = (BlockHeader*)((u8*)*h - BLKHDR_SZ);
+    if (b->flags & BF_LOCKED) return;
+    purge_block(z, b);
+}
+
+bool ReallocateHandle(Handle h, u32 byteCount) {
+    if (!h) return false;
+
+    ZoneInfo* z = *h && !in_rom(*h) ? zone_of(*h) : mp_zone(h);
+    if (!z) return false;
+
+    if (*h && !in_rom(*h)) {
+        BlockHeader* b = (BlockHeader*)((u8*)*h - BLKHDR_SZ);
+        if (b->flags & BF_LOCKED) return false;
+        purge_block(z, b);
+    }
+
+    /* Compaction works on the current zone */
+    ZoneInfo* saved = gCurrentZone;
+    gCurrentZone = z;
+    bool ok = handle_block_alloc(z, (void**)h, byteCount) != NULL;
+    gCurrentZone = saved;
+    return ok;
+}
+
 void PurgeMem(u32 cbNeeded) {
     ZoneInfo* z = gCurrentZone;
     if (!z) return;
@@ -1407,20 +1799,7 @@ void PurgeMem(u32 cbNeeded) {
             !(b->flags & BF_LOCKED)) {
 
             /* Purge this handle */
-            Handle h = b->masterPtr;
-            if (h) {
-                *h = NULL;  /* Clear master pointer */
-            }
-
-            /* Free the block */
-            b->flags = BF_FREE;
-            z->bytesUsed -= b->size;
-            z->bytesFree += b->size;
-
-            /* Coalesce */
-            b = coalesce_forward(z, b);
-            b = coalesce_backward(z, b);
-            freelist_insert(z, b);
+            b = purge_block(z, b);
 
             /* Check if we have enough */
             if (MaxMem() >= cbNeeded) return;
@@ -1510,6 +1889,12 @@ void InitMemoryManager(void) {
     gAppZone.name[0] = 'A'; gAppZone.name[1] = 0;
     serial_puts("MM: App Zone initialized (6144 KB)\n");
 
+    /* Initialize Temporary Memory Zone */
+    InitZone(&gTempZone, gTempHeap, sizeof(gTempHeap),
+             gTempMasters, sizeof(gTempMasters)/sizeof(void*));
+    gTempZone.name[0] = 'T'; gTempZone.name[1] = 0;
+    serial_puts("MM: Temp Zone initialized (512 KB)\n");
+
     /* Set current zone to app zone */
     gCurrentZone = &gAppZone;
 
@@ -1609,6 +1994,7 @@ bool MemoryManager_IsHeapPointer(const void* p)
     if (!p) return false;
     if (pointer_in_range(p, gSystemHeap, sizeof(gSystemHeap))) return true;
     if (pointer_in_range(p, gAppHeap, sizeof(gAppHeap))) return true;
+    if (pointer_in_range(p, gTempHeap, sizeof(gTempHeap))) return true;
     return false;
 }
 
@@ -1623,11 +2009,40 @@ void CheckHeap(ZoneInfo* zone) {
     u32 usedSize = 0;
     u32 blockCount = 0;
 
+    u32 prevSize = 0;
+
     u8* scan = zone->base;
     while (scan < zone->limit) {
         BlockHeader* b = (BlockHeader*)scan;
         blockCount++;
 
+        /* Structural checks: a bad size would derail the walk */
+        if (b->size < MIN_BLOCK_SIZE || (b->size & (ALIGN - 1)) ||
+            b->size > (u32)(zone->limit - scan)) {
+            serial_puts("[HEAP] CheckHeap: bad block size at 0x");
+            mm_print_hex((u32)(uintptr_t)b);
+            serial_puts(" size=0x");
+            mm_print_hex(b->size);
+            serial_putchar('\n');
+            return;
+        }
+        if (b->prevSize != prevSize) {
+            serial_puts("[HEAP] CheckHeap: prevSize mismatch at 0x");
+            mm_print_hex((u32)(uintptr_t)b);
+            serial_puts(" prev=0x");
+            mm_print_hex(b->prevSize);
+            serial_puts(" expected=0x");
+            mm_print_hex(prevSize);
+            serial_putchar('\n');
+        }
+        if ((b->flags & BF_HANDLE) && b->masterPtr && *b->masterPtr &&
+            *b->masterPtr != (Ptr)((u8*)b + BLKHDR_SZ)) {
+            serial_puts("[HEAP] CheckHeap: master pointer mismatch at 0x");
+            mm_print_hex((u32)(uintptr_t)b);
+            serial_putchar('\n');
+        }
+        prevSize = b->size;
+
         if (b->flags & BF_FREE) {
             freeSize += b->size;
         } else {
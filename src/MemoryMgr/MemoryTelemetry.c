@@ -0,0 +1,269 @@
+/*
+ * MemoryTelemetry.c - Memory Manager allocation telemetry
+ *
+ * Counters are updated from hooks in MemoryManager.c (see
+ * MemoryMgr/MemoryTelemetry.h).  Nothing here allocates or logs on the
+ * recording paths: the hooks run inside NewPtr/DisposePtr and must not
+ * re-enter the allocator or touch the serial port.
+ */
+
+#include "SystemTypes.h"
+#include "System71StdLib.h"
+#include "MemoryMgr/MemoryManager.h"
+#include "MemoryMgr/MemoryTelemetry.h"
+#include "TimeManager/TimeBase.h"
+#include <string.h>
+
+static MemTelemetrySnapshot gMemTel = {
+    .version = kMemTelemetryVersion,
+    .histBuckets = kMemTelemetryHistBuckets
+};
+static ZoneInfo* gMemTelZones[kMemTelemetryMaxZones];
+static UInt32 gMemTelOwnerTag = 0;
+
+/* ======================== Helpers ======================== */
+
+UInt64 MemTelemetry_Now(void) {
+    return PlatformCounterNow();
+}
+
+static MemTelemetryZoneStats* zone_stats(ZoneInfo* z) {
+    if (!z) return NULL;
+
+    for (u32 i = 0; i < gMemTel.zoneCount; i++) {
+        if (gMemTelZones[i] == z) return &gMemTel.zones[i];
+    }
+
+    /* First time we see this zone - claim a slot */
+    if (gMemTel.zoneCount >= kMemTelemetryMaxZones) return NULL;
+    u32 slot = gMemTel.zoneCount++;
+    gMemTelZones[slot] = z;
+    for (u32 i = 0; i < sizeof(gMemTel.zones[slot].name); i++) {
+        gMemTel.zones[slot].name[i] = z->name[i];
+        if (!z->name[i]) break;
+    }
+    return &gMemTel.zones[slot];
+}
+
+static u32 hist_bucket(u32 size) {
+    u32 bucket = 0;
+    u32 limit = 16;
+    while (bucket < kMemTelemetryHistBuckets - 1 && size > limit) {
+        limit <<= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+/* Find or claim the owner slot for key.  Slot 0 is the overflow bucket and
+ * is also used for blocks allocated before telemetry saw them. */
+static u32 owner_slot(UInt32 key) {
+    if (key == 0) return 0;
+
+    u32 start = 1 + ((key >> 2) * 2654435761u) % (kMemTelemetryMaxOwners - 1);
+    u32 i = start;
+    do {
+        MemTelemetryOwner* o = &gMemTel.owners[i];
+        if (o->key == key) return i;
+        if (o->key == 0) {
+            o->key = key;
+            gMemTel.ownerCount++;
+            return i;
+        }
+        i = (i + 1 < kMemTelemetryMaxOwners) ? i + 1 : 1;
+    } while (i != start);
+
+    return 0;
+}
+
+static void owner_credit(u32 slot, u32 bytes) {
+    MemTelemetryOwner* o = &gMemTel.owners[slot];
+    o->liveBytes += bytes;
+    if (o->liveBytes > o->peakLiveBytes) o->peakLiveBytes = o->liveBytes;
+}
+
+static void owner_debit(u32 slot, u32 bytes) {
+    MemTelemetryOwner* o = &gMemTel.owners[slot];
+    o->liveBytes = (o->liveBytes > bytes) ? o->liveBytes - bytes : 0;
+}
+
+static void zone_credit(MemTelemetryZoneStats* s, u32 bytes) {
+    s->liveBytes += bytes;
+    if (s->liveBytes > s->peakLiveBytes) s->peakLiveBytes = s->liveBytes;
+}
+
+static void zone_debit(MemTelemetryZoneStats* s, u32 bytes) {
+    s->liveBytes = (s->liveBytes > bytes) ? s->liveBytes - bytes : 0;
+}
+
+/* ======================== Recording Hooks ======================== */
+
+void MemTelemetry_RecordAlloc(ZoneInfo* z, MemTelemetryOp op, BlockHeader* b,
+                              u32 requested, UInt32 returnKey) {
+    if (!b) return;
+    MemTelemetryZoneStats* s = zone_stats(z);
+    if (!s) return;
+
+    s->sizeHist[hist_bucket(requested)]++;
+    zone_credit(s, b->size);
+
+    u32 slot = owner_slot(gMemTelOwnerTag ? gMemTelOwnerTag : returnKey);
+    gMemTel.owners[slot].allocCount++;
+    owner_credit(slot, b->size);
+    b->flags = (u16)((b->flags & ~BF_OWNER_MASK) | (slot << BF_OWNER_SHIFT));
+    (void)op;
+}
+
+void MemTelemetry_RecordFree(ZoneInfo* z, MemTelemetryOp op, BlockHeader* b) {
+    if (!b) return;
+    MemTelemetryZoneStats* s = zone_stats(z);
+    if (!s) return;
+
+    zone_debit(s, b->size);
+    owner_debit((b->flags & BF_OWNER_MASK) >> BF_OWNER_SHIFT, b->size);
+    (void)op;
+}
+
+void MemTelemetry_RecordPurge(ZoneInfo* z, BlockHeader* b) {
+    MemTelemetryZoneStats* s = zone_stats(z);
+    if (!s || !b) return;
+
+    s->purgedBlocks++;
+    s->purgedBytes += b->size;
+    zone_debit(s, b->size);
+    owner_debit((b->flags & BF_OWNER_MASK) >> BF_OWNER_SHIFT, b->size);
+}
+
+void MemTelemetry_RecordResize(ZoneInfo* z, BlockHeader* b, u32 oldBlockSize, bool moved) {
+    MemTelemetryZoneStats* s = zone_stats(z);
+    if (!s || !b) return;
+
+    u32 slot = (b->flags & BF_OWNER_MASK) >> BF_OWNER_SHIFT;
+    if (moved) s->handleMoves++;
+    if (b->size > oldBlockSize) {
+        zone_credit(s, b->size - oldBlockSize);
+        owner_credit(slot, b->size - oldBlockSize);
+    } else {
+        zone_debit(s, oldBlockSize - b->size);
+        owner_debit(slot, oldBlockSize - b->size);
+    }
+}
+
+void MemTelemetry_RecordFailure(ZoneInfo* z, MemTelemetryOp op) {
+    MemTelemetryZoneStats* s = zone_stats(z);
+    if (!s) return;
+    s->allocFailures++;
+    (void)op;
+}
+
+void MemTelemetry_RecordMoved(ZoneInfo* z, u32 bytes) {
+    MemTelemetryZoneStats* s = zone_stats(z);
+    if (s) s->compactBytesMoved += bytes;
+}
+
+void MemTelemetry_End(ZoneInfo* z, MemTelemetryOp op, UInt64 start) {
+    MemTelemetryZoneStats* s = zone_stats(z);
+    if (!s || op >= kMemOpCount) return;
+    s->calls[op]++;
+    s->cycles[op] += PlatformCounterNow() - start;
+}
+
+/* ======================== Public API ======================== */
+
+UInt32 MemTelemetry_SetOwnerTag(UInt32 tag) {
+    UInt32 prev = gMemTelOwnerTag;
+    gMemTelOwnerTag = tag;
+    return prev;
+}
+
+const MemTelemetrySnapshot* MemTelemetry_GetSnapshot(void) {
+    return &gMemTel;
+}
+
+/* Clear counters but keep zone and owner identities so blocks already
+ * tagged with an owner slot still resolve to the right key. */
+void MemTelemetry_Reset(void) {
+    for (u32 i = 0; i < kMemTelemetryMaxZones; i++) {
+        MemTelemetryZoneStats* s = &gMemTel.zones[i];
+        UInt32 live = s->liveBytes;
+        char name[4];
+        memcpy(name, s->name, sizeof(name));
+        memset(s, 0, sizeof(*s));
+        memcpy(s->name, name, sizeof(name));
+        s->liveBytes = s->peakLiveBytes = live;
+    }
+    for (u32 i = 0; i < kMemTelemetryMaxOwners; i++) {
+        MemTelemetryOwner* o = &gMemTel.owners[i];
+        o->allocCount = 0;
+        o->peakLiveBytes = o->liveBytes;
+    }
+}
+
+static const char* const kMemOpNames[kMemOpCount] = {
+    "NewPtr", "NewHandle", "DisposePtr", "DisposeHandle", "SetHandleSize", "CompactMem"
+};
+
+/* CSV snapshot.  Cycle totals are reported in units of 1024 counter ticks
+ * because the kernel printf has no 64-bit conversions. */
+void MemTelemetry_DumpCSV(void) {
+    char line[160];
+
+    serial_puts("# mtel,v1\n");
+    serial_puts("zone,op,calls,kcycles\n");
+    for (u32 zi = 0; zi < gMemTel.zoneCount; zi++) {
+        MemTelemetryZoneStats* s = &gMemTel.zones[zi];
+        for (u32 op = 0; op < kMemOpCount; op++) {
+            snprintf(line, sizeof(line), "%c,%s,%u,%u\n", s->name[0] ? s->name[0] : '?',
+                     kMemOpNames[op], s->calls[op], (u32)(s->cycles[op] >> 10));
+            serial_puts(line);
+        }
+    }
+
+    serial_puts("zone,live,peak,failures,moves,purged_blocks,purged_bytes,compact_moved\n");
+    for (u32 zi = 0; zi < gMemTel.zoneCount; zi++) {
+        MemTelemetryZoneStats* s = &gMemTel.zones[zi];
+        snprintf(line, sizeof(line), "%c,%u,%u,%u,%u,%u,%u,%u\n", s->name[0] ? s->name[0] : '?',
+                 s->liveBytes, s->peakLiveBytes, s->allocFailures, s->handleMoves,
+                 s->purgedBlocks, s->purgedBytes, s->compactBytesMoved);
+        serial_puts(line);
+    }
+
+    serial_puts("zone,bucket_max,count\n");
+    for (u32 zi = 0; zi < gMemTel.zoneCount; zi++) {
+        MemTelemetryZoneStats* s = &gMemTel.zones[zi];
+        for (u32 bk = 0; bk < kMemTelemetryHistBuckets; bk++) {
+            if (!s->sizeHist[bk]) continue;
+            snprintf(line, sizeof(line), "%c,%u,%u\n", s->name[0] ? s->name[0] : '?',
+                     (bk == kMemTelemetryHistBuckets - 1) ? 0xFFFFFFFFu : (16u << bk),
+                     s->sizeHist[bk]);
+            serial_puts(line);
+        }
+    }
+
+    serial_puts("owner,key,allocs,live,peak\n");
+    for (u32 i = 0; i < kMemTelemetryMaxOwners; i++) {
+        MemTelemetryOwner* o = &gMemTel.owners[i];
+        if (!o->allocCount && !o->liveBytes) continue;
+        snprintf(line, sizeof(line), "%u,%x,%u,%u,%u\n", i, o->key,
+                 o->allocCount, o->liveBytes, o->peakLiveBytes);
+        serial_puts(line);
+    }
+    serial_puts("# end\n");
+}
+
+/* Binary snapshot: "MTEL", little-endian u32 length, raw snapshot bytes. */
+void MemTelemetry_DumpBinary(void) {
+    const u8* p = (const u8*)&gMemTel;
+    u32 len = (u32)sizeof(gMemTel);
+
+    serial_putchar('M');
+    serial_putchar('T');
+    serial_putchar('E');
+    serial_putchar('L');
+    for (u32 i = 0; i < 4; i++) {
+        serial_putchar((char)((len >> (i * 8)) & 0xFF));
+    }
+    for (u32 i = 0; i < len; i++) {
+        serial_putchar((char)p[i]);
+    }
+}
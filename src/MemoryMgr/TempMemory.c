@@ -0,0 +1,121 @@
+/*
+ * TempMemory.c - Temporary memory and kernel scratch arena
+ *
+ * TempNewHandle and friends allocate from the temp zone set up by
+ * InitMemoryManager.  The scratch arena is a static bump region; blocks it
+ * can't hold spill into the temp zone and are disposed on release.
+ * See MemoryMgr/TempMemory.h.
+ */
+
+#include "SystemTypes.h"
+#include "MemoryMgr/MemoryManager.h"
+#include "MemoryMgr/TempMemory.h"
+
+/* ======================== Temporary Memory ======================== */
+
+Handle TempNewHandle(Size logicalSize, OSErr* resultCode) {
+    Handle h = NULL;
+
+    if (logicalSize >= 0) {
+        ZoneInfo* saved = GetZone();
+        SetZone(MemoryManager_GetTempZone());
+        h = NewHandle((u32)logicalSize);
+        SetZone(saved);
+    }
+
+    if (resultCode) *resultCode = h ? noErr : memFullErr;
+    return h;
+}
+
+Size TempFreeMem(void) {
+    return (Size)MemoryManager_GetTempZone()->bytesFree;
+}
+
+Size TempMaxMem(Size* grow) {
+    ZoneInfo* saved = GetZone();
+    SetZone(MemoryManager_GetTempZone());
+    Size max = (Size)MaxMem();
+    SetZone(saved);
+
+    /* The temp zone is fixed-size; it never grows */
+    if (grow) *grow = 0;
+    return max;
+}
+
+Ptr TempTopMem(void) {
+    return (Ptr)MemoryManager_GetTempZone()->limit;
+}
+
+static OSErr temp_handle_check(Handle h) {
+    if (!h) return nilHandleErr;
+    if (!*h) return memPurgedErr;
+    return noErr;
+}
+
+void TempHLock(Handle h, OSErr* resultCode) {
+    OSErr err = temp_handle_check(h);
+    if (err == noErr) HLock(h);
+    if (resultCode) *resultCode = err;
+}
+
+void TempHUnlock(Handle h, OSErr* resultCode) {
+    OSErr err = temp_handle_check(h);
+    if (err == noErr) HUnlock(h);
+    if (resultCode) *resultCode = err;
+}
+
+void TempDisposeHandle(Handle h, OSErr* resultCode) {
+    OSErr err = h ? noErr : nilHandleErr;
+    if (h) DisposeHandle(h);
+    if (resultCode) *resultCode = err;
+}
+
+/* ======================== Scratch Arena ======================== */
+
+static u8 gScratch[kTempScratchSize] __attribute__((aligned(kTempScratchAlign)));
+static u32 gScratchTop = 0;
+static u32 gScratchHighWater = 0;
+static void* gScratchSpill[kTempScratchSpillMax];
+static u32 gScratchSpills = 0;
+
+TempScratchMark TempScratch_Mark(void) {
+    TempScratchMark mark = { gScratchTop, gScratchSpills };
+    return mark;
+}
+
+void* TempScratch_Alloc(u32 size) {
+    u32 need = (size + (kTempScratchAlign - 1)) & ~(kTempScratchAlign - 1);
+
+    if (need >= size && need <= kTempScratchSize - gScratchTop) {
+        void* p = &gScratch[gScratchTop];
+        gScratchTop += need;
+        if (gScratchTop > gScratchHighWater) gScratchHighWater = gScratchTop;
+        return p;
+    }
+
+    /* Too big for what's left: spill to the temp zone, then the current one */
+    if (gScratchSpills >= kTempScratchSpillMax) return NULL;
+
+    ZoneInfo* saved = GetZone();
+    SetZone(MemoryManager_GetTempZone());
+    void* p = NewPtr(size);
+    SetZone(saved);
+    if (!p) p = NewPtr(size);
+    if (!p) return NULL;
+
+    gScratchSpill[gScratchSpills++] = p;
+    return p;
+}
+
+void TempScratch_Release(TempScratchMark mark) {
+    while (gScratchSpills > mark.spills) {
+        DisposePtr(gScratchSpill[--gScratchSpills]);
+    }
+    if (mark.top < gScratchTop) {
+        gScratchTop = mark.top;
+    }
+}
+
+u32 TempScratch_HighWater(void) {
+    return gScratchHighWater;
+}
@@ -1,8 +1,13 @@
 /*
  * ATA_Driver.c - ATA/IDE disk driver implementation
  *
- * Bare-metal ATA/IDE driver using PIO mode for System 7.1.
- * Supports LBA28 addressing for drives up to 128GB.
+ * Bare-metal ATA/IDE driver for System 7.1.  Transfers use READ/WRITE
+ * MULTIPLE or single-sector PIO.  PCI IDE bus-master DMA is experimental
+ * and only chosen when built with ATA_DMA=1.  LBA48 is used for addresses
+ * past 28 bits and for commands longer than 256 sectors.
+ *
+ * Interrupts are not wired up on x86, so DMA completion is detected by
+ * polling the bus-master status register with INTRQ masked (nIEN).
  */
 
 #include "ATA_Driver.h"
@@ -22,6 +27,98 @@ static ATADevice g_ata_devices[ATA_MAX_DEVICES];
 static int g_device_count = 0;
 static bool g_ata_initialized = false;
 
+/* PCI IDE controller bus-master base (BAR4), 0 if none usable */
+static uint16_t g_bm_base = 0;
+static uint8_t g_ide_prog_if = 0;
+
+/* Physical Region Descriptor; the kernel runs identity mapped */
+typedef struct {
+    uint32_t addr;
+    uint16_t bytes;         /* 0 = 64KB */
+    uint16_t flags;
+} __attribute__((packed)) ATA_PRD;
+
+#define ATA_PRD_ENTRIES 8
+
+/* One table per channel; must not cross a 64KB boundary */
+static ATA_PRD g_prd_tables[2][ATA_PRD_ENTRIES] __attribute__((aligned(128)));
+
+#define PCI_CONFIG_ADDRESS  0xCF8
+#define PCI_CONFIG_DATA     0xCFC
+
+static uint32_t pci_read32(uint8_t bus, uint8_t dev, uint8_t func, uint8_t reg) {
+    hal_outl(PCI_CONFIG_ADDRESS, 0x80000000u | ((uint32_t)bus << 16) |
+             ((uint32_t)dev << 11) | ((uint32_t)func << 8) | (reg & 0xFC));
+    return hal_inl(PCI_CONFIG_DATA);
+}
+
+static void pci_write32(uint8_t bus, uint8_t dev, uint8_t func, uint8_t reg, uint32_t value) {
+    hal_outl(PCI_CONFIG_ADDRESS, 0x80000000u | ((uint32_t)bus << 16) |
+             ((uint32_t)dev << 11) | ((uint32_t)func << 8) | (reg & 0xFC));
+    hal_outl(PCI_CONFIG_DATA, value);
+}
+
+/*
+ * ata_pci_probe - Find an IDE controller on bus 0 and enable bus mastering
+ */
+static void ata_pci_probe(void) {
+    g_bm_base = 0;
+
+    for (uint8_t dev = 0; dev < 32; dev++) {
+        for (uint8_t func = 0; func < 8; func++) {
+            uint32_t id = pci_read32(0, dev, func, 0x00);
+            if ((id & 0xFFFF) == 0xFFFF) {
+                if (func == 0) break;
+                continue;
+            }
+
+            uint32_t class_reg = pci_read32(0, dev, func, 0x08);
+            uint8_t class_code = (class_reg >> 24) & 0xFF;
+            uint8_t subclass = (class_reg >> 16) & 0xFF;
+            uint8_t prog_if = (class_reg >> 8) & 0xFF;
+            if (class_code != 0x01 || subclass != 0x01 || !(prog_if & 0x80)) {
+                continue;
+            }
+
+            uint32_t bar4 = pci_read32(0, dev, func, 0x20);
+            if (!(bar4 & 1) || (bar4 & 0xFFFC) == 0) {
+                continue;
+            }
+
+            /* I/O space + bus master */
+            uint32_t command = pci_read32(0, dev, func, 0x04);
+            pci_write32(0, dev, func, 0x04, (command & 0xFFFF) | 0x05);
+
+            g_bm_base = (uint16_t)(bar4 & 0xFFFC);
+            g_ide_prog_if = prog_if;
+            PLATFORM_LOG_DEBUG("ATA: IDE controller %04x:%04x at 00:%02x.%u, bus master at 0x%04x\n",
+                         id & 0xFFFF, id >> 16, dev, func, g_bm_base);
+            return;
+        }
+    }
+
+    PLATFORM_LOG_DEBUG("ATA: No bus-master IDE controller, using PIO\n");
+}
+
+/* Bus-master registers for a legacy-port channel, 0 if it isn't usable */
+static uint16_t ata_channel_bm(uint16_t base_io) {
+    if (!g_bm_base) return 0;
+
+    /* Native-mode channels don't use the legacy ports this driver drives */
+    bool primary = (base_io == ATA_PRIMARY_IO);
+    if (g_ide_prog_if & (primary ? 0x01 : 0x04)) return 0;
+
+    return primary ? g_bm_base : (uint16_t)(g_bm_base + ATA_BM_CHANNEL_STRIDE);
+}
+
+static inline void ata_insw(uint16_t port, void* buffer, uint32_t words) {
+    __asm__ volatile ("rep insw" : "+D"(buffer), "+c"(words) : "d"(port) : "memory");
+}
+
+static inline void ata_outsw(uint16_t port, const void* buffer, uint32_t words) {
+    __asm__ volatile ("rep outsw" : "+S"(buffer), "+c"(words) : "d"(port) : "memory");
+}
+
 /* 400ns delay by reading alternate status register */
 static inline void ata_io_delay(uint16_t control_io) {
     for (int i = 0; i < 4; i++) {
@@ -149,7 +246,7 @@ static bool ATA_IdentifyDevice(uint16_t base_io, bool is_slave, uint16_t* buffer
 
     /* Read 256 words (512 bytes) of identification data */
     for (int i = 0; i < 256; i++) {
-        hal_inw(base_io + ATA_REG_DATA);
+        buffer[i] = hal_inw(base_io + ATA_REG_DATA);
     }
 
     return true;
@@ -206,6 +303,42 @@ static void ATA_ParseIdentifyData(uint16_t* id_data, ATADevice* device) {
 
     /* Check for DMA support (word 49, bit 8) */
     device->dma_supported = (id_data[49] & (1 << 8)) != 0;
+
+    /* Largest DRQ block for READ/WRITE MULTIPLE (word 47, low byte) */
+    device->multiple_sectors = id_data[47] & 0xFF;
+}
+
+/*
+ * ATA_ConfigureTransfers - Enable READ/WRITE MULTIPLE and pick a transfer mode
+ */
+static void ATA_ConfigureTransfers(ATADevice* device) {
+    uint16_t base_io = device->base_io;
+
+    device->xfer_mode = ATA_XFER_PIO;
+
+    if (device->multiple_sectors > 1) {
+        ATA_SelectDrive(base_io, device->is_slave);
+        ATA_WaitReady(base_io);
+        hal_outb(base_io + ATA_REG_SECCOUNT, (uint8_t)device->multiple_sectors);
+        hal_outb(base_io + ATA_REG_COMMAND, ATA_CMD_SET_MULTIPLE);
+        ata_io_delay(device->control_io);
+        ATA_WaitBusy(base_io);
+
+        if (ATA_ReadStatus(base_io) & ATA_STATUS_ERR) {
+            device->multiple_sectors = 0;
+        } else {
+            device->xfer_mode = ATA_XFER_PIO_MULTIPLE;
+        }
+    } else {
+        device->multiple_sectors = 0;
+    }
+
+    device->bm_io = ata_channel_bm(base_io);
+#ifdef ATA_DMA
+    if (device->dma_supported && device->bm_io) {
+        device->xfer_mode = ATA_XFER_DMA;
+    }
+#endif
 }
 
 /*
@@ -246,6 +379,10 @@ bool ATA_DetectDevice(uint16_t base_io, bool is_slave, ATADevice* device) {
     ATA_ParseIdentifyData(id_buffer, device);
     device->present = true;
 
+    if (device->type == ATA_DEVICE_PATA || device->type == ATA_DEVICE_SATA) {
+        ATA_ConfigureTransfers(device);
+    }
+
     return true;
 }
 
@@ -264,6 +401,9 @@ OSErr hal_storage_init(void) {
     memset(g_ata_devices, 0, sizeof(g_ata_devices));
     g_device_count = 0;
 
+    /* Bus-master DMA needs the controller's BAR4 */
+    ata_pci_probe();
+
     /* Reset primary and secondary buses */
     PLATFORM_LOG_DEBUG("ATA: Resetting primary bus\n");
     ATA_SoftReset(ATA_PRIMARY_CONTROL);
@@ -345,128 +485,231 @@ ATADevice* ATA_GetDevice(int index) {
 }
 
 /*
- * ATA_ReadSectors - Read sectors using PIO mode (LBA28)
+ * ata_issue - Program the task file and send a command
  */
-OSErr ATA_ReadSectors(ATADevice* device, uint32_t lba, uint8_t count, void* buffer) {
-    if (!device || !device->present) {
-        return paramErr;
+static void ata_issue(ATADevice* device, uint64_t lba, uint32_t count, uint8_t command, bool lba48) {
+    uint16_t base_io = device->base_io;
+    uint8_t drive = device->is_slave ? ATA_DRIVE_SLAVE : ATA_DRIVE_MASTER;
+
+    ATA_WaitBusy(base_io);
+
+    if (lba48) {
+        hal_outb(base_io + ATA_REG_DRIVE_HEAD, drive | ATA_DRIVE_LBA);
+        ata_io_delay(device->control_io);
+
+        /* High-order bytes first, then low; a count of 0 means 65536 */
+        hal_outb(base_io + ATA_REG_SECCOUNT, (count >> 8) & 0xFF);
+        hal_outb(base_io + ATA_REG_LBA_LOW, (lba >> 24) & 0xFF);
+        hal_outb(base_io + ATA_REG_LBA_MID, (lba >> 32) & 0xFF);
+        hal_outb(base_io + ATA_REG_LBA_HIGH, (lba >> 40) & 0xFF);
+        hal_outb(base_io + ATA_REG_SECCOUNT, count & 0xFF);
+        hal_outb(base_io + ATA_REG_LBA_LOW, lba & 0xFF);
+        hal_outb(base_io + ATA_REG_LBA_MID, (lba >> 8) & 0xFF);
+        hal_outb(base_io + ATA_REG_LBA_HIGH, (lba >> 16) & 0xFF);
+    } else {
+        hal_outb(base_io + ATA_REG_DRIVE_HEAD, drive | ATA_DRIVE_LBA | ((lba >> 24) & 0x0F));
+        ata_io_delay(device->control_io);
+
+        /* All three LBA registers required for 28-bit LBA; a count of 0 means 256 */
+        hal_outb(base_io + ATA_REG_SECCOUNT, count & 0xFF);
+        hal_outb(base_io + ATA_REG_LBA_LOW, lba & 0xFF);
+        hal_outb(base_io + ATA_REG_LBA_MID, (lba >> 8) & 0xFF);
+        hal_outb(base_io + ATA_REG_LBA_HIGH, (lba >> 16) & 0xFF);
     }
 
-    if (count == 0) {
-        return noErr;
+    hal_outb(base_io + ATA_REG_COMMAND, command);
+    ata_io_delay(device->control_io);
+}
+
+static OSErr ata_check_error(ATADevice* device, const char* what) {
+    uint8_t status = ATA_ReadStatus(device->base_io);
+    if (status & (ATA_STATUS_ERR | ATA_STATUS_DF)) {
+        uint8_t error = hal_inb(device->base_io + ATA_REG_ERROR);
+        PLATFORM_LOG_DEBUG("ATA: %s error (status=0x%02x, error=0x%02x)\n", what, status, error);
+        return ioErr;
     }
+    return noErr;
+}
 
+/*
+ * ata_pio - One PIO command; `block` sectors move per DRQ
+ */
+static OSErr ata_pio(ATADevice* device, uint64_t lba, uint32_t count, uint8_t* buffer,
+                     bool write, bool lba48, uint32_t block) {
     uint16_t base_io = device->base_io;
-    uint16_t control_io = device->control_io;
-    uint16_t* buf16 = (uint16_t*)buffer;
+    uint8_t command;
 
-    /* Select drive and set LBA mode */
-    uint8_t drive_head = (device->is_slave ? ATA_DRIVE_SLAVE : ATA_DRIVE_MASTER) |
-                         ATA_DRIVE_LBA | ((lba >> 24) & 0x0F);
-    hal_outb(base_io + ATA_REG_DRIVE_HEAD, drive_head);
-    ata_io_delay(control_io);
+    if (block > 1) {
+        command = write ? (lba48 ? ATA_CMD_WRITE_MULTIPLE_EXT : ATA_CMD_WRITE_MULTIPLE)
+                        : (lba48 ? ATA_CMD_READ_MULTIPLE_EXT : ATA_CMD_READ_MULTIPLE);
+    } else {
+        command = write ? (lba48 ? ATA_CMD_WRITE_SECTORS_EXT : ATA_CMD_WRITE_SECTORS)
+                        : (lba48 ? ATA_CMD_READ_SECTORS_EXT : ATA_CMD_READ_SECTORS);
+    }
 
-    /* Set sector count and LBA (all three LBA registers required for 28-bit LBA) */
-    hal_outb(base_io + ATA_REG_SECCOUNT, count);
-    hal_outb(base_io + ATA_REG_LBA_LOW, lba & 0xFF);
-    hal_outb(base_io + ATA_REG_LBA_MID, (lba >> 8) & 0xFF);
-    hal_outb(base_io + ATA_REG_LBA_HIGH, (lba >> 16) & 0xFF);
-    hal_outb(base_io + ATA_REG_COMMAND, ATA_CMD_READ_SECTORS);
-    ata_io_delay(control_io);
+    ata_issue(device, lba, count, command, lba48);
+
+    uint32_t done = 0;
+    while (done < count) {
+        uint32_t n = count - done;
+        if (n > block) n = block;
 
-    /* Read each sector */
-    for (int sector = 0; sector < count; sector++) {
-        /* Wait for DRQ */
         if (!ATA_WaitDRQ(base_io)) {
-            PLATFORM_LOG_DEBUG("ATA: Read failed at sector %d\n", sector);
+            PLATFORM_LOG_DEBUG("ATA: %s failed at sector %u\n", write ? "Write" : "Read", done);
             return ioErr;
         }
 
-        /* Read 256 words (512 bytes) */
-        for (int i = 0; i < 256; i++) {
-            buf16[sector * 256 + i] = hal_inw(base_io + ATA_REG_DATA);
-        }
-
-        /* Check for errors */
-        uint8_t status = ATA_ReadStatus(base_io);
-        if (status & ATA_STATUS_ERR) {
-            uint8_t error = hal_inb(base_io + ATA_REG_ERROR);
-            PLATFORM_LOG_DEBUG("ATA: Read error (status=0x%02x, error=0x%02x)\n", status, error);
-            return ioErr;
+        if (write) {
+            ata_outsw(base_io + ATA_REG_DATA, buffer + done * 512, n * 256);
+        } else {
+            ata_insw(base_io + ATA_REG_DATA, buffer + done * 512, n * 256);
         }
+        done += n;
     }
 
-    PLATFORM_LOG_DEBUG("ATA: Read complete\n");
-    return noErr;
+    ATA_WaitBusy(base_io);
+    return ata_check_error(device, write ? "Write" : "Read");
 }
 
 /*
- * ATA_WriteSectors - Write sectors using PIO mode (LBA28)
+ * ata_dma - One bus-master DMA command of at most ATA_DMA_MAX_SECTORS
  */
-OSErr ATA_WriteSectors(ATADevice* device, uint32_t lba, uint8_t count, const void* buffer) {
-    if (!device || !device->present) {
-        return paramErr;
-    }
-
-    if (count == 0) {
-        return noErr;
+static OSErr ata_dma(ATADevice* device, uint64_t lba, uint32_t count, uint8_t* buffer,
+                     bool write, bool lba48) {
+    uint16_t bm = device->bm_io;
+    ATA_PRD* prd = g_prd_tables[device->base_io == ATA_PRIMARY_IO ? 0 : 1];
+
+    /* Split the buffer so no region crosses a 64KB boundary */
+    uint32_t addr = (uint32_t)(uintptr_t)buffer;
+    uint32_t remaining = count * 512;
+    int entries = 0;
+    while (remaining > 0) {
+        if (entries == ATA_PRD_ENTRIES) return paramErr;
+        uint32_t chunk = 0x10000 - (addr & 0xFFFF);
+        if (chunk > remaining) chunk = remaining;
+        prd[entries].addr = addr;
+        prd[entries].bytes = (uint16_t)(chunk & 0xFFFF);
+        prd[entries].flags = 0;
+        entries++;
+        addr += chunk;
+        remaining -= chunk;
+    }
+    prd[entries - 1].flags = ATA_PRD_EOT;
+
+    uint8_t direction = write ? 0 : ATA_BM_CMD_READ;
+    hal_outb(bm + ATA_BM_REG_COMMAND, 0);
+    hal_outl(bm + ATA_BM_REG_PRDT, (uint32_t)(uintptr_t)prd);
+    hal_outb(bm + ATA_BM_REG_COMMAND, direction);
+    hal_outb(bm + ATA_BM_REG_STATUS,
+             hal_inb(bm + ATA_BM_REG_STATUS) | ATA_BM_STATUS_ERR | ATA_BM_STATUS_IRQ);
+
+    uint8_t command = write ? (lba48 ? ATA_CMD_WRITE_DMA_EXT : ATA_CMD_WRITE_DMA)
+                            : (lba48 ? ATA_CMD_READ_DMA_EXT : ATA_CMD_READ_DMA);
+    ata_issue(device, lba, count, command, lba48);
+    hal_outb(bm + ATA_BM_REG_COMMAND, direction | ATA_BM_CMD_START);
+
+    /* Engine goes inactive once the PRD table is exhausted or on error */
+    uint8_t bm_status = 0;
+    int timeout = 10000000;
+    while (timeout-- > 0) {
+        bm_status = hal_inb(bm + ATA_BM_REG_STATUS);
+        if (!(bm_status & ATA_BM_STATUS_ACTIVE) || (bm_status & ATA_BM_STATUS_IRQ)) {
+            break;
+        }
+        if (hal_inb(device->control_io + ATA_REG_ALT_STATUS) & (ATA_STATUS_ERR | ATA_STATUS_DF)) {
+            break;
+        }
     }
 
-    uint16_t base_io = device->base_io;
-    uint16_t control_io = device->control_io;
-    const uint16_t* buf16 = (const uint16_t*)buffer;
+    ATA_WaitBusy(device->base_io);
+    hal_outb(bm + ATA_BM_REG_COMMAND, direction);
+    OSErr err = ata_check_error(device, write ? "DMA write" : "DMA read");
+    hal_outb(bm + ATA_BM_REG_STATUS,
+             hal_inb(bm + ATA_BM_REG_STATUS) | ATA_BM_STATUS_ERR | ATA_BM_STATUS_IRQ);
 
-    PLATFORM_LOG_DEBUG("ATA: Writing %u sector(s) to LBA %u\n", count, lba);
-
-    /* Wait for drive to be ready */
-    ATA_WaitReady(base_io);
-
-    /* Select drive and set LBA mode */
-    uint8_t drive_head = (device->is_slave ? ATA_DRIVE_SLAVE : ATA_DRIVE_MASTER) |
-                         ATA_DRIVE_LBA | ((lba >> 24) & 0x0F);
-    hal_outb(base_io + ATA_REG_DRIVE_HEAD, drive_head);
-    ata_io_delay(control_io);
+    if (timeout <= 0 || (bm_status & ATA_BM_STATUS_ERR)) {
+        PLATFORM_LOG_DEBUG("ATA: DMA %s (bm status=0x%02x)\n",
+                     timeout <= 0 ? "timeout" : "error", bm_status);
+        return ioErr;
+    }
+    return err;
+}
 
-    /* Set sector count and LBA */
-    hal_outb(base_io + ATA_REG_SECCOUNT, count);
-    hal_outb(base_io + ATA_REG_LBA_LOW, lba & 0xFF);
-    hal_outb(base_io + ATA_REG_LBA_MID, (lba >> 8) & 0xFF);
-    hal_outb(base_io + ATA_REG_LBA_HIGH, (lba >> 16) & 0xFF);
+/*
+ * ATA_GetSectorCount - Total addressable sectors
+ */
+uint64_t ATA_GetSectorCount(const ATADevice* device) {
+    if (!device) return 0;
+    return device->lba48_supported ? device->sectors_48 : device->sectors;
+}
 
-    /* Send WRITE SECTORS command */
-    hal_outb(base_io + ATA_REG_COMMAND, ATA_CMD_WRITE_SECTORS);
-    ata_io_delay(control_io);
+/*
+ * ATA_Transfer - Read or write any number of sectors
+ */
+OSErr ATA_Transfer(ATADevice* device, uint64_t lba, uint32_t count, void* buffer, bool write) {
+    if (!device || !device->present || !buffer) {
+        return paramErr;
+    }
+    if (lba + count > ATA_GetSectorCount(device)) {
+        return paramErr;
+    }
 
-    /* Write each sector */
-    for (int sector = 0; sector < count; sector++) {
-        /* Wait for DRQ */
-        if (!ATA_WaitDRQ(base_io)) {
-            PLATFORM_LOG_DEBUG("ATA: Write failed at sector %d\n", sector);
-            return ioErr;
+    uint8_t* buf = (uint8_t*)buffer;
+    while (count > 0) {
+        /* LBA28 covers the first 2^28 sectors, 256 per command */
+        bool lba48 = device->lba48_supported &&
+                     (lba + count > 0x0FFFFFFF || count > ATA_LBA28_MAX_SECTORS);
+        uint32_t n = lba48 ? ATA_LBA48_MAX_SECTORS : ATA_LBA28_MAX_SECTORS;
+
+        /* DMA needs a word-aligned buffer */
+        bool dma = device->xfer_mode == ATA_XFER_DMA && ((uintptr_t)buf & 1) == 0;
+        if (dma && n > ATA_DMA_MAX_SECTORS) n = ATA_DMA_MAX_SECTORS;
+        if (n > count) n = count;
+
+        OSErr err;
+        if (dma) {
+            err = ata_dma(device, lba, n, buf, write, lba48);
+            if (err != noErr) {
+                /* Retry this chunk with PIO and stop using DMA on this drive */
+                PLATFORM_LOG_DEBUG("ATA: Disabling DMA after failure at LBA %u\n", (uint32_t)lba);
+                device->xfer_mode = device->multiple_sectors ? ATA_XFER_PIO_MULTIPLE : ATA_XFER_PIO;
+                continue;
+            }
+        } else {
+            uint32_t block = (device->xfer_mode != ATA_XFER_PIO && device->multiple_sectors)
+                           ? device->multiple_sectors : 1;
+            err = ata_pio(device, lba, n, buf, write, lba48, block);
         }
-
-        /* Write 256 words (512 bytes) */
-        for (int i = 0; i < 256; i++) {
-            hal_outw(base_io + ATA_REG_DATA, buf16[sector * 256 + i]);
+        if (err != noErr) {
+            return err;
         }
 
-        /* Wait for completion */
-        ATA_WaitBusy(base_io);
+        lba += n;
+        count -= n;
+        buf += n * 512;
+    }
 
-        /* Check for errors */
-        uint8_t status = ATA_ReadStatus(base_io);
-        if (status & ATA_STATUS_ERR) {
-            uint8_t error = hal_inb(base_io + ATA_REG_ERROR);
-            PLATFORM_LOG_DEBUG("ATA: Write error (status=0x%02x, error=0x%02x)\n", status, error);
-            return ioErr;
-        }
+    return noErr;
+}
+
+/*
+ * ATA_ReadSectors - Read up to 255 sectors
+ */
+OSErr ATA_ReadSectors(ATADevice* device, uint32_t lba, uint8_t count, void* buffer) {
+    return ATA_Transfer(device, lba, count, buffer, false);
+}
+
+/*
+ * ATA_WriteSectors - Write up to 255 sectors and flush the drive cache
+ */
+OSErr ATA_WriteSectors(ATADevice* device, uint32_t lba, uint8_t count, const void* buffer) {
+    OSErr err = ATA_Transfer(device, lba, count, (void*)(uintptr_t)buffer, true);
+    if (err != noErr) {
+        return err;
     }
 
     /* Flush write cache */
-    ATA_FlushCache(device);
-
-    PLATFORM_LOG_DEBUG("ATA: Write complete\n");
-    return noErr;
+    return ATA_FlushCache(device);
 }
 
 /*
@@ -487,7 +730,8 @@ OSErr ATA_FlushCache(ATADevice* device) {
     ATA_SelectDrive(base_io, device->is_slave);
 
     /* Send FLUSH CACHE command */
-    hal_outb(base_io + ATA_REG_COMMAND, ATA_CMD_FLUSH_CACHE);
+    hal_outb(base_io + ATA_REG_COMMAND,
+             device->lba48_supported ? ATA_CMD_FLUSH_CACHE_EXT : ATA_CMD_FLUSH_CACHE);
     ata_io_delay(control_io);
 
     /* Wait for completion */
@@ -529,6 +773,10 @@ void ATA_PrintDeviceInfo(ATADevice* device) {
                  (device->sectors / 2048));  /* sectors * 512 / 1024 / 1024 */
     PLATFORM_LOG_DEBUG("ATA:   LBA48: %s\n", device->lba48_supported ? "Yes" : "No");
     PLATFORM_LOG_DEBUG("ATA:   DMA: %s\n", device->dma_supported ? "Yes" : "No");
+    PLATFORM_LOG_DEBUG("ATA:   Multiple: %u sectors/block\n", device->multiple_sectors);
+    PLATFORM_LOG_DEBUG("ATA:   Transfer mode: %s\n",
+                 device->xfer_mode == ATA_XFER_DMA ? "bus-master DMA" :
+                 device->xfer_mode == ATA_XFER_PIO_MULTIPLE ? "PIO multiple" : "PIO");
 }
 
 /*
@@ -546,7 +794,7 @@ OSErr hal_storage_get_drive_info(int drive_index, hal_storage_info_t* info) {
     }
 
     info->block_size = 512;  /* ATA sectors are always 512 bytes */
-    info->block_count = device->sectors;
+    info->block_count = ATA_GetSectorCount(device);
 
     return noErr;
 }
@@ -557,29 +805,7 @@ OSErr hal_storage_read_blocks(int drive_index, uint64_t start_block, uint32_t bl
         return paramErr;
     }
 
-    /* ATA uses LBA28, so we can only address 28 bits */
-    if (start_block > 0x0FFFFFFF) {
-        return paramErr;
-    }
-
-    /* Read in chunks of 255 sectors (max for LBA28) */
-    uint8_t* buf = (uint8_t*)buffer;
-    uint32_t remaining = block_count;
-    uint32_t current_lba = (uint32_t)start_block;
-
-    while (remaining > 0) {
-        uint8_t count = (remaining > 255) ? 255 : (uint8_t)remaining;
-        OSErr err = ATA_ReadSectors(device, current_lba, count, buf);
-        if (err != noErr) {
-            return err;
-        }
-
-        remaining -= count;
-        current_lba += count;
-        buf += (count * 512);
-    }
-
-    return noErr;
+    return ATA_Transfer(device, start_block, block_count, buffer, false);
 }
 
 OSErr hal_storage_write_blocks(int drive_index, uint64_t start_block, uint32_t block_count, const void* buffer) {
@@ -588,26 +814,9 @@ OSErr hal_storage_write_blocks(int drive_index, uint64_t start_block, uint32_t b
         return paramErr;
     }
 
-    /* ATA uses LBA28, so we can only address 28 bits */
-    if (start_block > 0x0FFFFFFF) {
-        return paramErr;
-    }
-
-    /* Write in chunks of 255 sectors (max for LBA28) */
-    const uint8_t* buf = (const uint8_t*)buffer;
-    uint32_t remaining = block_count;
-    uint32_t current_lba = (uint32_t)start_block;
-
-    while (remaining > 0) {
-        uint8_t count = (remaining > 255) ? 255 : (uint8_t)remaining;
-        OSErr err = ATA_WriteSectors(device, current_lba, count, buf);
-        if (err != noErr) {
-            return err;
-        }
-
-        remaining -= count;
-        current_lba += count;
-        buf += (count * 512);
+    OSErr err = ATA_Transfer(device, start_block, block_count, (void*)(uintptr_t)buffer, true);
+    if (err != noErr) {
+        return err;
     }
 
     /* Flush cache after write */
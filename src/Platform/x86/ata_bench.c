@@ -0,0 +1,135 @@
+/*
+ * ata_bench.c - ATA transfer mode benchmark
+ *
+ * Reads from the first ATA drive in each transfer mode it supports
+ * (single-sector PIO, READ MULTIPLE, and bus-master DMA when built with
+ * ATA_DMA=1): 16MB sequentially in 128KB requests, then 500 random 4KB
+ * reads.  Reports throughput over serial and checks every mode returns
+ * the same bytes.
+ *
+ * Activated with ATA_BENCH=1 compile flag; called from main.c after
+ * storage init.  Meant for QEMU, e.g. run_qemu.sh with a large -hda image.
+ */
+
+#include "SystemTypes.h"
+#include "ATA_Driver.h"
+#include "MemoryMgr/MemoryManager.h"
+#include "TimeManager/TimeBase.h"
+#include "Platform/PlatformLogging.h"
+
+#ifdef ATA_BENCH
+
+#define ATA_BENCH_LOG(fmt, ...) serial_logf(kLogModulePlatform, kLogLevelInfo, "[ATA BENCH] " fmt, ##__VA_ARGS__)
+
+#define BENCH_SEQ_BYTES     (16u * 1024u * 1024u)
+#define BENCH_REQ_SECTORS   256u        /* 128KB */
+#define BENCH_RANDOM_READS  500u
+#define BENCH_RANDOM_SECTORS 8u         /* 4KB */
+
+static const char* mode_name(ATATransferMode mode) {
+    switch (mode) {
+        case ATA_XFER_DMA:          return "DMA";
+        case ATA_XFER_PIO_MULTIPLE: return "PIO multiple";
+        default:                    return "PIO";
+    }
+}
+
+static uint32_t checksum(const uint8_t* p, uint32_t len) {
+    uint32_t sum = 0;
+    for (uint32_t i = 0; i < len; i++) {
+        sum = (sum << 1 | sum >> 31) ^ p[i];
+    }
+    return sum;
+}
+
+static void bench_mode(ATADevice* dev, ATATransferMode mode, uint8_t* buf,
+                       uint64_t sectors, uint32_t* firstSum) {
+    dev->xfer_mode = mode;
+
+    uint32_t seqSectors = BENCH_SEQ_BYTES / 512;
+    if (seqSectors > sectors) seqSectors = (uint32_t)sectors;
+    seqSectors -= seqSectors % BENCH_REQ_SECTORS;
+
+    uint32_t start = MicrosecondsNow();
+    for (uint32_t lba = 0; lba < seqSectors; lba += BENCH_REQ_SECTORS) {
+        if (ATA_Transfer(dev, lba, BENCH_REQ_SECTORS, buf, false) != noErr) {
+            ATA_BENCH_LOG("%s: sequential read failed at LBA %u\n", mode_name(mode), lba);
+            return;
+        }
+    }
+    uint32_t seqUs = MicrosecondsNow() - start;
+
+    /* Same bytes in every mode: compare the first request */
+    ATA_Transfer(dev, 0, BENCH_REQ_SECTORS, buf, false);
+    uint32_t sum = checksum(buf, BENCH_REQ_SECTORS * 512);
+    if (*firstSum == 0) *firstSum = sum;
+
+    uint32_t seed = 12345;
+    uint64_t span = sectors - BENCH_RANDOM_SECTORS;
+    start = MicrosecondsNow();
+    for (uint32_t i = 0; i < BENCH_RANDOM_READS; i++) {
+        seed = seed * 1103515245u + 12345u;
+        uint64_t lba = ((uint64_t)seed * 65536u + (seed >> 16)) % span;
+        if (ATA_Transfer(dev, lba, BENCH_RANDOM_SECTORS, buf, false) != noErr) {
+            ATA_BENCH_LOG("%s: random read failed at LBA %u\n", mode_name(mode), (uint32_t)lba);
+            return;
+        }
+    }
+    uint32_t randUs = MicrosecondsNow() - start;
+
+    if (seqUs == 0) seqUs = 1;
+    if (randUs == 0) randUs = 1;
+    ATA_BENCH_LOG("%s: sequential %u KB in %u us (%u KB/s), random %u x 4KB in %u us (%u IOPS)%s\n",
+                  mode_name(mode), seqSectors / 2, seqUs,
+                  (uint32_t)((uint64_t)seqSectors * 512 * 1000000 / 1024 / seqUs),
+                  BENCH_RANDOM_READS, randUs,
+                  (uint32_t)((uint64_t)BENCH_RANDOM_READS * 1000000 / randUs),
+                  sum == *firstSum ? "" : " DATA MISMATCH");
+}
+
+void ATABench_Run(void) {
+    ATADevice* dev = ATA_GetDevice(0);
+    if (!dev || !dev->present) {
+        ATA_BENCH_LOG("no ATA drive\n");
+        return;
+    }
+
+    uint64_t sectors = ATA_GetSectorCount(dev);
+    if (sectors < BENCH_REQ_SECTORS * 2) {
+        ATA_BENCH_LOG("drive too small (%u sectors)\n", (uint32_t)sectors);
+        return;
+    }
+
+    uint8_t* buf = (uint8_t*)NewPtr(BENCH_REQ_SECTORS * 512);
+    if (!buf) {
+        ATA_BENCH_LOG("no memory for buffer\n");
+        return;
+    }
+
+    ATA_BENCH_LOG("%s, %u MB, LBA48 %s, multiple %u, bus master 0x%04x\n",
+                  dev->model, (uint32_t)(sectors / 2048), dev->lba48_supported ? "yes" : "no",
+                  dev->multiple_sectors, dev->bm_io);
+
+    ATATransferMode saved = dev->xfer_mode;
+    uint32_t firstSum = 0;
+
+    bench_mode(dev, ATA_XFER_PIO, buf, sectors, &firstSum);
+    if (dev->multiple_sectors) {
+        bench_mode(dev, ATA_XFER_PIO_MULTIPLE, buf, sectors, &firstSum);
+    }
+#ifdef ATA_DMA
+    if (dev->dma_supported && dev->bm_io) {
+        bench_mode(dev, ATA_XFER_DMA, buf, sectors, &firstSum);
+        if (dev->xfer_mode != ATA_XFER_DMA) {
+            ATA_BENCH_LOG("DMA fell back to PIO\n");
+            saved = dev->xfer_mode;
+        }
+    }
+#endif
+
+    dev->xfer_mode = saved;
+    DisposePtr((Ptr)buf);
+    ATA_BENCH_LOG("done\n");
+}
+
+#endif /* ATA_BENCH */
@@ -33,6 +33,7 @@
 #include "ProcessMgr/ProcessMgr.h"
 #include "ProcessMgr/ProcessLogging.h"
 #include "SegmentLoader/SegmentLoader.h"
+#include "ResourceManager.h"
 #include "CPU/CPUBackend.h"
 #include "CPU/M68KInterp.h"
 #include "EventManager/EventManager.h"
@@ -289,6 +290,7 @@ OSErr LaunchApplication(LaunchParamBlockRec* launchParams)
     SegmentLoaderContext* segLoader = NULL;
     CPUAddr entryPoint;
     UInt32 targetPSN;
+    SInt16 callerResFile;
 
     if (!launchParams) {
         return paramErr;
@@ -325,6 +327,13 @@ OSErr LaunchApplication(LaunchParamBlockRec* launchParams)
         return err;
     }
 
+    /* Open the application's resource fork.  If it has none on disk, CODE
+     * comes from the files already open, as before */
+    callerResFile = CurResFile();
+    if (launchParams->launchAppSpec) {
+        (void)SegmentLoader_OpenAppFile(segLoader, launchParams->launchAppSpec->name);
+    }
+
     /* Load CODE 0 and CODE 1 (entry segments) */
     err = EnsureEntrySegmentsLoaded(segLoader);
     if (err != noErr) {
@@ -372,6 +381,9 @@ OSErr LaunchApplication(LaunchParamBlockRec* launchParams)
         err = segLoader->cpuBackend->EnterAt(segLoader->cpuAS, entryPoint,
                                             kEnterApp);
         /* If we get here, the app returned or there was an error */
+    } else {
+        /* The caller keeps running on its own resource chain */
+        UseResFile(callerResFile);
     }
 
     return err;
@@ -1156,26 +1156,28 @@ SInt16 QDPlatform_DrawGlyph(struct FontStrike *strike, UInt8 ch, SInt16 x, SInt1
         return 0;
     }
 
-    /* Check if character is in range */
-    if (ch < strike->firstChar || ch > strike->lastChar) {
+    /* Get location in bitmap (from location table) */
+    if (!strike->locTable) {
         return 0;
     }
 
-    /* Get character index */
+    /* Characters outside the strike draw its missing glyph, which follows
+     * lastChar in the location table */
     SInt16 charIndex = ch - strike->firstChar;
-
-    /* Get location in bitmap (from location table) */
-    if (!strike->locTable) {
-        return 0;
+    if (ch < strike->firstChar || ch > strike->lastChar) {
+        charIndex = strike->lastChar - strike->firstChar + 1;
     }
 
     SInt16 locStart = strike->locTable[charIndex];
     SInt16 locEnd = strike->locTable[charIndex + 1];
     SInt16 charWidth = locEnd - locStart;
 
+    /* Advance by character code; the glyph image may be wider or narrower */
+    SInt16 advance = strike->widthTable ? strike->widthTable[ch] : charWidth;
+
     /* Get bitmap data */
     if (!strike->bitmapData || !(*strike->bitmapData)) {
-        return charWidth;
+        return advance;
     }
 
     UInt8 *bitmap = (UInt8 *)(*strike->bitmapData);
@@ -1208,7 +1210,7 @@ SInt16 QDPlatform_DrawGlyph(struct FontStrike *strike, UInt8 ch, SInt16 x, SInt1
             pixelY = y - cport->portRect.top;
         } else {
             /* Color port without PixMap - shouldn't happen, fall back to framebuffer */
-            if (!framebuffer) return charWidth;
+            if (!framebuffer) return advance;
             renderBuffer = (Ptr)framebuffer;
             renderPitch = fb_pitch;
             renderWidth = fb_width;
@@ -1218,7 +1220,7 @@ SInt16 QDPlatform_DrawGlyph(struct FontStrike *strike, UInt8 ch, SInt16 x, SInt1
         }
     } else {
         /* Drawing to basic GrafPort (screen framebuffer) */
-        if (!framebuffer) return charWidth;
+        if (!framebuffer) return advance;
 
         renderBuffer = (Ptr)framebuffer;
         renderPitch = fb_pitch;
@@ -1231,7 +1233,7 @@ SInt16 QDPlatform_DrawGlyph(struct FontStrike *strike, UInt8 ch, SInt16 x, SInt1
         }
     }
 
-    if (!renderBuffer) return charWidth;
+    if (!renderBuffer) return advance;
 
     /* Draw the glyph */
     UInt32 *pixels = (UInt32 *)renderBuffer;
@@ -1259,12 +1261,7 @@ SInt16 QDPlatform_DrawGlyph(struct FontStrike *strike, UInt8 ch, SInt16 x, SInt1
         }
     }
 
-    /* Return character width for pen advancement */
-    if (strike->widthTable) {
-        return strike->widthTable[charIndex];
-    }
-
-    return charWidth;
+    return advance;
 }
 
 /**
@@ -0,0 +1,593 @@
+/*
+ * DcmpBench.c - 'dcmp' decompressor round-trip and throughput benchmark
+ *
+ * Builds three 64KB vectors - 68k-style code, sparse data with long runs,
+ * and noise - and packs each with simple dcmp 0, 1 and 2 encoders here.
+ * Every packed vector must unpack to the original; then each is unpacked
+ * repeatedly and the throughput reported.  Last, the packed vectors are
+ * written as resCompressed resources to a scratch file and read back
+ * through GetResource.  Then a boot's worth of repeated GetResource /
+ * ReleaseResource of compressed 'CDEF', 'WDEF', 'MDEF', 'FONT' and 'PICT'
+ * resources runs without and with the decompressed-resource cache, and
+ * PurgeMem is shown to reclaim the cached pictures but not the pinned
+ * definition procedures and fonts.
+ *
+ * The encoders only aim to cover every decoder path (literals,
+ * remembered literals and their reuse, constant words, runs, custom
+ * GreggyBits tables, tagged and untagged), not to pack well.
+ *
+ * Activated with DCMP_BENCH=1 compile flag; called from main.c once the
+ * boot volume is mounted.  This is a boot-time benchmark that reports over
+ * serial; the tree has no host build of it.
+ */
+
+#include "SystemTypes.h"
+#include "MacTypes.h"
+#include "System71StdLib.h"
+#include "FileManager.h"
+#include "MemoryMgr/MemoryManager.h"
+#include "ResourceMgr/ResourceMgr.h"
+#include "ResourceMgr/resource_manager.h"
+#include "ResourceMgr/ResourceMgrPriv.h"
+#include "ResourceMgr/ResourceLogging.h"
+#include "ResourceMgr/ResourceDecompress.h"
+#include "ResourceMgr/DecompressCache.h"
+#include "TimeManager/TimeBase.h"
+#include <string.h>
+
+#ifdef DCMP_BENCH
+
+#define DCMP_BENCH_LOG(fmt, ...) serial_logf(kLogModuleResource, kLogLevelInfo, "[DCMP BENCH] " fmt, ##__VA_ARGS__)
+
+#define BENCH_VECTOR_SIZE   65536u
+#define BENCH_BYTES         (8u * 1024u * 1024u)    /* Unpacked per timing */
+#define BENCH_CHUNK         8u      /* Bytes per remembered literal */
+#define BENCH_VARS          1024u
+#define BENCH_RES_TYPE      0x44434D50u     /* 'DCMP' */
+
+#define BENCH_BOOT_SIZE     8192u   /* Unpacked size of each boot resource */
+#define BENCH_BOOT_TYPES    5
+#define BENCH_BOOT_IDS      6
+#define BENCH_BOOT_ROUNDS   20
+
+static const UInt8 kScratchName[] = "\016DcmpBench File";
+
+static const char* const kVectorNames[] = { "code", "sparse", "noise" };
+#define BENCH_VECTORS (sizeof(kVectorNames) / sizeof(kVectorNames[0]))
+
+/* Words the dcmp 0 decoder has as constants (opcodes 0x4B-0x52) */
+static const UInt16 kDcmp0Common[] = {
+    0x0000, 0x4EBA, 0x0008, 0x4E75, 0x000C, 0x4EAD, 0x2053, 0x2F0B
+};
+
+typedef struct {
+    ResType      type;
+    ResID        id;
+    const UInt8* data;
+    UInt32       len;
+} BenchRes;
+
+typedef struct {
+    UInt8* out;
+    UInt8* end;
+    UInt32 vars;
+    UInt32 varOffset[BENCH_VARS];   /* In the source vector */
+    UInt32 varLength[BENCH_VARS];
+} Encoder;
+
+static UInt32 bench_rand(UInt32* seed) {
+    *seed = *seed * 1664525u + 1013904223u;
+    return *seed >> 8;
+}
+
+static void build_vector(UInt32 kind, UInt8* v) {
+    UInt32 seed = 0xDC0 + kind;
+    UInt32 i = 0;
+
+    if (kind == 0) {
+        /* Routines: LINK, a body of common and random words, UNLK, RTS */
+        while (i + 16 <= BENCH_VECTOR_SIZE) {
+            write_be16(v + i, 0x4E56);
+            write_be16(v + i + 2, (UInt16)(0x10000 - 4 * (bench_rand(&seed) % 8 + 1)));
+            i += 4;
+            UInt32 body = bench_rand(&seed) % 24 + 2;
+            for (UInt32 w = 0; w < body && i + 8 <= BENCH_VECTOR_SIZE; w++, i += 2) {
+                UInt32 r = bench_rand(&seed);
+                UInt16 word = (r % 3) ? kDcmp0Common[(r >> 4) % 8] : (UInt16)(r >> 8);
+                write_be16(v + i, word);
+            }
+            write_be16(v + i, 0x4E5E);
+            write_be16(v + i + 2, 0x4E75);
+            i += 4;
+        }
+        for (; i < BENCH_VECTOR_SIZE; i += 2) write_be16(v + i, 0x4E71);
+    } else if (kind == 1) {
+        /* Mostly zero, with short repeated records */
+        memset(v, 0, BENCH_VECTOR_SIZE);
+        while (i < BENCH_VECTOR_SIZE) {
+            i += (bench_rand(&seed) % 64) * 2;
+            UInt32 rec = bench_rand(&seed) % 4;
+            for (UInt32 b = 0; b < 12 && i < BENCH_VECTOR_SIZE; b++, i++) {
+                v[i] = (UInt8)(rec * 0x11 + b);
+            }
+        }
+    } else {
+        for (; i < BENCH_VECTOR_SIZE; i++) v[i] = (UInt8)bench_rand(&seed);
+    }
+}
+
+static Boolean put_byte(Encoder* e, UInt32 b) {
+    if (e->out >= e->end) return false;
+    *e->out++ = (UInt8)b;
+    return true;
+}
+
+static Boolean put_encoded(Encoder* e, SInt32 v) {
+    if (v >= 0 && v < 0x80) return put_byte(e, (UInt32)v);
+    if (v >= -0x4000 && v < 0x3F00) {
+        return put_byte(e, (UInt32)((v >> 8) + 0xC0)) && put_byte(e, (UInt32)v & 0xFF);
+    }
+    if (!put_byte(e, 0xFF) || e->end - e->out < 4) return false;
+    write_be32(e->out, (UInt32)v);
+    e->out += 4;
+    return true;
+}
+
+static Boolean put_bytes(Encoder* e, const UInt8* p, UInt32 n) {
+    if ((UInt32)(e->end - e->out) < n) return false;
+    memcpy(e->out, p, n);
+    e->out += n;
+    return true;
+}
+
+/* Index of a remembered chunk equal to src[at..at+n), or BENCH_VARS */
+static UInt32 find_var(const Encoder* e, const UInt8* src, UInt32 at, UInt32 n) {
+    for (UInt32 i = 0; i < e->vars; i++) {
+        if (e->varLength[i] == n && memcmp(src + e->varOffset[i], src + at, n) == 0) return i;
+    }
+    return BENCH_VARS;
+}
+
+static void header(UInt8* out, UInt32 unpacked, UInt8 version, SInt16 dcmpID,
+                   UInt8 tableSize, UInt8 flags) {
+    memset(out, 0, RD_HEADER_SIZE);
+    write_be32(out, RD_SIGNATURE);
+    write_be16(out + 4, RD_HEADER_SIZE);
+    out[6] = version;
+    write_be32(out + 8, unpacked);
+    if (version == 8) {
+        write_be16(out + 14, (UInt16)dcmpID);
+    } else {
+        write_be16(out + 12, (UInt16)dcmpID);
+        out[16] = tableSize;
+        out[17] = flags;
+    }
+}
+
+/* DonnBits, dcmp 0 (word units) or 1 (byte units): runs become extended
+ * run operations, dcmp 0's common words constants, and the rest 8-byte
+ * literals, remembered the first time and reused after that. */
+static UInt32 encode_donn(const UInt8* src, UInt32 size, UInt8* dst, UInt32 cap, SInt16 dcmpID) {
+    static Encoder e;
+    e.out = dst + RD_HEADER_SIZE;
+    e.end = dst + cap;
+    e.vars = 0;
+    header(dst, size, 8, dcmpID, 0, 0);
+
+    UInt32 at = 0;
+    while (at < size) {
+        /* Run of one word, or one byte for dcmp 1 */
+        UInt32 unit = dcmpID == 0 ? 2 : 1;
+        UInt32 run = 1;
+        while (at + (run + 1) * unit <= size &&
+               memcmp(src + at, src + at + run * unit, unit) == 0) run++;
+        if (run >= 4) {
+            if (!put_byte(&e, 0xFE) || !put_byte(&e, unit == 2 ? 0x03 : 0x02) ||
+                !put_encoded(&e, unit == 2 ? (SInt16)read_be16(src + at) : src[at]) ||
+                !put_encoded(&e, (SInt32)run - 1)) return 0;
+            at += run * unit;
+            continue;
+        }
+
+        if (dcmpID == 0 && at + 2 <= size) {
+            UInt16 w = read_be16(src + at);
+            UInt32 c = 0;
+            while (c < 8 && kDcmp0Common[c] != w) c++;
+            if (c < 8) {
+                if (!put_byte(&e, 0x4B + c)) return 0;
+                at += 2;
+                continue;
+            }
+        }
+
+        UInt32 n = size - at < BENCH_CHUNK ? size - at : BENCH_CHUNK;
+        UInt32 var = find_var(&e, src, at, n);
+        Boolean ok;
+        if (var < BENCH_VARS) {
+            if (dcmpID == 0) {
+                ok = var < 0x28 ? put_byte(&e, 0x23 + var) :
+                     var < 0x128 ? put_byte(&e, 0x20) && put_byte(&e, var - 0x28) :
+                     var < 0x228 ? put_byte(&e, 0x21) && put_byte(&e, var - 0x128) :
+                     put_byte(&e, 0x22) && put_byte(&e, (var - 0x28) >> 8) &&
+                     put_byte(&e, (var - 0x28) & 0xFF);
+            } else {
+                ok = var < 0xB0 ? put_byte(&e, 0x20 + var) :
+                     var < 0x1B0 ? put_byte(&e, 0xD2) && put_byte(&e, var - 0xB0) :
+                     var < 0x2B0 ? put_byte(&e, 0xD3) && put_byte(&e, var - 0x1B0) : false;
+                if (!ok) {
+                    ok = put_byte(&e, n - 1) && put_bytes(&e, src + at, n);
+                }
+            }
+        } else {
+            Boolean def = e.vars < BENCH_VARS;
+            if (dcmpID == 0) {
+                ok = put_byte(&e, (def ? 0x10 : 0x00) + n / 2) && put_bytes(&e, src + at, n);
+            } else {
+                ok = put_byte(&e, (def ? 0x10 : 0x00) + n - 1) && put_bytes(&e, src + at, n);
+            }
+            if (def) {
+                e.varOffset[e.vars] = at;
+                e.varLength[e.vars] = n;
+                e.vars++;
+            }
+        }
+        if (!ok) return 0;
+        at += n;
+    }
+
+    if (!put_byte(&e, 0xFF)) return 0;
+    return (UInt32)(e.out - dst);
+}
+
+/* GreggyBits: a custom table of the 256 most frequent words, tagged
+ * unless every word is in it */
+static UInt32 encode_greggy(const UInt8* src, UInt32 size, UInt8* dst, UInt32 cap) {
+    UInt32 words = size / 2;
+    UInt16* counts = (UInt16*)NewPtrClear(65536 * sizeof(UInt16));
+    UInt8* slot = (UInt8*)NewPtr(65536);
+    if (!counts || !slot) {
+        if (counts) DisposePtr((Ptr)counts);
+        if (slot) DisposePtr((Ptr)slot);
+        return 0;
+    }
+
+    for (UInt32 w = 0; w < words; w++) {
+        UInt16 v = read_be16(src + w * 2);
+        if (counts[v] < 0xFFFF) counts[v]++;
+    }
+
+    /* Pick the top 256 by repeated selection */
+    UInt16 table[256];
+    UInt32 entries = 0;
+    memset(slot, 0, 65536);
+    while (entries < 256) {
+        UInt32 best = 0, bestCount = 0;
+        for (UInt32 v = 0; v < 65536; v++) {
+            if (counts[v] > bestCount && !slot[v]) {
+                best = v;
+                bestCount = counts[v];
+            }
+        }
+        if (bestCount == 0) break;
+        slot[best] = 1;
+        table[entries++] = (UInt16)best;
+    }
+    if (entries == 0) table[entries++] = 0;
+
+    /* slot[v] becomes v's table index, if it has one */
+    memset(slot, 0, 65536);
+    Boolean all = true;
+    for (UInt32 i = 0; i < entries; i++) slot[table[i]] = (UInt8)i;
+    for (UInt32 w = 0; w < words && all; w++) {
+        UInt16 v = read_be16(src + w * 2);
+        all = table[slot[v]] == v;
+    }
+
+    UInt8 flags = RD_FLAG_CUSTOM_TABLE | (all ? 0 : RD_FLAG_TAGGED);
+    header(dst, size, 9, 2, (UInt8)(entries - 1), flags);
+    UInt8* out = dst + RD_HEADER_SIZE;
+    UInt8* end = dst + cap;
+    UInt32 result = 0;
+
+    if ((UInt32)(end - out) < entries * 2) goto done;
+    for (UInt32 i = 0; i < entries; i++, out += 2) write_be16(out, table[i]);
+
+    for (UInt32 w = 0; w < words; ) {
+        if (all) {
+            if (out >= end) goto done;
+            *out++ = slot[read_be16(src + w * 2)];
+            w++;
+            continue;
+        }
+        if (end - out < 17) goto done;
+        UInt8* tag = out++;
+        *tag = 0;
+        for (UInt32 bit = 0x80; bit && w < words; bit >>= 1, w++) {
+            UInt16 v = read_be16(src + w * 2);
+            if (table[slot[v]] == v) {
+                *tag |= (UInt8)bit;
+                *out++ = slot[v];
+            } else {
+                write_be16(out, v);
+                out += 2;
+            }
+        }
+    }
+    if (size & 1) {
+        if (out >= end) goto done;
+        *out++ = src[size - 1];
+    }
+    result = (UInt32)(out - dst);
+
+done:
+    DisposePtr((Ptr)counts);
+    DisposePtr((Ptr)slot);
+    return result;
+}
+
+static UInt32 encode(SInt16 dcmpID, const UInt8* src, UInt32 size, UInt8* dst, UInt32 cap) {
+    return dcmpID == 2 ? encode_greggy(src, size, dst, cap)
+                       : encode_donn(src, size, dst, cap, dcmpID);
+}
+
+/* Round trip and time one vector in one format */
+static void bench_one(UInt32 kind, SInt16 dcmpID, const UInt8* src, UInt8* packed, UInt32 cap,
+                      UInt8* out, UInt32* packedLen) {
+    *packedLen = encode(dcmpID, src, BENCH_VECTOR_SIZE, packed, cap);
+    if (*packedLen == 0) {
+        DCMP_BENCH_LOG("dcmp %d %s: encoder overflow\n", dcmpID, kVectorNames[kind]);
+        return;
+    }
+
+    memset(out, 0xA5, BENCH_VECTOR_SIZE);
+    OSErr err = RD_Decompress(packed, *packedLen, out, BENCH_VECTOR_SIZE);
+    if (err != noErr || memcmp(out, src, BENCH_VECTOR_SIZE) != 0) {
+        DCMP_BENCH_LOG("dcmp %d %s: round trip FAILED (err %d)\n", dcmpID, kVectorNames[kind], err);
+        *packedLen = 0;
+        return;
+    }
+
+    UInt32 rounds = BENCH_BYTES / BENCH_VECTOR_SIZE;
+    UInt32 start = MicrosecondsNow();
+    for (UInt32 r = 0; r < rounds; r++) {
+        RD_Decompress(packed, *packedLen, out, BENCH_VECTOR_SIZE);
+    }
+    UInt32 us = MicrosecondsNow() - start;
+    if (us == 0) us = 1;
+
+    /* Bytes per microsecond is MB/s */
+    UInt32 total = rounds * BENCH_VECTOR_SIZE;
+    DCMP_BENCH_LOG("dcmp %d %s: %u -> %u bytes, %u.%u MB/s\n", dcmpID, kVectorNames[kind],
+                   BENCH_VECTOR_SIZE, *packedLen, total / us, (total % us) * 10 / us);
+}
+
+/* Resource fork of resCompressed resources; res[] is grouped by type */
+static Boolean write_scratch(const BenchRes* res, UInt32 n) {
+    UInt32 dataLen = 0, numTypes = 0;
+    for (UInt32 i = 0; i < n; i++) {
+        dataLen += sizeof(ResourceDataEntry) + res[i].len;
+        if (i == 0 || res[i].type != res[i - 1].type) numTypes++;
+    }
+
+    UInt32 dataOffset = 256;
+    UInt32 mapOffset = dataOffset + dataLen;
+    UInt32 typeListOff = sizeof(ResMapHeader);
+    UInt32 mapLen = typeListOff + 2 + numTypes * sizeof(TypeListEntry) + n * sizeof(RefListEntry);
+    UInt32 forkSize = mapOffset + mapLen;
+    UInt8* fork = (UInt8*)NewPtrClear(forkSize);
+    if (!fork) return false;
+
+    for (UInt32 copy = 0; copy < 2; copy++) {
+        UInt8* hdr = fork + (copy ? mapOffset : 0);
+        write_be32(hdr + 0, dataOffset);
+        write_be32(hdr + 4, mapOffset);
+        write_be32(hdr + 8, dataLen);
+        write_be32(hdr + 12, mapLen);
+    }
+
+    UInt8* map = fork + mapOffset;
+    write_be16(map + 24, (UInt16)typeListOff);
+    write_be16(map + 26, 0xFFFF);
+    UInt8* typeList = map + typeListOff;
+    write_be16(typeList, (UInt16)(numTypes - 1));
+
+    UInt32 refListOff = 2 + numTypes * sizeof(TypeListEntry);
+    UInt32 dataPos = 0, t = 0;
+    for (UInt32 i = 0; i < n; i++) {
+        if (i == 0 || res[i].type != res[i - 1].type) {
+            UInt32 count = 1;
+            while (i + count < n && res[i + count].type == res[i].type) count++;
+            UInt8* te = typeList + 2 + t++ * sizeof(TypeListEntry);
+            write_be32(te, res[i].type);
+            write_be16(te + 4, (UInt16)(count - 1));
+            write_be16(te + 6, (UInt16)(refListOff + i * sizeof(RefListEntry)));
+        }
+
+        UInt8* ref = typeList + refListOff + i * sizeof(RefListEntry);
+        write_be16(ref, (UInt16)res[i].id);
+        write_be16(ref + 2, 0xFFFF);
+        ref[4] = resCompressed;
+        ref[5] = (UInt8)(dataPos >> 16);
+        write_be16(ref + 6, (UInt16)dataPos);
+
+        UInt8* entry = fork + dataOffset + dataPos;
+        write_be32(entry, res[i].len);
+        memcpy(entry + sizeof(ResourceDataEntry), res[i].data, res[i].len);
+        dataPos += sizeof(ResourceDataEntry) + res[i].len;
+    }
+
+    FileRefNum ref;
+    Boolean ok = false;
+    FSDelete(kScratchName, 0);
+    if (FSCreate(kScratchName, 0, 0x52534544u /* 'RSED' */, 0x72737263u /* 'rsrc' */) == noErr &&
+        FSOpenRF(kScratchName, 0, &ref) == noErr) {
+        UInt32 count = forkSize;
+        ok = FSWrite(ref, &count, fork) == noErr && count == forkSize;
+        FSClose(ref);
+    }
+    DisposePtr((Ptr)fork);
+    return ok;
+}
+
+static SInt16 open_scratch(const BenchRes* res, UInt32 n) {
+    if (!write_scratch(res, n)) {
+        DCMP_BENCH_LOG("could not write the scratch file\n");
+        return -1;
+    }
+    SInt16 refNum = OpenResFile(kScratchName);
+    if (refNum < 0) {
+        DCMP_BENCH_LOG("OpenResFile failed (%d)\n", ResError());
+        FSDelete(kScratchName, 0);
+    }
+    return refNum;
+}
+
+static void close_scratch(SInt16 refNum) {
+    CloseResFile(refNum);
+    FSDelete(kScratchName, 0);
+}
+
+/* One packed vector per format through GetResource */
+static void bench_resources(UInt8* const* vectors, UInt8* const* packed, const UInt32* lens) {
+    BenchRes res[3];
+    for (UInt32 f = 0; f < 3; f++) {
+        res[f].type = BENCH_RES_TYPE;
+        res[f].id = (ResID)f;
+        res[f].data = packed[f];
+        res[f].len = lens[f];
+    }
+
+    SInt16 saved = CurResFile();
+    SInt16 refNum = open_scratch(res, 3);
+    if (refNum < 0) return;
+    UseResFile(refNum);
+
+    UInt32 good = 0;
+    for (SInt16 id = 0; id < 3; id++) {
+        Handle h = Get1Resource(BENCH_RES_TYPE, id);
+        if (h && *h && GetHandleSize(h) == (Size)BENCH_VECTOR_SIZE &&
+            memcmp(*h, vectors[0], BENCH_VECTOR_SIZE) == 0) {
+            good++;
+        }
+    }
+
+    UseResFile(saved);
+    close_scratch(refNum);
+    DCMP_BENCH_LOG("GetResource: %u of 3 compressed resources unpacked correctly\n", good);
+}
+
+/* A boot's worth of compressed resource traffic: every definition
+ * procedure and font fetched and released again for each window, menu
+ * and control drawn, plus a set of pictures.  Run with and without the
+ * decompressed cache. */
+static void bench_boot_run(const BenchRes* res, UInt32 n, const UInt8* expect, Boolean cached) {
+    DC_SetEnabled(cached);
+    DecompCacheStats before;
+    DC_GetStats(&before);
+
+    SInt16 saved = CurResFile();
+    SInt16 refNum = open_scratch(res, n);
+    if (refNum < 0) return;
+    UseResFile(refNum);
+
+    UInt32 bad = 0;
+    UInt32 start = MicrosecondsNow();
+    for (UInt32 round = 0; round < BENCH_BOOT_ROUNDS; round++) {
+        for (UInt32 i = 0; i < n; i++) {
+            Handle h = Get1Resource(res[i].type, res[i].id);
+            if (!h || !*h || memcmp(*h, expect, BENCH_BOOT_SIZE) != 0) bad++;
+            if (h) ReleaseResource(h);
+        }
+    }
+    UInt32 us = MicrosecondsNow() - start;
+
+    DecompCacheStats after;
+    DC_GetStats(&after);
+    DCMP_BENCH_LOG("boot %s: %u loads in %u us, %u hits, %u misses, %u pinned + %u purgeable bytes, %u bad\n",
+                   cached ? "cached" : "uncached", BENCH_BOOT_ROUNDS * n, us,
+                   after.hits - before.hits, after.misses - before.misses,
+                   after.pinnedBytes, after.bytes, bad);
+
+    if (cached) {
+        /* Memory pressure takes the purgeable entries, not the pinned ones */
+        PurgeMem(0x7FFFFFFF);
+        DC_GetStats(&after);
+        DCMP_BENCH_LOG("after PurgeMem: %u entries, %u pinned + %u purgeable bytes, %u reclaimed\n",
+                       after.entries, after.pinnedBytes, after.bytes,
+                       after.reclaimed - before.reclaimed);
+    }
+
+    UseResFile(saved);
+    close_scratch(refNum);
+}
+
+static void bench_boot(const UInt8* code) {
+    static const ResType kTypes[] = {
+        0x43444546u /* 'CDEF' */, 0x464F4E54u /* 'FONT' */, 0x4D444546u /* 'MDEF' */,
+        0x50494354u /* 'PICT' */, 0x57444546u /* 'WDEF' */
+    };
+    BenchRes res[BENCH_BOOT_TYPES * BENCH_BOOT_IDS];
+    UInt8* packed = (UInt8*)NewPtr(BENCH_BOOT_SIZE * 2);
+    UInt32 len = packed ? encode(0, code, BENCH_BOOT_SIZE, packed, BENCH_BOOT_SIZE * 2) : 0;
+    if (len == 0) {
+        DCMP_BENCH_LOG("could not pack the boot resources\n");
+        if (packed) DisposePtr((Ptr)packed);
+        return;
+    }
+
+    for (UInt32 t = 0; t < BENCH_BOOT_TYPES; t++) {
+        for (UInt32 i = 0; i < BENCH_BOOT_IDS; i++) {
+            BenchRes* r = &res[t * BENCH_BOOT_IDS + i];
+            r->type = kTypes[t];
+            r->id = (ResID)i;
+            r->data = packed;
+            r->len = len;
+        }
+    }
+
+    bench_boot_run(res, BENCH_BOOT_TYPES * BENCH_BOOT_IDS, code, false);
+    bench_boot_run(res, BENCH_BOOT_TYPES * BENCH_BOOT_IDS, code, true);
+    DC_SetEnabled(true);
+    DisposePtr((Ptr)packed);
+}
+
+void DcmpBench_Run(void) {
+    UInt32 cap = BENCH_VECTOR_SIZE * 2;
+    UInt8* vectors[BENCH_VECTORS];
+    UInt8* packed[3];
+    UInt8* out = (UInt8*)NewPtr(BENCH_VECTOR_SIZE);
+    UInt32 lens[3];
+    Boolean ok = out != NULL;
+
+    for (UInt32 k = 0; k < BENCH_VECTORS; k++) {
+        vectors[k] = (UInt8*)NewPtr(BENCH_VECTOR_SIZE);
+        ok = ok && vectors[k];
+    }
+    for (UInt32 f = 0; f < 3; f++) {
+        packed[f] = (UInt8*)NewPtr(cap);
+        ok = ok && packed[f];
+    }
+
+    if (!ok) {
+        DCMP_BENCH_LOG("out of memory\n");
+    } else {
+        for (UInt32 k = 0; k < BENCH_VECTORS; k++) build_vector(k, vectors[k]);
+
+        /* The code vector is last so its packed forms are left for GetResource */
+        for (UInt32 k = BENCH_VECTORS; k-- > 0; ) {
+            for (SInt16 f = 0; f < 3; f++) {
+                bench_one(k, f, vectors[k], packed[f], cap, out, &lens[f]);
+            }
+        }
+        if (lens[0] && lens[1] && lens[2]) bench_resources(vectors, packed, lens);
+        bench_boot(vectors[0]);
+    }
+
+    for (UInt32 k = 0; k < BENCH_VECTORS; k++) if (vectors[k]) DisposePtr((Ptr)vectors[k]);
+    for (UInt32 f = 0; f < 3; f++) if (packed[f]) DisposePtr((Ptr)packed[f]);
+    if (out) DisposePtr((Ptr)out);
+
+    DCMP_BENCH_LOG("done\n");
+}
+
+#endif /* DCMP_BENCH */
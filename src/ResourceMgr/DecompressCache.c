@@ -0,0 +1,177 @@
+/*
+ * DecompressCache.c - Unpacked copies of compressed resources
+ *
+ * A fixed table scanned linearly: compressed resources are few, and the
+ * lookup runs only on the load path of one, next to a read and a copy.
+ * LRU order comes from a use clock stamped on every hit, as in
+ * ResourceCache.c.
+ */
+
+#include "SystemTypes.h"
+#include "MemoryMgr/MemoryManager.h"
+#include "ResourceManager.h"
+#include "ResourceMgr/DecompressCache.h"
+#include <string.h>
+
+typedef struct {
+    Handle  h;              /* NULL: free slot */
+    ResType type;
+    ResID   id;
+    SInt16  refNum;
+    Boolean pinned;
+    UInt32  size;
+    UInt32  lastUse;
+} DCEntry;
+
+static DCEntry gEntries[DC_MAX_ENTRIES];
+static UInt32 gClock = 0;
+static Boolean gEnabled = true;
+static DecompCacheStats gStats = { 0, DC_MAX_ENTRIES, 0, 0, 0, 0, 0, 0 };
+
+/* Unpacked once per boot: the system reloads these through every
+ * window, menu and control it draws */
+static Boolean dc_pinned_type(ResType type) {
+    return type == 0x43444546u ||   /* 'CDEF' */
+           type == 0x57444546u ||   /* 'WDEF' */
+           type == 0x4D444546u ||   /* 'MDEF' */
+           type == 0x464F4E54u;     /* 'FONT' */
+}
+
+static void dc_free(DCEntry* e) {
+    if (e->pinned) {
+        gStats.pinnedBytes -= e->size;
+    } else {
+        gStats.bytes -= e->size;
+    }
+    DisposeHandle(e->h);
+    memset(e, 0, sizeof(DCEntry));
+    gStats.entries--;
+}
+
+/* Drop entries the Memory Manager purged; their bytes are gone already */
+static void dc_collect(void) {
+    for (UInt32 i = 0; i < DC_MAX_ENTRIES; i++) {
+        DCEntry* e = &gEntries[i];
+        if (e->h && !*e->h) {
+            dc_free(e);
+            gStats.reclaimed++;
+        }
+    }
+}
+
+/* Least recently used unpinned entry, or NULL */
+static DCEntry* dc_oldest(void) {
+    DCEntry* oldest = NULL;
+    for (UInt32 i = 0; i < DC_MAX_ENTRIES; i++) {
+        DCEntry* e = &gEntries[i];
+        if (e->h && !e->pinned && (!oldest || e->lastUse < oldest->lastUse)) oldest = e;
+    }
+    return oldest;
+}
+
+/* Evict until need more bytes fit the budget and a slot is free */
+static void dc_trim(UInt32 need) {
+    dc_collect();
+    while (gStats.bytes + need > DC_BUDGET || gStats.entries >= gStats.maxEntries) {
+        DCEntry* e = dc_oldest();
+        if (!e) return;
+        dc_free(e);
+        gStats.evictions++;
+    }
+}
+
+Handle DC_Lookup(SInt16 refNum, ResType type, ResID id) {
+    for (UInt32 i = 0; i < DC_MAX_ENTRIES; i++) {
+        DCEntry* e = &gEntries[i];
+        if (!e->h || e->type != type || e->id != id || e->refNum != refNum) continue;
+
+        if (!*e->h) {
+            dc_free(e);
+            gStats.reclaimed++;
+            break;
+        }
+        gStats.hits++;
+        e->lastUse = ++gClock;
+        return e->h;
+    }
+    gStats.misses++;
+    return NULL;
+}
+
+void DC_Insert(SInt16 refNum, ResType type, ResID id, const void* data, UInt32 size) {
+    if (!gEnabled || !data) return;
+
+    Boolean pinned = dc_pinned_type(type);
+    if (!pinned && size > DC_BUDGET) return;
+
+    dc_trim(pinned ? 0 : size);
+    if (gStats.entries >= gStats.maxEntries) return;
+
+    DCEntry* e = NULL;
+    for (UInt32 i = 0; i < DC_MAX_ENTRIES && !e; i++) {
+        if (!gEntries[i].h) e = &gEntries[i];
+    }
+    if (!e) return;
+
+    Handle h = NewHandle(size);
+    if (!h) return;
+    memcpy(*h, data, size);
+    if (!pinned) HPurge(h);
+
+    e->h = h;
+    e->type = type;
+    e->id = id;
+    e->refNum = refNum;
+    e->pinned = pinned;
+    e->size = size;
+    e->lastUse = ++gClock;
+    gStats.entries++;
+    if (pinned) {
+        gStats.pinnedBytes += size;
+    } else {
+        gStats.bytes += size;
+    }
+}
+
+void DC_RemoveFile(SInt16 refNum) {
+    for (UInt32 i = 0; i < DC_MAX_ENTRIES; i++) {
+        if (gEntries[i].h && gEntries[i].refNum == refNum) dc_free(&gEntries[i]);
+    }
+}
+
+void DC_Flush(void) {
+    for (UInt32 i = 0; i < DC_MAX_ENTRIES; i++) {
+        if (gEntries[i].h) dc_free(&gEntries[i]);
+    }
+}
+
+void DC_SetMaxEntries(UInt32 maxEntries) {
+    gStats.maxEntries = maxEntries < DC_MAX_ENTRIES ? maxEntries : DC_MAX_ENTRIES;
+    while (gStats.entries > gStats.maxEntries) {
+        DCEntry* e = dc_oldest();
+        if (!e) break;
+        dc_free(e);
+        gStats.evictions++;
+    }
+}
+
+void DC_SetEnabled(Boolean on) {
+    gEnabled = on;
+    if (!on) DC_Flush();
+}
+
+void DC_GetStats(DecompCacheStats* stats) {
+    if (!stats) return;
+    dc_collect();
+    *stats = gStats;
+}
+
+/* Resource Manager entry points (ResourceManager.h) */
+
+void ResourceManager_FlushDecompressionCache(void) {
+    DC_Flush();
+}
+
+void ResourceManager_SetDecompressionCacheSize(Size maxItems) {
+    DC_SetMaxEntries((UInt32)maxItems);
+}
@@ -0,0 +1,475 @@
+/*
+ * ResBench.c - Resource file open benchmark
+ *
+ * First loads every built-in System resource and reports the heap it
+ * took, then opens every resource file in the root of the default volume, plus a
+ * generated 600KB suitcase ('CODE', 'PICT', 'ICN#' and 'STR '), two ways:
+ * reading the whole fork the way OpenResFile used to, and through
+ * OpenResFile, which now reads only the map.  Reports open latency and
+ * resident bytes for each, then for the suitcase times loading all 200
+ * 'ICN#' one Get1Resource at a time against one PreloadResources call.
+ * Last, it cycles GetResource over the suitcase's purgeable 'PICT's,
+ * which together exceed the resource cache's purgeable budget, and
+ * reports the cache's hits, misses and purges.  Then 100k mixed
+ * GetResource lookups and 1000 GetNamedResource run against the suitcase
+ * opened without and with its lookup index.  Last, a scattered "launch"
+ * sequence of Get1Resource calls over the suitcase is recorded as a
+ * prefetch manifest and timed, open included, without and with the
+ * manifest replayed at open.
+ *
+ * Activated with RES_BENCH=1 compile flag; called from main.c once the
+ * boot volume is mounted.  The suitcase is deleted again afterwards.
+ */
+
+#include "SystemTypes.h"
+#include "MacTypes.h"
+#include "System71StdLib.h"
+#include "FileManager.h"
+#include "MemoryMgr/MemoryManager.h"
+#include "ResourceMgr/ResourceMgr.h"
+#include "ResourceMgr/resource_manager.h"
+#include "ResourceMgr/ResourceMgrPriv.h"
+#include "ResourceMgr/ResourceLogging.h"
+#include "ResourceMgr/ResourceCache.h"
+#include "ResourceMgr/ResourcePrefetch.h"
+#include "FS/vfs.h"
+#include "TimeManager/TimeBase.h"
+#include <string.h>
+
+#ifdef RES_BENCH
+
+#define RES_BENCH_LOG(fmt, ...) serial_logf(kLogModuleResource, kLogLevelInfo, "[RES BENCH] " fmt, ##__VA_ARGS__)
+
+#define BENCH_MAX_FILES     32
+#define BENCH_ICON_TYPE     0x49434E23u     /* 'ICN#' */
+#define BENCH_FIRST_ID      30000   /* Clear of the System file's IDs */
+
+#define BENCH_PICT_TYPE     0x50494354u     /* 'PICT' */
+#define BENCH_CACHE_ROUNDS  4
+
+#define BENCH_STR_TYPE      0x53545220u     /* 'STR ' */
+#define BENCH_LOOKUPS       100000u
+#define BENCH_NAMED_LOOKUPS 1000u
+
+#define BENCH_LAUNCH_LOADS  96u
+
+typedef struct {
+    ResType type;
+    UInt16  count;
+    UInt32  size;
+    UInt8   attributes;
+    Boolean named;          /* "Item <n>" names in the map */
+} BenchType;
+
+static const BenchType kSuitcaseTypes[] = {
+    { 0x434F4445u /* 'CODE' */, 20,  8192,  0,            false },
+    { BENCH_PICT_TYPE,          24,  16384, resPurgeable, false },
+    { BENCH_ICON_TYPE,          200, 256,   0,            false },
+    { BENCH_STR_TYPE,           300, 64,    0,            true },
+};
+#define BENCH_TYPES (sizeof(kSuitcaseTypes) / sizeof(kSuitcaseTypes[0]))
+
+static const UInt8 kSuitcaseName[] = "\021ResBench Suitcase";
+
+/* Pascal string "Item <n>"; returns its size including the length byte */
+static UInt32 bench_name(UInt8* out, UInt32 n) {
+    char digits[8];
+    UInt32 len = 0;
+    do {
+        digits[len++] = (char)('0' + n % 10);
+        n /= 10;
+    } while (n);
+
+    memcpy(out + 1, "Item ", 5);
+    for (UInt32 i = 0; i < len; i++) out[6 + i] = (UInt8)digits[len - 1 - i];
+    out[0] = (UInt8)(5 + len);
+    return 1 + out[0];
+}
+
+/* Lay out a resource fork: header, data, then the map and its names */
+static UInt8* build_suitcase(UInt32* forkSize) {
+    UInt32 dataLen = 0, refs = 0, namesLen = 0;
+    UInt8 name[16];
+    for (UInt32 t = 0; t < BENCH_TYPES; t++) {
+        dataLen += kSuitcaseTypes[t].count * (sizeof(ResourceDataEntry) + kSuitcaseTypes[t].size);
+        refs += kSuitcaseTypes[t].count;
+        for (UInt16 i = 0; kSuitcaseTypes[t].named && i < kSuitcaseTypes[t].count; i++) {
+            namesLen += bench_name(name, i);
+        }
+    }
+
+    UInt32 dataOffset = 256;
+    UInt32 mapOffset = dataOffset + dataLen;
+    UInt32 typeListOff = sizeof(ResMapHeader);
+    UInt32 nameListOff = typeListOff + 2 + BENCH_TYPES * sizeof(TypeListEntry) + refs * sizeof(RefListEntry);
+    UInt32 mapLen = nameListOff + namesLen;
+
+    *forkSize = mapOffset + mapLen;
+    UInt8* fork = (UInt8*)NewPtrClear(*forkSize);
+    if (!fork) return NULL;
+
+    for (UInt32 copy = 0; copy < 2; copy++) {
+        UInt8* hdr = fork + (copy ? mapOffset : 0);
+        write_be32(hdr + 0, dataOffset);
+        write_be32(hdr + 4, mapOffset);
+        write_be32(hdr + 8, dataLen);
+        write_be32(hdr + 12, mapLen);
+    }
+
+    UInt8* map = fork + mapOffset;
+    write_be16(map + 24, (UInt16)typeListOff);
+    write_be16(map + 26, (UInt16)nameListOff);
+
+    UInt8* typeList = map + typeListOff;
+    write_be16(typeList, BENCH_TYPES - 1);
+
+    UInt32 refListOff = 2 + BENCH_TYPES * sizeof(TypeListEntry);
+    UInt32 dataPos = 0, namePos = 0;
+    for (UInt32 t = 0; t < BENCH_TYPES; t++) {
+        const BenchType* bt = &kSuitcaseTypes[t];
+        UInt8* te = typeList + 2 + t * sizeof(TypeListEntry);
+        write_be32(te, bt->type);
+        write_be16(te + 4, bt->count - 1);
+        write_be16(te + 6, (UInt16)refListOff);
+
+        for (UInt16 i = 0; i < bt->count; i++) {
+            UInt8* ref = typeList + refListOff + i * sizeof(RefListEntry);
+            write_be16(ref, (UInt16)(BENCH_FIRST_ID + i));
+            if (bt->named) {
+                write_be16(ref + 2, (UInt16)namePos);
+                namePos += bench_name(map + nameListOff + namePos, i);
+            } else {
+                write_be16(ref + 2, 0xFFFF);
+            }
+            ref[4] = bt->attributes;
+            ref[5] = (UInt8)(dataPos >> 16);
+            write_be16(ref + 6, (UInt16)dataPos);
+
+            UInt8* entry = fork + dataOffset + dataPos;
+            write_be32(entry, bt->size);
+            memset(entry + sizeof(ResourceDataEntry), (int)(t * 16 + (i & 15)), bt->size);
+            dataPos += sizeof(ResourceDataEntry) + bt->size;
+        }
+        refListOff += bt->count * sizeof(RefListEntry);
+    }
+    return fork;
+}
+
+static Boolean write_suitcase(void) {
+    UInt32 forkSize;
+    UInt8* fork = build_suitcase(&forkSize);
+    if (!fork) return false;
+
+    FileRefNum ref;
+    Boolean ok = false;
+    FSDelete(kSuitcaseName, 0);
+    if (FSCreate(kSuitcaseName, 0, 0x52534544u /* 'RSED' */, 0x72737263u /* 'rsrc' */) == noErr &&
+        FSOpenRF(kSuitcaseName, 0, &ref) == noErr) {
+        UInt32 count = forkSize;
+        ok = FSWrite(ref, &count, fork) == noErr && count == forkSize;
+        FSClose(ref);
+    }
+    DisposePtr((Ptr)fork);
+    return ok;
+}
+
+/* What OpenResFile used to do: read the whole fork.  Returns the time, or
+ * 0 if the file has no resource fork. */
+static UInt32 open_whole_fork(ConstStr255Param name, UInt32* forkBytes, UInt32* mapBytes) {
+    FileRefNum ref;
+    ResourceHeader header;
+    UInt32 count = sizeof(header);
+
+    UInt32 start = MicrosecondsNow();
+    if (FSOpenRF(name, 0, &ref) != noErr) return 0;
+    if (FSRead(ref, &count, &header) != noErr || count != sizeof(header)) {
+        FSClose(ref);
+        return 0;
+    }
+
+    UInt32 total = read_be32((UInt8*)&header.mapOffset) + read_be32((UInt8*)&header.mapLength);
+    UInt8* buf = (UInt8*)NewPtr(total);
+    Boolean ok = false;
+    if (buf) {
+        count = total;
+        ok = FSSetFPos(ref, fsFromStart, 0) == noErr &&
+             FSRead(ref, &count, buf) == noErr && count == total;
+    }
+    FSClose(ref);
+    UInt32 elapsed = MicrosecondsNow() - start;
+    if (buf) DisposePtr((Ptr)buf);
+    if (!ok) return 0;
+
+    *forkBytes = total;
+    *mapBytes = read_be32((UInt8*)&header.mapLength);
+    return elapsed ? elapsed : 1;
+}
+
+static void bench_file(ConstStr255Param name) {
+    char cname[64];
+    UInt8 len = (UInt8)name[0];
+    UInt32 forkBytes = 0, mapBytes = 0;
+
+    if (len >= sizeof(cname)) len = sizeof(cname) - 1;
+    memcpy(cname, name + 1, len);
+    cname[len] = '\0';
+
+    UInt32 wholeUs = open_whole_fork(name, &forkBytes, &mapBytes);
+    if (!wholeUs) return;
+
+    UInt32 start = MicrosecondsNow();
+    SInt16 refNum = OpenResFile(name);
+    UInt32 lazyUs = MicrosecondsNow() - start;
+    if (refNum < 0) {
+        RES_BENCH_LOG("%s: OpenResFile failed (%d)\n", cname, ResError());
+        return;
+    }
+
+    RES_BENCH_LOG("%s: whole fork %u bytes in %u us; map only %u bytes in %u us\n",
+                  cname, forkBytes, wholeUs, mapBytes, lazyUs);
+    CloseResFile(refNum);
+}
+
+/* 'ICN#' one by one against a single preload, each on a fresh open */
+static void bench_preload(void) {
+    SInt16 saved = CurResFile();
+    UInt16 icons = kSuitcaseTypes[2].count;
+
+    SInt16 refNum = OpenResFile(kSuitcaseName);
+    if (refNum < 0) return;
+    UseResFile(refNum);
+    UInt32 loaded = 0;
+    UInt32 start = MicrosecondsNow();
+    for (UInt16 i = 0; i < icons; i++) {
+        if (Get1Resource(BENCH_ICON_TYPE, (ResID)(BENCH_FIRST_ID + i))) loaded++;
+    }
+    UInt32 singleUs = MicrosecondsNow() - start;
+    UseResFile(saved);
+    CloseResFile(refNum);
+
+    refNum = OpenResFile(kSuitcaseName);
+    if (refNum < 0) return;
+    start = MicrosecondsNow();
+    PreloadResources(refNum, BENCH_ICON_TYPE);
+    UInt32 preloadUs = MicrosecondsNow() - start;
+    UseResFile(refNum);
+    UInt32 preloaded = 0;
+    for (UInt16 i = 0; i < icons; i++) {
+        if (Get1Resource(BENCH_ICON_TYPE, (ResID)(BENCH_FIRST_ID + i))) preloaded++;
+    }
+    UseResFile(saved);
+    CloseResFile(refNum);
+
+    RES_BENCH_LOG("'ICN#' x %u: one at a time %u us (%u loaded), PreloadResources %u us (%u loaded)\n",
+                  icons, singleUs, loaded, preloadUs, preloaded);
+}
+
+/* Round-robin over more purgeable data than the cache keeps resident */
+static void bench_cache(void) {
+    SInt16 saved = CurResFile();
+    UInt16 picts = kSuitcaseTypes[1].count;
+    size_t entries0, bytes0, hits0, misses0;
+
+    SInt16 refNum = OpenResFile(kSuitcaseName);
+    if (refNum < 0) return;
+    UseResFile(refNum);
+
+    GetResourceCacheStats(&entries0, &bytes0, &hits0, &misses0);
+    UInt32 failed = 0;
+    UInt32 start = MicrosecondsNow();
+    for (UInt32 round = 0; round < BENCH_CACHE_ROUNDS; round++) {
+        for (UInt16 i = 0; i < picts; i++) {
+            Handle h = GetResource(BENCH_PICT_TYPE, (ResID)(BENCH_FIRST_ID + i));
+            if (!h || !*h || (*h)[0] != (char)(16 + (i & 15))) failed++;
+        }
+    }
+    UInt32 elapsed = MicrosecondsNow() - start;
+
+    size_t entries, bytes, hits, misses;
+    ResCacheStats stats;
+    GetResourceCacheStats(&entries, &bytes, &hits, &misses);
+    RC_GetStats(&stats);
+    RES_BENCH_LOG("'PICT' x %u x %u rounds: %u us, %u hits, %u misses, %u purged; "
+                  "%u entries, %u bytes resident, %u bad\n",
+                  picts, BENCH_CACHE_ROUNDS, elapsed, (UInt32)(hits - hits0),
+                  (UInt32)(misses - misses0), stats.purges, (UInt32)entries,
+                  (UInt32)bytes, failed);
+
+    UseResFile(saved);
+    CloseResFile(refNum);
+    GetResourceCacheStats(&entries, &bytes, NULL, NULL);
+    RES_BENCH_LOG("after CloseResFile: %u entries, %u bytes resident\n",
+                  (UInt32)entries, (UInt32)bytes);
+}
+
+static UInt32 bench_rand(UInt32* seed) {
+    *seed = *seed * 1664525u + 1013904223u;
+    return *seed >> 8;
+}
+
+/* Mixed GetResource lookups with loading off, so every call resolves
+ * through the maps: 3 in 4 name a suitcase resource, the rest an ID past
+ * the end of its type, which falls through to the System file */
+static void bench_lookup_run(Boolean indexed) {
+    SInt16 saved = CurResFile();
+
+    ResMap_SetIndexing(indexed);
+    SInt16 refNum = OpenResFile(kSuitcaseName);
+    ResMap_SetIndexing(true);
+    if (refNum < 0) return;
+    UseResFile(refNum);
+    SetResLoad(false);
+
+    UInt32 seed = 0x10C8u, found = 0;
+    UInt32 start = MicrosecondsNow();
+    for (UInt32 n = 0; n < BENCH_LOOKUPS; n++) {
+        UInt32 r = bench_rand(&seed);
+        const BenchType* bt = &kSuitcaseTypes[r % BENCH_TYPES];
+        UInt32 i = (r >> 4) % bt->count;
+        if ((r >> 20) % 4 == 0) i += bt->count;
+        GetResource(bt->type, (ResID)(BENCH_FIRST_ID + i));
+        if (ResError() == noErr) found++;
+    }
+    UInt32 lookupUs = MicrosecondsNow() - start;
+
+    UInt32 named = 0;
+    UInt8 name[16];
+    start = MicrosecondsNow();
+    for (UInt32 n = 0; n < BENCH_NAMED_LOOKUPS; n++) {
+        bench_name(name, bench_rand(&seed) % kSuitcaseTypes[3].count);
+        GetNamedResource(BENCH_STR_TYPE, (ConstStr255Param)name);
+        if (ResError() == noErr) named++;
+    }
+    UInt32 namedUs = MicrosecondsNow() - start;
+
+    SetResLoad(true);
+    UseResFile(saved);
+    CloseResFile(refNum);
+
+    RES_BENCH_LOG("%s: %u GetResource in %u us (%u found); %u GetNamedResource in %u us (%u found)\n",
+                  indexed ? "indexed map" : "map walk", BENCH_LOOKUPS, lookupUs, found,
+                  BENCH_NAMED_LOOKUPS, namedUs, named);
+}
+
+/* Open the suitcase and load the launch sequence: a fixed walk that hops
+ * between types and IDs the way an application's startup does */
+static UInt32 bench_launch(UInt32* loaded) {
+    SInt16 saved = CurResFile();
+    UInt32 start = MicrosecondsNow();
+
+    SInt16 refNum = OpenResFile(kSuitcaseName);
+    if (refNum < 0) return 0;
+    UseResFile(refNum);
+    UInt32 seed = 0x1A0Cu;
+    *loaded = 0;
+    for (UInt32 n = 0; n < BENCH_LAUNCH_LOADS; n++) {
+        UInt32 r = bench_rand(&seed);
+        const BenchType* bt = &kSuitcaseTypes[r % 3];
+        if (Get1Resource(bt->type, (ResID)(BENCH_FIRST_ID + (r >> 4) % bt->count))) (*loaded)++;
+    }
+    UInt32 elapsed = MicrosecondsNow() - start;
+
+    UseResFile(saved);
+    CloseResFile(refNum);
+    return elapsed;
+}
+
+static void bench_prefetch(void) {
+    UInt32 loaded, prefetchLoaded;
+    ResPrefetchStats stats;
+
+    if (RP_BeginRecording() != noErr) return;
+    bench_launch(&loaded);
+    Handle manifest = RP_EndRecording();
+    if (!manifest) {
+        RES_BENCH_LOG("prefetch: nothing recorded\n");
+        return;
+    }
+    UInt32 manifestBytes = (UInt32)GetHandleSize(manifest);
+
+    UInt32 plainUs = bench_launch(&loaded);
+    RP_SetManifest(manifest);
+    UInt32 prefetchUs = bench_launch(&prefetchLoaded);
+    RP_SetManifest(NULL);
+
+    RP_GetStats(&stats);
+    RES_BENCH_LOG("launch x %u loads: %u us (%u loaded); with %u-byte manifest %u us "
+                  "(%u loaded, %u of %u recorded prefetched)\n",
+                  BENCH_LAUNCH_LOADS, plainUs, loaded, manifestBytes, prefetchUs,
+                  prefetchLoaded, stats.prefetched, stats.recorded);
+}
+
+/* Every resource of the System file (the built-in image when no System
+ * is on disk) loaded, then released */
+static void bench_system(void) {
+    SInt16 saved = CurResFile();
+    UseResFile(0);
+
+    UInt32 loaded = 0, inPlace = 0, bytes = 0;
+    UInt32 free0 = FreeMem();
+    UInt32 start = MicrosecondsNow();
+    for (SInt16 t = 1; t <= Count1Types(); t++) {
+        ResType type;
+        Get1IndType(&type, t);
+        for (SInt16 i = 1; i <= Count1Resources(type); i++) {
+            Handle h = Get1IndResource(type, i);
+            if (!h) continue;
+            loaded++;
+            bytes += GetHandleSize(h);
+            if (MemoryManager_IsROMHandle(h)) inPlace++;
+        }
+    }
+    UInt32 elapsed = MicrosecondsNow() - start;
+    UInt32 heapBytes = free0 - FreeMem();
+
+    for (SInt16 t = 1; t <= Count1Types(); t++) {
+        ResType type;
+        Get1IndType(&type, t);
+        for (SInt16 i = 1; i <= Count1Resources(type); i++) {
+            Handle h = Get1IndResource(type, i);
+            if (h) ReleaseResource(h);
+        }
+    }
+    UseResFile(saved);
+
+    RES_BENCH_LOG("System resources: %u loaded (%u bytes, %u in place) in %u us, %u heap bytes\n",
+                  loaded, bytes, inPlace, elapsed, heapBytes);
+}
+
+void ResBench_Run(void) {
+    VRefNum vref = VFS_GetBootVRef();
+    CatEntry entries[BENCH_MAX_FILES];
+    int count = 0;
+
+    bench_system();
+
+    if (!write_suitcase()) {
+        RES_BENCH_LOG("could not write the test suitcase\n");
+    } else {
+        bench_file(kSuitcaseName);
+        bench_preload();
+        bench_cache();
+        bench_lookup_run(false);
+        bench_lookup_run(true);
+        bench_prefetch();
+        FSDelete(kSuitcaseName, 0);
+    }
+
+    if (!VFS_Enumerate(vref, 2 /* root */, entries, BENCH_MAX_FILES, &count)) {
+        RES_BENCH_LOG("could not enumerate the boot volume\n");
+        count = 0;
+    }
+    for (int i = 0; i < count; i++) {
+        if (entries[i].kind != kNodeFile) continue;
+
+        Str255 name;
+        UInt8 len = (UInt8)strlen(entries[i].name);
+        name[0] = len;
+        memcpy(name + 1, entries[i].name, len);
+        bench_file(name);
+    }
+
+    RES_BENCH_LOG("done\n");
+}
+
+#endif /* RES_BENCH */
@@ -0,0 +1,222 @@
+/*
+ * ResourceCache.c - Loaded resource handles by (file, type, ID)
+ *
+ * Linear probing with backward-shift deletion, so lookups stop at the
+ * first empty slot and no tombstones build up as files close.  LRU order
+ * comes from a use clock stamped on every hit; purging only looks for the
+ * oldest stamp when the purgeable bytes go over budget.
+ */
+
+#include "SystemTypes.h"
+#include "MemoryMgr/MemoryManager.h"
+#include "ResourceMgr/ResourceCache.h"
+#include <string.h>
+
+#define RC_MIN_CAPACITY 64u
+
+typedef struct {
+    Handle  h;              /* NULL: empty slot */
+    ResType type;
+    ResID   id;
+    SInt16  refNum;
+    Boolean purgeable;
+    Boolean resident;       /* Counted in residentBytes */
+    UInt32  size;
+    UInt32  lastUse;
+} RCEntry;
+
+static RCEntry* gSlots = NULL;
+static UInt32 gCapacity = 0;
+static UInt32 gCount = 0;
+static UInt32 gClock = 0;
+static UInt32 gPurgeableBytes = 0;      /* Resident bytes of purgeable entries */
+static ResCacheStats gStats;
+
+static UInt32 rc_hash(SInt16 refNum, ResType type, ResID id) {
+    UInt32 x = type * 0x9E3779B1u;
+    x ^= ((UInt32)(UInt16)id << 16) | (UInt16)refNum;
+    x ^= x >> 15;
+    x *= 0x85EBCA6Bu;
+    x ^= x >> 13;
+    return x & (gCapacity - 1);
+}
+
+static RCEntry* rc_find(SInt16 refNum, ResType type, ResID id) {
+    if (gCount == 0) return NULL;
+
+    UInt32 i = rc_hash(refNum, type, id);
+    while (gSlots[i].h) {
+        RCEntry* e = &gSlots[i];
+        if (e->type == type && e->id == id && e->refNum == refNum) return e;
+        i = (i + 1) & (gCapacity - 1);
+    }
+    return NULL;
+}
+
+static void rc_account(RCEntry* e, Boolean add) {
+    if (!e->resident) return;
+    if (add) {
+        gStats.residentBytes += e->size;
+        if (e->purgeable) gPurgeableBytes += e->size;
+    } else {
+        gStats.residentBytes -= e->size;
+        if (e->purgeable) gPurgeableBytes -= e->size;
+    }
+}
+
+static void rc_place(const RCEntry* src) {
+    UInt32 i = rc_hash(src->refNum, src->type, src->id);
+    while (gSlots[i].h) {
+        i = (i + 1) & (gCapacity - 1);
+    }
+    gSlots[i] = *src;
+}
+
+static Boolean rc_grow(void) {
+    UInt32 newCapacity = gCapacity ? gCapacity * 2 : RC_MIN_CAPACITY;
+    RCEntry* newSlots = (RCEntry*)NewPtrClear(newCapacity * sizeof(RCEntry));
+    if (!newSlots) return false;
+
+    RCEntry* oldSlots = gSlots;
+    UInt32 oldCapacity = gCapacity;
+    gSlots = newSlots;
+    gCapacity = newCapacity;
+    for (UInt32 i = 0; i < oldCapacity; i++) {
+        if (oldSlots[i].h) rc_place(&oldSlots[i]);
+    }
+    if (oldSlots) DisposePtr(oldSlots);
+    return true;
+}
+
+/* Empty slot i, shifting later members of its probe run back into it */
+static void rc_remove_at(UInt32 i) {
+    UInt32 mask = gCapacity - 1;
+    UInt32 j = i;
+
+    rc_account(&gSlots[i], false);
+    gCount--;
+
+    for (;;) {
+        j = (j + 1) & mask;
+        if (!gSlots[j].h) break;
+
+        /* An entry may fill the hole unless its home lies cyclically in (i, j] */
+        UInt32 home = rc_hash(gSlots[j].refNum, gSlots[j].type, gSlots[j].id);
+        Boolean stays = (i <= j) ? (home > i && home <= j) : (home > i || home <= j);
+        if (!stays) {
+            gSlots[i] = gSlots[j];
+            i = j;
+        }
+    }
+    memset(&gSlots[i], 0, sizeof(RCEntry));
+}
+
+/* Empty least recently used purgeable handles until back in budget */
+static void rc_trim(void) {
+    UInt32 tries = gCount;
+
+    while (gPurgeableBytes > RC_PURGEABLE_BUDGET && tries-- > 0) {
+        RCEntry* oldest = NULL;
+        for (UInt32 i = 0; i < gCapacity; i++) {
+            RCEntry* e = &gSlots[i];
+            if (e->h && e->purgeable && e->resident &&
+                (!oldest || e->lastUse < oldest->lastUse)) {
+                oldest = e;
+            }
+        }
+        if (!oldest) return;
+
+        EmptyHandle(oldest->h);
+        if (*oldest->h) {
+            /* Locked: leave it for now as if just used */
+            oldest->lastUse = ++gClock;
+            continue;
+        }
+        rc_account(oldest, false);
+        oldest->resident = false;
+        gStats.purges++;
+    }
+}
+
+Handle RC_Lookup(SInt16 refNum, ResType type, ResID id) {
+    RCEntry* e = rc_find(refNum, type, id);
+    if (!e) {
+        gStats.misses++;
+        return NULL;
+    }
+
+    gStats.hits++;
+    e->lastUse = ++gClock;
+    if (!*e->h && e->resident) {
+        /* Purged behind our back (PurgeMem) */
+        rc_account(e, false);
+        e->resident = false;
+    }
+    return e->h;
+}
+
+void RC_Insert(SInt16 refNum, ResType type, ResID id, Handle h, Boolean purgeable) {
+    if (!h) return;
+
+    RCEntry* e = rc_find(refNum, type, id);
+    if (e) {
+        rc_account(e, false);
+    } else {
+        if ((gCount + 1) * 4 > gCapacity * 3 && !rc_grow()) {
+            if (gCount + 1 >= gCapacity) return;
+        }
+        RCEntry fresh;
+        memset(&fresh, 0, sizeof(fresh));
+        fresh.h = h;
+        fresh.type = type;
+        fresh.id = id;
+        fresh.refNum = refNum;
+        rc_place(&fresh);
+        gCount++;
+        e = rc_find(refNum, type, id);
+    }
+
+    e->h = h;
+    e->purgeable = purgeable;
+    e->resident = (*h != NULL);
+    e->size = GetHandleSize(h);
+    e->lastUse = ++gClock;
+    rc_account(e, true);
+    rc_trim();
+}
+
+void RC_Reloaded(SInt16 refNum, ResType type, ResID id) {
+    RCEntry* e = rc_find(refNum, type, id);
+    if (!e || !*e->h) return;
+
+    rc_account(e, false);
+    e->resident = true;
+    e->size = GetHandleSize(e->h);
+    e->lastUse = ++gClock;
+    rc_account(e, true);
+    rc_trim();
+}
+
+void RC_Remove(SInt16 refNum, ResType type, ResID id) {
+    RCEntry* e = rc_find(refNum, type, id);
+    if (e) rc_remove_at((UInt32)(e - gSlots));
+}
+
+void RC_RemoveFile(SInt16 refNum, void (*dispose)(Handle h)) {
+    for (UInt32 i = 0; i < gCapacity; ) {
+        if (gSlots[i].h && gSlots[i].refNum == refNum) {
+            Handle h = gSlots[i].h;
+            rc_remove_at(i);
+            if (dispose) dispose(h);
+            continue;   /* Slot i may hold a shifted entry now */
+        }
+        i++;
+    }
+}
+
+void RC_GetStats(ResCacheStats* stats) {
+    if (!stats) return;
+    *stats = gStats;
+    stats->entries = gCount;
+    stats->capacity = gCapacity;
+}
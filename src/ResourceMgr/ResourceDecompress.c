@@ -0,0 +1,553 @@
+/*
+ * ResourceDecompress.c - 'dcmp' 0, 1 and 2 decompression of resource data
+ *
+ * DonnBits (dcmp 0, word oriented; dcmp 1, byte oriented) decode through a
+ * 256-entry opcode table per format: each opcode maps to an operation
+ * class and its argument (literal length, variable index base, constant
+ * word), so the loop does one table load and one dense switch per
+ * opcode.  Bounds are checked once per operation, and literals and
+ * variable reuses are single memcpy calls.  Remembered literals are not
+ * copied aside: a variable is the (offset, length) of the literal where
+ * it was already written to the output.
+ *
+ * GreggyBits (dcmp 2) expands bytes to words through a table.  Whole
+ * groups of 8 words (one tag byte) are bounds-checked at once; untagged
+ * data is expanded four input bytes per 32-bit load.
+ */
+
+#include "SystemTypes.h"
+#include "MemoryMgr/MemoryManager.h"
+#include "ResourceMgr/ResourceMgrPriv.h"
+#include "ResourceMgr/ResourceDecompress.h"
+#include <string.h>
+
+/* Operation classes */
+enum {
+    RD_OP_BAD = 0,
+    RD_OP_END,
+    RD_OP_LIT,          /* arg bytes, or an encoded count of units if 0 */
+    RD_OP_DEF,          /* As RD_OP_LIT, and remember it */
+    RD_OP_LIT_BYTE,     /* Length in the next byte */
+    RD_OP_DEF_BYTE,
+    RD_OP_REF,          /* Variable arg */
+    RD_OP_REF_BYTE,     /* Variable arg + next byte */
+    RD_OP_REF_WORD,     /* Variable arg + next word */
+    RD_OP_CONST,        /* Constant word arg */
+    RD_OP_EXT
+};
+
+typedef struct {
+    UInt8  op;
+    UInt16 arg;
+} RDOp;
+
+typedef struct {
+    UInt32 offset;          /* In the output */
+    UInt32 length;
+} RDVar;
+
+typedef struct {
+    const UInt8* in;
+    const UInt8* inEnd;
+    UInt8*       out;
+    UInt8*       outStart;
+    UInt8*       outEnd;
+    RDVar*       vars;
+    UInt32       numVars;
+    UInt32       maxVars;
+    UInt32       unit;      /* Bytes per encoded literal count: 2 or 1 */
+} RDState;
+
+/* dcmp 0 constant words, opcodes 0x4B-0xFD */
+static const UInt16 kDcmp0Words[] = {
+    0x0000, 0x4EBA, 0x0008, 0x4E75, 0x000C, 0x4EAD, 0x2053, 0x2F0B,
+    0x6100, 0x0010, 0x7000, 0x2F00, 0x486E, 0x2050, 0x206E, 0x2F2E,
+    0xFFFC, 0x48E7, 0x3F3C, 0x0004, 0xFFF8, 0x2F0C, 0x2006, 0x4EED,
+    0x4E56, 0x2068, 0x4E5E, 0x0001, 0x588F, 0x4FEF, 0x0002, 0x0018,
+    0x6000, 0xFFFF, 0x508F, 0x4E90, 0x0006, 0x266E, 0x0014, 0xFFF4,
+    0x4CEE, 0x000A, 0x000E, 0x41EE, 0x4CDF, 0x48C0, 0xFFF0, 0x2D40,
+    0x0012, 0x302E, 0x7001, 0x2F28, 0x2054, 0x6700, 0x0020, 0x001C,
+    0x205F, 0x1800, 0x266F, 0x4878, 0x0016, 0x41FA, 0x303C, 0x2840,
+    0x7200, 0x286E, 0x200C, 0x6600, 0x206B, 0x2F07, 0x558F, 0x0028,
+    0xFFFE, 0xFFEC, 0x22D8, 0x200B, 0x000F, 0x598F, 0x2F3C, 0xFF00,
+    0x0118, 0x81E1, 0x4A00, 0x4EB0, 0xFFE8, 0x48C7, 0x0003, 0x0022,
+    0x0007, 0x001A, 0x6706, 0x6708, 0x4EF9, 0x0024, 0x2078, 0x0800,
+    0x6604, 0x002A, 0x4ED0, 0x3028, 0x265F, 0x6704, 0x0030, 0x43EE,
+    0x3F00, 0x201F, 0x001E, 0xFFF6, 0x202E, 0x42A7, 0x2007, 0xFFFA,
+    0x6002, 0x3D40, 0x0C40, 0x6606, 0x0026, 0x2D48, 0x2F01, 0x70FF,
+    0x6004, 0x1880, 0x4A40, 0x0040, 0x002C, 0x2F08, 0x0011, 0xFFE4,
+    0x2140, 0x2640, 0xFFF2, 0x426E, 0x4EB9, 0x3D7C, 0x0038, 0x000D,
+    0x6006, 0x422E, 0x203C, 0x670C, 0x2D68, 0x6608, 0x4A2E, 0x4AAE,
+    0x002E, 0x4840, 0x225F, 0x2200, 0x670A, 0x3007, 0x4267, 0x0032,
+    0x2028, 0x0009, 0x487A, 0x0200, 0x2F2B, 0x0005, 0x226E, 0x6602,
+    0xE580, 0x670E, 0x660A, 0x0050, 0x3E00, 0x660C, 0x2E00, 0xFFEE,
+    0x206D, 0x2040, 0xFFE0, 0x5340, 0x6008, 0x0480, 0x0068, 0x0B7C,
+    0x4400, 0x41E8, 0x4841
+};
+
+/* dcmp 1 constant words, opcodes 0xD5-0xFD */
+static const UInt16 kDcmp1Words[] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x2E01, 0x3E01, 0x0101, 0x1E01,
+    0xFFFF, 0x0E01, 0x3100, 0x1112, 0x0107, 0x3332, 0x1239, 0xED10,
+    0x0127, 0x2322, 0x0137, 0x0706, 0x0117, 0x0123, 0x00FF, 0x002F,
+    0x070E, 0xFD3C, 0x0135, 0x0115, 0x0102, 0x0007, 0x003E, 0x05D5,
+    0x0201, 0x0607, 0x0708, 0x3001, 0x0133, 0x0010, 0x1716, 0x373E,
+    0x3637
+};
+
+/* dcmp 2 word table used when the resource carries none */
+static const UInt16 kDcmp2Words[256] = {
+    0x0000, 0x0008, 0x4E75, 0x000C, 0x0010, 0x0018, 0x0020, 0x0028,
+    0x0030, 0x0038, 0x0040, 0x0048, 0x0050, 0x0058, 0x0060, 0x0068,
+    0x0070, 0x0078, 0x0080, 0x0088, 0x0090, 0x0098, 0x00A0, 0x00A8,
+    0x00B0, 0x00B8, 0x00C0, 0x00C8, 0x00D0, 0x00D8, 0x00E0, 0x00E8,
+    0x00F0, 0x00F8, 0x0100, 0x0108, 0x0110, 0x0118, 0x0120, 0x0128,
+    0x4EBA, 0x206F, 0x4E56, 0x48E7, 0x4CEE, 0x4E5E, 0x2F0A, 0x204F,
+    0xFFFF, 0xFFFE, 0xFFFC, 0xFFF8, 0xFFF0, 0xFFE0, 0xFFC0, 0xFF80,
+    0xFF00, 0xFE00, 0xFC00, 0xF800, 0xF000, 0xE000, 0xC000, 0x8000,
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+    0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+    0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+    0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+    0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+    0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+    0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,
+    0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+    0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,
+    0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7,
+    0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF,
+    0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7,
+    0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF,
+    0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x00C7,
+    0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF,
+    0x00D0, 0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x00D7,
+    0x00D8, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x00DD, 0x00DE, 0x00DF,
+    0x00E0, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x00E7,
+    0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF,
+    0x00F0, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x00F7,
+    0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x00FE, 0x00FF
+};
+
+static RDOp gDcmp0Ops[256];
+static RDOp gDcmp1Ops[256];
+static Boolean gOpsBuilt = false;
+
+static void set_ops(RDOp* ops, UInt32 first, UInt32 last, UInt8 op, UInt32 arg, Boolean step) {
+    for (UInt32 i = first; i <= last; i++) {
+        ops[i].op = op;
+        ops[i].arg = (UInt16)(step ? arg + (i - first) : arg);
+    }
+}
+
+static void build_ops(void) {
+    /* dcmp 0: literal lengths are in words */
+    set_ops(gDcmp0Ops, 0x00, 0x00, RD_OP_LIT, 0, false);
+    for (UInt32 i = 0x01; i <= 0x0F; i++) set_ops(gDcmp0Ops, i, i, RD_OP_LIT, i * 2, false);
+    set_ops(gDcmp0Ops, 0x10, 0x10, RD_OP_DEF, 0, false);
+    for (UInt32 i = 0x11; i <= 0x1F; i++) set_ops(gDcmp0Ops, i, i, RD_OP_DEF, (i - 0x10) * 2, false);
+    set_ops(gDcmp0Ops, 0x20, 0x20, RD_OP_REF_BYTE, 0x28, false);
+    set_ops(gDcmp0Ops, 0x21, 0x21, RD_OP_REF_BYTE, 0x128, false);
+    set_ops(gDcmp0Ops, 0x22, 0x22, RD_OP_REF_WORD, 0x28, false);
+    set_ops(gDcmp0Ops, 0x23, 0x4A, RD_OP_REF, 0, true);
+    set_ops(gDcmp0Ops, 0x4B, 0xFD, RD_OP_CONST, 0, true);
+    set_ops(gDcmp0Ops, 0xFE, 0xFE, RD_OP_EXT, 0, false);
+    set_ops(gDcmp0Ops, 0xFF, 0xFF, RD_OP_END, 0, false);
+
+    /* dcmp 1: literal lengths are in bytes */
+    for (UInt32 i = 0x00; i <= 0x0F; i++) set_ops(gDcmp1Ops, i, i, RD_OP_LIT, i + 1, false);
+    for (UInt32 i = 0x10; i <= 0x1F; i++) set_ops(gDcmp1Ops, i, i, RD_OP_DEF, i - 0x10 + 1, false);
+    set_ops(gDcmp1Ops, 0x20, 0xCF, RD_OP_REF, 0, true);
+    set_ops(gDcmp1Ops, 0xD0, 0xD0, RD_OP_LIT_BYTE, 0, false);
+    set_ops(gDcmp1Ops, 0xD1, 0xD1, RD_OP_DEF_BYTE, 0, false);
+    set_ops(gDcmp1Ops, 0xD2, 0xD2, RD_OP_REF_BYTE, 0xB0, false);
+    set_ops(gDcmp1Ops, 0xD3, 0xD3, RD_OP_REF_BYTE, 0x1B0, false);
+    set_ops(gDcmp1Ops, 0xD4, 0xD4, RD_OP_BAD, 0, false);
+    set_ops(gDcmp1Ops, 0xD5, 0xFD, RD_OP_CONST, 0, true);
+    set_ops(gDcmp1Ops, 0xFE, 0xFE, RD_OP_EXT, 0, false);
+    set_ops(gDcmp1Ops, 0xFF, 0xFF, RD_OP_END, 0, false);
+
+    gOpsBuilt = true;
+}
+
+static void put16(UInt8* p, UInt32 v) {
+    p[0] = (UInt8)(v >> 8);
+    p[1] = (UInt8)v;
+}
+
+static void put32(UInt8* p, UInt32 v) {
+    p[0] = (UInt8)(v >> 24);
+    p[1] = (UInt8)(v >> 16);
+    p[2] = (UInt8)(v >> 8);
+    p[3] = (UInt8)v;
+}
+
+/* Variable-length integer: 0x00-0x7F as is, 0xFF then 32 bits, otherwise
+ * a signed 15-bit value in this byte (biased by 0xC0) and the next */
+static Boolean read_encoded(RDState* s, SInt32* value) {
+    if (s->in >= s->inEnd) return false;
+
+    UInt8 b = *s->in++;
+    if (b < 0x80) {
+        *value = b;
+        return true;
+    }
+    if (b == 0xFF) {
+        if (s->inEnd - s->in < 4) return false;
+        *value = (SInt32)read_be32(s->in);
+        s->in += 4;
+        return true;
+    }
+    if (s->in >= s->inEnd) return false;
+    *value = ((SInt32)b - 0xC0) * 256 + *s->in++;
+    return true;
+}
+
+static Boolean out_room(const RDState* s, UInt32 n) {
+    return (UInt32)(s->outEnd - s->out) >= n;
+}
+
+static Boolean remember(RDState* s, UInt32 offset, UInt32 length) {
+    if (s->numVars >= s->maxVars) return false;
+    s->vars[s->numVars].offset = offset;
+    s->vars[s->numVars].length = length;
+    s->numVars++;
+    return true;
+}
+
+static Boolean reuse(RDState* s, UInt32 index) {
+    if (index >= s->numVars) return false;
+
+    const RDVar* v = &s->vars[index];
+    if (!out_room(s, v->length)) return false;
+    memcpy(s->out, s->outStart + v->offset, v->length);
+    s->out += v->length;
+    return true;
+}
+
+/* Extended operations (opcode 0xFE), shared by dcmp 0 and 1 */
+static Boolean extended(RDState* s) {
+    if (s->in >= s->inEnd) return false;
+
+    UInt8 kind = *s->in++;
+    SInt32 a, b, count;
+
+    switch (kind) {
+    case 0x00: {
+        /* Segment loader jump table: offset, MOVE.W #seg,-(SP), _LoadSeg */
+        SInt32 seg, offset;
+        if (!read_encoded(s, &seg) || !read_encoded(s, &count) ||
+            !read_encoded(s, &offset) || count < 0) return false;
+        for (SInt32 i = 0; i <= count; i++) {
+            if (i > 0) {
+                if (!read_encoded(s, &a)) return false;
+                offset += a - 6;
+            }
+            if (!out_room(s, 8)) return false;
+            put16(s->out, (UInt32)offset);
+            put16(s->out + 2, 0x3F3C);
+            put16(s->out + 4, (UInt32)seg);
+            put16(s->out + 6, 0xA9F0);
+            s->out += 8;
+        }
+        return true;
+    }
+    case 0x01: {
+        /* Entry vector: BSR branch, JMP offset(A5) */
+        SInt32 branch, delta, offset;
+        if (!read_encoded(s, &branch) || !read_encoded(s, &delta) ||
+            !read_encoded(s, &count) || !read_encoded(s, &offset) || count < 0) return false;
+        for (SInt32 i = 0; i < count; i++) {
+            if (i > 0) {
+                branch -= 8;
+                if (delta != 0) {
+                    offset += delta;
+                } else if (!read_encoded(s, &offset)) {
+                    return false;
+                }
+            }
+            if (!out_room(s, 8)) return false;
+            put16(s->out, 0x6100);
+            put16(s->out + 2, (UInt32)branch);
+            put16(s->out + 4, 0x4EED);
+            put16(s->out + 6, (UInt32)offset);
+            s->out += 8;
+        }
+        return true;
+    }
+    case 0x02:
+    case 0x03: {
+        /* Run of a byte or a word, count + 1 times */
+        UInt32 width = kind - 1;
+        if (!read_encoded(s, &a) || !read_encoded(s, &count) || count < 0 ||
+            (UInt32)count >= (UInt32)(s->outEnd - s->out) / width) return false;
+        UInt32 n = ((UInt32)count + 1) * width;
+        if (width == 1) {
+            memset(s->out, (int)(UInt8)a, n);
+        } else {
+            put16(s->out, (UInt32)a);
+            for (UInt32 i = 2; i < n; i += 2) memcpy(s->out + i, s->out, 2);
+        }
+        s->out += n;
+        return true;
+    }
+    case 0x04:
+    case 0x05: {
+        /* Words as deltas: signed bytes (4) or encoded values (5) */
+        if (!read_encoded(s, &a) || !read_encoded(s, &count) || count < 0 ||
+            (UInt32)count >= (UInt32)(s->outEnd - s->out) / 2) return false;
+        if (kind == 0x04 && (UInt32)(s->inEnd - s->in) < (UInt32)count) return false;
+        put16(s->out, (UInt32)a);
+        s->out += 2;
+        for (SInt32 i = 0; i < count; i++) {
+            if (kind == 0x04) {
+                a += (SInt8)*s->in++;
+            } else {
+                if (!read_encoded(s, &b)) return false;
+                a += b;
+            }
+            put16(s->out, (UInt32)a);
+            s->out += 2;
+        }
+        return true;
+    }
+    case 0x06: {
+        /* Longs as encoded deltas */
+        if (!read_encoded(s, &a) || !read_encoded(s, &count) || count < 0 ||
+            (UInt32)count >= (UInt32)(s->outEnd - s->out) / 4) return false;
+        put32(s->out, (UInt32)a);
+        s->out += 4;
+        for (SInt32 i = 0; i < count; i++) {
+            if (!read_encoded(s, &b)) return false;
+            a = (SInt32)((UInt32)a + (UInt32)b);
+            put32(s->out, (UInt32)a);
+            s->out += 4;
+        }
+        return true;
+    }
+    default:
+        return false;
+    }
+}
+
+static OSErr donn_bits(RDState* s, const RDOp* ops, const UInt16* words, UInt32 numWords) {
+    for (;;) {
+        if (s->in >= s->inEnd) break;
+
+        const RDOp* op = &ops[*s->in++];
+        UInt32 n = op->arg;
+        SInt32 v;
+
+        switch (op->op) {
+        case RD_OP_END:
+            return s->out == s->outEnd ? noErr : CantDecompress;
+
+        case RD_OP_LIT_BYTE:
+        case RD_OP_DEF_BYTE:
+            if (s->in >= s->inEnd) return CantDecompress;
+            n = *s->in++;
+            goto literal;
+
+        case RD_OP_LIT:
+        case RD_OP_DEF:
+            if (n == 0) {
+                if (!read_encoded(s, &v) || v < 0) return CantDecompress;
+                n = (UInt32)v * s->unit;
+            }
+        literal:
+            if ((UInt32)(s->inEnd - s->in) < n || !out_room(s, n)) return CantDecompress;
+            if ((op->op == RD_OP_DEF || op->op == RD_OP_DEF_BYTE) &&
+                !remember(s, (UInt32)(s->out - s->outStart), n)) return CantDecompress;
+            memcpy(s->out, s->in, n);
+            s->in += n;
+            s->out += n;
+            break;
+
+        case RD_OP_REF:
+            if (!reuse(s, n)) return CantDecompress;
+            break;
+
+        case RD_OP_REF_BYTE:
+            if (s->in >= s->inEnd || !reuse(s, n + *s->in++)) return CantDecompress;
+            break;
+
+        case RD_OP_REF_WORD:
+            if (s->inEnd - s->in < 2) return CantDecompress;
+            n += read_be16(s->in);
+            s->in += 2;
+            if (!reuse(s, n)) return CantDecompress;
+            break;
+
+        case RD_OP_CONST:
+            if (n >= numWords || !out_room(s, 2)) return CantDecompress;
+            put16(s->out, words[n]);
+            s->out += 2;
+            break;
+
+        case RD_OP_EXT:
+            if (!extended(s)) return CantDecompress;
+            break;
+
+        default:
+            return CantDecompress;
+        }
+    }
+
+    /* Ran off the input without an end opcode */
+    return s->out == s->outEnd ? noErr : CantDecompress;
+}
+
+static OSErr donn_bits_run(const UInt8* in, const UInt8* inEnd, UInt8* dst, UInt32 dstSize,
+                           SInt16 dcmpID) {
+    RDState s;
+    s.in = in;
+    s.inEnd = inEnd;
+    s.out = s.outStart = dst;
+    s.outEnd = dst + dstSize;
+    s.numVars = 0;
+    s.unit = (dcmpID == 0) ? 2 : 1;
+
+    /* Every remembered literal costs at least an opcode and a byte */
+    s.maxVars = (UInt32)(inEnd - in) / 2 + 1;
+    s.vars = (RDVar*)NewPtr(s.maxVars * sizeof(RDVar));
+    if (!s.vars) return memFullErr;
+
+    OSErr err;
+    if (dcmpID == 0) {
+        err = donn_bits(&s, gDcmp0Ops, kDcmp0Words, sizeof(kDcmp0Words) / sizeof(kDcmp0Words[0]));
+    } else {
+        err = donn_bits(&s, gDcmp1Ops, kDcmp1Words, sizeof(kDcmp1Words) / sizeof(kDcmp1Words[0]));
+    }
+    DisposePtr((Ptr)s.vars);
+    return err;
+}
+
+static OSErr greggy_bits(const RDHeader* hdr, const UInt8* in, const UInt8* inEnd,
+                         UInt8* dst, UInt32 dstSize) {
+    /* Table words, big-endian in memory so each one is a 2-byte copy */
+    UInt8 table[256][2];
+    for (UInt32 i = 0; i < 256; i++) put16(table[i], kDcmp2Words[i]);
+
+    if (hdr->flags & RD_FLAG_CUSTOM_TABLE) {
+        UInt32 entries = (UInt32)hdr->tableSize + 1;
+        if ((UInt32)(inEnd - in) < entries * 2) return CantDecompress;
+        memcpy(table, in, entries * 2);
+        in += entries * 2;
+    }
+
+    UInt8* out = dst;
+    UInt32 words = dstSize / 2;
+
+    if (!(hdr->flags & RD_FLAG_TAGGED)) {
+        /* Every byte is a table index */
+        if ((UInt32)(inEnd - in) < words) return CantDecompress;
+        UInt32 w = 0;
+        for (; w + 4 <= words; w += 4) {
+            UInt32 four;
+            memcpy(&four, in + w, 4);
+            four = read_be32((const UInt8*)&four);
+            memcpy(out, table[four >> 24], 2);
+            memcpy(out + 2, table[(four >> 16) & 0xFF], 2);
+            memcpy(out + 4, table[(four >> 8) & 0xFF], 2);
+            memcpy(out + 6, table[four & 0xFF], 2);
+            out += 8;
+        }
+        for (; w < words; w++) {
+            memcpy(out, table[in[w]], 2);
+            out += 2;
+        }
+        in += words;
+    } else {
+        /* A tag byte per 8 words, high bit first: 1 = table index, 0 = literal word */
+        while (words > 0) {
+            if (in >= inEnd) return CantDecompress;
+            UInt8 tag = *in++;
+
+            if (words >= 8 && inEnd - in >= 16) {
+                if (tag == 0) {
+                    memcpy(out, in, 16);
+                    in += 16;
+                } else {
+                    for (UInt32 bit = 0x80; bit; bit >>= 1) {
+                        if (tag & bit) {
+                            memcpy(out, table[*in++], 2);
+                        } else {
+                            memcpy(out, in, 2);
+                            in += 2;
+                        }
+                        out += 2;
+                    }
+                    words -= 8;
+                    continue;
+                }
+                out += 16;
+                words -= 8;
+                continue;
+            }
+
+            /* Last group, or input nearly used up: check each word */
+            UInt32 group = words < 8 ? words : 8;
+            for (UInt32 i = 0; i < group; i++) {
+                UInt32 need = (tag & (0x80 >> i)) ? 1 : 2;
+                if ((UInt32)(inEnd - in) < need) return CantDecompress;
+                memcpy(out, need == 1 ? table[*in] : in, 2);
+                in += need;
+                out += 2;
+            }
+            words -= group;
+        }
+    }
+
+    /* An odd last byte is stored as is */
+    if (dstSize & 1) {
+        if (in >= inEnd) return CantDecompress;
+        *out = *in;
+    }
+    return noErr;
+}
+
+Boolean RD_ParseHeader(const UInt8* data, UInt32 size, RDHeader* header) {
+    if (!data || !header || size < RD_HEADER_SIZE) return false;
+    if (read_be32(data) != RD_SIGNATURE) return false;
+
+    header->headerLength = read_be16(data + 4);
+    header->version = data[6];
+    header->attributes = data[7];
+    header->unpackedSize = read_be32(data + 8);
+    header->tableSize = 0;
+    header->flags = 0;
+
+    if (header->version == 8) {
+        header->dcmpID = (SInt16)read_be16(data + 14);
+    } else if (header->version == 9) {
+        header->dcmpID = (SInt16)read_be16(data + 12);
+        header->tableSize = data[16];
+        header->flags = data[17];
+    } else {
+        return false;
+    }
+    return header->headerLength >= RD_HEADER_SIZE && header->headerLength <= size;
+}
+
+OSErr RD_Decompress(const UInt8* data, UInt32 size, UInt8* dst, UInt32 dstSize) {
+    RDHeader hdr;
+
+    if (!RD_ParseHeader(data, size, &hdr) || !dst) return badExtResource;
+    if (hdr.unpackedSize != dstSize) return CantDecompress;
+    if (!gOpsBuilt) build_ops();
+
+    const UInt8* in = data + hdr.headerLength;
+    const UInt8* inEnd = data + size;
+
+    switch (hdr.dcmpID) {
+    case 0:
+    case 1:
+        return donn_bits_run(in, inEnd, dst, dstSize, hdr.dcmpID);
+    case 2:
+        return greggy_bits(&hdr, in, inEnd, dst, dstSize);
+    default:
+        return CantDecompress;
+    }
+}
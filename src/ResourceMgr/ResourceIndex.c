@@ -0,0 +1,246 @@
+/*
+ * ResourceIndex.c - Per-file lookup index over a resource map
+ *
+ * Three sorted arrays in one block: types, (type, ID) and (type, name
+ * hash).  The last two share an entry layout; an ID is stored biased so
+ * the unsigned key keeps signed order.  Entries with equal keys stay in
+ * map order, so a duplicate ID or name resolves to the same reference a
+ * linear walk of the map would find first.
+ */
+
+#include "SystemTypes.h"
+#include "MemoryMgr/MemoryManager.h"
+#include "ResourceMgr/ResourceMgrPriv.h"
+#include "ResourceMgr/ResourceIndex.h"
+#include <string.h>
+
+typedef struct {
+    ResType type;
+    UInt32  entry;          /* Map offset of the TypeListEntry */
+    UInt32  first;          /* First of the type's refs in refs[] */
+    UInt32  count;
+} RIType;
+
+typedef struct {
+    ResType type;
+    UInt32  key;            /* Biased ID, or name hash */
+    UInt32  ref;            /* Map offset of the RefListEntry */
+} RIEntry;
+
+struct ResIndex {
+    UInt32   numTypes;
+    UInt32   numRefs;
+    UInt32   numNames;
+    RIType*  types;
+    RIEntry* refs;
+    RIEntry* names;
+};
+
+static UInt32 id_key(ResID id) {
+    return (UInt32)((SInt32)id + 32768);
+}
+
+/* FNV-1a over a Pascal string, length byte included */
+static UInt32 name_hash(const UInt8* s) {
+    UInt32 h = 2166136261u;
+    for (UInt32 i = 0; i <= s[0]; i++) {
+        h ^= s[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+static Boolean entry_less(const RIEntry* a, const RIEntry* b) {
+    if (a->type != b->type) return a->type < b->type;
+    if (a->key != b->key) return a->key < b->key;
+    return a->ref < b->ref;
+}
+
+/* Shell sort (no qsort in freestanding) */
+static void sort_entries(RIEntry* arr, UInt32 n) {
+    for (UInt32 gap = n / 2; gap > 0; gap /= 2) {
+        for (UInt32 i = gap; i < n; i++) {
+            RIEntry temp = arr[i];
+            UInt32 j = i;
+            while (j >= gap && entry_less(&temp, &arr[j - gap])) {
+                arr[j] = arr[j - gap];
+                j -= gap;
+            }
+            arr[j] = temp;
+        }
+    }
+}
+
+static void sort_types(RIType* arr, UInt32 n) {
+    for (UInt32 i = 1; i < n; i++) {
+        RIType temp = arr[i];
+        UInt32 j = i;
+        while (j > 0 && arr[j - 1].type > temp.type) {
+            arr[j] = arr[j - 1];
+            j--;
+        }
+        arr[j] = temp;
+    }
+}
+
+/* First entry in [lo, hi) not less than (type, key) */
+static UInt32 lower_bound(const RIEntry* arr, UInt32 lo, UInt32 hi, ResType type, UInt32 key) {
+    while (lo < hi) {
+        UInt32 mid = lo + (hi - lo) / 2;
+        if (arr[mid].type < type || (arr[mid].type == type && arr[mid].key < key)) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+static const RIType* find_type(const ResIndex* idx, ResType type) {
+    UInt32 lo = 0, hi = idx->numTypes;
+    while (lo < hi) {
+        UInt32 mid = lo + (hi - lo) / 2;
+        if (idx->types[mid].type == type) return &idx->types[mid];
+        if (idx->types[mid].type < type) lo = mid + 1;
+        else hi = mid;
+    }
+    return NULL;
+}
+
+/* Offset of the type's reference list, or 0 if it does not fit the map */
+static UInt32 ref_list_at(UInt32 mapSize, UInt32 typeListOff, const TypeListEntry* te,
+                          UInt32* count) {
+    *count = (UInt32)read_be16((const UInt8*)&te->count) + 1;
+    UInt32 start = typeListOff + read_be16((const UInt8*)&te->refListOffset);
+    if (start >= mapSize || *count * sizeof(RefListEntry) > mapSize - start) return 0;
+    return start;
+}
+
+ResIndex* RI_Build(const UInt8* map, UInt32 mapSize) {
+    if (!map || mapSize < sizeof(ResMapHeader)) return NULL;
+
+    const ResMapHeader* hdr = (const ResMapHeader*)map;
+    UInt32 typeListOff = read_be16((const UInt8*)&hdr->typeListOffset);
+    UInt32 nameListOff = read_be16((const UInt8*)&hdr->nameListOffset);
+    if (typeListOff == 0xFFFF || typeListOff + 2 > mapSize) return NULL;
+
+    UInt32 numTypes = (UInt32)read_be16(map + typeListOff) + 1;
+    if (2 + numTypes * sizeof(TypeListEntry) > mapSize - typeListOff) return NULL;
+    const TypeListEntry* typeList = (const TypeListEntry*)(map + typeListOff + 2);
+
+    /* Size the arrays: refs of each type's first entry, and their names */
+    UInt32 numRefs = 0, numNames = 0;
+    for (UInt32 t = 0; t < numTypes; t++) {
+        ResType type = read_be32((const UInt8*)&typeList[t].resType);
+        Boolean dup = false;
+        for (UInt32 u = 0; u < t && !dup; u++) {
+            dup = read_be32((const UInt8*)&typeList[u].resType) == type;
+        }
+        UInt32 count;
+        UInt32 start = ref_list_at(mapSize, typeListOff, &typeList[t], &count);
+        if (dup || !start) continue;
+
+        numRefs += count;
+        if (nameListOff == 0xFFFF) continue;
+        const RefListEntry* refs = (const RefListEntry*)(map + start);
+        for (UInt32 r = 0; r < count; r++) {
+            if (read_be16((const UInt8*)&refs[r].nameOffset) != 0xFFFF) numNames++;
+        }
+    }
+
+    UInt32 bytes = sizeof(ResIndex) + numTypes * sizeof(RIType) +
+                   (numRefs + numNames) * sizeof(RIEntry);
+    ResIndex* idx = (ResIndex*)NewPtr(bytes);
+    if (!idx) return NULL;
+
+    idx->types = (RIType*)(idx + 1);
+    idx->refs = (RIEntry*)(idx->types + numTypes);
+    idx->names = idx->refs + numRefs;
+    idx->numTypes = idx->numRefs = idx->numNames = 0;
+
+    for (UInt32 t = 0; t < numTypes; t++) {
+        ResType type = read_be32((const UInt8*)&typeList[t].resType);
+        if (find_type(idx, type)) continue;
+
+        UInt32 count;
+        UInt32 start = ref_list_at(mapSize, typeListOff, &typeList[t], &count);
+        if (!start) continue;
+
+        RIType* it = &idx->types[idx->numTypes++];
+        it->type = type;
+        it->entry = (UInt32)((const UInt8*)&typeList[t] - map);
+        it->first = 0;
+        it->count = count;
+        sort_types(idx->types, idx->numTypes);
+    }
+
+    /* Refs grouped by type in sorted type order */
+    for (UInt32 t = 0; t < idx->numTypes; t++) {
+        RIType* it = &idx->types[t];
+        UInt32 count;
+        UInt32 start = ref_list_at(mapSize, typeListOff,
+                                   (const TypeListEntry*)(map + it->entry), &count);
+        const RefListEntry* refs = (const RefListEntry*)(map + start);
+
+        it->first = idx->numRefs;
+        for (UInt32 r = 0; r < count; r++) {
+            UInt32 refOff = start + r * sizeof(RefListEntry);
+            RIEntry* e = &idx->refs[idx->numRefs++];
+            e->type = it->type;
+            e->key = id_key((ResID)read_be16((const UInt8*)&refs[r].resID));
+            e->ref = refOff;
+
+            UInt16 nameOff = read_be16((const UInt8*)&refs[r].nameOffset);
+            if (nameOff == 0xFFFF || nameListOff == 0xFFFF) continue;
+            UInt32 namePos = nameListOff + nameOff;
+            if (namePos >= mapSize || namePos + 1 + map[namePos] > mapSize) continue;
+
+            RIEntry* n = &idx->names[idx->numNames++];
+            n->type = it->type;
+            n->key = name_hash(map + namePos);
+            n->ref = refOff;
+        }
+        sort_entries(idx->refs + it->first, count);
+    }
+    sort_entries(idx->names, idx->numNames);
+    return idx;
+}
+
+void RI_Dispose(ResIndex* idx) {
+    if (idx) DisposePtr((Ptr)idx);
+}
+
+UInt32 RI_FindType(const ResIndex* idx, ResType type) {
+    const RIType* it = idx ? find_type(idx, type) : NULL;
+    return it ? it->entry : 0;
+}
+
+UInt32 RI_FindResource(const ResIndex* idx, ResType type, ResID id) {
+    const RIType* it = idx ? find_type(idx, type) : NULL;
+    if (!it) return 0;
+
+    UInt32 end = it->first + it->count;
+    UInt32 key = id_key(id);
+    UInt32 i = lower_bound(idx->refs, it->first, end, type, key);
+    return (i < end && idx->refs[i].key == key) ? idx->refs[i].ref : 0;
+}
+
+UInt32 RI_FindNamed(const ResIndex* idx, const UInt8* map, ResType type, ConstStr255Param name) {
+    if (!idx || !map || !name) return 0;
+
+    const UInt8* want = (const UInt8*)name;
+    UInt32 hash = name_hash(want);
+    UInt32 nameListOff = read_be16((const UInt8*)&((const ResMapHeader*)map)->nameListOffset);
+
+    for (UInt32 i = lower_bound(idx->names, 0, idx->numNames, type, hash);
+         i < idx->numNames && idx->names[i].type == type && idx->names[i].key == hash; i++) {
+        const RefListEntry* ref = (const RefListEntry*)(map + idx->names[i].ref);
+        const UInt8* have = map + nameListOff + read_be16((const UInt8*)&ref->nameOffset);
+        if (memcmp(have, want, (size_t)want[0] + 1) == 0) return idx->names[i].ref;
+    }
+    return 0;
+}
+
+UInt32 RI_CountResources(const ResIndex* idx) {
+    return idx ? idx->numRefs : 0;
+}
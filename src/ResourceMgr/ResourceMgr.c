@@ -11,6 +11,10 @@
 #include "ResourceMgr/resource_manager.h"
 #include "ResourceMgr/ResourceMgrPriv.h"
 #include "ResourceMgr/ResourceLogging.h"
+#include "ResourceMgr/ResourceCache.h"
+#include "ResourceMgr/ResourceIndex.h"
+#include "ResourceMgr/ResourceDecompress.h"
+#include "ResourceMgr/DecompressCache.h"
 #include "System71StdLib.h"
 
 /* External functions we need */
@@ -19,41 +23,22 @@ extern void DisposeHandle(Handle h);
 extern void HLock(Handle h);
 extern void HUnlock(Handle h);
 extern void BlockMove(const void* srcPtr, void* destPtr, Size byteCount);
+extern Size GetHandleSize(Handle h);
+extern Ptr NewPtr(Size byteCount);
+extern void DisposePtr(Ptr p);
+extern bool ReallocateHandle(Handle h, UInt32 byteCount);
+extern void MemoryManager_SetROM(const void* base, UInt32 size);
+extern Handle MemoryManager_NewROMHandle(const void* data);
+extern bool MemoryManager_IsROMHandle(Handle h);
+extern bool MemoryManager_CopyROMHandle(Handle h);
 extern void serial_puts(const char* s);
 extern OSErr FSOpenRF(ConstStr255Param fileName, VolumeRefNum vRefNum, FileRefNum* refNum);
 extern OSErr FSRead(FileRefNum refNum, UInt32* count, void* buffer);
 extern OSErr FSClose(FileRefNum refNum);
 extern OSErr FSSetFPos(FileRefNum refNum, UInt16 posMode, SInt32 posOffset);
 
-/* Resource index for fast lookups */
-typedef struct {
-    ResType type;
-    UInt16 firstRefIndex;
-    UInt16 count;
-} TypeIndex;
-
-typedef struct {
-    ResType type;
-    ResID id;
-    UInt32 refOffset;  /* Offset of RefListEntry in map */
-    UInt16 nameOffset;  /* For named resource lookups */
-} RefIndex;
-
-static TypeIndex *gTypeIdx = NULL;
-static UInt32 gTypeIdxCount = 0;
-static RefIndex *gRefIdx = NULL;
-static UInt32 gRefIdxCount = 0;
-
-/* Resource cache to avoid duplicate loads */
-#define RM_CACHE_CAP 256
-typedef struct {
-    ResType type;
-    ResID id;
-    Handle h;
-} CacheEntry;
-
-static CacheEntry gCache[RM_CACHE_CAP];
-static UInt32 gCacheCount = 0;
+/* Build a ResIndex for files as they open */
+static Boolean gIndexMaps = true;
 
 /* Side-table for handle metadata */
 #define RM_HANDLE_CAP 512
@@ -99,100 +84,6 @@ void write_be32(UInt8* p, UInt32 val) {
     p[3] = val & 0xFF;
 }
 
-/* Shell sort for resource index (no qsort in freestanding) */
-static void SortRefIndex(RefIndex* arr, UInt32 n) {
-    UInt32 gap, i, j;
-    RefIndex temp;
-
-    for (gap = n/2; gap > 0; gap /= 2) {
-        for (i = gap; i < n; i++) {
-            temp = arr[i];
-            for (j = i; j >= gap; j -= gap) {
-                /* Compare (type,id) pairs */
-                if (arr[j-gap].type > temp.type ||
-                    (arr[j-gap].type == temp.type && arr[j-gap].id > temp.id)) {
-                    arr[j] = arr[j-gap];
-                } else {
-                    break;
-                }
-            }
-            arr[j] = temp;
-        }
-    }
-}
-
-/* Binary search for type in index */
-static SInt32 FindTypeIndex(ResType type) {
-    SInt32 left = 0, right = gTypeIdxCount - 1;
-
-    while (left <= right) {
-        SInt32 mid = left + (right - left) / 2;  /* Avoid integer overflow */
-        if (gTypeIdx[mid].type == type) {
-            return mid;
-        } else if (gTypeIdx[mid].type < type) {
-            left = mid + 1;
-        } else {
-            right = mid - 1;
-        }
-    }
-    return -1;  /* Not found */
-}
-
-/* Binary search for resource in index */
-static SInt32 FindRefIndex(ResType type, ResID id) {
-    SInt32 left = 0, right = gRefIdxCount - 1;
-
-    while (left <= right) {
-        SInt32 mid = left + (right - left) / 2;  /* Avoid integer overflow */
-        if (gRefIdx[mid].type < type ||
-            (gRefIdx[mid].type == type && gRefIdx[mid].id < id)) {
-            left = mid + 1;
-        } else if (gRefIdx[mid].type > type ||
-                   (gRefIdx[mid].type == type && gRefIdx[mid].id > id)) {
-            right = mid - 1;
-        } else {
-            return mid;  /* Found */
-        }
-    }
-    return -1;  /* Not found */
-}
-
-/* Cache operations */
-static Handle CacheLookup(ResType type, ResID id) {
-    /* Simple hash with linear probing */
-    UInt32 hash = ((type << 16) ^ id) % RM_CACHE_CAP;
-    UInt32 i;
-
-    for (i = 0; i < RM_CACHE_CAP; i++) {
-        UInt32 idx = (hash + i) % RM_CACHE_CAP;
-        if (gCache[idx].h && gCache[idx].type == type && gCache[idx].id == id) {
-            return gCache[idx].h;
-        }
-        if (!gCache[idx].h) {
-            break;  /* Empty slot, not found */
-        }
-    }
-    return NULL;
-}
-
-static void CacheInsert(ResType type, ResID id, Handle h) {
-    if (gCacheCount >= RM_CACHE_CAP) return;  /* Cache full */
-
-    UInt32 hash = ((type << 16) ^ id) % RM_CACHE_CAP;
-    UInt32 i;
-
-    for (i = 0; i < RM_CACHE_CAP; i++) {
-        UInt32 idx = (hash + i) % RM_CACHE_CAP;
-        if (!gCache[idx].h) {
-            gCache[idx].type = type;
-            gCache[idx].id = id;
-            gCache[idx].h = h;
-            gCacheCount++;
-            break;
-        }
-    }
-}
-
 /* Handle info operations */
 static void RecordHandleInfo(Handle h, ResType type, ResID id, UInt16 nameOff, UInt32 dataLen, SInt16 homeFile) {
     if (gHandleCount >= RM_HANDLE_CAP) return;
@@ -232,6 +123,167 @@ static HandleInfo* FindHandleInfo(Handle h) {
     return NULL;
 }
 
+static void RemoveHandleInfo(Handle h) {
+    HandleInfo* info = FindHandleInfo(h);
+    if (!info) return;
+
+    /* Backward-shift delete so later probes still find their entries */
+    UInt32 i = (UInt32)(info - gHandleInfo);
+    UInt32 j = i;
+    for (;;) {
+        j = (j + 1) % RM_HANDLE_CAP;
+        if (!gHandleInfo[j].h) break;
+        UInt32 home = ((UInt32)(uintptr_t)gHandleInfo[j].h >> 4) % RM_HANDLE_CAP;
+        Boolean stays = (i <= j) ? (home > i && home <= j) : (home > i || home <= j);
+        if (!stays) {
+            gHandleInfo[i] = gHandleInfo[j];
+            i = j;
+        }
+    }
+    gHandleInfo[i].h = NULL;
+    gHandleCount--;
+}
+
+/* Read bytes of a resource fork: from memory when the whole fork is
+ * resident, otherwise from the open fork */
+OSErr ResFile_ReadAt(ResFile* file, UInt32 offset, void* dst, UInt32 size) {
+    if (!file) return mapReadErr;
+
+    if (offset > file->dataSize || size > file->dataSize - offset) {
+        return mapReadErr;
+    }
+
+    if (file->data) {
+        BlockMove(file->data + offset, dst, size);
+        return noErr;
+    }
+
+    if (!file->forkOpen) return mapReadErr;
+
+    OSErr err = FSSetFPos(file->forkRef, fsFromStart, (SInt32)offset);
+    if (err != noErr) return err;
+
+    UInt32 count = size;
+    err = FSRead(file->forkRef, &count, dst);
+    if (count == size) return noErr;
+    return (err != noErr) ? err : mapReadErr;
+}
+
+/* Read the header and map of an open resource fork into file; the fork
+ * stays open for ResFile_ReadAt.  Leaves file untouched on failure. */
+static OSErr ResFile_OpenFork(ResFile* file, FileRefNum fileRef) {
+    ResourceHeader header;
+    UInt32 readCount = sizeof(ResourceHeader);
+
+    OSErr err = FSSetFPos(fileRef, fsFromStart, 0);
+    if (err == noErr) {
+        err = FSRead(fileRef, &readCount, &header);
+    }
+    if (err != noErr || readCount != sizeof(ResourceHeader)) {
+        return (err != noErr) ? err : mapReadErr;
+    }
+
+    /* Resource forks are big-endian */
+    UInt32 dataOffset = read_be32((UInt8*)&header.dataOffset);
+    UInt32 mapOffset = read_be32((UInt8*)&header.mapOffset);
+    UInt32 mapLength = read_be32((UInt8*)&header.mapLength);
+
+    if (mapLength < sizeof(ResMapHeader) || mapOffset > UINT32_MAX - mapLength) {
+        return mapReadErr;
+    }
+
+    Handle mapHandle = NewHandle(mapLength);
+    if (!mapHandle) return memFullErr;
+
+    err = FSSetFPos(fileRef, fsFromStart, (SInt32)mapOffset);
+    if (err == noErr) {
+        readCount = mapLength;
+        HLock(mapHandle);
+        err = FSRead(fileRef, &readCount, *mapHandle);
+        if (err == noErr && readCount != mapLength) err = mapReadErr;
+    }
+    if (err != noErr) {
+        DisposeHandle(mapHandle);
+        return err;
+    }
+
+    /* The map stays locked: reference entries are used by address */
+    file->data = NULL;
+    file->dataSize = mapOffset + mapLength;
+    file->map = (ResMapHeader*)*mapHandle;
+    file->mapSize = mapLength;
+    file->mapHandle = mapHandle;
+    file->dataBase = dataOffset;
+    file->forkOpen = true;
+    file->forkRef = fileRef;
+    file->rom = false;
+    return noErr;
+}
+
+/* Fork offset and length of a resource's data */
+static OSErr ResFile_DataExtent(ResFile* file, RefListEntry* ref, UInt32* offset, UInt32* length) {
+    UInt8 lengthBytes[sizeof(ResourceDataEntry)];
+
+    /* 24-bit offset from the start of the resource data section */
+    UInt32 dataOffset = ((UInt32)ref->dataOffsetHi << 16) | read_be16((UInt8*)&ref->dataOffsetLo);
+    UInt32 actualOffset = file->dataBase + dataOffset;
+
+    if (actualOffset < file->dataBase) return mapReadErr;
+
+    OSErr err = ResFile_ReadAt(file, actualOffset, lengthBytes, sizeof(lengthBytes));
+    if (err != noErr) return err;
+
+    *offset = actualOffset + sizeof(ResourceDataEntry);
+    *length = read_be32(lengthBytes);
+    if (*offset > file->dataSize || *length > file->dataSize - *offset) {
+        return mapReadErr;
+    }
+    return noErr;
+}
+
+/* Open the resource image linked into the kernel.  Its data is used in
+ * place - loading a resource makes a ROM handle pointing into it - and it
+ * is never written: the map, which holds the loaded handles, is copied to
+ * the heap. */
+static OSErr ResFile_OpenImage(ResFile* file, const UInt8* image, UInt32 size) {
+    if (size < sizeof(ResourceHeader)) return mapReadErr;
+
+    const ResourceHeader* header = (const ResourceHeader*)image;
+    UInt32 dataOffset = read_be32((const UInt8*)&header->dataOffset);
+    UInt32 mapOffset = read_be32((const UInt8*)&header->mapOffset);
+    if (mapOffset > size || size - mapOffset < sizeof(ResMapHeader) || dataOffset > mapOffset) {
+        return mapReadErr;
+    }
+
+    UInt32 mapLength = size - mapOffset;
+    Handle mapHandle = NewHandle(mapLength);
+    if (!mapHandle) return memFullErr;
+    HLock(mapHandle);
+    BlockMove(image + mapOffset, *mapHandle, mapLength);
+
+    file->data = (UInt8*)(uintptr_t)image;
+    file->dataSize = size;
+    file->map = (ResMapHeader*)*mapHandle;
+    file->mapSize = mapLength;
+    file->mapHandle = mapHandle;
+    file->dataBase = dataOffset;
+    file->rom = true;
+    MemoryManager_SetROM(image, size);
+    return noErr;
+}
+
+/* Index a newly opened map; without one, lookups walk the map */
+static void ResFile_BuildIndex(ResFile* file) {
+    file->index = gIndexMaps ? RI_Build((const UInt8*)file->map, file->mapSize) : NULL;
+    if (gIndexMaps && !file->index) {
+        RM_LOG_WARN("ResFile_BuildIndex: refNum=%d not indexed", file->refNum);
+    }
+}
+
+void ResMap_SetIndexing(Boolean on) {
+    gIndexMaps = on;
+}
+
 /* Initialize Resource Manager */
 void InitResourceManager(void) {
     int i;
@@ -256,48 +308,11 @@ void InitResourceManager(void) {
     if (err == noErr) {
         serial_puts("[ResourceMgr] Opening System file resource fork\n");
 
-        /* Read resource header */
-        ResourceHeader header;
-        UInt32 readCount = sizeof(ResourceHeader);
-        err = FSRead(fileRef, &readCount, &header);
-
-        if (err == noErr && readCount == sizeof(ResourceHeader)) {
-            /* Byte-swap header fields */
-            UInt32 mapOffset = read_be32((UInt8*)&header.mapOffset);
-            UInt32 mapLength = read_be32((UInt8*)&header.mapLength);
-
-            /* Check for integer overflow in size calculation */
-            if (mapOffset > UINT32_MAX - mapLength) {
-                serial_puts("[ResourceMgr] Integer overflow in totalSize calculation\n");
-                FSClose(fileRef);
-                return;
-            }
-
-            /* Allocate buffer for entire resource fork */
-            UInt32 totalSize = mapOffset + mapLength;
-            Handle dataHandle = NewHandle(totalSize);
-
-            if (dataHandle) {
-                /* Seek to beginning and read entire fork */
-                err = FSSetFPos(fileRef, fsFromStart, 0);
-                if (err == noErr) {
-                    readCount = totalSize;
-                    HLock(dataHandle);
-                    err = FSRead(fileRef, &readCount, *dataHandle);
-                    HUnlock(dataHandle);
-
-                    if (err == noErr && readCount == totalSize) {
-                        /* Successfully loaded System file */
-                        FSClose(fileRef);
-                        gResMgr.resFiles[0].data = (UInt8*)*dataHandle;
-                        gResMgr.resFiles[0].dataSize = totalSize;
-                        gResMgr.resFiles[0].mapHandle = dataHandle;
-                        serial_puts("[ResourceMgr] System file loaded from disk\n");
-                        goto parse_resources;
-                    }
-                }
-                DisposeHandle(dataHandle);
-            }
+        /* Only the map is read; resources come off the fork as they load */
+        err = ResFile_OpenFork(&gResMgr.resFiles[0], fileRef);
+        if (err == noErr) {
+            serial_puts("[ResourceMgr] System file map loaded from disk\n");
+            goto parse_resources;
         }
         FSClose(fileRef);
         serial_puts("[ResourceMgr] Failed to load System file, using embedded resources\n");
@@ -305,174 +320,20 @@ void InitResourceManager(void) {
         serial_puts("[ResourceMgr] System file not found, using embedded resources\n");
     }
 
-    /* Fallback: use embedded resource data */
+    /* Fallback: the resource image built into the kernel */
     extern const unsigned char patterns_rsrc_data[];
     extern const unsigned int patterns_rsrc_size;
 
-    gResMgr.resFiles[0].data = (UInt8*)(uintptr_t)patterns_rsrc_data;
-    gResMgr.resFiles[0].dataSize = patterns_rsrc_size;
+    if (ResFile_OpenImage(&gResMgr.resFiles[0], patterns_rsrc_data, patterns_rsrc_size) != noErr) {
+        serial_puts("[ResourceMgr] Warning: Invalid resource map offset\n");
+    }
 
 parse_resources:
 
-    /* Parse resource header and map */
-    if (gResMgr.resFiles[0].dataSize >= sizeof(ResourceHeader)) {
-        ResourceHeader* hdr = (ResourceHeader*)gResMgr.resFiles[0].data;
-        UInt32 mapOffset = read_be32((UInt8*)&hdr->mapOffset);
-
-        /* Bounds check map offset */
-        if (mapOffset + sizeof(ResMapHeader) <= gResMgr.resFiles[0].dataSize) {
-            ResMapHeader* map = (ResMapHeader*)(gResMgr.resFiles[0].data + mapOffset);
-            gResMgr.resFiles[0].map = map;
-            serial_puts("[ResourceMgr] Resource map loaded successfully\n");
-
-            /* Build index for fast lookups */
-            UInt16 typeListOff = read_be16((UInt8*)&map->typeListOffset);
-            UInt16 nameListOff = read_be16((UInt8*)&map->nameListOffset);
-            UInt32 mapSize = gResMgr.resFiles[0].dataSize - mapOffset;
-            gResMgr.resFiles[0].mapSize = mapSize;
-
-            /* Validate offsets - Inside Macintosh: offsets are from map start */
-            if (typeListOff != 0xFFFF && typeListOff + 2 <= mapSize &&
-                (nameListOff == 0xFFFF || nameListOff < mapSize)) {
-
-                UInt8* typeList = (UInt8*)map + typeListOff;
-                UInt16 numTypes = read_be16(typeList) + 1;
-
-                /* Bounds check: ensure type list fits in map */
-                UInt32 typeListSize = 2 + ((UInt32)numTypes * sizeof(TypeListEntry));
-                if (typeListOff + typeListSize > mapSize) {
-                    serial_puts("[ResourceMgr] Warning: Type list exceeds map bounds\n");
-                    gResMgr.resError = mapReadErr;
-                    return;
-                }
-
-                typeList += 2;
-
-                /* Count total resources for index allocation */
-                UInt32 totalRefs = 0;
-                for (i = 0; i < numTypes; i++) {
-                    TypeListEntry* te = (TypeListEntry*)(typeList + i * sizeof(TypeListEntry));
-                    UInt16 count = read_be16((UInt8*)&te->count) + 1;
-                    UInt16 refListOff = read_be16((UInt8*)&te->refListOffset);
-
-                    /* Validate count is reasonable */
-                    if (count > 1024) {
-                        serial_puts("[ResourceMgr] Warning: Excessive resource count, skipping\n");
-                        continue;
-                    }
-
-                    /* Bounds check reference list with overflow protection */
-                    UInt32 refListStart = typeListOff + refListOff;
-                    UInt32 refListSize = (UInt32)count * sizeof(RefListEntry);
-
-                    /* Check for multiplication overflow */
-                    if (count > 0 && refListSize / count != sizeof(RefListEntry)) {
-                        serial_puts("[ResourceMgr] Warning: Size calculation overflow\n");
-                        continue;
-                    }
-
-                    /* Check bounds */
-                    if (refListStart >= mapSize || refListStart + refListSize > mapSize) {
-                        serial_puts("[ResourceMgr] Warning: Reference list exceeds map bounds\n");
-                        continue;
-                    }
-
-                    /* Check totalRefs won't overflow */
-                    if (totalRefs + count < totalRefs) {
-                        serial_puts("[ResourceMgr] Warning: Total resource count overflow\n");
-                        break;
-                    }
-
-                    totalRefs += count;
-                }
-
-                /* Check for integer overflow in allocation sizes */
-                if (numTypes > SIZE_MAX / sizeof(TypeIndex)) {
-                    serial_puts("[ResourceMgr] Integer overflow in typeIdx allocation\n");
-                    return;
-                }
-                if (totalRefs > SIZE_MAX / sizeof(RefIndex)) {
-                    serial_puts("[ResourceMgr] Integer overflow in refIdx allocation\n");
-                    return;
-                }
-
-                /* Allocate index arrays */
-                Handle typeIdxH = NewHandle(numTypes * sizeof(TypeIndex));
-                Handle refIdxH = NewHandle(totalRefs * sizeof(RefIndex));
-
-                if (!typeIdxH || !refIdxH) {
-                    /* Clean up any successfully allocated handles */
-                    if (typeIdxH) {
-                        DisposeHandle(typeIdxH);
-                    }
-                    if (refIdxH) {
-                        DisposeHandle(refIdxH);
-                    }
-                    serial_puts("[ResourceMgr] Warning: Could not allocate index\n");
-                } else if (typeIdxH && refIdxH) {
-                    HLock(typeIdxH);
-                    HLock(refIdxH);
-                    gTypeIdx = (TypeIndex*)*typeIdxH;
-                    gRefIdx = (RefIndex*)*refIdxH;
-                    gTypeIdxCount = numTypes;
-                    gRefIdxCount = 0;
-
-                    /* Build index */
-                    for (i = 0; i < numTypes; i++) {
-                        TypeListEntry* te = (TypeListEntry*)(typeList + i * sizeof(TypeListEntry));
-                        ResType resType = read_be32((UInt8*)&te->resType);
-                        UInt16 count = read_be16((UInt8*)&te->count) + 1;
-                        UInt16 refListOff = read_be16((UInt8*)&te->refListOffset);
-
-                        gTypeIdx[i].type = resType;
-                        gTypeIdx[i].firstRefIndex = gRefIdxCount;
-                        gTypeIdx[i].count = count;
-
-                        /* Index all resources of this type */
-                        /* Reference list offset is from start of type list (Inside Macintosh rule) */
-                        UInt32 refListStart = typeListOff + refListOff;
-
-                        /* Skip if reference list is out of bounds */
-                        if (refListStart + count * sizeof(RefListEntry) > mapSize) {
-                            continue;
-                        }
-
-                        UInt8* refList = (UInt8*)map + refListStart;
-
-                        for (int j = 0; j < count; j++) {
-                            RefListEntry* ref = (RefListEntry*)(refList + j * sizeof(RefListEntry));
-                            ResID id = (ResID)read_be16((UInt8*)&ref->resID);
-                            UInt16 nameOff = read_be16((UInt8*)&ref->nameOffset);
-
-                            /* Validate name offset */
-                            if (nameOff != 0xFFFF && nameListOff != 0xFFFF) {
-                                UInt32 actualNameOff = nameListOff + nameOff;
-                                if (actualNameOff >= mapSize) {
-                                    nameOff = 0xFFFF;  /* Invalid name, mark as none */
-                                }
-                            }
-
-                            gRefIdx[gRefIdxCount].type = resType;
-                            gRefIdx[gRefIdxCount].id = id;
-                            gRefIdx[gRefIdxCount].refOffset = (UInt8*)ref - (UInt8*)map;
-                            gRefIdx[gRefIdxCount].nameOffset = nameOff;
-                            gRefIdxCount++;
-                        }
-                    }
-
-                    /* Sort reference index for binary search */
-                    SortRefIndex(gRefIdx, gRefIdxCount);
-
-                    serial_puts("[ResourceMgr] Built index for ");
-                    /* Would print count but no printf in freestanding */
-                    serial_puts(" resources\n");
-                }
-            } else {
-                serial_puts("[ResourceMgr] Warning: Invalid type/name list offsets\n");
-            }
-        } else {
-            serial_puts("[ResourceMgr] Warning: Invalid resource map offset\n");
-        }
+    /* Index the resource map for lookups */
+    if (gResMgr.resFiles[0].map) {
+        serial_puts("[ResourceMgr] Resource map loaded successfully\n");
+        ResFile_BuildIndex(&gResMgr.resFiles[0]);
     }
 
     serial_puts("[ResourceMgr] Resource Manager initialized\n");
@@ -527,6 +388,11 @@ TypeListEntry* ResMap_FindType(ResFile* file, ResType type) {
     }
 
     map = file->map;
+    if (file->index) {
+        UInt32 entryOff = RI_FindType(file->index, type);
+        return entryOff ? (TypeListEntry*)((UInt8*)map + entryOff) : NULL;
+    }
+
     typeListOff = read_be16((UInt8*)&map->typeListOffset);
 
     /* Bounds check: validate type list offset */
@@ -577,6 +443,11 @@ RefListEntry* ResMap_FindResource(ResFile* file, ResType type, ResID id) {
         return NULL;
     }
 
+    if (file->index) {
+        UInt32 refOff = RI_FindResource(file->index, type, id);
+        return refOff ? (RefListEntry*)((UInt8*)file->map + refOff) : NULL;
+    }
+
     typeEntry = ResMap_FindType(file, type);
     if (!typeEntry) return NULL;
 
@@ -614,60 +485,140 @@ RefListEntry* ResMap_FindResource(ResFile* file, ResType type, ResID id) {
     return NULL;
 }
 
-/* Load resource data from file */
-Handle ResFile_LoadResource(ResFile* file, RefListEntry* ref) {
-    UInt32 dataOffset;
-    ResourceDataEntry* dataEntry;
-    UInt32 dataLength;
-    Handle h;
-    UInt8* data;
+/* Read a resource's data into *h, allocating it if NULL or resizing it if
+ * purged.  A resCompressed resource is copied from the decompressed cache
+ * if it is there; otherwise it is read whole into a scratch block, unpacked
+ * into the handle and offered to the cache. */
+static OSErr ResFile_ReadData(ResFile* file, RefListEntry* ref, ResType type, Handle* h) {
+    UInt32 offset, length;
+    OSErr err = ResFile_DataExtent(file, ref, &offset, &length);
+    if (err != noErr) return err;
+
+    /* Built-in image: the data is used where it is */
+    if (file->rom && !*h && !(ref->attributes & resCompressed)) {
+        *h = MemoryManager_NewROMHandle(file->data + offset);
+        return *h ? noErr : noMemForRsrc;
+    }
+
+    ResID id = (ResID)read_be16((UInt8*)&ref->resID);
+    Handle unpacked = NULL;
+    UInt8* packed = NULL;
+    UInt32 size = length;
+    if (ref->attributes & resCompressed) {
+        unpacked = DC_Lookup(file->refNum, type, id);
+        if (unpacked) {
+            /* Locked so sizing *h cannot purge it */
+            HLock(unpacked);
+            size = (UInt32)GetHandleSize(unpacked);
+        } else {
+            RDHeader hdr;
+            packed = (UInt8*)NewPtr(length);
+            if (!packed) return noMemForRsrc;
+            err = ResFile_ReadAt(file, offset, packed, length);
+            if (err == noErr && !RD_ParseHeader(packed, length, &hdr)) err = badExtResource;
+            if (err != noErr) {
+                DisposePtr((Ptr)packed);
+                return err;
+            }
+            size = hdr.unpackedSize;
+        }
+    }
 
-    if (!file || !ref) return NULL;
+    if (!*h) {
+        *h = NewHandle(size);
+        if (!*h) err = noMemForRsrc;
+    } else if (!ReallocateHandle(*h, size)) {
+        err = noMemForRsrc;
+    }
+    if (err == noErr) {
+        HLock(*h);
+        if (unpacked) {
+            BlockMove(*unpacked, **h, size);
+        } else if (packed) {
+            err = RD_Decompress(packed, length, (UInt8*)**h, size);
+            if (err == noErr) DC_Insert(file->refNum, type, id, **h, size);
+        } else {
+            err = ResFile_ReadAt(file, offset, **h, length);
+        }
+        HUnlock(*h);
+    }
+
+    if (unpacked) HUnlock(unpacked);
+    if (packed) DisposePtr((Ptr)packed);
+    return err;
+}
 
-    /* Reconstruct 24-bit offset */
-    dataOffset = ((UInt32)ref->dataOffsetHi << 16) | read_be16((UInt8*)&ref->dataOffsetLo);
+/* Load resource data from file */
+Handle ResFile_LoadResource(ResFile* file, RefListEntry* ref, ResType type) {
+    Handle h = NULL;
 
-    /* Offset is from start of resource data section */
-    ResourceHeader* hdr = (ResourceHeader*)file->data;
-    UInt32 dataBase = read_be32((UInt8*)&hdr->dataOffset);
+    if (!file || !ref) return NULL;
 
-    /* Validate dataBase first */
-    if (dataBase >= file->dataSize || dataBase + 4 > file->dataSize) {
-        gResMgr.resError = mapReadErr;
+    OSErr err = ResFile_ReadData(file, ref, type, &h);
+    if (err != noErr) {
+        if (h) DisposeHandle(h);
+        gResMgr.resError = err;
         return NULL;
     }
 
-    UInt32 actualOffset = dataBase + dataOffset;
+    return h;
+}
 
-    /* Check for overflow and bounds */
-    if (actualOffset < dataBase || actualOffset + sizeof(ResourceDataEntry) > file->dataSize) {
-        gResMgr.resError = mapReadErr;
-        return NULL;
-    }
+/* Attach a freshly loaded handle to its reference entry, the cache and the
+ * handle side-table */
+static void ResFile_Adopt(ResFile* file, RefListEntry* ref, ResType type, ResID id, Handle h) {
+    ref->reserved = (UInt32)(uintptr_t)h;
 
-    dataEntry = (ResourceDataEntry*)(file->data + actualOffset);
-    dataLength = read_be32((UInt8*)&dataEntry->length);
+    /* Get name offset if resource has a name */
+    UInt16 nameOff = ref->nameOffset != 0xFFFF ?
+                    read_be16((UInt8*)&ref->nameOffset) : 0;
 
-    if (actualOffset + sizeof(ResourceDataEntry) + dataLength > file->dataSize) {
-        gResMgr.resError = mapReadErr;
-        return NULL;
-    }
+    /* A handle into the built-in image takes no heap to purge */
+    RC_Insert(file->refNum, type, id, h,
+              (ref->attributes & resPurgeable) && !MemoryManager_IsROMHandle(h));
+    RecordHandleInfo(h, type, id, nameOff, (UInt32)GetHandleSize(h), file->refNum);
+    RP_Record(file, type, id);
+}
 
-    /* Allocate handle and copy data */
-    h = NewHandle(dataLength);
-    if (!h) {
-        gResMgr.resError = noMemForRsrc;
-        return NULL;
-    }
+/* Bring back the data of a loaded resource whose handle was purged */
+static Handle ResFile_Restore(ResFile* file, ResType type, ResID id, Handle h) {
+    gResMgr.resError = noErr;
+    if (*h) return h;
 
-    HLock(h);
-    data = (UInt8*)*h;
-    BlockMove((UInt8*)dataEntry + sizeof(ResourceDataEntry), data, dataLength);
-    HUnlock(h);
+    RefListEntry* ref = ResMap_FindResource(file, type, id);
+    OSErr err = ref ? ResFile_ReadData(file, ref, type, &h) : resNotFound;
+    if (err != noErr) {
+        gResMgr.resError = err;
+        return h;
+    }
 
+    RC_Reloaded(file->refNum, type, id);
     return h;
 }
 
+/* Undo ResFile_Adopt: the handle is no longer the file's copy */
+static void ResFile_Forget(Handle h) {
+    HandleInfo* info = FindHandleInfo(h);
+    if (!info) return;
+
+    SInt16 home = info->homeFile;
+    if (home >= 0 && home < MAX_RES_FILES && gResMgr.resFiles[home].inUse &&
+        gResMgr.resFiles[home].map) {
+        RefListEntry* ref = ResMap_FindResource(&gResMgr.resFiles[home], info->type, info->id);
+        if (ref && ref->reserved == (UInt32)(uintptr_t)h) {
+            ref->reserved = 0;
+        }
+    }
+    RC_Remove(home, info->type, info->id);
+    RemoveHandleInfo(h);
+}
+
+/* CloseResFile: dispose of a handle still loaded from the file */
+static void ResFile_DisposeLoaded(Handle h) {
+    RemoveHandleInfo(h);
+    DisposeHandle(h);
+}
+
 /* Get resource by type and ID */
 Handle GetResource(ResType theType, ResID theID) {
     int i;
@@ -678,92 +629,36 @@ Handle GetResource(ResType theType, ResID theID) {
                  (char)(theType >> 24), (char)(theType >> 16),
                  (char)(theType >> 8), (char)theType, theID);
 
-    /* Built-in PAT patterns (System 7.1 standard patterns 1-10) */
-    if (theType == 0x50415420 /* 'PAT ' */ && theID >= 1 && theID <= 10) {
-        /* Classic Mac OS 8x8 pixel patterns (8 bytes each) */
-        static const UInt8 kBuiltinPatterns[10][8] = {
-            /* PAT 1: White */
-            {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
-            /* PAT 2: Light gray */
-            {0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55},
-            /* PAT 3: Dark gray */
-            {0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA},
-            /* PAT 4: Black */
-            {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-            /* PAT 5: Horizontal stripes */
-            {0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00},
-            /* PAT 6: Vertical stripes */
-            {0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA},
-            /* PAT 7: Diagonal stripes (45°) */
-            {0x88, 0x44, 0x22, 0x11, 0x88, 0x44, 0x22, 0x11},
-            /* PAT 8: Checkerboard */
-            {0x0F, 0x0F, 0x0F, 0x0F, 0xF0, 0xF0, 0xF0, 0xF0},
-            /* PAT 9: Cross-hatch */
-            {0xFF, 0x88, 0x88, 0x88, 0xFF, 0x88, 0x88, 0x88},
-            /* PAT 10: Dots */
-            {0x11, 0x44, 0x11, 0x44, 0x11, 0x44, 0x11, 0x44}
-        };
-
-        Handle h = NewHandle(8);
-        if (h) {
-            BlockMove(kBuiltinPatterns[theID - 1], *h, 8);
-            RM_LOG_DEBUG("Built-in PAT %d provided", theID);
-            gResMgr.resError = noErr;
-        } else {
-            gResMgr.resError = memFullErr;
+    /* Search all open resource files, starting with current: a handle
+     * cached for a file or an entry in its map hides the files below */
+    for (i = gResMgr.curResFile; i >= 0 && !ref; i--) {
+        if (!gResMgr.resFiles[i].inUse) continue;
+
+        Handle cached = RC_Lookup(i, theType, theID);
+        if (cached) {
+            RM_LOG_DEBUG("GetResource: cache hit, handle=%p", cached);
+            return ResFile_Restore(&gResMgr.resFiles[i], theType, theID, cached);
         }
-        return h;
-    }
 
-    /* Check cache first for fast hit */
-    Handle cached = CacheLookup(theType, theID);
-    if (cached) {
-        RM_LOG_DEBUG("GetResource: cache hit, handle=%p", cached);
-        gResMgr.resError = noErr;
-        return cached;
-    }
-
-    /* Try using index for O(log n) lookup if available */
-    if (gRefIdxCount > 0) {
-        SInt32 idx = FindRefIndex(theType, theID);
-        if (idx >= 0) {
-            /* Found in index - get the resource from any open file */
-            for (i = gResMgr.curResFile; i >= 0; i--) {
-                if (!gResMgr.resFiles[i].inUse) continue;
-
-                /* Check if this file has the resource at the indexed offset */
-                ref = ResMap_FindResource(&gResMgr.resFiles[i], theType, theID);
-                if (ref) {
-                    file = &gResMgr.resFiles[i];
-                    break;
-                }
-            }
+        ref = ResMap_FindResource(&gResMgr.resFiles[i], theType, theID);
+        if (ref) {
+            file = &gResMgr.resFiles[i];
         }
     }
 
-    /* Fall back to linear search if not found via index */
+    /* If not found in current chain, search other files */
     if (!ref) {
-        /* Search all open resource files, starting with current */
-        for (i = gResMgr.curResFile; i >= 0; i--) {
-            if (!gResMgr.resFiles[i].inUse) continue;
+        for (i = 0; i < MAX_RES_FILES && !ref; i++) {
+            if (!gResMgr.resFiles[i].inUse || i <= gResMgr.curResFile) continue;
+
+            Handle cached = RC_Lookup(i, theType, theID);
+            if (cached) {
+                return ResFile_Restore(&gResMgr.resFiles[i], theType, theID, cached);
+            }
 
             ref = ResMap_FindResource(&gResMgr.resFiles[i], theType, theID);
             if (ref) {
                 file = &gResMgr.resFiles[i];
-                break;
-            }
-        }
-
-        /* If not found in current chain, search other files */
-        if (!ref) {
-            for (i = 0; i < MAX_RES_FILES; i++) {
-                if (!gResMgr.resFiles[i].inUse || i == gResMgr.curResFile) continue;
-
-                ref = ResMap_FindResource(&gResMgr.resFiles[i], theType, theID);
-                if (ref) {
-                    file = &gResMgr.resFiles[i];
-                    break;
-                }
             }
         }
     }
@@ -778,38 +673,18 @@ Handle GetResource(ResType theType, ResID theID) {
     Handle h = (Handle)(uintptr_t)ref->reserved;
     if (h) {
         RM_LOG_DEBUG("GetResource: already loaded, handle=%p", h);
-        gResMgr.resError = noErr;
-        /* Update cache for next lookup */
-        CacheInsert(theType, theID, h);
-        return h;
+        return ResFile_Restore(file, theType, theID, h);
     }
 
     /* Load the resource */
     if (gResMgr.resLoad) {
-        h = ResFile_LoadResource(file, ref);
+        h = ResFile_LoadResource(file, ref, theType);
         if (h) {
             RM_LOG_INFO("GetResource('%c%c%c%c', %d) = handle %p",
                         (char)(theType >> 24), (char)(theType >> 16),
                         (char)(theType >> 8), (char)theType, theID, h);
-            /* Cache the handle (cast through uintptr_t for safety) */
-            ref->reserved = (UInt32)(uintptr_t)h;
-
-            /* Get data length and name offset for metadata */
-            UInt32 dataOffset = ((UInt32)ref->dataOffsetHi << 16) |
-                               read_be16((UInt8*)&ref->dataOffsetLo);
-            ResourceHeader* hdr = (ResourceHeader*)file->data;
-            UInt32 dataBase = read_be32((UInt8*)&hdr->dataOffset);
-            UInt32 actualOffset = dataBase + dataOffset;
-            ResourceDataEntry* dataEntry = (ResourceDataEntry*)(file->data + actualOffset);
-            UInt32 dataLength = read_be32((UInt8*)&dataEntry->length);
-
-            /* Get name offset if resource has a name */
-            UInt16 nameOff = ref->nameOffset != 0xFFFF ?
-                            read_be16((UInt8*)&ref->nameOffset) : 0;
-
-            /* Insert into cache and record handle info */
-            CacheInsert(theType, theID, h);
-            RecordHandleInfo(h, theType, theID, nameOff, dataLength, file->refNum);
+            /* Remember the handle and record its metadata */
+            ResFile_Adopt(file, ref, theType, theID, h);
         }
         return h;
     }
@@ -839,15 +714,14 @@ Handle Get1Resource(ResType theType, ResID theID) {
     /* Check if already loaded */
     Handle h = (Handle)(uintptr_t)ref->reserved;
     if (h) {
-        gResMgr.resError = noErr;
-        return h;
+        return ResFile_Restore(file, theType, theID, h);
     }
 
     /* Load the resource */
     if (gResMgr.resLoad) {
-        h = ResFile_LoadResource(file, ref);
+        h = ResFile_LoadResource(file, ref, theType);
         if (h) {
-            ref->reserved = (UInt32)(uintptr_t)h;
+            ResFile_Adopt(file, ref, theType, theID, h);
         }
         return h;
     }
@@ -856,115 +730,135 @@ Handle Get1Resource(ResType theType, ResID theID) {
     return NULL;
 }
 
-/* Get named resource */
-Handle GetNamedResource(ResType theType, ConstStr255Param name) {
-    if (!name || name[0] == 0) {
-        gResMgr.resError = resNotFound;
-        return NULL;
+/* Find a resource of type by name (exact Pascal string match) */
+RefListEntry* ResMap_FindNamedResource(ResFile* file, ResType type, ConstStr255Param name) {
+    if (!file || !file->map || !name) return NULL;
+
+    UInt8* mapData = (UInt8*)file->map;
+    if (file->index) {
+        UInt32 refOff = RI_FindNamed(file->index, mapData, type, name);
+        return refOff ? (RefListEntry*)(mapData + refOff) : NULL;
     }
 
-    /* Search through all resources of this type for matching name */
-    for (int i = gResMgr.curResFile; i >= 0; i--) {
-        if (!gResMgr.resFiles[i].inUse) continue;
+    /* Get type list */
+    ResMapHeader* map = file->map;
+    UInt16 typeListOffset = read_be16((UInt8*)&map->typeListOffset);
+    if (typeListOffset == 0xFFFF) return NULL;
 
-        ResFile* file = &gResMgr.resFiles[i];
-        if (!file->map) continue;
+    UInt8* typeList = mapData + typeListOffset;
+    UInt16 typeCount = read_be16(typeList);  /* Count is n-1 */
+    typeList += 2;  /* Skip count */
 
-        UInt8* mapData = (UInt8*)file->map;
+    /* Validate typeCount doesn't overflow buffer */
+    /* Cast to UInt32 before adding 1 to prevent overflow */
+    UInt32 typeListSize = 2 + (((UInt32)typeCount + 1) * sizeof(TypeListEntry));
+    if (typeListOffset + typeListSize > file->mapSize) {
+        return NULL;  /* Skip corrupted type list */
+    }
 
-        /* Get type list */
-        ResMapHeader* map = file->map;
-        UInt16 typeListOffset = read_be16((UInt8*)&map->typeListOffset);
-        if (typeListOffset == 0xFFFF) continue;
+    /* Find matching type */
+    for (UInt16 t = 0; t < typeCount + 1; t++) {  /* Use < instead of <= */
+        TypeListEntry* typeEntry = (TypeListEntry*)(typeList + t * sizeof(TypeListEntry));
+        if (read_be32((UInt8*)&typeEntry->resType) != type) continue;
 
-        UInt8* typeList = mapData + typeListOffset;
-        UInt16 typeCount = read_be16(typeList);  /* Count is n-1 */
-        typeList += 2;  /* Skip count */
+        /* Get reference list for this type */
+        UInt16 refListOffset = read_be16((UInt8*)&typeEntry->refListOffset);
+        UInt16 resCount = read_be16((UInt8*)&typeEntry->count);  /* Count is n-1 */
 
-        /* Validate typeCount doesn't overflow buffer */
+        /* Validate refList bounds before accessing */
+        UInt32 refListStart = typeListOffset + refListOffset;
         /* Cast to UInt32 before adding 1 to prevent overflow */
-        UInt32 typeListSize = 2 + (((UInt32)typeCount + 1) * sizeof(TypeListEntry));
-        if (typeListOffset + typeListSize > file->mapSize) {
-            continue;  /* Skip corrupted type list */
+        UInt32 refListSize = (((UInt32)resCount + 1)) * sizeof(RefListEntry);
+        if (refListStart + refListSize > file->mapSize) {
+            continue;  /* Skip corrupted reference list */
         }
 
-        /* Find matching type */
-        for (UInt16 t = 0; t < typeCount + 1; t++) {  /* Use < instead of <= */
-            TypeListEntry* typeEntry = (TypeListEntry*)(typeList + t * sizeof(TypeListEntry));
-            if (read_be32((UInt8*)&typeEntry->resType) != theType) continue;
-
-            /* Get reference list for this type */
-            UInt16 refListOffset = read_be16((UInt8*)&typeEntry->refListOffset);
-            UInt16 resCount = read_be16((UInt8*)&typeEntry->count);  /* Count is n-1 */
-
-            /* Validate refList bounds before accessing */
-            UInt32 refListStart = typeListOffset + refListOffset;
-            /* Cast to UInt32 before adding 1 to prevent overflow */
-            UInt32 refListSize = (((UInt32)resCount + 1)) * sizeof(RefListEntry);
-            if (refListStart + refListSize > file->mapSize) {
-                continue;  /* Skip corrupted reference list */
-            }
+        RefListEntry* refList = (RefListEntry*)(mapData + refListStart);
 
-            RefListEntry* refList = (RefListEntry*)(mapData + refListStart);
+        /* Check each resource of this type */
+        for (UInt16 r = 0; r < resCount + 1; r++) {  /* Use < instead of <= */
+            RefListEntry* ref = &refList[r];
 
-            /* Check each resource of this type */
-            for (UInt16 r = 0; r < resCount + 1; r++) {  /* Use < instead of <= */
-                RefListEntry* ref = &refList[r];
+            /* Check if resource has a name */
+            UInt16 nameOffset = read_be16((UInt8*)&ref->nameOffset);
+            if (nameOffset == 0xFFFF) continue;
 
-                /* Check if resource has a name */
-                UInt16 nameOffset = read_be16((UInt8*)&ref->nameOffset);
-                if (nameOffset == 0xFFFF) continue;
+            /* Get name list offset from map */
+            UInt16 nameListOffset = read_be16((UInt8*)&map->nameListOffset);
+            if (nameListOffset == 0xFFFF) continue;
 
-                /* Get name list offset from map */
-                UInt16 nameListOffset = read_be16((UInt8*)&map->nameListOffset);
-                if (nameListOffset == 0xFFFF) continue;
+            /* Bounds check: ensure name is within map */
+            UInt32 namePos = (UInt32)nameListOffset + (UInt32)nameOffset;
+            if (namePos >= file->mapSize) continue;  /* Name offset out of bounds */
 
-                /* Bounds check: ensure name is within map */
-                UInt32 namePos = (UInt32)nameListOffset + (UInt32)nameOffset;
-                if (namePos >= file->mapSize) continue;  /* Name offset out of bounds */
+            /* Get the resource name */
+            UInt8* resName = mapData + namePos;
+            UInt8 nameLen = resName[0];
 
-                /* Get the resource name */
-                UInt8* resName = mapData + namePos;
-                UInt8 nameLen = resName[0];
+            /* Validate name length fits within map */
+            if (namePos + 1 + nameLen > file->mapSize) continue;
 
-                /* Validate name length fits within map */
-                if (namePos + 1 + nameLen > file->mapSize) continue;
-
-                /* Compare names (Pascal string comparison) */
-                if (nameLen == name[0]) {
-                    Boolean match = true;
-                    for (UInt8 c = 1; c <= nameLen; c++) {
-                        if (resName[c] != name[c]) {
-                            match = false;
-                            break;
-                        }
-                    }
-                    if (match) {
-                        /* Found it - get the resource ID and load it */
-                        ResID id = (ResID)read_be16((UInt8*)&ref->resID);
-                        return GetResource(theType, id);
+            /* Compare names (Pascal string comparison) */
+            if (nameLen == (UInt8)name[0]) {
+                Boolean match = true;
+                for (UInt8 c = 1; c <= nameLen; c++) {
+                    if (resName[c] != (UInt8)name[c]) {
+                        match = false;
+                        break;
                     }
                 }
+                if (match) return ref;
             }
         }
     }
 
-    gResMgr.resError = resNotFound;
     return NULL;
 }
 
-/* Get named resource from current file (stub) */
-Handle Get1NamedResource(ResType theType, ConstStr255Param name) {
-    (void)theType;
-    (void)name;
+/* Get named resource */
+Handle GetNamedResource(ResType theType, ConstStr255Param name) {
+    if (!name || name[0] == 0) {
+        gResMgr.resError = resNotFound;
+        return NULL;
+    }
+
+    /* Search through all resources of this type for matching name */
+    for (int i = gResMgr.curResFile; i >= 0; i--) {
+        if (!gResMgr.resFiles[i].inUse) continue;
+
+        RefListEntry* ref = ResMap_FindNamedResource(&gResMgr.resFiles[i], theType, name);
+        if (ref) {
+            /* Found it - get the resource ID and load it */
+            ResID id = (ResID)read_be16((UInt8*)&ref->resID);
+            return GetResource(theType, id);
+        }
+    }
+
     gResMgr.resError = resNotFound;
     return NULL;
 }
 
+/* Get named resource from current file */
+Handle Get1NamedResource(ResType theType, ConstStr255Param name) {
+    if (gResMgr.curResFile < 0 || !name || name[0] == 0) {
+        gResMgr.resError = resNotFound;
+        return NULL;
+    }
+
+    RefListEntry* ref = ResMap_FindNamedResource(&gResMgr.resFiles[gResMgr.curResFile],
+                                                 theType, name);
+    if (!ref) {
+        gResMgr.resError = resNotFound;
+        return NULL;
+    }
+    return Get1Resource(theType, (ResID)read_be16((UInt8*)&ref->resID));
+}
+
 /* Release resource */
 void ReleaseResource(Handle theResource) {
     /* In read-only mode, just dispose the handle */
     if (theResource) {
+        ResFile_Forget(theResource);
         DisposeHandle(theResource);
     }
 }
@@ -1044,18 +938,35 @@ SInt16 HomeResFile(Handle theResource) {
     return -1;
 }
 
-/* Detach resource from file */
+/* Detach resource from file: the handle becomes the caller's */
 void DetachResource(Handle theResource) {
-    /* In read-only mode, this is a no-op */
-    (void)theResource;
+    if (!theResource || !FindHandleInfo(theResource)) {
+        gResMgr.resError = resNotFound;
+        return;
+    }
+    /* The caller may change or resize it: it cannot stay in the image */
+    if (!MemoryManager_CopyROMHandle(theResource)) {
+        gResMgr.resError = memFullErr;
+        return;
+    }
+    ResFile_Forget(theResource);
     gResMgr.resError = noErr;
 }
 
-/* Load resource data */
+/* Load resource data: reload it if the handle was purged */
 void LoadResource(Handle theResource) {
-    /* In our implementation, resources are always loaded */
-    (void)theResource;
-    gResMgr.resError = noErr;
+    HandleInfo* info = theResource ? FindHandleInfo(theResource) : NULL;
+    if (!info) {
+        gResMgr.resError = theResource ? resNotFound : nilHandleErr;
+        return;
+    }
+
+    SInt16 home = info->homeFile;
+    if (home < 0 || home >= MAX_RES_FILES || !gResMgr.resFiles[home].inUse) {
+        gResMgr.resError = resFileNotOpen;
+        return;
+    }
+    ResFile_Restore(&gResMgr.resFiles[home], info->type, info->id, theResource);
 }
 
 /* Set whether to auto-load resources */
@@ -1090,73 +1001,18 @@ SInt16 OpenResFile(ConstStr255Param fileName) {
         return -1;
     }
 
-    /* Read resource header */
-    ResourceHeader header;
-    UInt32 readCount = sizeof(ResourceHeader);
-    err = FSRead(fileRef, &readCount, &header);
-    if (err != noErr || readCount != sizeof(ResourceHeader)) {
-        FSClose(fileRef);
-        gResMgr.resError = err;
-        return -1;
-    }
-
-    /* Byte-swap header fields (resource forks are big-endian) */
-    UInt32 mapOffset = read_be32((UInt8*)&header.mapOffset);
-    UInt32 mapLength = read_be32((UInt8*)&header.mapLength);
-
-    /* Unused but available for validation if needed */
-    (void)read_be32((UInt8*)&header.dataOffset);
-    (void)read_be32((UInt8*)&header.dataLength);
-
-    /* Validate header */
-    if (mapLength < sizeof(ResMapHeader)) {
-        FSClose(fileRef);
-        gResMgr.resError = mapReadErr;
-        return -1;
-    }
-
-    /* Allocate buffer for entire resource fork */
-    UInt32 totalSize = mapOffset + mapLength;
-    Handle dataHandle = NewHandle(totalSize);
-    if (!dataHandle) {
-        FSClose(fileRef);
-        gResMgr.resError = memFullErr;
-        return -1;
-    }
-
-    /* Seek to beginning and read entire fork */
-    err = FSSetFPos(fileRef, fsFromStart, 0);
+    /* Read the map only; resource data is read from the fork on load */
+    ResFile* resFile = &gResMgr.resFiles[refNum];
+    err = ResFile_OpenFork(resFile, fileRef);
     if (err != noErr) {
-        DisposeHandle(dataHandle);
         FSClose(fileRef);
         gResMgr.resError = err;
         return -1;
     }
 
-    readCount = totalSize;
-    HLock(dataHandle);
-    err = FSRead(fileRef, &readCount, *dataHandle);
-    HUnlock(dataHandle);
-
-    if (err != noErr || readCount != totalSize) {
-        DisposeHandle(dataHandle);
-        FSClose(fileRef);
-        gResMgr.resError = err;
-        return -1;
-    }
-
-    /* Done with file - resource data now in memory */
-    FSClose(fileRef);
-
-    /* Initialize resource file control block */
-    ResFile* resFile = &gResMgr.resFiles[refNum];
     resFile->inUse = true;
     resFile->refNum = refNum;
-    resFile->data = (UInt8*)*dataHandle;
-    resFile->dataSize = totalSize;
-    resFile->map = (ResMapHeader*)(resFile->data + mapOffset);
-    resFile->mapSize = mapLength;
-    resFile->mapHandle = dataHandle;
+    ResFile_BuildIndex(resFile);
 
     /* Copy filename for debugging */
     UInt8 len = fileName[0];
@@ -1166,6 +1022,9 @@ SInt16 OpenResFile(ConstStr255Param fileName) {
         resFile->fileName[i + 1] = fileName[i + 1];
     }
 
+    /* Load what a prefetch manifest recorded for this file */
+    RP_FileOpened(resFile);
+
     gResMgr.resError = noErr;
     return refNum;
 }
@@ -1190,14 +1049,26 @@ void CloseResFile(SInt16 refNum) {
 void ResFile_Close(SInt16 refNum) {
     ResFile* file = &gResMgr.resFiles[refNum];
 
+    /* Resources still loaded from the file go with it */
+    RC_RemoveFile(refNum, ResFile_DisposeLoaded);
+    DC_RemoveFile(refNum);
+
+    RI_Dispose(file->index);
+    file->index = NULL;
     if (file->mapHandle) {
         DisposeHandle(file->mapHandle);
+        file->mapHandle = NULL;
+    }
+    if (file->forkOpen) {
+        FSClose(file->forkRef);
+        file->forkOpen = false;
     }
 
     file->inUse = false;
     file->refNum = -1;
     file->data = NULL;
     file->map = NULL;
+    file->rom = false;
 
     /* If this was current file, switch to system */
     if (gResMgr.curResFile == refNum) {
@@ -1217,7 +1088,7 @@ void AddResource(Handle theData, ResType theType, ResID theID, ConstStr255Param
                 (char)(theType >> 8), (char)theType, theID, theData);
 
     /* Store in cache for immediate retrieval */
-    CacheInsert(theType, theID, theData);
+    RC_Insert(gResMgr.curResFile, theType, theID, theData, false);
 
     /* Record handle info */
     UInt16 nameOff = (name && name[0] > 0) ? 1 : 0;  /* Simplified name handling */
@@ -1243,9 +1114,25 @@ void UpdateResFile(SInt16 refNum) {
     gResMgr.resError = mapReadErr;
 }
 
+/* Only resources of the built-in image can be changed, in memory: the
+ * handle gets its own copy of the data to modify (copy-on-write) and
+ * stays the resource's.  Nothing is ever written back. */
 void ChangedResource(Handle theResource) {
-    (void)theResource;
-    gResMgr.resError = mapReadErr;
+    HandleInfo* info = theResource ? FindHandleInfo(theResource) : NULL;
+    SInt16 home = info ? info->homeFile : -1;
+    if (home < 0 || home >= MAX_RES_FILES || !gResMgr.resFiles[home].inUse ||
+        !gResMgr.resFiles[home].rom) {
+        gResMgr.resError = info ? mapReadErr : resNotFound;
+        return;
+    }
+    if (!MemoryManager_CopyROMHandle(theResource)) {
+        gResMgr.resError = memFullErr;
+        return;
+    }
+
+    RefListEntry* ref = ResMap_FindResource(&gResMgr.resFiles[home], info->type, info->id);
+    if (ref) ref->attributes |= resChanged;
+    gResMgr.resError = noErr;
 }
 
 /* Get/set resource attributes */
@@ -1402,8 +1289,14 @@ Handle GetIndResource(ResType theType, SInt16 index) {
         return NULL;
     }
 
-    h = ResFile_LoadResource(file, ref);
+    h = (Handle)(uintptr_t)ref->reserved;
     if (h) {
+        return ResFile_Restore(file, theType, (ResID)read_be16((UInt8*)&ref->resID), h);
+    }
+
+    h = ResFile_LoadResource(file, ref, theType);
+    if (h) {
+        ResFile_Adopt(file, ref, theType, (ResID)read_be16((UInt8*)&ref->resID), h);
         gResMgr.resError = noErr;
     } else {
         gResMgr.resError = resNotFound;
@@ -1493,4 +1386,142 @@ SInt16 UniqueID(ResType theType) {
 
 SInt16 Unique1ID(ResType theType) {
     return UniqueID(theType);
-}
\ No newline at end of file
+}
+/* Largest stretch of a fork read in one transfer by a batched load */
+#define RM_PRELOAD_SPAN (256u * 1024u)
+
+/* Largest step from one batched resource to the next within a span; past
+ * it, reading the bytes between costs more than another read */
+#define RM_PRELOAD_STEP (32u * 1024u)
+
+static UInt32 ResFile_RefOffset(const ResFile* file, const RefListEntry* ref) {
+    return file->dataBase + (((UInt32)ref->dataOffsetHi << 16) |
+                             read_be16((const UInt8*)&ref->dataOffsetLo));
+}
+
+/* Load a set of not-yet-loaded resources in fork order.  Runs of them that
+ * fit in RM_PRELOAD_SPAN bytes, each starting within RM_PRELOAD_STEP of
+ * the one before, come off disk in one read and are split
+ * into handles from there; the rest, and compressed resources, are loaded
+ * one at a time.  Sorts items[] in place; loaded entries are skipped. */
+void ResFile_LoadBatch(ResFile* file, ResBatchItem* items, UInt32 count) {
+    UInt32 n = 0;
+    for (UInt32 i = 0; i < count; i++) {
+        if (items[i].ref->reserved) continue;
+        items[n] = items[i];
+        items[n].offset = ResFile_RefOffset(file, items[n].ref);
+        n++;
+    }
+
+    /* Insertion sort: manifests and type lists are mostly in order */
+    for (UInt32 i = 1; i < n; i++) {
+        ResBatchItem temp = items[i];
+        UInt32 j = i;
+        while (j > 0 && items[j - 1].offset > temp.offset) {
+            items[j] = items[j - 1];
+            j--;
+        }
+        items[j] = temp;
+    }
+
+    for (UInt32 i = 0; i < n; ) {
+        /* Span from item i to the last one of its run that starts within
+         * RM_PRELOAD_SPAN; that one's length is the only one read ahead,
+         * and if it does not fit the span stops where it starts */
+        UInt32 lo = items[i].offset, spanLen = 0, end = i + 1;
+        if (!file->data && !(items[i].ref->attributes & resCompressed)) {
+            while (end < n && !(items[end].ref->attributes & resCompressed) &&
+                   items[end].offset - lo < RM_PRELOAD_SPAN &&
+                   items[end].offset - items[end - 1].offset <= RM_PRELOAD_STEP) {
+                end++;
+            }
+            UInt32 offset, length;
+            if (end == i + 1) {
+                /* Alone: loaded on its own below */
+            } else if (ResFile_DataExtent(file, items[end - 1].ref, &offset, &length) == noErr &&
+                       offset + length - lo <= RM_PRELOAD_SPAN) {
+                spanLen = offset + length - lo;
+            } else {
+                spanLen = items[end - 1].offset - lo;
+                end--;
+            }
+        }
+
+        UInt8* span = NULL;
+        if (end - i > 1) {
+            span = (UInt8*)NewPtr(spanLen);
+            if (span && ResFile_ReadAt(file, lo, span, spanLen) != noErr) {
+                DisposePtr((Ptr)span);
+                span = NULL;
+            }
+        }
+
+        for (; i < end; i++) {
+            RefListEntry* ref = items[i].ref;
+            ResID id = (ResID)read_be16((UInt8*)&ref->resID);
+            Handle h = NULL;
+
+            if (ref->reserved) continue;   /* Listed twice */
+            UInt32 at = items[i].offset - lo;
+            if (span && at + sizeof(ResourceDataEntry) <= spanLen &&
+                read_be32(span + at) <= spanLen - at - sizeof(ResourceDataEntry)) {
+                UInt32 length = read_be32(span + at);
+                h = NewHandle(length);
+                if (h) {
+                    BlockMove(span + at + sizeof(ResourceDataEntry), *h, length);
+                } else {
+                    gResMgr.resError = noMemForRsrc;
+                }
+            } else {
+                h = ResFile_LoadResource(file, ref, items[i].type);
+            }
+
+            if (h) {
+                ResFile_Adopt(file, ref, items[i].type, id, h);
+            }
+        }
+
+        if (span) DisposePtr((Ptr)span);
+    }
+}
+
+/* Preload all not-yet-loaded resources of one type in batched reads */
+void PreloadResources(SInt16 refNum, ResType theType) {
+    if (refNum < 0 || refNum >= MAX_RES_FILES || !gResMgr.resFiles[refNum].inUse) {
+        gResMgr.resError = badRefNum;
+        return;
+    }
+
+    ResFile* file = &gResMgr.resFiles[refNum];
+    TypeListEntry* typeEntry = ResMap_FindType(file, theType);
+    RefListEntry* refs = ResMap_GetIndResource(file, theType, 1);
+    if (!typeEntry || !refs) {
+        gResMgr.resError = resNotFound;
+        return;
+    }
+    UInt16 count = read_be16((UInt8*)&typeEntry->count) + 1;
+
+    ResBatchItem* items = (ResBatchItem*)NewPtr(count * sizeof(ResBatchItem));
+    if (!items) {
+        gResMgr.resError = memFullErr;
+        return;
+    }
+    for (UInt16 i = 0; i < count; i++) {
+        items[i].ref = &refs[i];
+        items[i].type = theType;
+    }
+
+    gResMgr.resError = noErr;
+    ResFile_LoadBatch(file, items, count);
+    DisposePtr((Ptr)items);
+}
+
+void GetResourceCacheStats(size_t* entries, size_t* totalSize, size_t* hits, size_t* misses) {
+    ResCacheStats stats;
+    RC_GetStats(&stats);
+
+    if (entries) *entries = stats.entries;
+    if (totalSize) *totalSize = stats.residentBytes;
+    if (hits) *hits = stats.hits;
+    if (misses) *misses = stats.misses;
+}
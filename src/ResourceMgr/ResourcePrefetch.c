@@ -0,0 +1,212 @@
+/*
+ * ResourcePrefetch.c - Recorded resource loads replayed as batched reads
+ *
+ * The recording lives in one block from RP_BeginRecording to
+ * RP_EndRecording: file names, then items in load order.  A resource
+ * loaded twice is recorded once.
+ */
+
+#include "SystemTypes.h"
+#include "MemoryMgr/MemoryManager.h"
+#include "FileManager.h"
+#include "ResourceMgr/ResourceMgrPriv.h"
+#include "ResourceMgr/ResourcePrefetch.h"
+#include <string.h>
+
+#define RP_HEADER_SIZE  12u
+#define RP_ITEM_SIZE    8u
+
+typedef struct {
+    UInt16  file;
+    ResID   id;
+    ResType type;
+} RPItem;
+
+typedef struct {
+    UInt32 numFiles;
+    UInt32 numItems;
+    Str255 names[RP_MAX_FILES];
+    RPItem items[RP_MAX_ITEMS];
+} RPRecording;
+
+static RPRecording* gRecording = NULL;
+static Handle gManifest = NULL;
+static ResPrefetchStats gStats;
+
+static Boolean rp_same_name(const UInt8* a, const UInt8* b) {
+    return a[0] == b[0] && memcmp(a + 1, b + 1, a[0]) == 0;
+}
+
+OSErr RP_BeginRecording(void) {
+    if (!gRecording) {
+        gRecording = (RPRecording*)NewPtr(sizeof(RPRecording));
+        if (!gRecording) return memFullErr;
+    }
+    gRecording->numFiles = 0;
+    gRecording->numItems = 0;
+    return noErr;
+}
+
+/* Called by the Resource Manager for each resource it loads */
+void RP_Record(const ResFile* file, ResType type, ResID id) {
+    RPRecording* r = gRecording;
+    if (!r || !file->forkOpen) return;
+
+    UInt32 f = 0;
+    while (f < r->numFiles && !rp_same_name(r->names[f], file->fileName)) f++;
+    if (f == r->numFiles) {
+        if (f == RP_MAX_FILES) return;
+        memcpy(r->names[f], file->fileName, (size_t)file->fileName[0] + 1);
+        r->numFiles++;
+    }
+
+    for (UInt32 i = 0; i < r->numItems; i++) {
+        if (r->items[i].file == f && r->items[i].type == type && r->items[i].id == id) return;
+    }
+    if (r->numItems == RP_MAX_ITEMS) return;
+
+    RPItem* item = &r->items[r->numItems++];
+    item->file = (UInt16)f;
+    item->id = id;
+    item->type = type;
+}
+
+Handle RP_EndRecording(void) {
+    RPRecording* r = gRecording;
+    if (!r) return NULL;
+    gRecording = NULL;
+
+    gStats.recorded = r->numItems;
+    Handle manifest = NULL;
+    if (r->numItems > 0) {
+        UInt32 size = RP_HEADER_SIZE + r->numItems * RP_ITEM_SIZE;
+        for (UInt32 f = 0; f < r->numFiles; f++) size += (UInt32)r->names[f][0] + 1;
+
+        manifest = NewHandle(size);
+        if (manifest) {
+            UInt8* p = (UInt8*)*manifest;
+            write_be32(p, RP_SIGNATURE);
+            write_be16(p + 4, RP_VERSION);
+            write_be16(p + 6, (UInt16)r->numFiles);
+            write_be32(p + 8, r->numItems);
+            p += RP_HEADER_SIZE;
+            for (UInt32 f = 0; f < r->numFiles; f++) {
+                memcpy(p, r->names[f], (size_t)r->names[f][0] + 1);
+                p += r->names[f][0] + 1;
+            }
+            for (UInt32 i = 0; i < r->numItems; i++, p += RP_ITEM_SIZE) {
+                write_be16(p, r->items[i].file);
+                write_be16(p + 2, (UInt16)r->items[i].id);
+                write_be32(p + 4, r->items[i].type);
+            }
+        }
+    }
+
+    DisposePtr((Ptr)r);
+    return manifest;
+}
+
+/* Start of the items and the index of fileName in manifest, or NULL */
+static const UInt8* rp_parse(Handle manifest, const UInt8* fileName, UInt32* file, UInt32* numItems) {
+    UInt32 size = (UInt32)GetHandleSize(manifest);
+    const UInt8* p = (const UInt8*)*manifest;
+    if (!p || size < RP_HEADER_SIZE || read_be32(p) != RP_SIGNATURE ||
+        read_be16(p + 4) != RP_VERSION) return NULL;
+
+    UInt32 numFiles = read_be16(p + 6);
+    *numItems = read_be32(p + 8);
+    *file = numFiles;
+
+    UInt32 at = RP_HEADER_SIZE;
+    for (UInt32 f = 0; f < numFiles; f++) {
+        if (at >= size || at + 1 + p[at] > size) return NULL;
+        if (*file == numFiles && rp_same_name(p + at, fileName)) *file = f;
+        at += 1 + p[at];
+    }
+    if (*numItems > (size - at) / RP_ITEM_SIZE) return NULL;
+    return *file < numFiles ? p + at : NULL;
+}
+
+/* Called by OpenResFile: load what the manifest lists for file */
+void RP_FileOpened(ResFile* file) {
+    UInt32 f, numItems;
+    if (!gManifest || !rp_parse(gManifest, file->fileName, &f, &numItems)) return;
+
+    ResBatchItem* batch = (ResBatchItem*)NewPtr(numItems * sizeof(ResBatchItem));
+    if (!batch) return;
+
+    /* Parse again: NewPtr may have moved the manifest */
+    const UInt8* items = rp_parse(gManifest, file->fileName, &f, &numItems);
+    UInt32 count = 0;
+    for (UInt32 i = 0; i < numItems; i++) {
+        const UInt8* item = items + i * RP_ITEM_SIZE;
+        if (read_be16(item) != f) continue;
+
+        ResType type = read_be32(item + 4);
+        RefListEntry* ref = ResMap_FindResource(file, type, (ResID)read_be16(item + 2));
+        if (!ref) continue;
+        batch[count].ref = ref;
+        batch[count].type = type;
+        count++;
+    }
+
+    ResFile_LoadBatch(file, batch, count);
+    DisposePtr((Ptr)batch);
+    gStats.filesReplayed++;
+    gStats.prefetched += count;
+}
+
+void RP_SetManifest(Handle manifest) {
+    if (gManifest && gManifest != manifest) DisposeHandle(gManifest);
+    gManifest = manifest;
+}
+
+Handle RP_SwapManifest(Handle manifest) {
+    Handle previous = gManifest;
+    gManifest = manifest;
+    return previous;
+}
+
+OSErr RP_SaveManifest(Handle manifest, ConstStr255Param fileName) {
+    if (!manifest || !*manifest) return nilHandleErr;
+
+    FileRefNum ref;
+    FSDelete(fileName, 0);
+    OSErr err = FSCreate(fileName, 0, 0x4D414353u /* 'MACS' */, 0x72706D66u /* 'rpmf' */);
+    if (err == noErr) err = FSOpen(fileName, 0, &ref);
+    if (err != noErr) return err;
+
+    UInt32 count = (UInt32)GetHandleSize(manifest);
+    HLock(manifest);
+    err = FSWrite(ref, &count, *manifest);
+    HUnlock(manifest);
+    FSClose(ref);
+    return err;
+}
+
+Handle RP_LoadManifest(ConstStr255Param fileName) {
+    FileRefNum ref;
+    UInt32 size;
+    if (FSOpen(fileName, 0, &ref) != noErr) return NULL;
+
+    Handle manifest = NULL;
+    if (FSGetEOF(ref, &size) == noErr && size >= RP_HEADER_SIZE) {
+        manifest = NewHandle(size);
+        if (manifest) {
+            UInt32 count = size;
+            HLock(manifest);
+            OSErr err = FSRead(ref, &count, *manifest);
+            HUnlock(manifest);
+            if (err != noErr || count != size || read_be32((UInt8*)*manifest) != RP_SIGNATURE) {
+                DisposeHandle(manifest);
+                manifest = NULL;
+            }
+        }
+    }
+    FSClose(ref);
+    return manifest;
+}
+
+void RP_GetStats(ResPrefetchStats* stats) {
+    if (stats) *stats = gStats;
+}
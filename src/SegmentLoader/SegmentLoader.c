@@ -7,18 +7,25 @@
 #include "SegmentLoader/SegmentLoader.h"
 #include "SegmentLoader/CodeParser.h"
 #include "SegmentLoader/SegmentLoaderLogging.h"
-#include "ResourceMgr/resource_manager.h"
+#include "ResourceManager.h"
 #include "MemoryMgr/MemoryManager.h"
 #include "EventManager/EventManager.h"
 #include "CPU/M68KInterp.h"
 #include "System71StdLib.h"
 #include <string.h>
+#ifdef RES_PREFETCH
+#include "ResourceMgr/ResourcePrefetch.h"
+#include "TimeManager/TimeBase.h"
+#endif
 
 /* Resource fetching - use standard Resource Manager */
 
 /* Forward declarations */
 static OSErr LoadCODE0AndSetupA5(SegmentLoaderContext* ctx);
 static OSErr LoadCODE1(SegmentLoaderContext* ctx);
+#ifdef RES_PREFETCH
+static void EndLaunchPrefetch(SegmentLoaderContext* ctx);
+#endif
 
 /*
  * SegmentLoader_Initialize - Initialize segment loader for process
@@ -127,6 +134,106 @@ OSErr EnsureEntrySegmentsLoaded(SegmentLoaderContext* ctx)
         return err;
     }
 
+#ifdef RES_PREFETCH
+    if (ctx->resFileRefNum >= 0) {
+        EndLaunchPrefetch(ctx);
+    }
+#endif
+    return noErr;
+}
+
+#ifdef RES_PREFETCH
+/* Launch manifest for appName: "<app> Prefetch", within 31 characters */
+static void LaunchManifestName(ConstStr255Param appName, Str255 name)
+{
+    static const char kSuffix[] = " Prefetch";
+    UInt8 suffixLen = sizeof(kSuffix) - 1;
+    UInt8 len = appName[0];
+
+    if (len > 31 - suffixLen) {
+        len = 31 - suffixLen;
+    }
+    memcpy(name + 1, appName + 1, len);
+    memcpy(name + 1 + len, kSuffix, suffixLen);
+    name[0] = len + suffixLen;
+}
+
+/*
+ * EndLaunchPrefetch - Save a first launch's recording and report the time
+ */
+static void EndLaunchPrefetch(SegmentLoaderContext* ctx)
+{
+    UInt32 elapsed = MicrosecondsNow() - ctx->launchStartUs;
+    ResPrefetchStats stats;
+
+    if (ctx->recordingLaunch) {
+        Handle manifest = RP_EndRecording();
+        ctx->recordingLaunch = false;
+        if (manifest) {
+            RP_SaveManifest(manifest, ctx->manifestName);
+            DisposeHandle(manifest);
+        }
+        RP_GetStats(&stats);
+        serial_printf("[SEG] launch %u us, %u loads recorded\n",
+                      (unsigned)elapsed, (unsigned)stats.recorded);
+    } else {
+        RP_GetStats(&stats);
+        serial_printf("[SEG] launch %u us, %u resources prefetched so far\n",
+                      (unsigned)elapsed, (unsigned)stats.prefetched);
+    }
+}
+#endif
+
+/*
+ * SegmentLoader_OpenAppFile - Open the application's resource fork
+ */
+OSErr SegmentLoader_OpenAppFile(SegmentLoaderContext* ctx, ConstStr255Param appName)
+{
+    SInt16 refNum;
+
+    if (!ctx || !appName || appName[0] == 0) {
+        return paramErr;
+    }
+
+#ifdef RES_PREFETCH
+    /* Replay arms the app's manifest only for its own open, so a boot
+     * manifest stays armed for the files it names */
+    Handle manifest;
+    Handle saved = NULL;
+
+    ctx->launchStartUs = MicrosecondsNow();
+    LaunchManifestName(appName, ctx->manifestName);
+    manifest = RP_LoadManifest(ctx->manifestName);
+    if (manifest) {
+        saved = RP_SwapManifest(manifest);
+    } else {
+        ctx->recordingLaunch = (RP_BeginRecording() == noErr);
+    }
+
+    refNum = OpenResFile(appName);
+
+    if (manifest) {
+        RP_SwapManifest(saved);
+        DisposeHandle(manifest);
+    }
+#else
+    refNum = OpenResFile(appName);
+#endif
+
+    if (refNum < 0) {
+        OSErr err = ResError();
+#ifdef RES_PREFETCH
+        if (ctx->recordingLaunch) {
+            Handle discard = RP_EndRecording();
+            if (discard) DisposeHandle(discard);
+            ctx->recordingLaunch = false;
+        }
+#endif
+        return err != noErr ? err : resFNotFound;
+    }
+
+    ctx->resFileRefNum = refNum;
+    UseResFile(refNum);
     return noErr;
 }
 
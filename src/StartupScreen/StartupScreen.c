@@ -27,6 +27,9 @@
 #include "MemoryMgr/MemoryManager.h"
 #include "EventManager/EventManager.h"
 #include "SoundManager/SoundEffects.h"
+#ifdef RES_PREFETCH
+#include "TimeManager/TimeBase.h"
+#endif
 
 extern void PlatformDrawRGBABitmap(const UInt8* rgba_data, int width, int height, int dest_x, int dest_y);
 
@@ -59,6 +62,11 @@ static StartupScreenConfig gConfig = {
     .textColor = {0x0000, 0x0000, 0x0000}         /* Black */
 };
 
+#ifdef RES_PREFETCH
+/* Microseconds at the last phase marker */
+static UInt32 gPhaseStartUs = 0;
+#endif
+
 /* Progress callback */
 static StartupProgressProc gProgressCallback = NULL;
 static void* gProgressUserData = NULL;
@@ -458,7 +466,19 @@ OSErr BeginExtensionLoading(UInt16 extensionCount) {
  * Set startup phase
  */
 OSErr SetStartupPhase(StartupPhase phase) {
+#ifdef RES_PREFETCH
+    /* Phase marker on the serial log, to time boot with and without a
+     * prefetch manifest */
+    UInt32 now = MicrosecondsNow();
+    serial_printf("[STARTUP] phase %d at %u us (+%u us)\n", (int)phase,
+                  (unsigned)now, (unsigned)(now - gPhaseStartUs));
+    gPhaseStartUs = now;
+#endif
+
     gStartupScreen.currentPhase = phase;
+    if (!gStartupScreen.window) {
+        return noErr;
+    }
 
     /* Update display based on phase */
     switch (phase) {
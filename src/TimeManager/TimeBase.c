@@ -259,6 +259,18 @@ void Microseconds(UnsignedWide *microTickCount) {
     microTickCount->lo = (UInt32)(us & 0xFFFFFFFF);
 }
 
+/**
+ * MicrosecondsNow - Low 32 bits of Microseconds()
+ *
+ * For timing intervals: the difference of two readings is right across a
+ * wrap, for intervals up to about 71 minutes.
+ */
+UInt32 MicrosecondsNow(void) {
+    UnsignedWide now;
+    Microseconds(&now);
+    return now.lo;
+}
+
 /**
  * TickCount - Returns 60 Hz ticks since boot (Classic Mac OS API)
  *
@@ -10,6 +10,7 @@
 #include "WindowManager/WMLogging.h"
 #include "EventManager/EventManager.h"
 #include "MemoryMgr/MemoryManager.h"
+#include "MemoryMgr/TempMemory.h"
 #include "sys71_stubs.h"
 
 /* Color constants */
@@ -1636,7 +1637,8 @@ void WM_Update(void) {
                 return;  /* Too many windows, cannot allocate */
             }
 
-            windowStack = (WindowPtr*)NewPtr(windowCount * sizeof(WindowPtr));
+            TempScratchMark mark = TempScratch_Mark();
+            windowStack = (WindowPtr*)TempScratch_Alloc(windowCount * sizeof(WindowPtr));
             if (windowStack) {
                 /* Initialize array to NULL to avoid uninitialized access */
                 memset(windowStack, 0, windowCount * sizeof(WindowPtr));
@@ -1655,9 +1657,8 @@ void WM_Update(void) {
                         PaintOne(wnd, NULL);
                     }
                 }
-
-                DisposePtr((Ptr)windowStack);
             }
+            TempScratch_Release(mark);
         }
     }
 
@@ -30,6 +30,8 @@ extern void DoMenuCommand(short menuID, short item);
 #include "../include/FontManager/FontManager.h"
 #include "../include/PS2Controller.h"
 #include "../include/FS/vfs.h"
+#include "../include/FS/hfs_bcache.h"
+#include "../include/FileMgr/fs_queue.h"
 #include "../include/MemoryMgr/MemoryManager.h"
 #include "Platform/include/boot.h"
 
@@ -39,9 +41,34 @@ extern void DoMenuCommand(short menuID, short item);
 #include "../include/Resources/system7_resources.h"
 #include "../include/TimeManager/TimeManager.h"
 #include "../include/ExtensionManager/DefLoader.h"
+#include "../include/StartupScreen/StartupScreen.h"
 #ifdef ENABLE_PROCESS_COOP
 #include "../include/ProcessMgr/ProcessTypes.h"
 #endif
+#ifdef ATA_BENCH
+#include "../include/ATA_Driver.h"
+#endif
+#ifdef HFS_BENCH
+#include "../include/FS/hfs_volume.h"
+#endif
+#ifdef ALLOC_BENCH
+#include "../include/FileMgr/alloc_bitmap.h"
+#endif
+#ifdef DCMP_BENCH
+#include "../include/ResourceMgr/ResourceDecompress.h"
+#endif
+#ifdef FONT_BENCH
+#include "../include/FontManager/FontCache.h"
+#endif
+#ifdef FONT_RASTER_SMOKE_TEST
+#include "../include/FontManager/FontRasterizer.h"
+#endif
+#ifdef RES_PREFETCH
+#include "../include/ResourceMgr/ResourcePrefetch.h"
+
+/* Boot volume file with the resource loads recorded on an earlier boot */
+static const unsigned char kBootPrefetchManifest[] = "\021Resource Prefetch";
+#endif
 
 /* Forward declaration for DispatchEvent (no header available yet) */
 extern Boolean DispatchEvent(EventRecord* evt);
@@ -675,6 +702,7 @@ extern OSErr InitializeFinder(void);
 extern void FinderEventLoop(void);
 extern OSErr CleanUpDesktop(void);
 extern void DrawDesktop(void);
+extern void FolderWindow_Idle(void);
 
 #ifdef TM_SMOKE_TEST
 /* Time Manager test callback */
@@ -962,16 +990,14 @@ static void init_system71(void) {
     serial_puts("  Menu Bits Pool initialized (4 × 160KB buffers)\n");
 
     /* Startup Screen - show "Welcome to Macintosh" */
-    extern OSErr InitStartupScreen(const void* config);
-    extern OSErr ShowWelcomeScreen(void);
-    extern OSErr SetStartupPhase(int phase);
-    extern void HideStartupScreen(void);
     if (InitStartupScreen(NULL) == noErr) {
         serial_puts("  Startup Screen initialized\n");
         ShowWelcomeScreen();
         serial_puts("  Welcome screen displayed\n");
     }
 
+    SetStartupPhase(kStartupPhaseDrivers);
+
     /* Storage HAL (ATA/IDE Driver) */
     extern OSErr hal_storage_init(void);
     serial_puts("  Initializing storage subsystem...\n");
@@ -999,6 +1025,20 @@ static void init_system71(void) {
 
         /* Initial file system contents are now created during volume creation in HFS_CreateBlankVolume() */
         serial_puts("  Initial file system contents created during volume initialization\n");
+
+#ifdef RES_PREFETCH
+        /* Replay the last boot's resource loads as their files open, or
+         * record this boot's for next time */
+        {
+            Handle manifest = RP_LoadManifest(kBootPrefetchManifest);
+            if (manifest) {
+                RP_SetManifest(manifest);
+                serial_puts("  Resource prefetch manifest armed\n");
+            } else {
+                RP_BeginRecording();
+            }
+        }
+#endif
     } else {
         serial_puts("  WARNING: Failed to mount boot volume\n");
     }
@@ -1053,6 +1093,51 @@ static void init_system71(void) {
         serial_puts("  WARNING: Process Manager initialization failed\n");
     }
 
+#ifdef HEAP_BENCH
+    /* Memory Manager benchmarks (handle growth, TEInsert) */
+    HeapBench_Run();
+#endif
+
+#ifdef ATA_BENCH
+    /* ATA PIO / READ MULTIPLE / bus-master DMA throughput on drive 0 */
+    ATABench_Run();
+#endif
+
+#ifdef HFS_BENCH
+    /* HFS catalog B-tree lookups on a generated 50k-file volume */
+    HFSBench_Run();
+#endif
+
+#ifdef ALLOC_BENCH
+    /* Allocation bitmap run searches on a fragmented, nearly full volume */
+    AllocBench_Run();
+#endif
+
+#ifdef RES_BENCH
+    /* Resource file open: whole fork against map only, and type preload */
+    ResBench_Run();
+#endif
+
+#ifdef DCMP_BENCH
+    /* 'dcmp' 0/1/2 round trips, unpack throughput and compressed GetResource */
+    DcmpBench_Run();
+#endif
+
+#ifdef FONT_BENCH
+    /* Strike cache hit ratio under a Finder plus SimpleText text workload */
+    FontBench_Run();
+#endif
+
+#ifdef FONT_RASTER_SMOKE_TEST
+    /* Outline glyphs against reference bitmaps */
+    FontRasterSmoke_Run();
+#endif
+
+#ifdef HFS_BCACHE_SMOKE_TEST
+    /* Block buffer cache against an in-memory device */
+    HFSBCacheSmoke_Run();
+#endif
+
 #ifdef TM_SMOKE_TEST
     /* Segment Loader Test Harness (smoke checks for first-light validation) */
     extern void SegmentLoader_TestBoot(void);
@@ -1195,10 +1280,23 @@ static void init_system71(void) {
     }
 
     /* Hide startup screen before starting Finder */
+    SetStartupPhase(kStartupPhaseFinder);
     HideStartupScreen();
 
     /* Initialize Finder */
     OSErr err = InitializeFinder();
+    SetStartupPhase(kStartupPhaseComplete);
+
+#ifdef RES_PREFETCH
+    {
+        Handle manifest = RP_EndRecording();
+        if (manifest) {
+            RP_SaveManifest(manifest, kBootPrefetchManifest);
+            DisposeHandle(manifest);
+            serial_puts("  Resource prefetch manifest recorded\n");
+        }
+    }
+#endif
     if (err == noErr) {
         serial_puts("  Finder initialized\n");
 
@@ -1800,6 +1898,9 @@ void kernel_main(uint32_t magic, uint32_t* mb2_info) {
         /* IMPORTANT: Call TimerISR each iteration for high-cadence timer checking */
         TimeManager_TimerISR();  /* Poll timer (simulated ISR) - must be called each loop */
         TimeManager_DrainDeferred(16, 1000);  /* Process up to 16 tasks, max 1ms */
+        FSQueue_Service(8, 2000);  /* Async File Manager requests, max 2ms */
+        FolderWindow_Idle();       /* One enumeration batch for folders still filling */
+        HFS_BC_Idle();             /* Write back disk blocks dirty for 2s */
 
 #ifdef ENABLE_PROCESS_COOP
         /* Cooperative yield point - let other processes run */
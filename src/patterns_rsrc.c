@@ -1,7 +1,7 @@
 /* Auto-generated from Patterns.rsrc */
-const unsigned char patterns_rsrc_data[] = {
-  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x16, 0xa4, 0x00, 0x00, 0x15, 0xa4,
-  0x00, 0x00, 0x05, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+const unsigned char patterns_rsrc_data[] __attribute__((aligned(4))) = {
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x17, 0x4c, 0x00, 0x00, 0x16, 0x4c,
+  0x00, 0x00, 0x06, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -21,7 +21,17 @@ const unsigned char patterns_rsrc_data[] = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xaa, 0x55, 0xaa, 0x55,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x08, 0xaa, 0x55, 0xaa, 0x55,
+  0xaa, 0x55, 0xaa, 0x55, 0x00, 0x00, 0x00, 0x08, 0x55, 0xaa, 0x55, 0xaa,
+  0x55, 0xaa, 0x55, 0xaa, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x00, 0xff, 0x00,
+  0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x08, 0xaa, 0xaa, 0xaa, 0xaa,
+  0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x08, 0x88, 0x44, 0x22, 0x11,
+  0x88, 0x44, 0x22, 0x11, 0x00, 0x00, 0x00, 0x08, 0x0f, 0x0f, 0x0f, 0x0f,
+  0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x08, 0xff, 0x88, 0x88, 0x88,
+  0xff, 0x88, 0x88, 0x88, 0x00, 0x00, 0x00, 0x08, 0x11, 0x44, 0x11, 0x44,
+  0x11, 0x44, 0x11, 0x44, 0x00, 0x00, 0x00, 0x08, 0xaa, 0x55, 0xaa, 0x55,
   0xaa, 0x55, 0xaa, 0x55, 0x00, 0x00, 0x00, 0x08, 0x88, 0x00, 0x22, 0x00,
   0x88, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0x22, 0x88, 0x22,
   0x88, 0x22, 0x88, 0x22, 0x00, 0x00, 0x00, 0x08, 0x77, 0xdd, 0x77, 0xdd,
@@ -110,94 +120,95 @@ const unsigned char patterns_rsrc_data[] = {
   0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0xff, 0x00, 0x00, 0x00,
   0xff, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0xff, 0x00, 0x99, 0x00,
   0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x6c, 0x50, 0x50, 0x41, 0x54, 0x38, 0x00, 0x00, 0x08, 0x00, 0x08,
-  0x00, 0x08, 0xff, 0xff, 0xff, 0xff, 0xc8, 0xc8, 0xc8, 0xff, 0x96, 0x96,
-  0x96, 0xff, 0x64, 0x64, 0x64, 0xff, 0x32, 0x32, 0x32, 0xff, 0x00, 0x00,
-  0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,
-  0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02,
-  0x03, 0x03, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x04, 0x04, 0x01, 0x01,
-  0x02, 0x02, 0x03, 0x03, 0x04, 0x04, 0x02, 0x02, 0x03, 0x03, 0x04, 0x04,
-  0x05, 0x05, 0x02, 0x02, 0x03, 0x03, 0x04, 0x04, 0x05, 0x05, 0x03, 0x03,
-  0x04, 0x04, 0x05, 0x05, 0x00, 0x00, 0x03, 0x03, 0x04, 0x04, 0x05, 0x05,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c,
-  0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0x00, 0x00,
-  0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00,
-  0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x00,
-  0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10, 0x10,
-  0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01,
-  0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x80, 0xe8, 0x80, 0xe8, 0x80, 0xe8,
-  0x00, 0x01, 0x7d, 0x00, 0x7d, 0x00, 0x7d, 0x00, 0x00, 0x02, 0x00, 0x00,
-  0x64, 0xaf, 0x11, 0xb0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xd4, 0x00,
-  0x00, 0x04, 0x02, 0x41, 0xab, 0x54, 0xea, 0xff, 0x00, 0x05, 0xf2, 0xd7,
-  0x08, 0x56, 0x84, 0xec, 0x00, 0x06, 0xdd, 0x6b, 0x08, 0xc2, 0x06, 0xa2,
-  0x00, 0x07, 0xfc, 0x00, 0xf3, 0x7d, 0x05, 0x2f, 0x00, 0x00, 0x00, 0xba,
-  0x00, 0x00, 0x00, 0x00, 0xdd, 0xdd, 0x00, 0x03, 0x99, 0x99, 0x99, 0x99,
-  0xff, 0xff, 0x00, 0x04, 0xcc, 0xcc, 0xff, 0xff, 0x99, 0x99, 0x00, 0x05,
-  0x33, 0x33, 0x66, 0x66, 0x33, 0x33, 0x00, 0x06, 0x99, 0x99, 0x66, 0x66,
-  0x22, 0x22, 0x00, 0x07, 0xff, 0xff, 0x99, 0x99, 0x99, 0x99, 0x00, 0x01,
-  0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55,
-  0xaa, 0x55, 0x00, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x48, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
-  0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e,
-  0x00, 0x00, 0x00, 0x00, 0x25, 0x25, 0x25, 0x25, 0x56, 0x56, 0x56, 0x56,
-  0x25, 0x25, 0x25, 0x25, 0x56, 0x56, 0x56, 0x56, 0x25, 0x25, 0x25, 0x25,
-  0x56, 0x56, 0x56, 0x56, 0x25, 0x25, 0x25, 0x25, 0x56, 0x56, 0x56, 0x56,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x02, 0x99, 0x99, 0x66, 0x66, 0x00, 0x00, 0x00, 0xba, 0x00, 0x00,
-  0x00, 0x00, 0xdd, 0xdd, 0x00, 0x03, 0x99, 0x99, 0x99, 0x99, 0xff, 0xff,
-  0x00, 0x04, 0xcc, 0xcc, 0xff, 0xff, 0x99, 0x99, 0x00, 0x05, 0x33, 0x33,
-  0x66, 0x66, 0x33, 0x33, 0x00, 0x06, 0x99, 0x99, 0x66, 0x66, 0x22, 0x22,
-  0x00, 0x07, 0xff, 0xff, 0x99, 0x99, 0x99, 0x99, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x6c, 0x50, 0x50, 0x41, 0x54, 0x38, 0x00, 0x00, 0x08,
+  0x00, 0x08, 0x00, 0x08, 0xff, 0xff, 0xff, 0xff, 0xc8, 0xc8, 0xc8, 0xff,
+  0x96, 0x96, 0x96, 0xff, 0x64, 0x64, 0x64, 0xff, 0x32, 0x32, 0x32, 0xff,
+  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff,
+  0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x00, 0x00, 0x01, 0x01,
+  0x02, 0x02, 0x03, 0x03, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x04, 0x04,
+  0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x04, 0x04, 0x02, 0x02, 0x03, 0x03,
+  0x04, 0x04, 0x05, 0x05, 0x02, 0x02, 0x03, 0x03, 0x04, 0x04, 0x05, 0x05,
+  0x03, 0x03, 0x04, 0x04, 0x05, 0x05, 0x00, 0x00, 0x03, 0x03, 0x04, 0x04,
+  0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x00, 0x01, 0x00, 0x00,
   0x00, 0x1c, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55,
   0x00, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
   0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
   0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01,
   0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00,
-  0x00, 0x00, 0x25, 0x25, 0x25, 0x25, 0x56, 0x56, 0x56, 0x56, 0x25, 0x25,
-  0x25, 0x25, 0x56, 0x56, 0x56, 0x56, 0x25, 0x25, 0x25, 0x25, 0x56, 0x56,
-  0x56, 0x56, 0x25, 0x25, 0x25, 0x25, 0x56, 0x56, 0x56, 0x56, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0x99, 0x99, 0x66, 0x66, 0x00, 0x00, 0x00, 0xba, 0x33, 0x33, 0x00, 0x03,
-  0xcc, 0xcc, 0x33, 0x33, 0x33, 0x33, 0x00, 0x04, 0xff, 0xff, 0xff, 0xff,
-  0x33, 0x33, 0x00, 0x05, 0xff, 0xff, 0xcc, 0xcc, 0x99, 0x99, 0x00, 0x06,
-  0xff, 0xff, 0x66, 0x66, 0x00, 0x00, 0x00, 0x07, 0xcc, 0xcc, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x4e,
+  0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10,
+  0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01,
+  0x01, 0x01, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x80, 0xe8, 0x80, 0xe8,
+  0x80, 0xe8, 0x00, 0x01, 0x7d, 0x00, 0x7d, 0x00, 0x7d, 0x00, 0x00, 0x02,
+  0x00, 0x00, 0x64, 0xaf, 0x11, 0xb0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+  0xd4, 0x00, 0x00, 0x04, 0x02, 0x41, 0xab, 0x54, 0xea, 0xff, 0x00, 0x05,
+  0xf2, 0xd7, 0x08, 0x56, 0x84, 0xec, 0x00, 0x06, 0xdd, 0x6b, 0x08, 0xc2,
+  0x06, 0xa2, 0x00, 0x07, 0xfc, 0x00, 0xf3, 0x7d, 0x05, 0x2f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0x00, 0xdd, 0xdd, 0x00, 0x03,
+  0x99, 0x99, 0x99, 0x99, 0xff, 0xff, 0x00, 0x04, 0xcc, 0xcc, 0xff, 0xff,
+  0x99, 0x99, 0x00, 0x05, 0x33, 0x33, 0x66, 0x66, 0x33, 0x33, 0x00, 0x06,
+  0x99, 0x99, 0x66, 0x66, 0x22, 0x22, 0x00, 0x07, 0xff, 0xff, 0x99, 0x99,
+  0x99, 0x99, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x4e,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x55,
+  0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0x00, 0x00, 0x00, 0x00, 0x80, 0x04,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x25, 0x25, 0x25, 0x25,
+  0x56, 0x56, 0x56, 0x56, 0x25, 0x25, 0x25, 0x25, 0x56, 0x56, 0x56, 0x56,
+  0x25, 0x25, 0x25, 0x25, 0x56, 0x56, 0x56, 0x56, 0x25, 0x25, 0x25, 0x25,
+  0x56, 0x56, 0x56, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x99, 0x99, 0x66, 0x66, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0x00, 0xdd, 0xdd, 0x00, 0x03,
+  0x99, 0x99, 0x99, 0x99, 0xff, 0xff, 0x00, 0x04, 0xcc, 0xcc, 0xff, 0xff,
+  0x99, 0x99, 0x00, 0x05, 0x33, 0x33, 0x66, 0x66, 0x33, 0x33, 0x00, 0x06,
+  0x99, 0x99, 0x66, 0x66, 0x22, 0x22, 0x00, 0x07, 0xff, 0xff, 0x99, 0x99,
+  0x99, 0x99, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x4e,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x55,
   0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0x00, 0x00, 0x00, 0x00, 0x80, 0x04,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x32, 0x75, 0x55, 0x55,
-  0x32, 0x77, 0x55, 0x55, 0x23, 0x22, 0x77, 0x55, 0x72, 0x33, 0x22, 0x75,
-  0x57, 0x22, 0x33, 0x27, 0x55, 0x77, 0x22, 0x32, 0x55, 0x55, 0x77, 0x23,
-  0x55, 0x55, 0x57, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x25, 0x25, 0x25, 0x25,
+  0x56, 0x56, 0x56, 0x56, 0x25, 0x25, 0x25, 0x25, 0x56, 0x56, 0x56, 0x56,
+  0x25, 0x25, 0x25, 0x25, 0x56, 0x56, 0x56, 0x56, 0x25, 0x25, 0x25, 0x25,
+  0x56, 0x56, 0x56, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
   0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x66, 0x66, 0x99, 0x99, 0xff, 0xff,
-  0x00, 0x03, 0x00, 0x00, 0x00, 0xba, 0x33, 0x33, 0x00, 0x03, 0xcc, 0xcc,
-  0x33, 0x33, 0x33, 0x33, 0x00, 0x04, 0xff, 0xff, 0xff, 0xff, 0x33, 0x33,
-  0x00, 0x05, 0xff, 0xff, 0xcc, 0xcc, 0x99, 0x99, 0x00, 0x06, 0xff, 0xff,
-  0x66, 0x66, 0x00, 0x00, 0x00, 0x07, 0xcc, 0xcc, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x55, 0xaa, 0x55,
-  0xaa, 0x55, 0xaa, 0x55, 0x00, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x32, 0x75, 0x55, 0x55, 0x32, 0x77,
-  0x55, 0x55, 0x23, 0x22, 0x77, 0x55, 0x72, 0x33, 0x22, 0x75, 0x57, 0x22,
-  0x33, 0x27, 0x55, 0x77, 0x22, 0x32, 0x55, 0x55, 0x77, 0x23, 0x55, 0x55,
-  0x57, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x66, 0x66, 0x99, 0x99, 0xff, 0xff, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x99, 0x99, 0x66, 0x66, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xba, 0x33, 0x33, 0x00, 0x03, 0xcc, 0xcc, 0x33, 0x33,
+  0x33, 0x33, 0x00, 0x04, 0xff, 0xff, 0xff, 0xff, 0x33, 0x33, 0x00, 0x05,
+  0xff, 0xff, 0xcc, 0xcc, 0x99, 0x99, 0x00, 0x06, 0xff, 0xff, 0x66, 0x66,
+  0x00, 0x00, 0x00, 0x07, 0xcc, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55,
+  0xaa, 0x55, 0x00, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x48, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+  0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e,
+  0x00, 0x00, 0x00, 0x00, 0x32, 0x75, 0x55, 0x55, 0x32, 0x77, 0x55, 0x55,
+  0x23, 0x22, 0x77, 0x55, 0x72, 0x33, 0x22, 0x75, 0x57, 0x22, 0x33, 0x27,
+  0x55, 0x77, 0x22, 0x32, 0x55, 0x55, 0x77, 0x23, 0x55, 0x55, 0x57, 0x23,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x66, 0x66, 0x99, 0x99, 0xff, 0xff, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xba, 0x33, 0x33, 0x00, 0x03, 0xcc, 0xcc, 0x33, 0x33,
+  0x33, 0x33, 0x00, 0x04, 0xff, 0xff, 0xff, 0xff, 0x33, 0x33, 0x00, 0x05,
+  0xff, 0xff, 0xcc, 0xcc, 0x99, 0x99, 0x00, 0x06, 0xff, 0xff, 0x66, 0x66,
+  0x00, 0x00, 0x00, 0x07, 0xcc, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55,
+  0xaa, 0x55, 0x00, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x48, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+  0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e,
+  0x00, 0x00, 0x00, 0x00, 0x32, 0x75, 0x55, 0x55, 0x32, 0x77, 0x55, 0x55,
+  0x23, 0x22, 0x77, 0x55, 0x72, 0x33, 0x22, 0x75, 0x57, 0x22, 0x33, 0x27,
+  0x55, 0x77, 0x22, 0x32, 0x55, 0x55, 0x77, 0x23, 0x55, 0x55, 0x57, 0x23,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x66, 0x66, 0x99, 0x99, 0xff, 0xff, 0x00, 0x03, 0x00, 0x00,
   0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x99, 0x99, 0x33, 0x33, 0x00, 0x04,
   0xcc, 0xcc, 0x99, 0x99, 0xff, 0xff, 0x00, 0x05, 0x99, 0x99, 0xcc, 0xcc,
   0x99, 0x99, 0x00, 0x06, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x07,
@@ -214,23 +225,55 @@ const unsigned char patterns_rsrc_data[] = {
   0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
   0x00, 0x01, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x00, 0x02, 0x00, 0x00,
   0x66, 0x66, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xba, 0x00, 0x00, 0x99, 0x99, 0x33, 0x33, 0x00, 0x04, 0xcc, 0xcc,
-  0x99, 0x99, 0xff, 0xff, 0x00, 0x05, 0x99, 0x99, 0xcc, 0xcc, 0x99, 0x99,
-  0x00, 0x06, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x07, 0x66, 0x66,
-  0xcc, 0xcc, 0xcc, 0xcc, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00,
-  0x00, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0x00, 0x00, 0x00, 0x00,
-  0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x48,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10,
-  0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01,
-  0x01, 0x01, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10,
-  0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x07, 0x00, 0x00, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x00, 0x01,
-  0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x00, 0x02, 0x00, 0x00, 0x66, 0x66,
-  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba,
-  0xdd, 0xdd, 0x00, 0x04, 0x00, 0x00, 0x99, 0x99, 0xff, 0xff, 0x00, 0x05,
+  0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x99, 0x99, 0x33, 0x33, 0x00, 0x04,
+  0xcc, 0xcc, 0x99, 0x99, 0xff, 0xff, 0x00, 0x05, 0x99, 0x99, 0xcc, 0xcc,
+  0x99, 0x99, 0x00, 0x06, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x07,
+  0x66, 0x66, 0xcc, 0xcc, 0xcc, 0xcc, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c,
+  0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0x00, 0x00,
+  0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00,
+  0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10, 0x10,
+  0x01, 0x01, 0x01, 0x01, 0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01,
+  0x10, 0x10, 0x10, 0x10, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+  0x00, 0x01, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x00, 0x02, 0x00, 0x00,
+  0x66, 0x66, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xba, 0xdd, 0xdd, 0x00, 0x04, 0x00, 0x00, 0x99, 0x99,
+  0xff, 0xff, 0x00, 0x05, 0xff, 0xff, 0x00, 0x00, 0x99, 0x99, 0x00, 0x06,
+  0xcc, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x4e,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x55,
+  0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0x00, 0x00, 0x00, 0x00, 0x80, 0x04,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x33, 0x53, 0x33, 0x53,
+  0x33, 0x33, 0x33, 0x33, 0x53, 0x33, 0x53, 0x33, 0x33, 0x33, 0x33, 0x33,
+  0x33, 0x53, 0x33, 0x53, 0x33, 0x33, 0x33, 0x33, 0x53, 0x33, 0x53, 0x33,
+  0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x66, 0x66, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0x00, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xba, 0xdd, 0xdd, 0x00, 0x04, 0x00, 0x00, 0x99, 0x99,
+  0xff, 0xff, 0x00, 0x05, 0xff, 0xff, 0x00, 0x00, 0x99, 0x99, 0x00, 0x06,
+  0xcc, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x4e,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x55,
+  0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0x00, 0x00, 0x00, 0x00, 0x80, 0x04,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x33, 0x53, 0x33, 0x53,
+  0x33, 0x33, 0x33, 0x33, 0x53, 0x33, 0x53, 0x33, 0x33, 0x33, 0x33, 0x33,
+  0x33, 0x53, 0x33, 0x53, 0x33, 0x33, 0x33, 0x33, 0x53, 0x33, 0x53, 0x33,
+  0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x66, 0x66, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0x00, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x99, 0x99, 0xff, 0xff, 0x00, 0x05,
   0xff, 0xff, 0x00, 0x00, 0x99, 0x99, 0x00, 0x06, 0xcc, 0xcc, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
   0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00,
@@ -239,60 +282,29 @@ const unsigned char patterns_rsrc_data[] = {
   0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x48, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
   0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e,
-  0x00, 0x00, 0x00, 0x00, 0x33, 0x53, 0x33, 0x53, 0x33, 0x33, 0x33, 0x33,
-  0x53, 0x33, 0x53, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x53, 0x33, 0x53,
-  0x33, 0x33, 0x33, 0x33, 0x53, 0x33, 0x53, 0x33, 0x33, 0x33, 0x33, 0x33,
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x77, 0x22, 0x77, 0x22, 0x77, 0x22, 0x77,
+  0x77, 0x22, 0x77, 0x22, 0x77, 0x22, 0x77, 0x22, 0x22, 0x77, 0x22, 0x77,
+  0x22, 0x77, 0x22, 0x77, 0x77, 0x22, 0x77, 0x22, 0x77, 0x22, 0x77, 0x22,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0xff, 0xff,
   0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x02, 0x00, 0x00, 0x66, 0x66, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
-  0x00, 0x00, 0xcc, 0xcc, 0x00, 0x04, 0x00, 0x00, 0x00, 0xba, 0xdd, 0xdd,
-  0x00, 0x04, 0x00, 0x00, 0x99, 0x99, 0xff, 0xff, 0x00, 0x05, 0xff, 0xff,
-  0x00, 0x00, 0x99, 0x99, 0x00, 0x06, 0xcc, 0xcc, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0x00, 0x1c, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55,
-  0x00, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
-  0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
-  0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01,
-  0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00,
-  0x00, 0x00, 0x33, 0x53, 0x33, 0x53, 0x33, 0x33, 0x33, 0x33, 0x53, 0x33,
-  0x53, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x53, 0x33, 0x53, 0x33, 0x33,
-  0x33, 0x33, 0x53, 0x33, 0x53, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0x00, 0x00, 0x66, 0x66, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
-  0xcc, 0xcc, 0x00, 0x04, 0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x99, 0x99,
-  0xff, 0xff, 0x00, 0x05, 0xff, 0xff, 0x00, 0x00, 0x99, 0x99, 0x00, 0x06,
-  0xcc, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x4e,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x55,
-  0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0x00, 0x00, 0x00, 0x00, 0x80, 0x04,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x22, 0x77, 0x22, 0x77,
+  0x00, 0x00, 0xdd, 0xdd, 0x00, 0x04, 0x00, 0x00, 0x99, 0x99, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x99, 0x99, 0xff, 0xff, 0x00, 0x05,
+  0xff, 0xff, 0x00, 0x00, 0x99, 0x99, 0x00, 0x06, 0xcc, 0xcc, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55,
+  0xaa, 0x55, 0x00, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x48, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+  0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e,
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x77, 0x22, 0x77, 0x22, 0x77, 0x22, 0x77,
+  0x77, 0x22, 0x77, 0x22, 0x77, 0x22, 0x77, 0x22, 0x22, 0x77, 0x22, 0x77,
   0x22, 0x77, 0x22, 0x77, 0x77, 0x22, 0x77, 0x22, 0x77, 0x22, 0x77, 0x22,
-  0x22, 0x77, 0x22, 0x77, 0x22, 0x77, 0x22, 0x77, 0x77, 0x22, 0x77, 0x22,
-  0x77, 0x22, 0x77, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x66, 0x66, 0x00, 0x00,
-  0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xdd, 0xdd, 0x00, 0x04, 0x00, 0x00,
-  0x99, 0x99, 0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x99, 0x99, 0xff, 0xff,
-  0x00, 0x05, 0xff, 0xff, 0x00, 0x00, 0x99, 0x99, 0x00, 0x06, 0xcc, 0xcc,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x55, 0xaa, 0x55,
-  0xaa, 0x55, 0xaa, 0x55, 0x00, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x22, 0x77, 0x22, 0x77, 0x22, 0x77,
-  0x22, 0x77, 0x77, 0x22, 0x77, 0x22, 0x77, 0x22, 0x77, 0x22, 0x22, 0x77,
-  0x22, 0x77, 0x22, 0x77, 0x22, 0x77, 0x77, 0x22, 0x77, 0x22, 0x77, 0x22,
-  0x77, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x66, 0x66, 0x00, 0x00, 0x00, 0x03,
-  0x00, 0x00, 0x00, 0x00, 0xdd, 0xdd, 0x00, 0x04, 0x00, 0x00, 0x99, 0x99,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x00, 0x66, 0x66, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0xdd, 0xdd, 0x00, 0x04, 0x00, 0x00, 0x99, 0x99, 0x00, 0x00,
   0x00, 0x00, 0x00, 0xba, 0xff, 0xff, 0x00, 0x05, 0xff, 0xff, 0x00, 0x00,
   0x99, 0x99, 0x00, 0x06, 0xdd, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
   0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c,
@@ -309,23 +321,55 @@ const unsigned char patterns_rsrc_data[] = {
   0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
   0x66, 0x66, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xdd, 0xdd,
   0x00, 0x04, 0x00, 0x00, 0x99, 0x99, 0xff, 0xff, 0x00, 0x05, 0x00, 0x00,
-  0x00, 0xba, 0xff, 0xff, 0x00, 0x05, 0xff, 0xff, 0x00, 0x00, 0x99, 0x99,
-  0x00, 0x06, 0xdd, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00,
-  0x00, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0x00, 0x00, 0x00, 0x00,
-  0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x48,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06,
-  0x06, 0x06, 0x66, 0x66, 0x66, 0x66, 0x06, 0x06, 0x06, 0x06, 0x66, 0x66,
-  0x66, 0x66, 0x06, 0x06, 0x06, 0x06, 0x66, 0x66, 0x66, 0x66, 0x06, 0x06,
-  0x06, 0x06, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x07, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x66, 0x66,
-  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xdd, 0xdd, 0x00, 0x04,
-  0x00, 0x00, 0x99, 0x99, 0xff, 0xff, 0x00, 0x05, 0x00, 0x00, 0x00, 0xba,
-  0xff, 0xff, 0x00, 0x00, 0x99, 0x99, 0x00, 0x06, 0xdd, 0xdd, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xba, 0xff, 0xff, 0x00, 0x05, 0xff, 0xff, 0x00, 0x00,
+  0x99, 0x99, 0x00, 0x06, 0xdd, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c,
+  0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0x00, 0x00,
+  0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00,
+  0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x06, 0x06, 0x06, 0x66, 0x66, 0x66, 0x66, 0x06, 0x06, 0x06, 0x06,
+  0x66, 0x66, 0x66, 0x66, 0x06, 0x06, 0x06, 0x06, 0x66, 0x66, 0x66, 0x66,
+  0x06, 0x06, 0x06, 0x06, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+  0x66, 0x66, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xdd, 0xdd,
+  0x00, 0x04, 0x00, 0x00, 0x99, 0x99, 0xff, 0xff, 0x00, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xba, 0xff, 0xff, 0x00, 0x00, 0x99, 0x99, 0x00, 0x06,
+  0xdd, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x4e,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x55,
+  0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0x00, 0x00, 0x00, 0x00, 0x80, 0x04,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x44, 0x44,
+  0x33, 0x33, 0x44, 0x44, 0x33, 0x33, 0x44, 0x44, 0x33, 0x33, 0x44, 0x44,
+  0x44, 0x44, 0x00, 0x00, 0x44, 0x44, 0x00, 0x00, 0x44, 0x44, 0x00, 0x00,
+  0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x66, 0x66, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xdd, 0xdd, 0x00, 0x04, 0x00, 0x00,
+  0x99, 0x99, 0xff, 0xff, 0x00, 0x05, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xba, 0xff, 0xff, 0x00, 0x00, 0x99, 0x99, 0x00, 0x06,
+  0xdd, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x4e,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x55,
+  0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0x00, 0x00, 0x00, 0x00, 0x80, 0x04,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x44, 0x44,
+  0x33, 0x33, 0x44, 0x44, 0x33, 0x33, 0x44, 0x44, 0x33, 0x33, 0x44, 0x44,
+  0x44, 0x44, 0x00, 0x00, 0x44, 0x44, 0x00, 0x00, 0x44, 0x44, 0x00, 0x00,
+  0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x66, 0x66, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xdd, 0xdd, 0x00, 0x04, 0x00, 0x00,
+  0x99, 0x99, 0xff, 0xff, 0x00, 0x05, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xba, 0x99, 0x99, 0x00, 0x06, 0xdd, 0xdd, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
   0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55,
@@ -333,61 +377,46 @@ const unsigned char patterns_rsrc_data[] = {
   0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x48, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
   0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e,
-  0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x44, 0x44, 0x33, 0x33, 0x44, 0x44,
-  0x33, 0x33, 0x44, 0x44, 0x33, 0x33, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00,
-  0x44, 0x44, 0x00, 0x00, 0x44, 0x44, 0x00, 0x00, 0x44, 0x44, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+  0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+  0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0xff, 0xff,
   0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x02, 0x00, 0x00, 0x66, 0x66, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
   0x00, 0x00, 0xdd, 0xdd, 0x00, 0x04, 0x00, 0x00, 0x99, 0x99, 0xff, 0xff,
-  0x00, 0x05, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0xff, 0xff,
+  0x00, 0x05, 0xff, 0xff, 0x00, 0x00, 0x99, 0x99, 0x00, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xba, 0x99, 0x99, 0x00, 0x06, 0xdd, 0xdd, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55,
+  0xaa, 0x55, 0x00, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x48, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+  0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e,
+  0x00, 0x00, 0x00, 0x00, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+  0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+  0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x00, 0x66, 0x66, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0xdd, 0xdd, 0x00, 0x04, 0x00, 0x00, 0x99, 0x99, 0xff, 0xff,
+  0x00, 0x05, 0xff, 0xff, 0x00, 0x00, 0x99, 0x99, 0x00, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xba, 0xdd, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c,
+  0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0x00, 0x00,
+  0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00,
+  0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x05, 0x00, 0x04, 0x50, 0x50, 0x00, 0x00, 0x05, 0x04, 0x00, 0x05,
+  0x50, 0x40, 0x40, 0x50, 0x00, 0x04, 0x04, 0x05, 0x00, 0x00, 0x40, 0x40,
+  0x00, 0x05, 0x04, 0x04, 0x40, 0x50, 0x50, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+  0x66, 0x66, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xdd, 0xdd,
+  0x00, 0x04, 0x00, 0x00, 0x99, 0x99, 0xff, 0xff, 0x00, 0x05, 0xff, 0xff,
   0x00, 0x00, 0x99, 0x99, 0x00, 0x06, 0xdd, 0xdd, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0x00, 0x1c, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55,
-  0x00, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
-  0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
-  0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01,
-  0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00,
-  0x00, 0x00, 0x33, 0x33, 0x44, 0x44, 0x33, 0x33, 0x44, 0x44, 0x33, 0x33,
-  0x44, 0x44, 0x33, 0x33, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x44, 0x44,
-  0x00, 0x00, 0x44, 0x44, 0x00, 0x00, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0x00, 0x00, 0x66, 0x66, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
-  0xdd, 0xdd, 0x00, 0x04, 0x00, 0x00, 0x99, 0x99, 0xff, 0xff, 0x00, 0x05,
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x99, 0x99, 0x00, 0x06,
-  0xdd, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x4e,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x55,
-  0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0x00, 0x00, 0x00, 0x00, 0x80, 0x04,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x77, 0x77, 0x77, 0x77,
-  0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0x77, 0x77,
-  0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
-  0x77, 0x77, 0x77, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x66, 0x66, 0x00, 0x00,
-  0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xdd, 0xdd, 0x00, 0x04, 0x00, 0x00,
-  0x99, 0x99, 0xff, 0xff, 0x00, 0x05, 0xff, 0xff, 0x00, 0x00, 0x99, 0x99,
-  0x00, 0x06, 0x00, 0x00, 0x00, 0xba, 0x99, 0x99, 0x00, 0x06, 0xdd, 0xdd,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x55, 0xaa, 0x55,
-  0xaa, 0x55, 0xaa, 0x55, 0x00, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
-  0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x75, 0x77, 0x77, 0x77, 0x77,
-  0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
-  0x77, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x66, 0x66, 0x00, 0x00, 0x00, 0x03,
-  0x00, 0x00, 0x00, 0x00, 0xdd, 0xdd, 0x00, 0x04, 0x00, 0x00, 0x99, 0x99,
-  0xff, 0xff, 0x00, 0x05, 0xff, 0xff, 0x00, 0x00, 0x99, 0x99, 0x00, 0x06,
   0x00, 0x00, 0x00, 0xba, 0xdd, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
   0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c,
   0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -404,207 +433,211 @@ const unsigned char patterns_rsrc_data[] = {
   0x66, 0x66, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xdd, 0xdd,
   0x00, 0x04, 0x00, 0x00, 0x99, 0x99, 0xff, 0xff, 0x00, 0x05, 0xff, 0xff,
   0x00, 0x00, 0x99, 0x99, 0x00, 0x06, 0xdd, 0xdd, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xba, 0xdd, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00,
-  0x00, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0x00, 0x00, 0x00, 0x00,
-  0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x48,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05,
-  0x00, 0x04, 0x50, 0x50, 0x00, 0x00, 0x05, 0x04, 0x00, 0x05, 0x50, 0x40,
-  0x40, 0x50, 0x00, 0x04, 0x04, 0x05, 0x00, 0x00, 0x40, 0x40, 0x00, 0x05,
-  0x04, 0x04, 0x40, 0x50, 0x50, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x07, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x66, 0x66,
-  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xdd, 0xdd, 0x00, 0x04,
-  0x00, 0x00, 0x99, 0x99, 0xff, 0xff, 0x00, 0x05, 0xff, 0xff, 0x00, 0x00,
-  0x99, 0x99, 0x00, 0x06, 0xdd, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba,
-  0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55,
-  0xaa, 0x55, 0x00, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x48, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
-  0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e,
+  0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x4e,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x55,
+  0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0x00, 0x00, 0x00, 0x00, 0x80, 0x04,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02,
   0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00,
   0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02,
-  0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x02, 0x00, 0x00, 0x66, 0x66, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
-  0x00, 0x00, 0xdd, 0xdd, 0x00, 0x04, 0x00, 0x00, 0x99, 0x99, 0xff, 0xff,
-  0x00, 0x05, 0xff, 0xff, 0x00, 0x00, 0x99, 0x99, 0x00, 0x06, 0xdd, 0xdd,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xba, 0x00, 0x00,
-  0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0x00, 0x1c, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55,
-  0x00, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
-  0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
-  0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x01,
-  0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00,
-  0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02,
-  0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0x00, 0x00, 0x66, 0x66, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
-  0xdd, 0xdd, 0x00, 0x04, 0x00, 0x00, 0x99, 0x99, 0xff, 0xff, 0x00, 0x05,
-  0xff, 0xff, 0x00, 0x00, 0x99, 0x99, 0x00, 0x06, 0xdd, 0xdd, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xba, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x66, 0x66, 0x00, 0x00,
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xdd, 0xdd, 0x00, 0x04, 0x00, 0x00,
+  0x99, 0x99, 0xff, 0xff, 0x00, 0x05, 0xff, 0xff, 0x00, 0x00, 0x99, 0x99,
+  0x00, 0x06, 0xdd, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff,
   0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x4e,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x55,
   0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55, 0x00, 0x00, 0x00, 0x00, 0x80, 0x04,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x34, 0x44, 0x44, 0x40, 0x34, 0x44, 0x44, 0x40, 0x34, 0x44, 0x34, 0x40,
-  0x34, 0x40, 0x44, 0x40, 0x34, 0x44, 0x44, 0x40, 0x34, 0x44, 0x44, 0x40,
-  0x33, 0x33, 0x33, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
   0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x66, 0x66, 0x00, 0x00,
   0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xdd, 0xdd, 0x00, 0x04, 0x00, 0x00,
   0x99, 0x99, 0xff, 0xff, 0x00, 0x05, 0xff, 0xff, 0x00, 0x00, 0x99, 0x99,
-  0x00, 0x06, 0xdd, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x00, 0x00, 0xba, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x55, 0xaa, 0x55,
-  0xaa, 0x55, 0xaa, 0x55, 0x00, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x34, 0x44,
-  0x44, 0x40, 0x34, 0x44, 0x44, 0x40, 0x34, 0x44, 0x34, 0x40, 0x34, 0x40,
-  0x44, 0x40, 0x34, 0x44, 0x44, 0x40, 0x34, 0x44, 0x44, 0x40, 0x33, 0x33,
-  0x33, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x66, 0x66, 0x00, 0x00, 0x00, 0x03,
-  0x00, 0x00, 0x00, 0x00, 0xdd, 0xdd, 0x00, 0x04, 0x00, 0x00, 0x99, 0x99,
-  0xff, 0xff, 0x00, 0x05, 0xff, 0xff, 0x00, 0x00, 0x99, 0x99, 0x00, 0x06,
-  0xdd, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x16, 0xa4, 0x00, 0x00, 0x15, 0xa4,
-  0x00, 0x00, 0x05, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x1c, 0x03, 0x16, 0x00, 0x01, 0x50, 0x41, 0x54, 0x20, 0x00, 0x1f,
-  0x00, 0x12, 0x70, 0x70, 0x61, 0x74, 0x00, 0x1d, 0x01, 0x92, 0x00, 0x10,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
-  0x00, 0x09, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
-  0x00, 0x14, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
-  0x00, 0x1d, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
-  0x00, 0x26, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
-  0x00, 0x31, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16,
-  0x00, 0x40, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17,
-  0x00, 0x51, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
-  0x00, 0x60, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19,
-  0x00, 0x6e, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a,
-  0x00, 0x73, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b,
-  0x00, 0x7e, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c,
-  0x00, 0x88, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d,
-  0x00, 0x8d, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e,
-  0x00, 0x98, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
-  0x00, 0xa6, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-  0x00, 0xac, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21,
-  0x00, 0xbb, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
-  0x00, 0xcc, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23,
-  0x00, 0xd2, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24,
-  0x00, 0xd8, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25,
-  0x00, 0xdf, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26,
-  0x00, 0xee, 0x00, 0x00, 0x01, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27,
-  0x00, 0xfd, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28,
-  0x01, 0x04, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29,
-  0x01, 0x0d, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a,
-  0x01, 0x13, 0x00, 0x00, 0x01, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b,
-  0x01, 0x1a, 0x00, 0x00, 0x01, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c,
-  0x01, 0x20, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d,
-  0x01, 0x24, 0x00, 0x00, 0x01, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e,
-  0x01, 0x28, 0x00, 0x00, 0x01, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f,
-  0x01, 0x32, 0x00, 0x00, 0x01, 0x74, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2c,
-  0x01, 0x3e, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2d,
-  0x01, 0x4c, 0x00, 0x00, 0x01, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2e,
-  0x01, 0x58, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x30,
-  0x01, 0x63, 0x00, 0x00, 0x02, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90,
-  0x01, 0x82, 0x00, 0x00, 0x03, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90,
-  0x01, 0x82, 0x00, 0x00, 0x03, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x91,
-  0x01, 0x95, 0x00, 0x00, 0x04, 0x96, 0x00, 0x00, 0x00, 0x00, 0x01, 0x91,
-  0x01, 0x95, 0x00, 0x00, 0x04, 0x96, 0x00, 0x00, 0x00, 0x00, 0x01, 0x93,
-  0x01, 0xa5, 0x00, 0x00, 0x06, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x93,
-  0x01, 0xa5, 0x00, 0x00, 0x06, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x94,
-  0x01, 0xbd, 0x00, 0x00, 0x07, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x01, 0x94,
-  0x01, 0xbd, 0x00, 0x00, 0x07, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x01, 0x95,
-  0x01, 0xd5, 0x00, 0x00, 0x09, 0x06, 0x00, 0x00, 0x00, 0x00, 0x01, 0x95,
-  0x01, 0xd5, 0x00, 0x00, 0x09, 0x06, 0x00, 0x00, 0x00, 0x00, 0x01, 0x96,
-  0x01, 0xed, 0x00, 0x00, 0x0a, 0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0x96,
-  0x01, 0xed, 0x00, 0x00, 0x0a, 0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0x97,
-  0x02, 0x05, 0x00, 0x00, 0x0b, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x01, 0x97,
-  0x02, 0x05, 0x00, 0x00, 0x0b, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x01, 0x98,
-  0x02, 0x1d, 0x00, 0x00, 0x0d, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x01, 0x98,
-  0x02, 0x1d, 0x00, 0x00, 0x0d, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x01, 0x99,
-  0x02, 0x35, 0x00, 0x00, 0x0e, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x01, 0x99,
-  0x02, 0x35, 0x00, 0x00, 0x0e, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9a,
-  0x02, 0x4d, 0x00, 0x00, 0x10, 0x72, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9a,
-  0x02, 0x4d, 0x00, 0x00, 0x10, 0x72, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9b,
-  0x02, 0x65, 0x00, 0x00, 0x11, 0xee, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9b,
-  0x02, 0x65, 0x00, 0x00, 0x11, 0xee, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9c,
-  0x02, 0x7e, 0x00, 0x00, 0x13, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9c,
-  0x02, 0x7e, 0x00, 0x00, 0x13, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9d,
-  0x02, 0x98, 0x00, 0x00, 0x14, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9d,
-  0x02, 0x98, 0x00, 0x00, 0x14, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x08, 0x35,
-  0x30, 0x25, 0x20, 0x47, 0x72, 0x61, 0x79, 0x0a, 0x31, 0x32, 0x2e, 0x35,
-  0x25, 0x20, 0x47, 0x72, 0x61, 0x79, 0x08, 0x32, 0x35, 0x25, 0x20, 0x47,
-  0x72, 0x61, 0x79, 0x08, 0x37, 0x35, 0x25, 0x20, 0x47, 0x72, 0x61, 0x79,
-  0x0a, 0x38, 0x37, 0x2e, 0x35, 0x25, 0x20, 0x47, 0x72, 0x61, 0x79, 0x0e,
-  0x56, 0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x4c, 0x69, 0x6e,
-  0x65, 0x73, 0x10, 0x48, 0x6f, 0x72, 0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61,
-  0x6c, 0x20, 0x4c, 0x69, 0x6e, 0x65, 0x73, 0x0e, 0x52, 0x69, 0x67, 0x68,
-  0x74, 0x20, 0x44, 0x69, 0x61, 0x67, 0x6f, 0x6e, 0x61, 0x6c, 0x0d, 0x4c,
-  0x65, 0x66, 0x74, 0x20, 0x44, 0x69, 0x61, 0x67, 0x6f, 0x6e, 0x61, 0x6c,
-  0x04, 0x47, 0x72, 0x69, 0x64, 0x0a, 0x4c, 0x69, 0x67, 0x68, 0x74, 0x20,
-  0x47, 0x72, 0x69, 0x64, 0x09, 0x44, 0x61, 0x72, 0x6b, 0x20, 0x47, 0x72,
-  0x69, 0x64, 0x04, 0x44, 0x6f, 0x74, 0x73, 0x0a, 0x44, 0x65, 0x6e, 0x73,
-  0x65, 0x20, 0x44, 0x6f, 0x74, 0x73, 0x0d, 0x44, 0x69, 0x61, 0x67, 0x6f,
-  0x6e, 0x61, 0x6c, 0x20, 0x44, 0x6f, 0x74, 0x73, 0x05, 0x57, 0x61, 0x76,
-  0x65, 0x73, 0x0e, 0x44, 0x69, 0x61, 0x67, 0x6f, 0x6e, 0x61, 0x6c, 0x20,
-  0x42, 0x72, 0x69, 0x63, 0x6b, 0x10, 0x48, 0x6f, 0x72, 0x69, 0x7a, 0x6f,
-  0x6e, 0x74, 0x61, 0x6c, 0x20, 0x42, 0x72, 0x69, 0x63, 0x6b, 0x05, 0x57,
-  0x65, 0x61, 0x76, 0x65, 0x05, 0x50, 0x6c, 0x61, 0x69, 0x64, 0x06, 0x53,
-  0x63, 0x61, 0x6c, 0x65, 0x73, 0x0e, 0x53, 0x6d, 0x61, 0x6c, 0x6c, 0x20,
-  0x43, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x0e, 0x4c, 0x61, 0x72,
-  0x67, 0x65, 0x20, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x06,
-  0x54, 0x68, 0x61, 0x74, 0x63, 0x68, 0x08, 0x54, 0x68, 0x61, 0x74, 0x63,
-  0x68, 0x65, 0x73, 0x05, 0x4d, 0x6f, 0x69, 0x72, 0x65, 0x06, 0x42, 0x61,
-  0x73, 0x6b, 0x65, 0x74, 0x05, 0x43, 0x72, 0x6f, 0x73, 0x73, 0x03, 0x53,
-  0x6b, 0x79, 0x03, 0x4f, 0x61, 0x6b, 0x09, 0x4d, 0x6f, 0x75, 0x6e, 0x74,
-  0x61, 0x69, 0x6e, 0x73, 0x0b, 0x53, 0x6f, 0x6c, 0x69, 0x64, 0x20, 0x42,
-  0x6c, 0x61, 0x63, 0x6b, 0x0d, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x47, 0x72,
-  0x61, 0x64, 0x69, 0x65, 0x6e, 0x74, 0x0b, 0x43, 0x6f, 0x6c, 0x6f, 0x72,
-  0x42, 0x72, 0x69, 0x63, 0x6b, 0x73, 0x0a, 0x43, 0x6f, 0x6c, 0x6f, 0x72,
-  0x57, 0x65, 0x61, 0x76, 0x65, 0x0e, 0x50, 0x61, 0x74, 0x74, 0x65, 0x72,
-  0x6e, 0x54, 0x68, 0x69, 0x73, 0x4f, 0x6e, 0x65, 0x0f, 0x41, 0x75, 0x74,
-  0x68, 0x65, 0x6e, 0x74, 0x69, 0x63, 0x34, 0x43, 0x6f, 0x6c, 0x6f, 0x72,
-  0x12, 0x2d, 0x35, 0x37, 0x36, 0x30, 0x5f, 0x34, 0x63, 0x6f, 0x6c, 0x6f,
-  0x72, 0x50, 0x69, 0x78, 0x50, 0x61, 0x74, 0x02, 0x31, 0x36, 0x0c, 0x41,
-  0x75, 0x74, 0x68, 0x50, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6e, 0x31, 0x0a,
-  0x70, 0x70, 0x61, 0x74, 0x5f, 0x34, 0x30, 0x32, 0x5f, 0x31, 0x0c, 0x41,
-  0x75, 0x74, 0x68, 0x50, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6e, 0x32, 0x0a,
-  0x70, 0x70, 0x61, 0x74, 0x5f, 0x34, 0x30, 0x32, 0x5f, 0x32, 0x0c, 0x41,
-  0x75, 0x74, 0x68, 0x50, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6e, 0x33, 0x0a,
-  0x70, 0x70, 0x61, 0x74, 0x5f, 0x34, 0x30, 0x32, 0x5f, 0x33, 0x0c, 0x41,
-  0x75, 0x74, 0x68, 0x50, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6e, 0x34, 0x0a,
-  0x70, 0x70, 0x61, 0x74, 0x5f, 0x34, 0x30, 0x32, 0x5f, 0x34, 0x0c, 0x41,
-  0x75, 0x74, 0x68, 0x50, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6e, 0x35, 0x0a,
-  0x70, 0x70, 0x61, 0x74, 0x5f, 0x34, 0x30, 0x32, 0x5f, 0x35, 0x0c, 0x41,
-  0x75, 0x74, 0x68, 0x50, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6e, 0x36, 0x0a,
-  0x70, 0x70, 0x61, 0x74, 0x5f, 0x34, 0x30, 0x32, 0x5f, 0x36, 0x0c, 0x41,
-  0x75, 0x74, 0x68, 0x50, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6e, 0x37, 0x0a,
-  0x70, 0x70, 0x61, 0x74, 0x5f, 0x34, 0x30, 0x32, 0x5f, 0x37, 0x0c, 0x41,
-  0x75, 0x74, 0x68, 0x50, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6e, 0x38, 0x0a,
-  0x70, 0x70, 0x61, 0x74, 0x5f, 0x34, 0x30, 0x32, 0x5f, 0x38, 0x0c, 0x41,
-  0x75, 0x74, 0x68, 0x50, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6e, 0x39, 0x0a,
-  0x70, 0x70, 0x61, 0x74, 0x5f, 0x34, 0x30, 0x32, 0x5f, 0x39, 0x0d, 0x41,
-  0x75, 0x74, 0x68, 0x50, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6e, 0x31, 0x30,
-  0x0b, 0x70, 0x70, 0x61, 0x74, 0x5f, 0x34, 0x30, 0x32, 0x5f, 0x31, 0x30,
-  0x0d, 0x41, 0x75, 0x74, 0x68, 0x50, 0x61, 0x74, 0x74, 0x65, 0x72, 0x6e,
-  0x31, 0x31, 0x0b, 0x70, 0x70, 0x61, 0x74, 0x5f, 0x34, 0x30, 0x32, 0x5f,
-  0x31, 0x31
+  0x00, 0x06, 0xdd, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xba, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55,
+  0xaa, 0x55, 0x00, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x48, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+  0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e,
+  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x34, 0x44, 0x44, 0x40,
+  0x34, 0x44, 0x44, 0x40, 0x34, 0x44, 0x34, 0x40, 0x34, 0x40, 0x44, 0x40,
+  0x34, 0x44, 0x44, 0x40, 0x34, 0x44, 0x44, 0x40, 0x33, 0x33, 0x33, 0x34,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x00, 0x66, 0x66, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0xdd, 0xdd, 0x00, 0x04, 0x00, 0x00, 0x99, 0x99, 0xff, 0xff,
+  0x00, 0x05, 0xff, 0xff, 0x00, 0x00, 0x99, 0x99, 0x00, 0x06, 0xdd, 0xdd,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xba, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x55, 0xaa, 0x55, 0xaa, 0x55,
+  0xaa, 0x55, 0x00, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x48, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+  0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e,
+  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x34, 0x44, 0x44, 0x40,
+  0x34, 0x44, 0x44, 0x40, 0x34, 0x44, 0x34, 0x40, 0x34, 0x40, 0x44, 0x40,
+  0x34, 0x44, 0x44, 0x40, 0x34, 0x44, 0x44, 0x40, 0x33, 0x33, 0x33, 0x34,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x00, 0x66, 0x66, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0xdd, 0xdd, 0x00, 0x04, 0x00, 0x00, 0x99, 0x99, 0xff, 0xff,
+  0x00, 0x05, 0xff, 0xff, 0x00, 0x00, 0x99, 0x99, 0x00, 0x06, 0xdd, 0xdd,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x17, 0x4c, 0x00, 0x00, 0x16, 0x4c,
+  0x00, 0x00, 0x06, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1c, 0x03, 0x8e, 0x00, 0x01, 0x50, 0x41, 0x54, 0x20, 0x00, 0x29,
+  0x00, 0x12, 0x70, 0x70, 0x61, 0x74, 0x00, 0x1d, 0x02, 0x0a, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x00, 0x06, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x00, 0x11, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+  0x00, 0x1b, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0x00, 0x21, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+  0x00, 0x34, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0x00, 0x45, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0x00, 0x56, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0x00, 0x63, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
+  0x00, 0x6f, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+  0x00, 0x74, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+  0x00, 0x7d, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+  0x00, 0x88, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+  0x00, 0x91, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
+  0x00, 0x9a, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
+  0x00, 0xa5, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16,
+  0x00, 0xb4, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17,
+  0x00, 0xc5, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+  0x00, 0xd4, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19,
+  0x00, 0xe2, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a,
+  0x00, 0xe7, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b,
+  0x00, 0xf2, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c,
+  0x00, 0x6f, 0x00, 0x00, 0x01, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d,
+  0x00, 0xfc, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e,
+  0x01, 0x07, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
+  0x01, 0x15, 0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+  0x01, 0x1b, 0x00, 0x00, 0x01, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21,
+  0x01, 0x2a, 0x00, 0x00, 0x01, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+  0x01, 0x3b, 0x00, 0x00, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23,
+  0x01, 0x41, 0x00, 0x00, 0x01, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24,
+  0x01, 0x47, 0x00, 0x00, 0x01, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25,
+  0x01, 0x4e, 0x00, 0x00, 0x01, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26,
+  0x01, 0x5d, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27,
+  0x01, 0x6c, 0x00, 0x00, 0x01, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28,
+  0x01, 0x73, 0x00, 0x00, 0x01, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29,
+  0x01, 0x7c, 0x00, 0x00, 0x01, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a,
+  0x01, 0x82, 0x00, 0x00, 0x01, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b,
+  0x01, 0x89, 0x00, 0x00, 0x01, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c,
+  0x01, 0x8f, 0x00, 0x00, 0x01, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d,
+  0x01, 0x93, 0x00, 0x00, 0x01, 0xd4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e,
+  0x01, 0x97, 0x00, 0x00, 0x01, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f,
+  0x01, 0xa1, 0x00, 0x00, 0x01, 0xec, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2c,
+  0x01, 0xad, 0x00, 0x00, 0x01, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2d,
+  0x01, 0xbb, 0x00, 0x00, 0x02, 0x58, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2e,
+  0x01, 0xc7, 0x00, 0x00, 0x02, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x01, 0x30,
+  0x01, 0xd2, 0x00, 0x00, 0x03, 0x18, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90,
+  0x01, 0xf1, 0x00, 0x00, 0x04, 0x14, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90,
+  0x01, 0xf1, 0x00, 0x00, 0x04, 0x14, 0x00, 0x00, 0x00, 0x00, 0x01, 0x91,
+  0x02, 0x04, 0x00, 0x00, 0x05, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x91,
+  0x02, 0x04, 0x00, 0x00, 0x05, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x93,
+  0x02, 0x14, 0x00, 0x00, 0x06, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x93,
+  0x02, 0x14, 0x00, 0x00, 0x06, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x94,
+  0x02, 0x2c, 0x00, 0x00, 0x08, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x94,
+  0x02, 0x2c, 0x00, 0x00, 0x08, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x95,
+  0x02, 0x44, 0x00, 0x00, 0x09, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x95,
+  0x02, 0x44, 0x00, 0x00, 0x09, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x96,
+  0x02, 0x5c, 0x00, 0x00, 0x0b, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x96,
+  0x02, 0x5c, 0x00, 0x00, 0x0b, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x97,
+  0x02, 0x74, 0x00, 0x00, 0x0c, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x97,
+  0x02, 0x74, 0x00, 0x00, 0x0c, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x98,
+  0x02, 0x8c, 0x00, 0x00, 0x0e, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x98,
+  0x02, 0x8c, 0x00, 0x00, 0x0e, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x99,
+  0x02, 0xa4, 0x00, 0x00, 0x0f, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x99,
+  0x02, 0xa4, 0x00, 0x00, 0x0f, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9a,
+  0x02, 0xbc, 0x00, 0x00, 0x11, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9a,
+  0x02, 0xbc, 0x00, 0x00, 0x11, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9b,
+  0x02, 0xd4, 0x00, 0x00, 0x12, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9b,
+  0x02, 0xd4, 0x00, 0x00, 0x12, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9c,
+  0x02, 0xed, 0x00, 0x00, 0x14, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9c,
+  0x02, 0xed, 0x00, 0x00, 0x14, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9d,
+  0x03, 0x07, 0x00, 0x00, 0x15, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9d,
+  0x03, 0x07, 0x00, 0x00, 0x15, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x05, 0x57,
+  0x68, 0x69, 0x74, 0x65, 0x0a, 0x4c, 0x69, 0x67, 0x68, 0x74, 0x20, 0x47,
+  0x72, 0x61, 0x79, 0x09, 0x44, 0x61, 0x72, 0x6b, 0x20, 0x47, 0x72, 0x61,
+  0x79, 0x05, 0x42, 0x6c, 0x61, 0x63, 0x6b, 0x12, 0x48, 0x6f, 0x72, 0x69,
+  0x7a, 0x6f, 0x6e, 0x74, 0x61, 0x6c, 0x20, 0x53, 0x74, 0x72, 0x69, 0x70,
+  0x65, 0x73, 0x10, 0x56, 0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x20,
+  0x53, 0x74, 0x72, 0x69, 0x70, 0x65, 0x73, 0x10, 0x44, 0x69, 0x61, 0x67,
+  0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x53, 0x74, 0x72, 0x69, 0x70, 0x65, 0x73,
+  0x0c, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x72, 0x62, 0x6f, 0x61, 0x72,
+  0x64, 0x0b, 0x43, 0x72, 0x6f, 0x73, 0x73, 0x2d, 0x68, 0x61, 0x74, 0x63,
+  0x68, 0x04, 0x44, 0x6f, 0x74, 0x73, 0x08, 0x35, 0x30, 0x25, 0x20, 0x47,
+  0x72, 0x61, 0x79, 0x0a, 0x31, 0x32, 0x2e, 0x35, 0x25, 0x20, 0x47, 0x72,
+  0x61, 0x79, 0x08, 0x32, 0x35, 0x25, 0x20, 0x47, 0x72, 0x61, 0x79, 0x08,
+  0x37, 0x35, 0x25, 0x20, 0x47, 0x72, 0x61, 0x79, 0x0a, 0x38, 0x37, 0x2e,
+  0x35, 0x25, 0x20, 0x47, 0x72, 0x61, 0x79, 0x0e, 0x56, 0x65, 0x72, 0x74,
+  0x69, 0x63, 0x61, 0x6c, 0x20, 0x4c, 0x69, 0x6e, 0x65, 0x73, 0x10, 0x48,
+  0x6f, 0x72, 0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61, 0x6c, 0x20, 0x4c, 0x69,
+  0x6e, 0x65, 0x73, 0x0e, 0x52, 0x69, 0x67, 0x68, 0x74, 0x20, 0x44, 0x69,
+  0x61, 0x67, 0x6f, 0x6e, 0x61, 0x6c, 0x0d, 0x4c, 0x65, 0x66, 0x74, 0x20,
+  0x44, 0x69, 0x61, 0x67, 0x6f, 0x6e, 0x61, 0x6c, 0x04, 0x47, 0x72, 0x69,
+  0x64, 0x0a, 0x4c, 0x69, 0x67, 0x68, 0x74, 0x20, 0x47, 0x72, 0x69, 0x64,
+  0x09, 0x44, 0x61, 0x72, 0x6b, 0x20, 0x47, 0x72, 0x69, 0x64, 0x0a, 0x44,
+  0x65, 0x6e, 0x73, 0x65, 0x20, 0x44, 0x6f, 0x74, 0x73, 0x0d, 0x44, 0x69,
+  0x61, 0x67, 0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x44, 0x6f, 0x74, 0x73, 0x05,
+  0x57, 0x61, 0x76, 0x65, 0x73, 0x0e, 0x44, 0x69, 0x61, 0x67, 0x6f, 0x6e,
+  0x61, 0x6c, 0x20, 0x42, 0x72, 0x69, 0x63, 0x6b, 0x10, 0x48, 0x6f, 0x72,
+  0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61, 0x6c, 0x20, 0x42, 0x72, 0x69, 0x63,
+  0x6b, 0x05, 0x57, 0x65, 0x61, 0x76, 0x65, 0x05, 0x50, 0x6c, 0x61, 0x69,
+  0x64, 0x06, 0x53, 0x63, 0x61, 0x6c, 0x65, 0x73, 0x0e, 0x53, 0x6d, 0x61,
+  0x6c, 0x6c, 0x20, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x0e,
+  0x4c, 0x61, 0x72, 0x67, 0x65, 0x20, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x65,
+  0x72, 0x73, 0x06, 0x54, 0x68, 0x61, 0x74, 0x63, 0x68, 0x08, 0x54, 0x68,
+  0x61, 0x74, 0x63, 0x68, 0x65, 0x73, 0x05, 0x4d, 0x6f, 0x69, 0x72, 0x65,
+  0x06, 0x42, 0x61, 0x73, 0x6b, 0x65, 0x74, 0x05, 0x43, 0x72, 0x6f, 0x73,
+  0x73, 0x03, 0x53, 0x6b, 0x79, 0x03, 0x4f, 0x61, 0x6b, 0x09, 0x4d, 0x6f,
+  0x75, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x73, 0x0b, 0x53, 0x6f, 0x6c, 0x69,
+  0x64, 0x20, 0x42, 0x6c, 0x61, 0x63, 0x6b, 0x0d, 0x43, 0x6f, 0x6c, 0x6f,
+  0x72, 0x47, 0x72, 0x61, 0x64, 0x69, 0x65, 0x6e, 0x74, 0x0b, 0x43, 0x6f,
+  0x6c, 0x6f, 0x72, 0x42, 0x72, 0x69, 0x63, 0x6b, 0x73, 0x0a, 0x43, 0x6f,
+  0x6c, 0x6f, 0x72, 0x57, 0x65, 0x61, 0x76, 0x65, 0x0e, 0x50, 0x61, 0x74,
+  0x74, 0x65, 0x72, 0x6e, 0x54, 0x68, 0x69, 0x73, 0x4f, 0x6e, 0x65, 0x0f,
+  0x41, 0x75, 0x74, 0x68, 0x65, 0x6e, 0x74, 0x69, 0x63, 0x34, 0x43, 0x6f,
+  0x6c, 0x6f, 0x72, 0x12, 0x2d, 0x35, 0x37, 0x36, 0x30, 0x5f, 0x34, 0x63,
+  0x6f, 0x6c, 0x6f, 0x72, 0x50, 0x69, 0x78, 0x50, 0x61, 0x74, 0x02, 0x31,
+  0x36, 0x0c, 0x41, 0x75, 0x74, 0x68, 0x50, 0x61, 0x74, 0x74, 0x65, 0x72,
+  0x6e, 0x31, 0x0a, 0x70, 0x70, 0x61, 0x74, 0x5f, 0x34, 0x30, 0x32, 0x5f,
+  0x31, 0x0c, 0x41, 0x75, 0x74, 0x68, 0x50, 0x61, 0x74, 0x74, 0x65, 0x72,
+  0x6e, 0x32, 0x0a, 0x70, 0x70, 0x61, 0x74, 0x5f, 0x34, 0x30, 0x32, 0x5f,
+  0x32, 0x0c, 0x41, 0x75, 0x74, 0x68, 0x50, 0x61, 0x74, 0x74, 0x65, 0x72,
+  0x6e, 0x33, 0x0a, 0x70, 0x70, 0x61, 0x74, 0x5f, 0x34, 0x30, 0x32, 0x5f,
+  0x33, 0x0c, 0x41, 0x75, 0x74, 0x68, 0x50, 0x61, 0x74, 0x74, 0x65, 0x72,
+  0x6e, 0x34, 0x0a, 0x70, 0x70, 0x61, 0x74, 0x5f, 0x34, 0x30, 0x32, 0x5f,
+  0x34, 0x0c, 0x41, 0x75, 0x74, 0x68, 0x50, 0x61, 0x74, 0x74, 0x65, 0x72,
+  0x6e, 0x35, 0x0a, 0x70, 0x70, 0x61, 0x74, 0x5f, 0x34, 0x30, 0x32, 0x5f,
+  0x35, 0x0c, 0x41, 0x75, 0x74, 0x68, 0x50, 0x61, 0x74, 0x74, 0x65, 0x72,
+  0x6e, 0x36, 0x0a, 0x70, 0x70, 0x61, 0x74, 0x5f, 0x34, 0x30, 0x32, 0x5f,
+  0x36, 0x0c, 0x41, 0x75, 0x74, 0x68, 0x50, 0x61, 0x74, 0x74, 0x65, 0x72,
+  0x6e, 0x37, 0x0a, 0x70, 0x70, 0x61, 0x74, 0x5f, 0x34, 0x30, 0x32, 0x5f,
+  0x37, 0x0c, 0x41, 0x75, 0x74, 0x68, 0x50, 0x61, 0x74, 0x74, 0x65, 0x72,
+  0x6e, 0x38, 0x0a, 0x70, 0x70, 0x61, 0x74, 0x5f, 0x34, 0x30, 0x32, 0x5f,
+  0x38, 0x0c, 0x41, 0x75, 0x74, 0x68, 0x50, 0x61, 0x74, 0x74, 0x65, 0x72,
+  0x6e, 0x39, 0x0a, 0x70, 0x70, 0x61, 0x74, 0x5f, 0x34, 0x30, 0x32, 0x5f,
+  0x39, 0x0d, 0x41, 0x75, 0x74, 0x68, 0x50, 0x61, 0x74, 0x74, 0x65, 0x72,
+  0x6e, 0x31, 0x30, 0x0b, 0x70, 0x70, 0x61, 0x74, 0x5f, 0x34, 0x30, 0x32,
+  0x5f, 0x31, 0x30, 0x0d, 0x41, 0x75, 0x74, 0x68, 0x50, 0x61, 0x74, 0x74,
+  0x65, 0x72, 0x6e, 0x31, 0x31, 0x0b, 0x70, 0x70, 0x61, 0x74, 0x5f, 0x34,
+  0x30, 0x32, 0x5f, 0x31, 0x31
 };
 const unsigned int patterns_rsrc_size = sizeof(patterns_rsrc_data);
@@ -239,6 +239,7 @@ void SetAutoDecompression(Boolean enable) {
     (void)enable;
 }
 
+#ifndef ENABLE_RESOURCES
 void ResourceManager_SetDecompressionCacheSize(Size size) {
     SYSTEM_LOG_DEBUG("ResourceManager_SetDecompressionCacheSize: Setting cache to %lu bytes\n", (unsigned long)size);
     /* In a full implementation, this would:
@@ -249,6 +250,7 @@ void ResourceManager_SetDecompressionCacheSize(Size size) {
      * For kernel environment, no compression cache needed */
     (void)size;
 }
+#endif
 
 void InstallDecompressHook(DecompressHookProc proc) {
     SYSTEM_LOG_DEBUG("InstallDecompressHook: Installing hook at %p\n", proc);
@@ -1628,6 +1630,11 @@ size_t fread(void *ptr, size_t size, size_t nmemb, void *stream) {
     return 0;
 }
 
+size_t fwrite(const void *ptr, size_t size, size_t nmemb, void *stream) {
+    /* Stub: File operations not supported */
+    return 0;
+}
+
 int fprintf(void *stream, const char *format, ...) {
     /* Stub: File operations not supported */
     return -1;
@@ -1653,12 +1660,6 @@ void HSetState(Handle h, UInt8 state) {
     return;
 }
 
-/* HFS B-tree stubs */
-OSErr HFS_BT_FindRecord(void *btree, const void *key, void *record, UInt32 *recLen) {
-    /* Stub: HFS B-tree operations not available */
-    return -1;
-}
-
 /* Trap dispatcher stub */
 int TrapDispatcher_SetTrapAddress(UInt16 trap_number, UInt16 trap_word, void *handler) {
     /* Stub: Trap patching not available in bare-metal */
@@ -0,0 +1,240 @@
+/*
+ * HFSImageTest.c - Hosted test for the paged HFS disk image
+ *
+ * The kernel's stdio is stubbed, so hfs_image.c only pages a real file when
+ * it is built for the host.  This builds it against libc (see the
+ * test-hfs-image target in the Makefile), runs it over a sparse image,
+ * checks reads, writes, eviction and read-only handling, and times the open
+ * and the first volume-header read against reading the whole image up
+ * front the way HFS_BD_InitFile used to.
+ *
+ * Usage: HFSImageTest [image-size-in-MB]     (default 1024)
+ */
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "FS/hfs_image.h"
+
+#define TEST_LOG(fmt, ...) printf("[HFSIMAGE] " fmt, ##__VA_ARGS__)
+
+static int g_failures;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { TEST_LOG("FAIL line %d: %s\n", __LINE__, #cond); g_failures++; } \
+} while (0)
+
+/* Memory Manager and logging for hfs_image.c.  It is compiled against the
+ * kernel headers, which clash with libc's, so these are declared by hand */
+void* NewPtr(uint32_t byteCount);
+void DisposePtr(void* p);
+void serial_logf(int module, int level, const char* fmt, ...);
+
+void* NewPtr(uint32_t byteCount) { return malloc(byteCount); }
+void DisposePtr(void* p) { free(p); }
+void serial_logf(int module, int level, const char* fmt, ...) {
+    va_list ap;
+    va_start(ap, fmt);
+    vfprintf(stderr, fmt, ap);
+    va_end(ap);
+}
+
+static double now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6;
+}
+
+/* Byte the fixture expects at `offset` */
+static uint8_t pattern(uint64_t offset) {
+    return (uint8_t)((offset * 2654435761u) >> 24);
+}
+
+static void fill_pattern(uint8_t* buf, uint64_t offset, uint32_t len) {
+    for (uint32_t i = 0; i < len; i++) buf[i] = pattern(offset + i);
+}
+
+static int check_pattern(const uint8_t* buf, uint64_t offset, uint32_t len) {
+    for (uint32_t i = 0; i < len; i++) {
+        if (buf[i] != pattern(offset + i)) return 0;
+    }
+    return 1;
+}
+
+/* Spots the fixture seeds: volume header, chunk straddles, the tail */
+static uint64_t g_marks[6];
+
+static int make_image(const char* path, uint64_t size) {
+    int fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0600);
+    if (fd < 0 || ftruncate(fd, (off_t)size) != 0) return -1;
+
+    g_marks[0] = 1024;                                  /* MDB sector */
+    g_marks[1] = HFS_IMAGE_CHUNK_SIZE - 256;
+    g_marks[2] = size / 3;
+    g_marks[3] = size / 2 - 100;
+    g_marks[4] = size - 2 * HFS_IMAGE_CHUNK_SIZE - 300;
+    g_marks[5] = size - 4096;
+
+    uint8_t buf[4096];
+    for (int i = 0; i < 6; i++) {
+        fill_pattern(buf, g_marks[i], sizeof(buf));
+        if (pwrite(fd, buf, sizeof(buf), (off_t)g_marks[i]) != (ssize_t)sizeof(buf)) {
+            close(fd);
+            return -1;
+        }
+    }
+    close(fd);
+    return 0;
+}
+
+static void test_reads(HFS_Image* img, uint64_t size) {
+    uint8_t buf[4096];
+    for (int i = 0; i < 6; i++) {
+        memset(buf, 0, sizeof(buf));
+        CHECK(HFS_Image_Read(img, g_marks[i], buf, sizeof(buf)));
+        CHECK(check_pattern(buf, g_marks[i], sizeof(buf)));
+    }
+
+    /* Unwritten space in a sparse file reads back as zeros */
+    CHECK(HFS_Image_Read(img, size / 4, buf, 512));
+    for (int i = 0; i < 512; i++) CHECK(buf[i] == 0);
+
+    CHECK(!HFS_Image_Read(img, size - 100, buf, 512));
+    CHECK(HFS_Image_Read(img, size - 512, buf, 512));
+}
+
+static void test_eviction(HFS_Image* img) {
+    HFS_ImageStats before, after;
+    uint8_t sector[512];
+
+    HFS_Image_GetStats(img, &before);
+    for (uint32_t i = 0; i < 2 * HFS_IMAGE_CHUNKS; i++) {
+        CHECK(HFS_Image_Read(img, (uint64_t)(100 + i) * HFS_IMAGE_CHUNK_SIZE, sector, sizeof(sector)));
+    }
+    HFS_Image_GetStats(img, &after);
+    CHECK(after.resident == HFS_IMAGE_CHUNKS);
+    CHECK(after.faults - before.faults == 2 * HFS_IMAGE_CHUNKS);
+
+    /* Rereading the newest chunk is a hit */
+    CHECK(HFS_Image_Read(img, (uint64_t)(100 + 2 * HFS_IMAGE_CHUNKS - 1) * HFS_IMAGE_CHUNK_SIZE,
+                         sector, sizeof(sector)));
+    HFS_Image_GetStats(img, &before);
+    CHECK(before.hits == after.hits + 1);
+}
+
+static void test_writes(HFS_Image* img, const char* path, uint64_t size) {
+    /* Straddles a chunk boundary in the middle of the image */
+    uint64_t offset = size / 2 + HFS_IMAGE_CHUNK_SIZE * 3 - 1000;
+    uint8_t buf[3000];
+    fill_pattern(buf, offset ^ 0x5A5A, sizeof(buf));
+
+    CHECK(HFS_Image_Write(img, offset, buf, sizeof(buf)));
+
+    /* Push it out by eviction, then again by flush after a second write */
+    uint8_t sector[512];
+    for (uint32_t i = 0; i < HFS_IMAGE_CHUNKS + 1; i++) {
+        CHECK(HFS_Image_Read(img, (uint64_t)(300 + i) * HFS_IMAGE_CHUNK_SIZE, sector, sizeof(sector)));
+    }
+    HFS_ImageStats stats;
+    HFS_Image_GetStats(img, &stats);
+    CHECK(stats.writebacks >= 2);
+
+    CHECK(HFS_Image_Write(img, g_marks[0], "\x42\x44", 2));
+    CHECK(HFS_Image_Flush(img));
+
+    int fd = open(path, O_RDONLY);
+    uint8_t check[3000];
+    CHECK(fd >= 0 && pread(fd, check, sizeof(check), (off_t)offset) == (ssize_t)sizeof(check));
+    CHECK(memcmp(check, buf, sizeof(buf)) == 0);
+    CHECK(pread(fd, check, 2, (off_t)g_marks[0]) == 2 && check[0] == 0x42 && check[1] == 0x44);
+    close(fd);
+
+    CHECK(!HFS_Image_Write(img, size - 1, buf, 2));
+}
+
+static void test_readonly(const char* path) {
+    HFS_Image* img = HFS_Image_Open(path, true);
+    CHECK(img != NULL);
+    if (!img) return;
+    uint8_t sector[512] = { 0 };
+    CHECK(!HFS_Image_Write(img, 0, sector, sizeof(sector)));
+    CHECK(HFS_Image_Read(img, 0, sector, sizeof(sector)));
+    HFS_Image_Close(img);
+}
+
+/* What HFS_BD_InitFile did before paging: read every byte up front */
+static double time_eager_load(const char* path, uint64_t size) {
+    double t0 = now_ms();
+    FILE* f = fopen(path, "rb");
+    uint8_t* all = f ? malloc(size) : NULL;
+    size_t got = all ? fread(all, 1, size, f) : 0;
+    double t1 = now_ms();
+    if (f) fclose(f);
+    free(all);
+    return (got == size) ? t1 - t0 : -1.0;
+}
+
+int main(int argc, char** argv) {
+    uint64_t sizeMB = (argc > 1) ? strtoull(argv[1], NULL, 10) : 1024;
+    uint64_t size = sizeMB * 1024 * 1024;
+    char path[] = "/tmp/HFSImageTestXXXXXX";
+    int fd = mkstemp(path);
+    if (fd < 0) {
+        perror("mkstemp");
+        return 1;
+    }
+    close(fd);
+
+    if (make_image(path, size) != 0) {
+        perror("make_image");
+        unlink(path);
+        return 1;
+    }
+
+    double t0 = now_ms();
+    HFS_Image* img = HFS_Image_Open(path, false);
+    double t1 = now_ms();
+    uint8_t mdb[512];
+    int mdbOK = img && HFS_Image_Read(img, 1024, mdb, sizeof(mdb));
+    double t2 = now_ms();
+    CHECK(img != NULL);
+    CHECK(mdbOK);
+    if (!img) {
+        unlink(path);
+        return 1;
+    }
+    CHECK(HFS_Image_Size(img) == size);
+
+    TEST_LOG("image %llu MB, %u KB chunks, %u resident\n",
+             (unsigned long long)sizeMB, HFS_IMAGE_CHUNK_SIZE / 1024, HFS_IMAGE_CHUNKS);
+    TEST_LOG("open %.3f ms, first MDB read %.3f ms\n", t1 - t0, t2 - t1);
+
+    test_reads(img, size);
+    test_eviction(img);
+    test_writes(img, path, size);
+
+    HFS_ImageStats stats;
+    HFS_Image_GetStats(img, &stats);
+    TEST_LOG("faults %u hits %u writebacks %u resident %u\n",
+             stats.faults, stats.hits, stats.writebacks, stats.resident);
+    HFS_Image_Close(img);
+
+    test_readonly(path);
+
+    double eager = time_eager_load(path, size);
+    if (eager >= 0) {
+        TEST_LOG("eager whole-image load %.1f ms (%llu MB resident)\n",
+                 eager, (unsigned long long)sizeMB);
+    } else {
+        TEST_LOG("eager whole-image load failed (not enough memory)\n");
+    }
+
+    unlink(path);
+    TEST_LOG("%s (%d failures)\n", g_failures ? "FAILED" : "passed", g_failures);
+    return g_failures ? 1 : 0;
+}